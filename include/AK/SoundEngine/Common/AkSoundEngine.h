@@ -210,6 +210,7 @@ struct AkInitSettings
 
     AkUInt32            uMaxNumPaths;				///< Maximum number of paths for positioning
 	AkUInt32            uCommandQueueSize;			///< Size of the command queue, in bytes
+	AkUInt32            uMaxCommandQueueSize;		///< Size up to which the command queue may grow when it is full, in bytes. Producer threads only wait for the audio thread to free space once this size is reached. Set to uCommandQueueSize or less to disable growing.
 	bool				bEnableGameSyncPreparation;	///< Sets to true to enable AK::SoundEngine::PrepareGameSync usage.
 	AkUInt32			uContinuousPlaybackLookAhead;	///< Number of quanta ahead when continuous containers should instantiate a new voice before which next sounds should start playing. This look-ahead time allows I/O to occur, and is especially useful to reduce the latency of continuous containers with trigger rate or sample-accurate transitions. 
 													///< Default is 1 audio quantum, also known as an audio frame. Its size is equal to AkInitSettings::uNumSamplesPerFrame / AkPlatformInitSettings::uSampleRate. For many platforms the default values - which can be overridden - are respectively 1,024 samples and 48 kHz. This gives a default 21.3 ms for an audio quantum, which is adequate if you have a RAM-based streaming device that completes transfers within 20 ms. With 1 look-ahead quantum, voices spawned by continuous containers are more likely to be ready when they are required to play, thereby improving the overall precision of sound scheduling. If your device completes transfers in 30 ms instead, you might consider increasing this value to 2 because it will grant new voices 2 audio quanta (~43 ms) to fetch data. 
@@ -230,6 +231,11 @@ struct AkInitSettings
 
 	AkFloorPlane		eFloorPlane;				///< Floor plane axis for 3D game object viewing.
     AkTaskSchedulerDesc taskSchedulerDesc;			///< The defined client task scheduler that AkSoundEngine will use to schedule internal tasks.	
+	AkUInt32			uPanGainCacheSize;			///< Maximum number of cells of the 3D panning gain cache, per output device and channel configuration. When non-zero, the speaker gains of 3D-positioned mono sources are memoized on a grid of directions (5 degrees), spreads, focuses and center percentages (10%), and interpolated between cells instead of being computed from scratch every frame. When the cache is full, cells not used recently are evicted. Emitter orientation is not taken into account. Default is 0 (disabled).
+	AkUInt32			uVirtualVoiceRefreshInterval;	///< Number of audio frames between two full evaluations of a voice that became virtual because it fell below the volume threshold. In between, the voice is evaluated again only if its parameters change (RTPC, states, fades, live edits) or if its distance to its closest listener changes by more than fVirtualVoiceRefreshDistance. Voices with modulators or 3D automation, and voices forced virtual by limiting, are not affected. Changes of bus volumes, HDR windows and ducking may be noticed up to this many frames late. Default is 0 (every frame).
+	AkReal32			fVirtualVoiceRefreshDistance;	///< Change of the distance between a virtual voice's emitter and its closest listener, in game units, after which the voice is evaluated again without waiting for uVirtualVoiceRefreshInterval. Default is 0 (any movement).
+	bool				bFloat16VoiceBuffers;		///< When true, and a task scheduler is used, the output of each voice mixed into a single bus is stored in half-precision (16-bit float) from the end of the voice's processing until it is mixed, and its single-precision pipeline buffers are released immediately for the next voices. This halves the memory and bandwidth of pending voice outputs at the cost of 11 bits of precision (about -66 dB relative to each sample). Default is false.
+	AkUInt32			uDecodedMediaCacheSize;		///< Memory budget of the decoded media cache, in bytes. When non-zero, in-memory Vorbis and Opus media played without looping are kept in decoded (32-bit float) form after their second play, and later plays of the same media read the decoded samples instead of decoding them again. Only media whose decoded size is at most a quarter of the budget are cached. Least recently used media are evicted first, and media are removed when their bank is unloaded. Default is 0 (disabled).
 
 	AkUInt32			uBankReadBufferSize;		///< The number of bytes read by the BankReader when new data needs to be loaded from disk during serialization. Increasing this trades memory usage for larger, but fewer, file-read events during bank loading.
 
@@ -237,6 +243,46 @@ struct AkInitSettings
 	bool				bDebugOutOfRangeCheckEnabled;	///< Debug setting: Enable checks for out-of-range (and NAN) floats in the processing code.  Do not enable in any normal usage, this setting uses a lot of CPU.  Will print error messages in the log if invalid values are found at various point in the pipeline. Contact AK Support with the new error messages for more information.
 };
 
+/// Command queue statistics, accumulated since the sound engine was initialized
+/// \sa 
+/// - <tt>AK::SoundEngine::GetCommandQueueStats()</tt>
+struct AkCommandQueueStats
+{
+	AkUInt32	uQueueSize;			///< Current size of the command queue, in bytes
+	AkUInt32	uNumGrows;			///< Number of times the command queue was grown because it was full
+	AkUInt32	uNumStalls;			///< Number of times a producer thread had to wait for the audio thread to free space in the command queue
+	AkUInt32	uNumContentions;	///< Number of command reservations that had to be retried because another thread reserved space at the same time
+};
+
+/// Statistics of the 3D panning gain caches, accumulated since the sound engine was initialized
+/// \sa 
+/// - <tt>AkInitSettings::uPanGainCacheSize</tt>
+/// - <tt>AK::SoundEngine::GetPanGainCacheStats()</tt>
+struct AkPanGainCacheStats
+{
+	AkUInt32	uNumHits;			///< Number of 3D panning computations served entirely from cached cells
+	AkUInt32	uNumMisses;			///< Number of 3D panning computations for which at least one cell had to be computed
+	AkUInt32	uNumBypasses;		///< Number of 3D panning computations that could not use the cache (non-mono inputs, emitter on the listener, out of memory)
+	AkUInt32	uNumCellsComputed;	///< Number of cells computed
+	AkUInt32	uNumFlushes;		///< Number of times a cache was emptied, because the speaker angles or panning rule of its device changed
+	AkUInt32	uNumEvictions;		///< Number of cells removed from a full cache to make room for new ones
+};
+
+/// Statistics of the decoded media cache, accumulated since the sound engine was initialized
+/// \sa 
+/// - <tt>AkInitSettings::uDecodedMediaCacheSize</tt>
+/// - <tt>AK::SoundEngine::GetDecodedMediaCacheStats()</tt>
+struct AkDecodedMediaCacheStats
+{
+	AkUInt32	uNumHits;			///< Number of sources that played their media from the cache
+	AkUInt32	uNumMisses;			///< Number of sources with cacheable media that had to decode it
+	AkUInt32	uNumInsertions;		///< Number of decoded media added to the cache
+	AkUInt32	uNumEvictions;		///< Number of decoded media removed from the cache to make room for others
+	AkUInt32	uNumRejections;		///< Number of decoded media that could not be recorded or added, because the media in use by sources and the other recordings left no room for them
+	AkUInt32	uNumEntries;		///< Current number of decoded media in the cache
+	AkUInt32	uMemoryUsed;		///< Current size of the decoded media in the cache, in bytes, including those of unloaded banks that sources still play and those being recorded
+};
+
 /// Necessary settings for setting externally-loaded sources
 struct AkSourceSettings
 {
@@ -1540,7 +1586,8 @@ namespace AK
 		/// \warning The object's orientation vector (in_Position.Orientation) must be normalized.
 		/// \return 
 		/// - AK_Success when successful
-		/// - AK_InvalidParameter if parameters are not valid.
+		/// - AK_Fail if in_GameObjectID is reserved by the sound engine, such as AK_INVALID_GAME_OBJECT.
+		/// - AK_InvalidParameter if in_Position is not a valid transform.
 		/// \sa 
 		/// - \ref soundengine_3dpositions
         AK_EXTERNAPIFUNC( AKRESULT, SetPosition )( 
@@ -1548,6 +1595,27 @@ namespace AK
 			const AkSoundPosition & in_Position	///< Position to set; in_Position.Orientation must be normalized.
 		    );
 
+		/// Sets the position of many game objects at once.
+		/// This is equivalent to calling <tt>AK::SoundEngine::SetPosition()</tt> for each game object, but the positions are
+		/// sent to the audio thread in a few large messages instead of one message per game object, which is much cheaper
+		/// when updating thousands of game objects every frame.
+		/// \warning The orientation vectors of all positions must be normalized.
+		/// \return
+		/// - AK_Success when successful, including when in_uNumGameObjects is 0.
+		/// - AK_Fail if in_pGameObjectIDs or in_pPositions is NULL while in_uNumGameObjects is not 0. Nothing is updated.
+		/// - AK_Fail if a game object ID is reserved, as with <tt>AK::SoundEngine::SetPosition()</tt>.
+		/// - AK_InvalidParameter if a position is not a valid transform, as with <tt>AK::SoundEngine::SetPosition()</tt>.
+		/// - AK_InvalidParameter if the command could not be queued. Positions already queued are still applied.
+		/// When some entries are not valid, the other game objects are still updated and the first error found is returned.
+		/// \sa
+		/// - <tt>AK::SoundEngine::SetPosition()</tt>
+		/// - \ref soundengine_3dpositions
+        AK_EXTERNAPIFUNC( AKRESULT, SetPositions )(
+			AkUInt32 in_uNumGameObjects,				///< Number of game objects, and size of both arrays.
+			const AkGameObjectID * in_pGameObjectIDs,	///< Array of game object identifiers.
+			const AkSoundPosition * in_pPositions		///< Array of positions to set, in the same order as in_pGameObjectIDs.
+		    );
+
 		/// Sets multiple positions to a single game object.
 		/// Setting multiple positions on a single game object is a way to simulate multiple emission sources while using the resources of only one voice.
 		/// This can be used to simulate wall openings, area sounds, or multiple objects emitting the same sound in the same area.
@@ -3818,6 +3886,27 @@ namespace AK
 		/// the sound engine since initialization. 
 		/// \return Tick count.
 		AK_EXTERNAPIFUNC(AkUInt32, GetBufferTick)();
+
+		/// Obtains the command queue statistics, accumulated since initialization. 
+		/// Use them to tune AkInitSettings::uCommandQueueSize and AkInitSettings::uMaxCommandQueueSize.
+		/// \sa AkCommandQueueStats
+		AK_EXTERNAPIFUNC(void, GetCommandQueueStats)(
+			AkCommandQueueStats & out_stats		///< Returned statistics
+			);
+
+		/// Obtains the statistics of the 3D panning gain caches, accumulated since initialization.
+		/// Use them to tune AkInitSettings::uPanGainCacheSize.
+		/// \sa AkPanGainCacheStats
+		AK_EXTERNAPIFUNC(void, GetPanGainCacheStats)(
+			AkPanGainCacheStats & out_stats		///< Returned statistics
+			);
+
+		/// Obtains the statistics of the decoded media cache. The hit rate is uNumHits / (uNumHits + uNumMisses).
+		/// Use them to tune AkInitSettings::uDecodedMediaCacheSize.
+		/// \sa AkDecodedMediaCacheStats
+		AK_EXTERNAPIFUNC(void, GetDecodedMediaCacheStats)(
+			AkDecodedMediaCacheStats & out_stats	///< Returned statistics
+			);
 	}
 }
 
@@ -175,6 +175,9 @@ struct AkDeviceData
 	AkUInt32			uNumLowLevelRequestsPending;	///< Number of low-level transfers that are currently pending
 	AkUInt32			uCustomParam;		///< Custom number queried from low-level IO.
 	AkUInt32			uCachePinnedBytes;  ///< Number of bytes that can be pinned into cache.
+	AkUInt32			uNumSchedulerPasses;			///< Number of scheduler passes in the previous monitoring frame
+	AkUInt32			uNumSchedulerTasksEvaluated;	///< Number of tasks evaluated by the scheduler in the previous monitoring frame
+	AkUInt32			uMaxSchedulerTasksPerPass;		///< Largest number of tasks evaluated in a single scheduler pass in the previous monitoring frame
 };
 
 /// Stream general information.
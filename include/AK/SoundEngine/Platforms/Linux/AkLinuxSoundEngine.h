@@ -65,4 +65,6 @@ struct AkPlatformInitSettings
 														///< \ref AkAudioAPI
 	AkDataTypeID		sampleType;					///< Sample type. AK_FLOAT for 32 bit float, AK_INT for 16 bit signed integer, defaults to AK_FLOAT.
 													///< Supported by AkAPI_PulseAudio only.
+	bool				bPipelinedMixing;			///< When true, the effects and device output of the top-level busses of a frame are processed by the task scheduler while the voices of the next frame start, at the cost of one extra buffer of latency. 
+													///< Voices routed directly to a top-level bus wait for that output to complete. Requires AkInitSettings::taskSchedulerDesc. Defaults to false.
 };
@@ -77,6 +77,11 @@ static AkForceInline AKSIMD_V8F32 AKSIMD_COMPLEXMUL_AVX2(const AKSIMD_V8F32 cIn1
 
 #define AKSIMD_INSERT_V2I128( a, m128, idx) _mm256_inserti128_si256(a, m128, idx)
 
+#define AKSIMD_EXTRACT_V2I128( a, idx) _mm256_extracti128_si256(a, idx)
+
+/// For each 128b lane, copies the 32b integer at index idx to every position of the lane (see _mm_shuffle_epi32)
+#define AKSIMD_SPLAT_V8I32( a, idx ) _mm256_shuffle_epi32(a, AKSIMD_SHUFFLE(idx,idx,idx,idx))
+
 /// For each 128b lane, select one of the four input 128b lanes across a and b,
 /// based on the mask i. AKSIMD_SHUFFLE can still be directly used as a control
 #define AKSIMD_PERMUTE_2X128_V8I32( a, b, i ) _mm256_permute2x128_si256(a, b, i)
@@ -97,6 +102,13 @@ static AkForceInline AKSIMD_V8F32 AKSIMD_COMPLEXMUL_AVX2(const AKSIMD_V8F32 cIn1
 /// Converts the eight signed 16b integer values of a to signed 32-bit integer values
 #define AKSIMD_CONVERT_V8I16_TO_V8I32( __vec__ ) _mm256_cvtepi16_epi32( (__vec__) )
 
+/// Cast vector of type AKSIMD_V8I32 to AKSIMD_V8F32. This intrinsic is only
+/// used for compilation and does not generate any instructions, thus it has zero latency.
+#define AKSIMD_CAST_V8I32_TO_V8F32( __vec__ ) _mm256_castsi256_ps( (__vec__) )
+
+/// Extracts the 32-bit integer at index __idx__ of a
+#define AKSIMD_EXTRACT_V8I32( __vec__, __idx__ ) _mm256_extract_epi32( (__vec__), (__idx__) )
+
 //@}
 ////////////////////////////////////////////////////////////////////////
 
@@ -162,6 +174,16 @@ static AkForceInline AKSIMD_V8F32 AKSIMD_COMPLEXMUL_AVX2(const AKSIMD_V8F32 cIn1
 #define AKSIMD_SHIFTLEFT_V8I32( __vec__, __shiftBy__ ) \
 	_mm256_slli_epi32( (__vec__), (__shiftBy__) )
 
+/// Shifts each 128b lane of a left by in_shiftBy bytes
+/// while shifting in zeros (see _mm_slli_si128)
+#define AKSIMD_SHIFTLEFTBYTES_V8I32( __vec__, __shiftBy__ ) \
+	_mm256_slli_si256( (__vec__), (__shiftBy__) )
+
+/// Shifts the 8 signed or unsigned 32-bit integers in a right by
+/// in_shiftBy bits while shifting in zeros (see _mm_srli_epi32)
+#define AKSIMD_SHIFTRIGHT_V8I32( __vec__, __shiftBy__ ) \
+	_mm256_srli_epi32( (__vec__), (__shiftBy__) )
+
 /// Shifts the 8 signed 32-bit integers in a right by in_shiftBy
 /// bits while shifting in the sign bit (see _mm_srai_epi32)
 #define AKSIMD_SHIFTRIGHTARITH_V8I32( __vec__, __shiftBy__ ) \
@@ -0,0 +1,148 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkADPCMBenchmark.cpp
+//
+// Compares CAkADPCMCodec::DecodeAllChannels and PtADPCM::DecodeAllChannels,
+// which decode several channel blocks at a time in SIMD lanes, with the
+// scalar decoders called for each channel (as CAkSrcFileADPCM did):
+// output must be bit-identical, for 1 to 8 channels and any number of
+// blocks. Then times both on the same random blocks.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "AkADPCMCodec.h"
+#include "PtADPCM_Decode.h"
+
+namespace
+{
+	const AkUInt32 kMaxChannels = 8;
+	const AkUInt32 kMaxBlocks = 16;		// 1024 frames: a typical pipeline buffer.
+
+	AkUInt8 s_aSrc[ kMaxBlocks * kMaxChannels * ADPCM_BLOCK_SIZE ];
+	AkInt16 s_aRef[ kMaxBlocks * kMaxChannels * ADPCM_SAMPLES_PER_BLOCK ];
+	AkInt16 s_aLanes[ kMaxBlocks * kMaxChannels * ADPCM_SAMPLES_PER_BLOCK ];
+
+	enum Codec
+	{
+		Codec_IMA,
+		Codec_Pt
+	};
+
+	// Random codes, with headers the encoders could produce: a step index within the step table
+	// for IMA ADPCM, a difference level within the difference table for PtADPCM.
+	void RandomBlocks( Codec in_eCodec, AkUInt32 in_uNumChannelBlocks, AkBenchRandom & io_random )
+	{
+		for ( AkUInt32 i = 0; i < in_uNumChannelBlocks * ADPCM_BLOCK_SIZE; ++i )
+			s_aSrc[ i ] = (AkUInt8)io_random.Next();
+		for ( AkUInt32 u = 0; u < in_uNumChannelBlocks; ++u )
+		{
+			if ( in_eCodec == Codec_IMA )
+				s_aSrc[ u * ADPCM_BLOCK_SIZE + 2 ] %= 89;
+			else
+				s_aSrc[ u * ADPCM_BLOCK_SIZE + 4 ] %= 12;
+		}
+	}
+
+	void DecodeReference( Codec in_eCodec, AkUInt32 in_uNumBlocks, AkUInt32 in_uNumChannels )
+	{
+		for ( AkUInt32 c = 0; c < in_uNumChannels; ++c )
+		{
+			if ( in_eCodec == Codec_IMA )
+				CAkADPCMCodec::Decode( s_aSrc + c * ADPCM_BLOCK_SIZE, (unsigned char *)( s_aRef + c ), in_uNumBlocks, ADPCM_BLOCK_SIZE * in_uNumChannels, in_uNumChannels );
+			else
+				PtADPCM::DecodeBlocks( s_aRef + c, s_aSrc + c * ADPCM_BLOCK_SIZE, in_uNumBlocks * ADPCM_SAMPLES_PER_BLOCK, ADPCM_BLOCK_SIZE * in_uNumChannels, in_uNumChannels );
+		}
+	}
+
+	void DecodeLanes( Codec in_eCodec, AkUInt32 in_uNumBlocks, AkUInt32 in_uNumChannels )
+	{
+		if ( in_eCodec == Codec_IMA )
+			CAkADPCMCodec::DecodeAllChannels( s_aSrc, (unsigned char *)s_aLanes, in_uNumBlocks, in_uNumChannels );
+		else
+			PtADPCM::DecodeAllChannels( s_aLanes, s_aSrc, in_uNumBlocks, in_uNumChannels );
+	}
+
+	bool CheckCodec( Codec in_eCodec, const char * in_szName, AkUInt32 in_uNumPasses, AkBenchRandom & io_random )
+	{
+		for ( AkUInt32 uPass = 0; uPass < in_uNumPasses; ++uPass )
+		{
+			for ( AkUInt32 uNumChannels = 1; uNumChannels <= kMaxChannels; ++uNumChannels )
+			{
+				// Block counts that do and do not fill all lanes.
+				for ( AkUInt32 uNumBlocks = 1; uNumBlocks <= 5; ++uNumBlocks )
+				{
+					RandomBlocks( in_eCodec, uNumBlocks * uNumChannels, io_random );
+					memset( s_aRef, 0, sizeof( s_aRef ) );
+					memset( s_aLanes, 0, sizeof( s_aLanes ) );
+					DecodeReference( in_eCodec, uNumBlocks, uNumChannels );
+					DecodeLanes( in_eCodec, uNumBlocks, uNumChannels );
+					if ( memcmp( s_aRef, s_aLanes, sizeof( s_aRef ) ) != 0 )
+					{
+						printf( "FAILED: %s DecodeAllChannels differs (%u channels, %u blocks)\n", in_szName, uNumChannels, uNumBlocks );
+						return false;
+					}
+				}
+			}
+		}
+		return true;
+	}
+
+	void TimeCodec( Codec in_eCodec, const char * in_szName, AkUInt32 in_uNumChannels, AkUInt32 in_uNumCalls, AkBenchRandom & io_random )
+	{
+		RandomBlocks( in_eCodec, kMaxBlocks * in_uNumChannels, io_random );
+
+		AkBenchTimer timer;
+		timer.Start();
+		for ( AkUInt32 uCall = 0; uCall < in_uNumCalls; ++uCall )
+			DecodeReference( in_eCodec, kMaxBlocks, in_uNumChannels );
+		AkReal64 fRefMs = timer.Stop();
+
+		timer.Start();
+		for ( AkUInt32 uCall = 0; uCall < in_uNumCalls; ++uCall )
+			DecodeLanes( in_eCodec, kMaxBlocks, in_uNumChannels );
+		AkReal64 fLanesMs = timer.Stop();
+
+		const AkUInt64 uNumSamples = (AkUInt64)in_uNumCalls * kMaxBlocks * ADPCM_SAMPLES_PER_BLOCK * in_uNumChannels;
+		char szName[ 64 ];
+		snprintf( szName, sizeof( szName ), "%s per channel (%u ch)", in_szName, in_uNumChannels );
+		AkBenchReport( szName, fRefMs, uNumSamples, "sample" );
+		snprintf( szName, sizeof( szName ), "%s DecodeAllChannels (%u ch)", in_szName, in_uNumChannels );
+		AkBenchReport( szName, fLanesMs, uNumSamples, "sample" );
+		AkBenchReportSpeedup( "  speedup", fRefMs, fLanesMs );
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 uNumPasses = bCheckOnly ? 20 : 500;
+	const AkUInt32 uNumCalls = bCheckOnly ? 1000 : 50000;
+
+	AkBenchRandom random;
+	bool bOk = CheckCodec( Codec_IMA, "IMA ADPCM", uNumPasses, random );
+	bOk = CheckCodec( Codec_Pt, "PtADPCM", uNumPasses, random ) && bOk;
+
+	for ( AkUInt32 uNumChannels = 1; uNumChannels <= 2; ++uNumChannels )
+	{
+		TimeCodec( Codec_IMA, "IMA ADPCM", uNumChannels, uNumCalls, random );
+		TimeCodec( Codec_Pt, "PtADPCM", uNumChannels, uNumCalls, random );
+	}
+
+	printf( bOk ? "ADPCM output identical: OK\n" : "ADPCM output identical: FAILED\n" );
+	return bOk ? 0 : 1;
+}
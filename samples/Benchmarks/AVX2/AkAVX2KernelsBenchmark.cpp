@@ -0,0 +1,342 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkAVX2KernelsBenchmark.cpp
+//
+// Compares the AVX2 interpolating resamplers and mixer gain kernels
+// with the routines they replace when AkRuntimeEnvironmentMgr reports
+// AVX2: output and resampler state must be bit-identical. Then times
+// both on the same random input.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "AkResamplerCommon.h"
+#include "AkMixerCommon.h"
+#include "AkRuntimeEnvironmentMgr.h"
+#include <AK/SoundEngine/Common/AkSimd.h>
+#include <math.h>
+
+namespace
+{
+	const AkUInt16 kNumFrames = 1024;
+	const AkUInt32 kMaxChannels = 6;
+
+	typedef AKRESULT( *ResampleFunc )( AkAudioBuffer *, AkAudioBuffer *, AkUInt32, AkInternalPitchState * );
+	typedef void( *ApplyGainFunc )( AkAudioBuffer *, AkAudioBuffer *, AkRamp );
+	typedef void( *MixChannelFunc )( AkReal32 *, AkReal32 *, AkReal32, AkReal32, AkUInt32 );
+
+	struct ResamplerCase
+	{
+		const char *	szName;
+		ResampleFunc	pfnRef;
+		ResampleFunc	pfnAVX2;
+		AkUInt32		uNumChannels;
+		bool			bI16;
+	};
+
+	const ResamplerCase s_aResamplerCases[] = {
+		{ "Interpolating_I16_1Chan", Interpolating_I16_1Chan, Interpolating_I16_1ChanAVX2, 1, true },
+		{ "Interpolating_I16_2Chan", Interpolating_I16_2Chan, Interpolating_I16_2ChanAVX2, 2, true },
+		{ "Interpolating_Native_1Chan", Interpolating_Native_1Chan, Interpolating_Native_1ChanAVX2, 1, false },
+		{ "Interpolating_Native_2Chan", Interpolating_Native_2Chan, Interpolating_Native_2ChanAVX2, 2, false },
+	};
+
+	// Parameters of one resampling call.
+	struct PitchSetup
+	{
+		AkUInt32 uFloatIndex;
+		AkUInt32 uCurrentFrameSkip;
+		AkUInt32 uTargetFrameSkip;
+		AkUInt32 uRampInc;
+		AkUInt16 uInFrames;
+		AkUInt16 uOutFrameOffset;
+	};
+
+	AkUInt32 RandomFrameSkip( AkBenchRandom & io_random )
+	{
+		// -2 to +2 octaves.
+		AkReal32 fCents = io_random.NextSigned() * 2400.f;
+		return (AkUInt32)( FPMUL * powf( 2.f, fCents / 1200.f ) );
+	}
+
+	PitchSetup RandomPitchSetup( AkBenchRandom & io_random )
+	{
+		PitchSetup setup;
+		setup.uFloatIndex = io_random.Next() & FPMASK;
+		setup.uCurrentFrameSkip = RandomFrameSkip( io_random );
+		setup.uTargetFrameSkip = RandomFrameSkip( io_random );
+		setup.uRampInc = 1 + io_random.Next() % 8;
+		setup.uInFrames = (AkUInt16)( 16 + io_random.Next() % ( kNumFrames - 16 ) );
+		setup.uOutFrameOffset = (AkUInt16)( io_random.Next() % 64 );
+		return setup;
+	}
+
+	// Result of one resampling call: output frames and the pitch state which is carried to the next call.
+	struct ResampleResult
+	{
+		AkReal32 AK_ALIGN_SIMD( afOut[ 2 * kNumFrames ] );
+		AKRESULT eResult;
+		AkUInt32 uInValidFrames;
+		AkUInt32 uOutValidFrames;
+		AkInternalPitchState state;
+	};
+
+	void Resample( const ResamplerCase & in_case, ResampleFunc in_pfn, const PitchSetup & in_setup, const void * in_pInput, ResampleResult & out_result )
+	{
+		AkChannelConfig channelConfig;
+		channelConfig.SetStandard( in_case.uNumChannels == 1 ? AK_SPEAKER_SETUP_MONO : AK_SPEAKER_SETUP_STEREO );
+
+		AkAudioBuffer inBuffer;
+		inBuffer.AttachInterleavedData( (void*)in_pInput, kNumFrames, in_setup.uInFrames, channelConfig );
+		AkAudioBuffer outBuffer;
+		memset( out_result.afOut, 0, sizeof( out_result.afOut ) );
+		outBuffer.AttachContiguousDeinterleavedData( out_result.afOut, kNumFrames, in_setup.uOutFrameOffset, channelConfig );
+
+		AkInternalPitchState & state = out_result.state;
+		memset( &state, 0, sizeof( state ) );
+		if ( in_case.bI16 )
+		{
+			state.iLastValue = state.iLastValueStatic;
+			state.iLastValue[ 0 ] = 1234;
+			state.iLastValue[ 1 ] = -4321;
+		}
+		else
+		{
+			state.fLastValue = state.fLastValueStatic;
+			state.fLastValue[ 0 ] = 0.25f;
+			state.fLastValue[ 1 ] = -0.5f;
+		}
+		state.uOutFrameOffset = in_setup.uOutFrameOffset;
+		state.uFloatIndex = in_setup.uFloatIndex;
+		state.uCurrentFrameSkip = in_setup.uCurrentFrameSkip;
+		state.uTargetFrameSkip = in_setup.uTargetFrameSkip;
+		state.uInterpolationRampInc = in_setup.uRampInc;
+		state.uRequestedFrames = kNumFrames;
+
+		out_result.eResult = in_pfn( &inBuffer, &outBuffer, kNumFrames, &state );
+		out_result.uInValidFrames = inBuffer.uValidFrames;
+		out_result.uOutValidFrames = outBuffer.uValidFrames;
+	}
+
+	bool SameResult( const ResamplerCase & in_case, const ResampleResult & in_a, const ResampleResult & in_b )
+	{
+		return in_a.eResult == in_b.eResult
+			&& in_a.uInValidFrames == in_b.uInValidFrames
+			&& in_a.uOutValidFrames == in_b.uOutValidFrames
+			&& in_a.state.uInFrameOffset == in_b.state.uInFrameOffset
+			&& in_a.state.uOutFrameOffset == in_b.state.uOutFrameOffset
+			&& in_a.state.uFloatIndex == in_b.state.uFloatIndex
+			&& in_a.state.uInterpolationRampCount == in_b.state.uInterpolationRampCount
+			&& memcmp( in_a.state.fLastValueStatic, in_b.state.fLastValueStatic, sizeof( in_a.state.fLastValueStatic ) ) == 0
+			&& memcmp( in_a.afOut, in_b.afOut, in_case.uNumChannels * kNumFrames * sizeof( AkReal32 ) ) == 0;
+	}
+
+	bool BenchResampler( const ResamplerCase & in_case, AkUInt32 in_uNumCalls, AkBenchRandom & io_random )
+	{
+		static AkReal32 AK_ALIGN_SIMD( s_afInput[ 2 * kNumFrames ] );
+		static AkInt16 AK_ALIGN_SIMD( s_aiInput[ 2 * kNumFrames ] );
+		for ( AkUInt32 i = 0; i < 2 * kNumFrames; ++i )
+		{
+			s_afInput[ i ] = io_random.NextSigned();
+			s_aiInput[ i ] = (AkInt16)( io_random.Next() >> 16 );
+		}
+		const void * pInput = in_case.bI16 ? (const void*)s_aiInput : (const void*)s_afInput;
+
+		static ResampleResult s_ref, s_avx2;
+		for ( AkUInt32 uCall = 0; uCall < in_uNumCalls; ++uCall )
+		{
+			PitchSetup setup = RandomPitchSetup( io_random );
+			Resample( in_case, in_case.pfnRef, setup, pInput, s_ref );
+			Resample( in_case, in_case.pfnAVX2, setup, pInput, s_avx2 );
+			if ( !SameResult( in_case, s_ref, s_avx2 ) )
+			{
+				printf( "FAILED: %s differs (index %u, skip %u -> %u, ramp inc %u, %u input frames)\n", in_case.szName,
+					setup.uFloatIndex, setup.uCurrentFrameSkip, setup.uTargetFrameSkip, setup.uRampInc, setup.uInFrames );
+				return false;
+			}
+		}
+
+		// Timing: the same pitch transitions for both, one full output buffer per call.
+		const AkUInt32 kNumSetups = 64;
+		PitchSetup aSetups[ kNumSetups ];
+		for ( AkUInt32 i = 0; i < kNumSetups; ++i )
+		{
+			aSetups[ i ] = RandomPitchSetup( io_random );
+			aSetups[ i ].uInFrames = kNumFrames;
+			aSetups[ i ].uOutFrameOffset = 0;
+		}
+
+		AkReal64 afMs[ 2 ];
+		AkUInt64 uFrames[ 2 ] = { 0, 0 };
+		ResampleFunc apfn[ 2 ] = { in_case.pfnRef, in_case.pfnAVX2 };
+		for ( AkUInt32 uVariant = 0; uVariant < 2; ++uVariant )
+		{
+			AkBenchTimer timer;
+			timer.Start();
+			for ( AkUInt32 uCall = 0; uCall < in_uNumCalls; ++uCall )
+			{
+				Resample( in_case, apfn[ uVariant ], aSetups[ uCall % kNumSetups ], pInput, s_ref );
+				uFrames[ uVariant ] += s_ref.uOutValidFrames;
+			}
+			afMs[ uVariant ] = timer.Stop();
+		}
+
+		char szName[ 64 ];
+		snprintf( szName, sizeof( szName ), "%s", in_case.szName );
+		AkBenchReport( szName, afMs[ 0 ], uFrames[ 0 ], "frame" );
+		snprintf( szName, sizeof( szName ), "%sAVX2", in_case.szName );
+		AkBenchReport( szName, afMs[ 1 ], uFrames[ 1 ], "frame" );
+		AkBenchReportSpeedup( "  speedup", afMs[ 0 ], afMs[ 1 ] );
+		return true;
+	}
+
+	struct GainCase
+	{
+		const char *	szName;
+		ApplyGainFunc	pfnRef;
+		ApplyGainFunc	pfnAVX2;
+		AkUInt32		uNumChannels;
+		bool			bInt16Out;
+	};
+
+	const GainCase s_aGainCases[] = {
+		{ "ApplyGainMono", ApplyGainMono_V4F32, ApplyGainMono_AVX2, 1, false },
+		{ "ApplyGainN", ApplyGainN_V4F32, ApplyGainN_AVX2, kMaxChannels, false },
+		{ "ApplyGainNInt16", ApplyGainNInt16_V4F32, ApplyGainNInt16_AVX2, kMaxChannels, true },
+	};
+
+	bool BenchGain( const GainCase & in_case, AkUInt32 in_uNumCalls, AkBenchRandom & io_random )
+	{
+		static AkReal32 AK_ALIGN_SIMD( s_afInput[ kMaxChannels * kNumFrames ] );
+		static AkReal32 AK_ALIGN_SIMD( s_afOutRef[ kMaxChannels * kNumFrames ] );
+		static AkReal32 AK_ALIGN_SIMD( s_afOutAVX2[ kMaxChannels * kNumFrames ] );
+		for ( AkUInt32 i = 0; i < kMaxChannels * kNumFrames; ++i )
+			s_afInput[ i ] = io_random.NextSigned();
+
+		AkChannelConfig channelConfig;
+		if ( in_case.uNumChannels == 1 )
+			channelConfig.SetStandard( AK_SPEAKER_SETUP_MONO );
+		else
+			channelConfig.SetAnonymous( in_case.uNumChannels );
+
+		AkAudioBuffer inBuffer, outRef, outAVX2;
+		inBuffer.AttachContiguousDeinterleavedData( s_afInput, kNumFrames, kNumFrames, channelConfig );
+		outRef.AttachContiguousDeinterleavedData( s_afOutRef, kNumFrames, kNumFrames, channelConfig );
+		outAVX2.AttachContiguousDeinterleavedData( s_afOutAVX2, kNumFrames, kNumFrames, channelConfig );
+		const size_t uOutSize = in_case.uNumChannels * kNumFrames * ( in_case.bInt16Out ? sizeof( AkInt16 ) : sizeof( AkReal32 ) );
+
+		// Constant and ramping gains.
+		for ( AkUInt32 uCall = 0; uCall < in_uNumCalls; ++uCall )
+		{
+			AkReal32 fPrev = io_random.NextSigned() + 1.f;
+			AkRamp gain( fPrev, ( uCall & 1 ) ? fPrev : io_random.NextSigned() + 1.f );
+			in_case.pfnRef( &inBuffer, &outRef, gain );
+			in_case.pfnAVX2( &inBuffer, &outAVX2, gain );
+			if ( memcmp( s_afOutRef, s_afOutAVX2, uOutSize ) != 0 )
+			{
+				printf( "FAILED: %s differs (gain %f -> %f)\n", in_case.szName, gain.fPrev, gain.fNext );
+				return false;
+			}
+		}
+
+		AkReal64 afMs[ 2 ];
+		ApplyGainFunc apfn[ 2 ] = { in_case.pfnRef, in_case.pfnAVX2 };
+		for ( AkUInt32 uVariant = 0; uVariant < 2; ++uVariant )
+		{
+			AkBenchTimer timer;
+			timer.Start();
+			for ( AkUInt32 uCall = 0; uCall < in_uNumCalls; ++uCall )
+				apfn[ uVariant ]( &inBuffer, &outRef, AkRamp( 0.5f, ( uCall & 1 ) ? 0.5f : 0.75f ) );
+			afMs[ uVariant ] = timer.Stop();
+		}
+
+		const AkUInt64 uNumSamples = (AkUInt64)in_uNumCalls * in_case.uNumChannels * kNumFrames;
+		char szName[ 64 ];
+		snprintf( szName, sizeof( szName ), "%s_V4F32", in_case.szName );
+		AkBenchReport( szName, afMs[ 0 ], uNumSamples, "sample" );
+		snprintf( szName, sizeof( szName ), "%s_AVX2", in_case.szName );
+		AkBenchReport( szName, afMs[ 1 ], uNumSamples, "sample" );
+		AkBenchReportSpeedup( "  speedup", afMs[ 0 ], afMs[ 1 ] );
+		return true;
+	}
+
+	bool BenchMixChannel( AkUInt32 in_uNumCalls, AkBenchRandom & io_random )
+	{
+		static AkReal32 AK_ALIGN_SIMD( s_afInput[ kNumFrames ] );
+		static AkReal32 AK_ALIGN_SIMD( s_afOutRef[ kNumFrames ] );
+		static AkReal32 AK_ALIGN_SIMD( s_afOutAVX2[ kNumFrames ] );
+		for ( AkUInt32 i = 0; i < kNumFrames; ++i )
+			s_afInput[ i ] = io_random.NextSigned();
+
+		// Mixing accumulates in the destination: both start from the same content.
+		for ( AkUInt32 uCall = 0; uCall < in_uNumCalls; ++uCall )
+		{
+			for ( AkUInt32 i = 0; i < kNumFrames; ++i )
+				s_afOutRef[ i ] = s_afOutAVX2[ i ] = io_random.NextSigned();
+			AkReal32 fVolume = io_random.NextSigned() + 1.f;
+			AkReal32 fVolumeDelta = ( uCall & 1 ) ? 0.f : io_random.NextSigned() / kNumFrames;
+			MixChannel_V4F32( s_afInput, s_afOutRef, fVolume, fVolumeDelta, kNumFrames );
+			MixChannel_AVX2( s_afInput, s_afOutAVX2, fVolume, fVolumeDelta, kNumFrames );
+			if ( memcmp( s_afOutRef, s_afOutAVX2, sizeof( s_afOutRef ) ) != 0 )
+			{
+				printf( "FAILED: MixChannel differs (volume %f, delta %g)\n", fVolume, fVolumeDelta );
+				return false;
+			}
+		}
+
+		AkReal64 afMs[ 2 ];
+		MixChannelFunc apfn[ 2 ] = { MixChannel_V4F32, MixChannel_AVX2 };
+		for ( AkUInt32 uVariant = 0; uVariant < 2; ++uVariant )
+		{
+			memset( s_afOutRef, 0, sizeof( s_afOutRef ) );
+			AkBenchTimer timer;
+			timer.Start();
+			for ( AkUInt32 uCall = 0; uCall < in_uNumCalls; ++uCall )
+				apfn[ uVariant ]( s_afInput, s_afOutRef, 0.5f, ( uCall & 1 ) ? 0.f : 0.0001f, kNumFrames );
+			afMs[ uVariant ] = timer.Stop();
+		}
+
+		const AkUInt64 uNumSamples = (AkUInt64)in_uNumCalls * kNumFrames;
+		AkBenchReport( "MixChannel_V4F32", afMs[ 0 ], uNumSamples, "sample" );
+		AkBenchReport( "MixChannel_AVX2", afMs[ 1 ], uNumSamples, "sample" );
+		AkBenchReportSpeedup( "  speedup", afMs[ 0 ], afMs[ 1 ] );
+		return true;
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	if ( !AK::AkRuntimeEnvironmentMgr::Instance()->GetSIMDSupport( AK::AK_SIMD_AVX2 ) )
+	{
+		printf( "AVX2 is not supported by this processor: nothing to compare.\n" );
+		return 0;
+	}
+
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 uNumCalls = bCheckOnly ? 2000 : 100000;
+
+	AkBenchRandom random;
+	bool bOk = true;
+	for ( AkUInt32 i = 0; i < sizeof( s_aResamplerCases ) / sizeof( s_aResamplerCases[ 0 ] ); ++i )
+		bOk = BenchResampler( s_aResamplerCases[ i ], uNumCalls, random ) && bOk;
+	for ( AkUInt32 i = 0; i < sizeof( s_aGainCases ) / sizeof( s_aGainCases[ 0 ] ); ++i )
+		bOk = BenchGain( s_aGainCases[ i ], uNumCalls, random ) && bOk;
+	bOk = BenchMixChannel( uNumCalls, random ) && bOk;
+
+	printf( bOk ? "AVX2 output identical: OK\n" : "AVX2 output identical: FAILED\n" );
+	return bOk ? 0 : 1;
+}
@@ -0,0 +1,169 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkAncestorParamsBenchmark.cpp
+//
+// Measures the parameter refresh of many voices sharing the same
+// ancestors. Footsteps on gravel play on N game objects, one every few
+// frames on each of them. The Footstep_Weight game parameter drives the
+// volume of the Footsteps switch container, so the ancestors of the
+// footsteps have one set of parameters per game object (see
+// AkAncestorParamsCache). Before each frame, the switch container
+// notifies its voices that its volume changed, as it does when an RTPC
+// subscription or a state transition changes its parameters: every voice
+// is refreshed in every frame. The time per game object should not grow
+// with N. The check is that every footstep starts.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "AkBenchEngine.h"
+#include "Wwise_IDs.h"
+
+#include "AkPrivateTypes.h"
+#include "AkAudioLibIndex.h"
+#include "AkParameterNodeBase.h"
+#include "AkCritical.h"
+
+namespace
+{
+	const AkGameObjectID kListenerID = 1;
+	const AkGameObjectID kFirstGameObjectID = 100;
+
+	// Footsteps switch container of the IntegrationDemo project (Wwise_IDs.h only lists the IDs of game syncs and events).
+	const AkUniqueID kFootstepsID = 400530090;
+
+	// A footstep lasts about 10 frames: each game object plays one every kStepPeriod frames.
+	const AkUInt32 kStepPeriod = 4;
+
+	// Each game object has its own Footstep_Weight.
+	bool RegisterWalkers( AkUInt32 in_uNumGameObjects )
+	{
+		for ( AkUInt32 i = 0; i < in_uNumGameObjects; ++i )
+		{
+			AkGameObjectID gameObjectID = kFirstGameObjectID + i;
+			if ( AK::SoundEngine::RegisterGameObj( gameObjectID ) != AK_Success
+				|| AK::SoundEngine::SetSwitch( AK::SWITCHES::SURFACE::GROUP, AK::SWITCHES::SURFACE::SWITCH::GRAVEL, gameObjectID ) != AK_Success
+				|| AK::SoundEngine::SetRTPCValue( AK::GAME_PARAMETERS::FOOTSTEP_WEIGHT, (AkRtpcValue)( i % 101 ), gameObjectID ) != AK_Success )
+			{
+				printf( "Could not register game object %u\n", i );
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void UnregisterWalkers( AkUInt32 in_uNumGameObjects )
+	{
+		AK::SoundEngine::StopAll();
+		AkBenchEngineRenderFrame();
+		for ( AkUInt32 i = 0; i < in_uNumGameObjects; ++i )
+			AK::SoundEngine::UnregisterGameObj( kFirstGameObjectID + i );
+		AkBenchEngineRenderFrame();
+	}
+
+	// Renders in_uNumFrames frames, starting footsteps and notifying the voices of the Footsteps container before each of them.
+	// Returns the time in ms, or a negative value if a footstep does not start.
+	AkReal64 RenderFrames( CAkParameterNodeBase * in_pFootsteps, AkUInt32 in_uNumGameObjects, AkUInt32 in_uNumFrames )
+	{
+		AkReal64 fMs = 0.0;
+		for ( AkUInt32 uFrame = 0; uFrame < in_uNumFrames; ++uFrame )
+		{
+			{
+				CAkFunctionCritical globalLock;
+				in_pFootsteps->NotifyParamChanged( false, RTPC_Volume );
+			}
+
+			for ( AkUInt32 i = 0; i < in_uNumGameObjects; ++i )
+			{
+				AkGameObjectID gameObjectID = kFirstGameObjectID + i;
+				if ( ( uFrame + i ) % kStepPeriod == 0
+					&& AK::SoundEngine::PostEvent( AK::EVENTS::PLAY_FOOTSTEPS, gameObjectID ) == AK_INVALID_PLAYING_ID )
+				{
+					printf( "Could not play a footstep on game object %u\n", i );
+					return -1.0;
+				}
+			}
+
+			AkBenchTimer timer;
+			timer.Start();
+			AkBenchEngineRenderFrame();
+			fMs += timer.Stop();
+		}
+		return fMs;
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 aNumGameObjects[] = { 16, 64, 256, 1024 };
+	const AkUInt32 uNumSizes = bCheckOnly ? 2 : sizeof( aNumGameObjects ) / sizeof( aNumGameObjects[ 0 ] );
+	const AkUInt32 uNumWarmUpFrames = 16;
+
+	AkInitSettings initSettings;
+	AkPlatformInitSettings platformSettings;
+	AkBenchEngineGetDefaultSettings( initSettings, platformSettings );
+	bool bOk = AkBenchEngineInit( initSettings, platformSettings );
+
+	AkBankID bankID;
+	if ( bOk && AK::SoundEngine::LoadBank( "Gravel.bnk", bankID ) != AK_Success )
+	{
+		printf( "Gravel.bnk: LoadBank() failed\n" );
+		bOk = false;
+	}
+
+	// Without a listener, the footsteps are inaudible and killed.
+	if ( bOk && ( AK::SoundEngine::RegisterGameObj( kListenerID ) != AK_Success
+		|| AK::SoundEngine::SetDefaultListeners( &kListenerID, 1 ) != AK_Success ) )
+	{
+		printf( "Could not register the listener\n" );
+		bOk = false;
+	}
+
+	CAkParameterNodeBase * pFootsteps = bOk ? g_pIndex->GetNodePtrAndAddRef( kFootstepsID, AkNodeType_Default ) : NULL;
+	if ( bOk && !pFootsteps )
+	{
+		printf( "Could not find the Footsteps container\n" );
+		bOk = false;
+	}
+
+	for ( AkUInt32 uSize = 0; bOk && uSize < uNumSizes; ++uSize )
+	{
+		AkUInt32 uNumGameObjects = aNumGameObjects[ uSize ];
+		bOk = RegisterWalkers( uNumGameObjects )
+			&& RenderFrames( pFootsteps, uNumGameObjects, uNumWarmUpFrames ) >= 0.0;
+		if ( bOk )
+		{
+			// Same number of game object frames for every size.
+			AkUInt32 uNumFrames = AkMax( ( bCheckOnly ? 1024u : 65536u ) / uNumGameObjects, uNumWarmUpFrames );
+			AkReal64 fMs = RenderFrames( pFootsteps, uNumGameObjects, uNumFrames );
+			bOk = fMs >= 0.0;
+
+			char szName[ 64 ];
+			snprintf( szName, sizeof( szName ), "RenderAudio, %u game objects", uNumGameObjects );
+			AkBenchReport( szName, fMs, (AkUInt64)uNumFrames * uNumGameObjects, "object" );
+		}
+		UnregisterWalkers( uNumGameObjects );
+	}
+
+	if ( pFootsteps )
+		pFootsteps->Release();
+	AkBenchEngineTerm();
+
+	printf( bOk ? "Ancestor params: OK\n" : "Ancestor params: FAILED\n" );
+	return bOk ? 0 : 1;
+}
@@ -0,0 +1,210 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkBankLoadBenchmark.cpp
+//
+// Measures how long bank loading keeps the audio thread waiting. A
+// real-time thread renders a frame (RenderAudio() without an audio
+// thread) every 100 microseconds while the banks of the IntegrationDemo
+// project are loaded and unloaded. The bank thread takes the main lock
+// while it builds each hierarchy item, and the frame takes it for its
+// whole pass. The render thread preempts the bank thread when it wakes
+// up, so a long frame is the bank thread finishing a critical section:
+// the frame times sample the lock hold time of the bank thread, even
+// on a single core. The check is that every bank loads and unloads.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "AkBenchEngine.h"
+#include <AK/Tools/Common/AkPlatformFuncs.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+namespace
+{
+	const char * const kBanks[] =
+	{
+		"Car.bnk",
+		"Bus3d_Demo.bnk",
+		"BGM.bnk",
+		"Dirt.bnk",
+		"Gravel.bnk",
+		"Metal.bnk",
+		"Wood.bnk",
+		"MarkerTest.bnk",
+		"Positioning_Demo.bnk",
+		"ExternalSources.bnk",
+		"Microphone.bnk",
+	};
+	const AkUInt32 kNumBanks = sizeof( kBanks ) / sizeof( kBanks[ 0 ] );
+
+	// The render thread sleeps this long between frames, letting the bank thread run.
+	const useconds_t kRenderPeriodUs = 100;
+
+	// Frames longer than this are counted separately. For reference, an audio frame of 1024 samples at 48 kHz lasts 21 ms.
+	const AkReal64 kLongFrameMs = 0.1;
+
+	struct FrameStats
+	{
+		FrameStats() : uFrames( 0 ), uLongFrames( 0 ), fTotalMs( 0.0 ), fMaxMs( 0.0 ) {}
+
+		void Add( AkReal64 in_fMs )
+		{
+			++uFrames;
+			if ( in_fMs > kLongFrameMs )
+				++uLongFrames;
+			fTotalMs += in_fMs;
+			fMaxMs = AkMax( fMaxMs, in_fMs );
+		}
+
+		AkUInt32 uFrames;
+		AkUInt32 uLongFrames;
+		AkReal64 fTotalMs;
+		AkReal64 fMaxMs;
+	};
+
+	enum Phase
+	{
+		Phase_Load,
+		Phase_Unload,
+		Phase_Stop
+	};
+
+	struct RenderThreadParams
+	{
+		AkAtomic32 iPhase;
+		bool bRealTime;
+		FrameStats aStats[ Phase_Stop ];
+	};
+
+	AK_DECLARE_THREAD_ROUTINE( RenderThread )
+	{
+		RenderThreadParams * pParams = AK_GET_THREAD_ROUTINE_PARAMETER_PTR( RenderThreadParams );
+
+		// AkCreateThread() leaves the scheduling policy to the one inherited on Linux.
+		sched_param schedParam;
+		schedParam.sched_priority = sched_get_priority_min( SCHED_FIFO );
+		pParams->bRealTime = pthread_setschedparam( pthread_self(), SCHED_FIFO, &schedParam ) == 0;
+
+		for ( ;; )
+		{
+			AkInt32 iPhase = AkAtomicLoad32( &pParams->iPhase );
+			if ( iPhase == Phase_Stop )
+				break;
+			AkBenchTimer timer;
+			timer.Start();
+			AkBenchEngineRenderFrame();
+			pParams->aStats[ iPhase ].Add( timer.Stop() );
+			usleep( kRenderPeriodUs );
+		}
+		AK_THREAD_RETURN( AK_RETURN_THREAD_OK );
+	}
+
+	void ReportFrames( const char * in_szName, const FrameStats & in_stats )
+	{
+		AkBenchReport( in_szName, in_stats.fTotalMs, AkMax( in_stats.uFrames, (AkUInt32)1 ), "frame" );
+		printf( "%-40s %10.3f ms max frame, %u of %u frames over %.1f ms\n", "", in_stats.fMaxMs, in_stats.uLongFrames, in_stats.uFrames, kLongFrameMs );
+	}
+
+	bool LoadAndUnloadBanks( AkUInt32 in_uNumPasses, AkAtomic32 * io_pPhase )
+	{
+		for ( AkUInt32 uPass = 0; uPass < in_uNumPasses; ++uPass )
+		{
+			AkBankID aBankIDs[ kNumBanks ];
+			AkAtomicStore32( io_pPhase, Phase_Load );
+			for ( AkUInt32 i = 0; i < kNumBanks; ++i )
+			{
+				AKRESULT eResult = AK::SoundEngine::LoadBank( kBanks[ i ], aBankIDs[ i ] );
+				if ( eResult != AK_Success )
+				{
+					printf( "%s: LoadBank() returned %d\n", kBanks[ i ], eResult );
+					return false;
+				}
+			}
+			AkAtomicStore32( io_pPhase, Phase_Unload );
+			for ( AkUInt32 i = 0; i < kNumBanks; ++i )
+			{
+				AKRESULT eResult = AK::SoundEngine::UnloadBank( aBankIDs[ i ], NULL );
+				if ( eResult != AK_Success )
+				{
+					printf( "%s: UnloadBank() returned %d\n", kBanks[ i ], eResult );
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 uNumPasses = bCheckOnly ? 2 : 100;
+	const AkUInt32 uNumIdleFrames = bCheckOnly ? 100 : 2000;
+
+	AkInitSettings initSettings;
+	AkPlatformInitSettings platformSettings;
+	AkBenchEngineGetDefaultSettings( initSettings, platformSettings );
+	bool bOk = AkBenchEngineInit( initSettings, platformSettings );
+
+	if ( bOk )
+	{
+		// Frames with nothing else going on.
+		FrameStats idleStats;
+		for ( AkUInt32 i = 0; i < uNumIdleFrames; ++i )
+		{
+			AkBenchTimer timer;
+			timer.Start();
+			AkBenchEngineRenderFrame();
+			idleStats.Add( timer.Stop() );
+		}
+		ReportFrames( "RenderAudio, idle", idleStats );
+
+		// Frames rendered while banks are loaded and unloaded.
+		RenderThreadParams params;
+		AkAtomicStore32( &params.iPhase, Phase_Load );
+
+		AkThreadProperties threadProperties;
+		AKPLATFORM::AkGetDefaultThreadProperties( threadProperties );
+		threadProperties.uSchedPolicy = SCHED_OTHER;
+		threadProperties.nPriority = 0;
+		params.bRealTime = false;
+		AkThread renderThread;
+		AKPLATFORM::AkCreateThread( RenderThread, &params, threadProperties, &renderThread, "Render" );
+
+		AkBenchTimer timer;
+		timer.Start();
+		bOk = LoadAndUnloadBanks( uNumPasses, &params.iPhase );
+		AkReal64 fLoadMs = timer.Stop();
+
+		AkAtomicStore32( &params.iPhase, Phase_Stop );
+		AKPLATFORM::AkWaitForSingleThread( &renderThread );
+		AKPLATFORM::AkCloseThread( &renderThread );
+
+		if ( !params.bRealTime )
+			printf( "Could not make the render thread real-time: the frame times include scheduling delays.\n" );
+		AkBenchReport( "LoadBank + UnloadBank", fLoadMs, uNumPasses * kNumBanks, "bank" );
+		ReportFrames( "RenderAudio, during LoadBank", params.aStats[ Phase_Load ] );
+		ReportFrames( "RenderAudio, during UnloadBank", params.aStats[ Phase_Unload ] );
+	}
+
+	AkBenchEngineTerm();
+
+	printf( bOk ? "Bank load: OK\n" : "Bank load: FAILED\n" );
+	return bOk ? 0 : 1;
+}
@@ -0,0 +1,164 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkCommandQueueBenchmark.cpp
+//
+// Measures the contention of game threads posting commands at the same
+// time. 1 to 8 producer threads each call SetRTPCValue() and
+// SetPosition() on their own game object as fast as they can, while the
+// main thread renders frames (RenderAudio() without an audio thread),
+// which drains the command queue. Reports the time per command seen by
+// the producers, and the reservations retried because another producer
+// moved the write pointer first (AkCommandQueueStats::uNumContentions).
+// The check is that every command is accepted.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "AkBenchEngine.h"
+#include <AK/Tools/Common/AkPlatformFuncs.h>
+
+namespace
+{
+	const AkUInt32 kMaxProducers = 8;
+	const AkGameObjectID kFirstGameObjectID = 100;
+	const AkRtpcID kRtpcID = 1;
+
+	struct ProducerParams
+	{
+		AkGameObjectID gameObjectID;
+		AkUInt32 uNumCommands;
+		AkAtomic32 * pNumRunning;
+		AkReal64 fMs;
+		AkUInt32 uNumFailed;
+	};
+
+	AK_DECLARE_THREAD_ROUTINE( ProducerThread )
+	{
+		ProducerParams * pParams = AK_GET_THREAD_ROUTINE_PARAMETER_PTR( ProducerParams );
+
+		AkBenchTimer timer;
+		timer.Start();
+		for ( AkUInt32 i = 0; i < pParams->uNumCommands; i += 2 )
+		{
+			if ( AK::SoundEngine::SetRTPCValue( kRtpcID, (AkRtpcValue)( i % 101 ), pParams->gameObjectID ) != AK_Success )
+				++pParams->uNumFailed;
+
+			AkSoundPosition position;
+			position.Set( (AkReal32)( i % 100 ), 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 1.f, 0.f );
+			if ( AK::SoundEngine::SetPosition( pParams->gameObjectID, position ) != AK_Success )
+				++pParams->uNumFailed;
+		}
+		pParams->fMs = timer.Stop();
+
+		AkAtomicDec32( pParams->pNumRunning );
+		AK_THREAD_RETURN( AK_RETURN_THREAD_OK );
+	}
+
+	// Posts in_uNumCommands commands from each of in_uNumProducers threads while rendering frames. Returns false if a command was refused.
+	bool PostCommands( AkUInt32 in_uNumProducers, AkUInt32 in_uNumCommands )
+	{
+		AkCommandQueueStats statsBefore;
+		AK::SoundEngine::GetCommandQueueStats( statsBefore );
+
+		AkAtomic32 iNumRunning;
+		AkAtomicStore32( &iNumRunning, (AkInt32)in_uNumProducers );
+
+		ProducerParams aParams[ kMaxProducers ];
+		AkThread aThreads[ kMaxProducers ];
+		AkThreadProperties threadProperties;
+		AKPLATFORM::AkGetDefaultThreadProperties( threadProperties );
+		for ( AkUInt32 i = 0; i < in_uNumProducers; ++i )
+		{
+			aParams[ i ].gameObjectID = kFirstGameObjectID + i;
+			aParams[ i ].uNumCommands = in_uNumCommands;
+			aParams[ i ].pNumRunning = &iNumRunning;
+			aParams[ i ].fMs = 0.0;
+			aParams[ i ].uNumFailed = 0;
+			AKPLATFORM::AkCreateThread( ProducerThread, &aParams[ i ], threadProperties, &aThreads[ i ], "Producer" );
+		}
+
+		AkUInt32 uNumFrames = 0;
+		while ( AkAtomicLoad32( &iNumRunning ) > 0 )
+		{
+			AkBenchEngineRenderFrame();
+			++uNumFrames;
+		}
+
+		AkReal64 fProducerMs = 0.0;
+		AkUInt32 uNumFailed = 0;
+		for ( AkUInt32 i = 0; i < in_uNumProducers; ++i )
+		{
+			AKPLATFORM::AkWaitForSingleThread( &aThreads[ i ] );
+			AKPLATFORM::AkCloseThread( &aThreads[ i ] );
+			fProducerMs += aParams[ i ].fMs;
+			uNumFailed += aParams[ i ].uNumFailed;
+		}
+
+		// Process what is left.
+		AkBenchEngineRenderFrame();
+
+		AkCommandQueueStats statsAfter;
+		AK::SoundEngine::GetCommandQueueStats( statsAfter );
+
+		const AkUInt64 uTotalCommands = (AkUInt64)in_uNumProducers * in_uNumCommands;
+		char szName[ 64 ];
+		snprintf( szName, sizeof( szName ), "%u producer thread(s)", in_uNumProducers );
+		AkBenchReport( szName, fProducerMs, uTotalCommands, "command" );
+		AkUInt32 uNumContentions = statsAfter.uNumContentions - statsBefore.uNumContentions;
+		printf( "  %u retried reservations (%.3f per 1000 commands), %u stalls, %u grows, queue of %u KB, %u frames rendered\n",
+			uNumContentions, 1000.0 * uNumContentions / uTotalCommands,
+			statsAfter.uNumStalls - statsBefore.uNumStalls, statsAfter.uNumGrows - statsBefore.uNumGrows,
+			statsAfter.uQueueSize / 1024, uNumFrames );
+
+		if ( uNumFailed != 0 )
+		{
+			printf( "FAILED: %u of %u commands were refused\n", uNumFailed, (AkUInt32)uTotalCommands );
+			return false;
+		}
+		return true;
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 uNumCommands = bCheckOnly ? 20000 : 1000000;
+	const AkUInt32 aNumProducers[] = { 1, 2, 4, 8 };
+
+	AkInitSettings initSettings;
+	AkPlatformInitSettings platformSettings;
+	AkBenchEngineGetDefaultSettings( initSettings, platformSettings );
+	bool bOk = AkBenchEngineInit( initSettings, platformSettings );
+
+	for ( AkUInt32 i = 0; bOk && i < kMaxProducers; ++i )
+	{
+		if ( AK::SoundEngine::RegisterGameObj( kFirstGameObjectID + i ) != AK_Success )
+		{
+			printf( "RegisterGameObj() failed\n" );
+			bOk = false;
+		}
+	}
+	AkBenchEngineRenderFrame();
+
+	for ( AkUInt32 i = 0; bOk && i < sizeof( aNumProducers ) / sizeof( aNumProducers[ 0 ] ); ++i )
+		bOk = PostCommands( aNumProducers[ i ], uNumCommands / aNumProducers[ i ] );
+
+	AkBenchEngineTerm();
+
+	printf( bOk ? "Command queue: OK\n" : "Command queue: FAILED\n" );
+	return bOk ? 0 : 1;
+}
@@ -0,0 +1,104 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkBenchmark.h
+//
+// Helpers shared by the benchmarks of this directory. Each benchmark
+// first checks that an optimized code path gives the same results as the
+// reference path it replaces, then times both. When run with --check
+// (as ctest does), only the check and a short timing pass are performed.
+// The process returns 0 when the check passes, 1 otherwise.
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef _AK_BENCHMARK_H_
+#define _AK_BENCHMARK_H_
+
+#include <AK/SoundEngine/Common/AkTypes.h>
+#include <AK/Tools/Common/AkPlatformFuncs.h>
+#include <stdio.h>
+#include <string.h>
+
+// Benchmarks that compile engine code which allocates link with AkBenchmarkMemory.cpp, which implements 
+// the AK::MemoryMgr allocation functions with the C runtime. Set to true to make all allocations fail.
+extern bool g_bAkBenchFailAllocs;
+
+// Returns true when only the equivalence check and a short timing pass should run.
+inline bool AkBenchIsCheckOnly( int argc, char * argv[] )
+{
+	for ( int i = 1; i < argc; ++i )
+	{
+		if ( strcmp( argv[ i ], "--check" ) == 0 )
+			return true;
+	}
+	return false;
+}
+
+// Deterministic pseudo-random numbers (xorshift32): runs are reproducible.
+class AkBenchRandom
+{
+public:
+	AkBenchRandom( AkUInt32 in_uSeed = 0x12345678 ) : m_uState( in_uSeed ? in_uSeed : 1 ) {}
+
+	inline AkUInt32 Next()
+	{
+		m_uState ^= m_uState << 13;
+		m_uState ^= m_uState >> 17;
+		m_uState ^= m_uState << 5;
+		return m_uState;
+	}
+
+	// Uniform in [-1, 1).
+	inline AkReal32 NextSigned()
+	{
+		return (AkReal32)( (AkInt32)Next() ) * ( 1.f / 2147483648.f );
+	}
+
+private:
+	AkUInt32 m_uState;
+};
+
+class AkBenchTimer
+{
+public:
+	inline void Start() { AKPLATFORM::PerformanceCounter( &m_iStart ); }
+
+	// Elapsed time since Start(), in milliseconds.
+	inline AkReal64 Stop()
+	{
+		AkInt64 iStop, iFreq;
+		AKPLATFORM::PerformanceCounter( &iStop );
+		AKPLATFORM::PerformanceFrequency( &iFreq );
+		return (AkReal64)( iStop - m_iStart ) * 1000.0 / (AkReal64)iFreq;
+	}
+
+private:
+	AkInt64 m_iStart;
+};
+
+// Prints one timing line: total time and time per item (sample, lookup, ...).
+inline void AkBenchReport( const char * in_szName, AkReal64 in_fMs, AkUInt64 in_uNumItems, const char * in_szItem )
+{
+	printf( "%-40s %10.3f ms %10.3f ns/%s\n", in_szName, in_fMs, in_fMs * 1000000.0 / (AkReal64)in_uNumItems, in_szItem );
+}
+
+// Prints the ratio of two timings of the same work.
+inline void AkBenchReportSpeedup( const char * in_szName, AkReal64 in_fRefMs, AkReal64 in_fOptMs )
+{
+	printf( "%-40s %10.2fx\n", in_szName, in_fOptMs > 0.0 ? in_fRefMs / in_fOptMs : 0.0 );
+}
+
+#endif //_AK_BENCHMARK_H_
@@ -0,0 +1,74 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkBenchmarkMemory.cpp
+//
+// AK::MemoryMgr allocation functions for benchmarks, backed by the C
+// runtime, so that engine sources can be compiled in without the
+// Memory Manager.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include <AK/SoundEngine/Common/AkMemoryMgr.h>
+#include <stdlib.h>
+
+bool g_bAkBenchFailAllocs = false;
+
+namespace AK
+{
+	namespace MemoryMgr
+	{
+		void * Malloc( AkMemPoolId /*in_poolId*/, size_t in_uSize )
+		{
+			return g_bAkBenchFailAllocs ? NULL : malloc( in_uSize );
+		}
+
+		void * Realloc( AkMemPoolId /*in_poolId*/, void * in_pAlloc, size_t in_uSize )
+		{
+			return g_bAkBenchFailAllocs ? NULL : realloc( in_pAlloc, in_uSize );
+		}
+
+		void Free( AkMemPoolId /*in_poolId*/, void * in_pMemAddress )
+		{
+			free( in_pMemAddress );
+		}
+
+		void * Malign( AkMemPoolId /*in_poolId*/, size_t in_uSize, AkUInt32 in_uAlignment )
+		{
+			if ( g_bAkBenchFailAllocs )
+				return NULL;
+
+#if defined(AK_WIN)
+			return _aligned_malloc( in_uSize, in_uAlignment );
+#else
+			void * pMem = NULL;
+			if ( posix_memalign( &pMem, AkMax( in_uAlignment, (AkUInt32)sizeof( void * ) ), in_uSize ) != 0 )
+				return NULL;
+			return pMem;
+#endif
+		}
+
+		void Falign( AkMemPoolId /*in_poolId*/, void * in_pMemAddress )
+		{
+#if defined(AK_WIN)
+			_aligned_free( in_pMemAddress );
+#else
+			free( in_pMemAddress );
+#endif
+		}
+	}
+}
@@ -0,0 +1,221 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkDecodedMediaCacheBenchmark.cpp
+//
+// Checks that the decoded media cache (see
+// AkInitSettings::uDecodedMediaCacheSize) stays within its budget when
+// many sources record at the same time, the way the Vorbis and Opus
+// sources drive it: each media misses twice before it is recorded, and
+// is recorded one audio frame at a time. Rounds of kNumSources sources
+// start recording together, and some hold on to the media they read
+// from the cache, which cannot be evicted. The check is that the memory
+// of the cached and recording media never exceeds the budget, and that
+// every recording it admits is added to the cache. Then times the
+// recording and the reading of media, per frame.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "AkBenchEngine.h"
+
+#include "AkDecodedMediaCache.h"
+
+namespace
+{
+	const AkUInt32 kBudget = 4 * 1024 * 1024;
+	const AkUInt32 kNumSources = 8;
+	const AkUInt32 kNumChannels = 2;
+	const AkUInt32 kFrameSize = 1024;
+	const AkUInt32 kMaxMediaFrames = kBudget / 4 / ( kNumChannels * sizeof( AkReal32 ) );	// Media up to a quarter of the budget are cached.
+
+	struct Totals
+	{
+		AkReal64 fRecordMs;
+		AkReal64 fReadMs;
+		AkUInt64 uNumRecordedFrames;
+		AkUInt64 uNumReadFrames;
+		AkUInt32 uNumRecordings;
+	};
+
+	AkReal32 AK_ALIGN_SIMD( s_afFrame[ kNumChannels * kFrameSize ] );
+
+	// Media of a quarter of the budget and smaller, each always of the same length.
+	AkUInt32 GetNumFrames( AkUniqueID in_mediaID )
+	{
+		return kMaxMediaFrames / ( 1 + in_mediaID % 4 );
+	}
+
+	AkDecodedMediaKey MakeKey( AkUniqueID in_mediaID, AkUInt32 in_uNumFrames )
+	{
+		AkDecodedMediaKey key;
+		key.mediaID = in_mediaID;
+		key.uMediaSize = in_uNumFrames / 8;
+		key.uSampleRate = 48000;
+		key.uChannelConfig = 0x203;
+		key.uFormatTag = AK_WAVE_FORMAT_VORBIS;
+		return key;
+	}
+
+	bool WithinBudget( const char * in_szWhen )
+	{
+		AkDecodedMediaCacheStats stats;
+		AK::SoundEngine::GetDecodedMediaCacheStats( stats );
+		if ( stats.uMemoryUsed > kBudget )
+		{
+			printf( "FAILED: %u bytes used %s, over the budget of %u\n", stats.uMemoryUsed, in_szWhen, kBudget );
+			return false;
+		}
+		return true;
+	}
+
+	// Plays kNumSources media at once, from in_firstMediaID. Media found in the cache are
+	// read and, if in_bHold, kept in out_ppHeld until the caller releases them. Other media are recorded, on their second miss.
+	// Returns false if the budget is exceeded or a recording is lost.
+	bool PlaySources( AkUniqueID in_firstMediaID, bool in_bHold, const AkDecodedMedia ** out_ppHeld, Totals & io_totals )
+	{
+		AkDecodedMedia * apRecordings[ kNumSources ];
+		const AkDecodedMedia * apMedia[ kNumSources ];
+		AkUInt32 auNumFrames[ kNumSources ];
+		AkUInt32 uMaxFrames = 0;
+		for ( AkUInt32 i = 0; i < kNumSources; ++i )
+		{
+			auNumFrames[ i ] = GetNumFrames( in_firstMediaID + i );
+			uMaxFrames = AkMax( uMaxFrames, auNumFrames[ i ] );
+			const AkDecodedMediaKey key = MakeKey( in_firstMediaID + i, auNumFrames[ i ] );
+			apMedia[ i ] = AkDecodedMediaCache::Acquire( key );
+			apRecordings[ i ] = NULL;
+			if ( !apMedia[ i ] )
+			{
+				// Like a source that missed once before, unless this media is a candidate already.
+				apRecordings[ i ] = AkDecodedMediaCache::BeginRecording( key, auNumFrames[ i ], kNumChannels, 48000, 0 );
+				if ( !apRecordings[ i ] )
+					apRecordings[ i ] = AkDecodedMediaCache::BeginRecording( key, auNumFrames[ i ], kNumChannels, 48000, 0 );
+				if ( apRecordings[ i ] )
+					++io_totals.uNumRecordings;
+			}
+			if ( !WithinBudget( "after a recording began" ) )
+				return false;
+		}
+
+		AkBenchTimer timer;
+		for ( AkUInt32 uFrame = 0; uFrame < uMaxFrames; uFrame += kFrameSize )
+		{
+			for ( AkUInt32 i = 0; i < kNumSources; ++i )
+			{
+				if ( uFrame >= auNumFrames[ i ] )
+					continue;
+				const AkUInt32 uNumFrames = AkMin( kFrameSize, auNumFrames[ i ] - uFrame );
+				if ( apRecordings[ i ] )
+				{
+					timer.Start();
+					AkDecodedMediaCache::Record( apRecordings[ i ], uFrame, s_afFrame, kFrameSize, uNumFrames );
+					io_totals.fRecordMs += timer.Stop();
+					io_totals.uNumRecordedFrames += uNumFrames;
+					if ( !apRecordings[ i ] && uFrame + uNumFrames != auNumFrames[ i ] )
+					{
+						printf( "FAILED: recording of media %u was cancelled\n", in_firstMediaID + i );
+						return false;
+					}
+				}
+				else if ( apMedia[ i ] )
+				{
+					timer.Start();
+					apMedia[ i ]->CopyFrames( uFrame, uNumFrames, s_afFrame, kFrameSize );
+					io_totals.fReadMs += timer.Stop();
+					io_totals.uNumReadFrames += uNumFrames;
+				}
+			}
+			if ( !WithinBudget( "while recording" ) )
+				return false;
+		}
+
+		for ( AkUInt32 i = 0; i < kNumSources; ++i )
+		{
+			if ( apMedia[ i ] && in_bHold && !out_ppHeld[ i ] )
+				out_ppHeld[ i ] = apMedia[ i ];
+			else if ( apMedia[ i ] )
+				AkDecodedMediaCache::Release( apMedia[ i ] );
+		}
+		return true;
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 uNumRounds = bCheckOnly ? 20 : 400;
+
+	AkInitSettings initSettings;
+	AkPlatformInitSettings platformSettings;
+	AkBenchEngineGetDefaultSettings( initSettings, platformSettings );
+	initSettings.uDecodedMediaCacheSize = kBudget;
+	bool bOk = AkBenchEngineInit( initSettings, platformSettings );
+
+	AkBenchRandom random;
+	for ( AkUInt32 i = 0; i < kNumChannels * kFrameSize; ++i )
+		s_afFrame[ i ] = random.NextSigned();
+
+	const AkDecodedMedia * apHeld[ kNumSources ] = {};
+	Totals totals = {};
+	for ( AkUInt32 uRound = 0; bOk && uRound < uNumRounds; ++uRound )
+	{
+		// Media from a small set, so that some are found in the cache. Every few rounds, sources keep theirs until the next such round.
+		const AkUniqueID firstMediaID = 1 + ( random.Next() % 4 ) * kNumSources / 2;
+		const bool bHold = ( uRound % 4 ) == 0;
+		if ( bHold )
+		{
+			for ( AkUInt32 i = 0; i < kNumSources; ++i )
+			{
+				if ( apHeld[ i ] )
+					AkDecodedMediaCache::Release( apHeld[ i ] );
+				apHeld[ i ] = NULL;
+			}
+		}
+		bOk = PlaySources( firstMediaID, bHold, apHeld, totals );
+	}
+
+	for ( AkUInt32 i = 0; i < kNumSources; ++i )
+	{
+		if ( apHeld[ i ] )
+			AkDecodedMediaCache::Release( apHeld[ i ] );
+	}
+
+	AkDecodedMediaCacheStats stats;
+	AK::SoundEngine::GetDecodedMediaCacheStats( stats );
+	if ( bOk )
+	{
+		AkBenchReport( "Record", totals.fRecordMs, totals.uNumRecordedFrames, "sample frame" );
+		AkBenchReport( "Read", totals.fReadMs, totals.uNumReadFrames, "sample frame" );
+		printf( "  %u hits, %u misses, %u insertions, %u evictions, %u rejections, %u KB used\n",
+			stats.uNumHits, stats.uNumMisses, stats.uNumInsertions, stats.uNumEvictions, stats.uNumRejections, stats.uMemoryUsed / 1024 );
+		if ( stats.uNumInsertions != totals.uNumRecordings )
+		{
+			printf( "FAILED: %u recordings were admitted, but %u were added to the cache\n", totals.uNumRecordings, stats.uNumInsertions );
+			bOk = false;
+		}
+		else if ( stats.uNumInsertions == 0 || stats.uNumHits == 0 || stats.uNumRejections == 0 )
+		{
+			printf( "FAILED: the rounds did not fill the cache\n" );
+			bOk = false;
+		}
+	}
+
+	AkBenchEngineTerm();
+
+	printf( bOk ? "Decoded media cache budget: OK\n" : "Decoded media cache budget: FAILED\n" );
+	return bOk ? 0 : 1;
+}
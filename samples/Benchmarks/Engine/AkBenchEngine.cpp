@@ -0,0 +1,101 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkBenchEngine.cpp
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchEngine.h"
+#include "AkDefaultIOHookBlocking.h"
+
+#include <AK/SoundEngine/Common/AkMemoryMgr.h>
+#include <AK/SoundEngine/Common/AkModule.h>
+#include <AK/SoundEngine/Common/AkStreamMgrModule.h>
+#include <AK/Plugin/AkVorbisDecoderFactory.h>
+#include <stdio.h>
+
+static CAkDefaultIOHookBlocking s_lowLevelIO;
+
+void AkBenchEngineGetDefaultSettings( AkInitSettings & out_initSettings, AkPlatformInitSettings & out_platformSettings )
+{
+	AK::SoundEngine::GetDefaultInitSettings( out_initSettings );
+	out_initSettings.bUseLEngineThread = false;
+
+	AK::SoundEngine::GetDefaultPlatformInitSettings( out_platformSettings );
+}
+
+bool AkBenchEngineInit( AkInitSettings & in_initSettings, AkPlatformInitSettings & in_platformSettings )
+{
+	AkMemSettings memSettings;
+	AK::MemoryMgr::GetDefaultSettings( memSettings );
+	if ( AK::MemoryMgr::Init( &memSettings ) != AK_Success )
+	{
+		printf( "AK::MemoryMgr::Init() failed\n" );
+		return false;
+	}
+
+	AkStreamMgrSettings stmSettings;
+	AK::StreamMgr::GetDefaultSettings( stmSettings );
+	if ( !AK::StreamMgr::Create( stmSettings ) )
+	{
+		printf( "AK::StreamMgr::Create() failed\n" );
+		return false;
+	}
+
+	AkDeviceSettings deviceSettings;
+	AK::StreamMgr::GetDefaultDeviceSettings( deviceSettings );
+	if ( s_lowLevelIO.Init( deviceSettings ) != AK_Success
+		|| s_lowLevelIO.SetBasePath( AKTEXT( AK_BENCH_BANK_PATH ) ) != AK_Success )
+	{
+		printf( "Low-level I/O initialization failed\n" );
+		return false;
+	}
+
+	AKRESULT eResult = AK::SoundEngine::Init( &in_initSettings, &in_platformSettings );
+	if ( eResult != AK_Success )
+	{
+		printf( "AK::SoundEngine::Init() returned %d\n", eResult );
+		return false;
+	}
+
+	// Complete the initialization (see bUseLEngineThread).
+	AkBenchEngineRenderFrame();
+
+	AkBankID bankID;
+	eResult = AK::SoundEngine::LoadBank( "Init.bnk", bankID );
+	if ( eResult != AK_Success )
+	{
+		printf( "Init.bnk: LoadBank() returned %d\n", eResult );
+		return false;
+	}
+
+	return true;
+}
+
+void AkBenchEngineTerm()
+{
+	if ( AK::SoundEngine::IsInitialized() )
+		AK::SoundEngine::Term();
+
+	if ( AK::IAkStreamMgr::Get() )
+	{
+		s_lowLevelIO.Term();
+		AK::IAkStreamMgr::Get()->Destroy();
+	}
+
+	if ( AK::MemoryMgr::IsInitialized() )
+		AK::MemoryMgr::Term();
+}
@@ -0,0 +1,50 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkBenchEngine.h
+//
+// Sound engine set-up shared by the engine benchmarks: default Memory
+// and Stream Managers, blocking low-level I/O reading the banks of the
+// IntegrationDemo project, and a sound engine which renders its frames
+// in RenderAudio() (no audio thread) into a silent output.
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef _AK_BENCH_ENGINE_H_
+#define _AK_BENCH_ENGINE_H_
+
+#include <AK/SoundEngine/Common/AkSoundEngine.h>
+
+// Fills the settings used by AkBenchEngineInit(). Benchmarks change them before initializing.
+void AkBenchEngineGetDefaultSettings( AkInitSettings & out_initSettings, AkPlatformInitSettings & out_platformSettings );
+
+// Initializes the engine and loads Init.bnk. Returns false (and prints why) on failure.
+bool AkBenchEngineInit( AkInitSettings & in_initSettings, AkPlatformInitSettings & in_platformSettings );
+
+void AkBenchEngineTerm();
+
+// Captures the output of the frames rendered next into out_pSamples (interleaved channels of the main output), up to
+// in_uMaxSamples samples. Stops the previous capture, if any, and returns the number of samples it captured.
+// AkBenchEngineCaptureOutput( NULL, 0 ) stops capturing.
+AkUInt32 AkBenchEngineCaptureOutput( AkReal32 * out_pSamples, AkUInt32 in_uMaxSamples );
+
+// Renders one audio frame on the calling thread.
+inline void AkBenchEngineRenderFrame()
+{
+	AK::SoundEngine::RenderAudio();
+}
+
+#endif //_AK_BENCH_ENGINE_H_
@@ -0,0 +1,220 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkBenchPlatform.cpp
+//
+// Platform part of the sound engine for the engine benchmarks. It
+// replaces Linux/AkLEngine.cpp and Linux/AkSink.cpp, which need the
+// ALSA and PulseAudio headers. The default sink has no audio API: it
+// asks for one frame every time the engine checks, so that each call
+// to RenderAudio() renders exactly one frame, and it discards it,
+// unless the benchmark captures the output (AkBenchEngineCaptureOutput).
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "AkLEngine.h"
+#include "AkSink.h"
+#include "AkEffectsMgr.h"
+#include "AkSettings.h"
+#include "AkBenchEngine.h"
+
+extern AkInitSettings		g_settings;
+extern AkPlatformInitSettings g_PDSettings;
+
+AkEvent	CAkLEngine::m_EventStop;
+AK::IAkPlatformContext* CAkLEngine::m_pPlatformContext = NULL;
+
+AkAudioAPI CAkSink::s_CurrentAudioAPI = AkAPI_Default;
+
+// Output capture of the default sink, on the thread rendering the frames.
+static AkReal32 * s_pCapture = NULL;
+static AkUInt32 s_uMaxCaptureSamples = 0;
+static AkUInt32 s_uNumCapturedSamples = 0;
+
+AkUInt32 AkBenchEngineCaptureOutput( AkReal32 * out_pSamples, AkUInt32 in_uMaxSamples )
+{
+	AkUInt32 uNumCapturedSamples = s_uNumCapturedSamples;
+	s_pCapture = out_pSamples;
+	s_uMaxCaptureSamples = in_uMaxSamples;
+	s_uNumCapturedSamples = 0;
+	return uNumCapturedSamples;
+}
+
+class CAkBenchPlatformContext : public AK::IAkLinuxContext
+{
+public:
+	bool UsePulseAudioServerInfo() override { return false; }
+	const char* GetStreamName(AkDeviceID /*deviceID*/) override { return "Benchmark"; }
+	AkUInt32 GetChannelCount(AkDeviceID /*deviceID*/) override { return 0; }
+	void SetSinkInitialized(bool /*isInitialized*/) override {}
+	bool IsPluginSupported(AkPluginID pluginID) override { return pluginID == AKPLUGINID_DEFAULT_SINK; }
+	bool IsStreamReady(AkPluginID /*pluginID*/) override { return true; }
+	const char* GetStreamName(AkPluginID /*pluginID*/, AkDeviceID deviceID) override { return GetStreamName(deviceID); }
+	AkUInt32 GetChannelCount(AkPluginID /*pluginID*/, AkDeviceID deviceID) override { return GetChannelCount(deviceID); }
+	void SetSinkInitialized(AkPluginID /*pluginID*/, bool /*isInitialized*/) override {}
+};
+
+namespace AK
+{
+	namespace SoundEngine
+	{
+		AKRESULT RegisterPluginDLL(const AkOSChar* /*in_DllName*/, const AkOSChar* /*in_DllPath*/)
+		{
+			return AK_NotImplemented;
+		}
+
+		AKRESULT GetDeviceSpatialAudioSupport(AkUInt32 /*in_idDevice*/)
+		{
+			return AK_NotCompatible;
+		}
+	}
+};
+
+AK::IAkPlugin* AkCreateDefaultSink(AK::IAkPluginMemAlloc * in_pAllocator)
+{
+	return AK_PLUGIN_NEW(in_pAllocator, CAkSink());
+}
+
+CAkSink::CAkSink()
+	: m_pRealSink(NULL)
+{
+}
+
+CAkSink::~CAkSink()
+{
+}
+
+AKRESULT CAkSink::Init(AK::IAkPluginMemAlloc* /*in_pAllocator*/, AK::IAkSinkPluginContext* /*in_pSinkPluginContext*/, AK::IAkPluginParam* /*in_pParams*/, AkAudioFormat& io_rFormat)
+{
+	if (!io_rFormat.channelConfig.IsValid())
+		io_rFormat.channelConfig.SetStandard(AK_SPEAKER_SETUP_STEREO);
+	io_rFormat.uBlockAlign = io_rFormat.channelConfig.uNumChannels * sizeof(AkReal32);
+	io_rFormat.uSampleRate = g_PDSettings.uSampleRate;
+	return AK_Success;
+}
+
+AKRESULT CAkSink::Term(AK::IAkPluginMemAlloc* in_pAllocator)
+{
+	AK_PLUGIN_DELETE(in_pAllocator, this);
+	return AK_Success;
+}
+
+AKRESULT CAkSink::Reset() { return AK_Success; }
+
+AKRESULT CAkSink::GetPluginInfo(AkPluginInfo & out_rPluginInfo)
+{
+	out_rPluginInfo.eType = AkPluginTypeSink;
+	out_rPluginInfo.bIsInPlace = false;
+	out_rPluginInfo.uBuildVersion = AK_WWISESDK_VERSION_COMBINED;
+	return AK_Success;
+}
+
+void CAkSink::Consume(AkAudioBuffer* in_pInputBuffer, AkRamp in_gain)
+{
+	if (!s_pCapture || !in_pInputBuffer)
+		return;
+
+	// Interleaved, with the volume ramp applied like the real sinks do.
+	const AkUInt32 uNumChannels = in_pInputBuffer->NumChannels();
+	const AkUInt32 uNumFrames = AkMin((AkUInt32)in_pInputBuffer->uValidFrames, (s_uMaxCaptureSamples - s_uNumCapturedSamples) / AkMax(uNumChannels, 1u));
+	const AkReal32 fStep = in_pInputBuffer->uValidFrames ? (in_gain.fNext - in_gain.fPrev) / in_pInputBuffer->uValidFrames : 0.f;
+	AkReal32 * pOut = s_pCapture + s_uNumCapturedSamples;
+	for (AkUInt32 uFrame = 0; uFrame < uNumFrames; ++uFrame)
+	{
+		AkReal32 fGain = in_gain.fPrev + fStep * uFrame;
+		for (AkUInt32 uChannel = 0; uChannel < uNumChannels; ++uChannel)
+			*pOut++ = in_pInputBuffer->GetChannel(uChannel)[uFrame] * fGain;
+	}
+	s_uNumCapturedSamples += uNumFrames * uNumChannels;
+}
+
+void CAkSink::OnFrameEnd() {}
+bool CAkSink::IsStarved() { return false; }
+void CAkSink::ResetStarved() {}
+AKRESULT CAkSink::IsDataNeeded(AkUInt32& out_uBuffersNeeded) { out_uBuffersNeeded = 1; return AK_Success; }
+
+void CAkLEngine::GetDefaultPlatformInitSettings(AkPlatformInitSettings & out_pPlatformSettings)
+{
+	memset( &out_pPlatformSettings, 0, sizeof( AkPlatformInitSettings ) );
+
+	GetDefaultPlatformThreadInitSettings(out_pPlatformSettings);
+
+	out_pPlatformSettings.uNumRefillsInVoice = AK_DEFAULT_NUM_REFILLS_IN_VOICE_BUFFER;
+	out_pPlatformSettings.uSampleRate = DEFAULT_NATIVE_FREQUENCY;
+	out_pPlatformSettings.sampleType = AK_DEFAULT_SAMPLE_TYPE;
+	out_pPlatformSettings.bPipelinedMixing = false;
+}
+
+void CAkLEngine::GetDefaultOutputSettings( AkOutputSettings & out_settings )
+{
+	GetDefaultOutputSettingsCommon(out_settings);
+}
+
+bool CAkLEngine::PlatformSupportsHwVoices()
+{
+	return false;
+}
+
+void CAkLEngine::PlatformWaitForHwVoices()
+{
+}
+
+AKRESULT CAkLEngine::Init()
+{
+	AkAudioLibSettings::SetAudioBufferSettings(g_PDSettings.uSampleRate, g_settings.uNumSamplesPerFrame);
+	m_bPipelinedOutput = g_PDSettings.bPipelinedMixing;
+	return SoftwareInit();
+}
+
+AKRESULT CAkLEngine::InitPlatformContext()
+{
+	m_pPlatformContext = AkNew(AkMemID_SoundEngine, CAkBenchPlatformContext());
+	if (!m_pPlatformContext)
+		return AK_InsufficientMemory;
+	return AK_Success;
+}
+
+void CAkLEngine::Term()
+{
+	SoftwareTerm();
+}
+
+void CAkLEngine::TermPlatformContext()
+{
+	AkDelete(AkMemID_SoundEngine, m_pPlatformContext);
+	m_pPlatformContext = NULL;
+}
+
+void CAkLEngine::Perform()
+{
+#if defined(AK_CPU_X86) || defined(AK_CPU_X86_64)
+	AkUInt32 uFlushZeroMode = _MM_GET_FLUSH_ZERO_MODE();
+	_MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+#endif
+
+	SoftwarePerform();
+
+#if defined(AK_CPU_X86) || defined(AK_CPU_X86_64)
+	_MM_SET_FLUSH_ZERO_MODE(uFlushZeroMode);
+#endif
+}
+
+AKRESULT CAkLEngine::GetPlatformDeviceList(AkPluginID /*in_pluginID*/, AkUInt32& io_maxNumDevices, AkDeviceDescription* /*out_deviceDescriptions*/)
+{
+	io_maxNumDevices = 0;
+	return AK_NotCompatible;
+}
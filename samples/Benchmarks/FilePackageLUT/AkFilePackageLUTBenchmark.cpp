@@ -0,0 +1,211 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkFilePackageLUTBenchmark.cpp
+//
+// Compares file lookups in a file package LUT through the hash index
+// built by CAkFilePackageLUT::Setup() with the binary search used when
+// the index cannot be allocated (and before the index existed).
+// Packages of various sizes are synthesized in memory; half of the
+// lookups are for IDs which are not in the package.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "AkFilePackageLUT.h"
+#include <algorithm>
+#include <vector>
+
+// Referenced by CAkFilePackageLUT::GetSoundBankID(), which this benchmark does not use.
+namespace AK { namespace SoundEngine {
+AkUInt32 GetIDFromString( const char* )
+{
+	return AK_INVALID_UNIQUE_ID;
+}
+} }
+
+namespace
+{
+	typedef CAkFilePackageLUT::AkFileEntry<AkFileID> FileEntry;
+
+	// Header of a file package, as parsed by CAkFilePackageLUT::Setup().
+	struct PackageHeader
+	{
+		char		headerDefinition[AKPK_HEADER_CHUNK_DEF_SIZE];
+		AkUInt32	uVersion;
+		AkUInt32	uLanguageMapSize;
+		AkUInt32	uSoundBanksLUTSize;
+		AkUInt32	uStmFilesLUTSize;
+		AkUInt32	uExternalsLUTSize;
+	};
+
+	// Languages of the package, sorted. Their IDs are 1 and 2 (0 is SFX).
+	static const char * s_aLanguages[] = { "english", "french" };
+	static const AkUInt32 s_uNumLanguages = sizeof( s_aLanguages ) / sizeof( s_aLanguages[ 0 ] );
+
+	template <class T>
+	void Append( std::vector<AkUInt8> & io_data, const T & in_value )
+	{
+		io_data.insert( io_data.end(), (const AkUInt8*)&in_value, (const AkUInt8*)&in_value + sizeof( T ) );
+	}
+
+	// Builds a package header with no soundbanks and no externals, and in_uNumFiles streamed files.
+	// Every 4th file also has a version in each language. Entries are sorted by file ID, then language ID.
+	void BuildPackage( AkUInt32 in_uNumFiles, AkBenchRandom & io_random, std::vector<AkUInt8> & out_header, std::vector<AkFileID> & out_fileIDs )
+	{
+		out_fileIDs.clear();
+		for ( AkUInt32 i = 0; i < in_uNumFiles; ++i )
+			out_fileIDs.push_back( io_random.Next() & ~1U ); // Even IDs only: odd IDs are missing.
+		std::vector<AkFileID> sortedIDs( out_fileIDs );
+		std::sort( sortedIDs.begin(), sortedIDs.end() );
+
+		std::vector<FileEntry> entries;
+		for ( AkUInt32 i = 0; i < sortedIDs.size(); ++i )
+		{
+			if ( i > 0 && sortedIDs[ i ] == sortedIDs[ i - 1 ] )
+				continue;
+			AkUInt32 uNumVersions = ( i % 4 == 0 ) ? s_uNumLanguages + 1 : 1;
+			for ( AkUInt32 uLang = 0; uLang < uNumVersions; ++uLang )
+			{
+				FileEntry entry;
+				entry.fileID = sortedIDs[ i ];
+				entry.uBlockSize = 1;
+				entry.uFileSize = 1024;
+				entry.uStartBlock = (AkUInt32)entries.size() * 1024;
+				entry.uLanguageID = uLang;
+				entries.push_back( entry );
+			}
+		}
+
+		// Language map: string count, { offset, ID } entries, then the strings, padded to 4 bytes.
+		std::vector<AkUInt8> langMap;
+		Append( langMap, s_uNumLanguages );
+		AkUInt32 uStringOffset = sizeof( AkUInt32 ) + s_uNumLanguages * 2 * sizeof( AkUInt32 );
+		for ( AkUInt32 uLang = 0; uLang < s_uNumLanguages; ++uLang )
+		{
+			Append( langMap, uStringOffset );
+			Append( langMap, uLang + 1 );
+			uStringOffset += (AkUInt32)strlen( s_aLanguages[ uLang ] ) + 1;
+		}
+		for ( AkUInt32 uLang = 0; uLang < s_uNumLanguages; ++uLang )
+			langMap.insert( langMap.end(), s_aLanguages[ uLang ], s_aLanguages[ uLang ] + strlen( s_aLanguages[ uLang ] ) + 1 );
+		langMap.resize( ( langMap.size() + 3 ) & ~3 );
+
+		const AkUInt32 uEmptyLUT = 0;
+		const AkUInt32 uStmLUTSize = sizeof( AkUInt32 ) + (AkUInt32)( entries.size() * sizeof( FileEntry ) );
+
+		PackageHeader header;
+		memset( &header, 0, sizeof( header ) );
+		header.uVersion = AKPK_CURRENT_VERSION;
+		header.uLanguageMapSize = (AkUInt32)langMap.size();
+		header.uSoundBanksLUTSize = sizeof( AkUInt32 );
+		header.uStmFilesLUTSize = uStmLUTSize;
+		header.uExternalsLUTSize = sizeof( AkUInt32 );
+
+		out_header.clear();
+		Append( out_header, header );
+		out_header.insert( out_header.end(), langMap.begin(), langMap.end() );
+		Append( out_header, uEmptyLUT );
+		Append( out_header, (AkUInt32)entries.size() );
+		out_header.insert( out_header.end(), (const AkUInt8*)&entries[ 0 ], (const AkUInt8*)( &entries[ 0 ] + entries.size() ) );
+		Append( out_header, uEmptyLUT );
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 uNumLookups = bCheckOnly ? 100000 : 4000000;
+	static const AkUInt32 s_aNumFiles[] = { 100, 1000, 10000, 100000 };
+
+	// SFX and language-specific lookups.
+	AkFileSystemFlags aFlags[ 2 ] = {
+		AkFileSystemFlags( AKCOMPANYID_AUDIOKINETIC, AKCODECID_VORBIS, 0, NULL, false, AK_INVALID_FILE_ID ),
+		AkFileSystemFlags( AKCOMPANYID_AUDIOKINETIC, AKCODECID_VORBIS, 0, NULL, true, AK_INVALID_FILE_ID )
+	};
+
+	AkBenchRandom random;
+	bool bOk = true;
+	for ( AkUInt32 uSize = 0; uSize < sizeof( s_aNumFiles ) / sizeof( s_aNumFiles[ 0 ] ); ++uSize )
+	{
+		std::vector<AkUInt8> header;
+		std::vector<AkFileID> fileIDs;
+		BuildPackage( s_aNumFiles[ uSize ], random, header, fileIDs );
+
+		// Same header data, with and without the hash index.
+		CAkFilePackageLUT lutHashed;
+		CAkFilePackageLUT lutBinary;
+		if ( lutHashed.Setup( &header[ 0 ], (AkUInt32)header.size() ) != AK_Success )
+			return 1;
+		g_bAkBenchFailAllocs = true;
+		AKRESULT eResult = lutBinary.Setup( &header[ 0 ], (AkUInt32)header.size() );
+		g_bAkBenchFailAllocs = false;
+		if ( eResult != AK_Success )
+			return 1;
+
+		// Lookups: IDs of the package, and the same IDs with the low bit set, which are missing.
+		std::vector<AkFileID> lookups( uNumLookups );
+		std::vector<AkFileSystemFlags*> lookupFlags( uNumLookups );
+		for ( AkUInt32 i = 0; i < uNumLookups; ++i )
+		{
+			lookups[ i ] = fileIDs[ random.Next() % fileIDs.size() ] | ( i & 1 );
+			lookupFlags[ i ] = &aFlags[ ( i >> 1 ) & 1 ];
+		}
+
+		// Every lookup must return the same entry, in every language.
+		for ( AkUInt32 uLang = 0; uLang < s_uNumLanguages && bOk; ++uLang )
+		{
+			if ( lutHashed.SetCurLanguage( s_aLanguages[ uLang ] ) != AK_Success
+				|| lutBinary.SetCurLanguage( s_aLanguages[ uLang ] ) != AK_Success )
+				return 1;
+
+			for ( AkUInt32 i = 0; i < uNumLookups; ++i )
+			{
+				if ( lutHashed.LookupFile( lookups[ i ], lookupFlags[ i ] ) != lutBinary.LookupFile( lookups[ i ], lookupFlags[ i ] ) )
+				{
+					printf( "FAILED: %u files, %s, lookup of file ID %u differs\n", s_aNumFiles[ uSize ], s_aLanguages[ uLang ], lookups[ i ] );
+					bOk = false;
+					break;
+				}
+			}
+		}
+
+		// Sum the results so that the lookups are not optimized away.
+		AkUInt64 uChecksum[ 2 ] = { 0, 0 };
+		AkBenchTimer timer;
+		timer.Start();
+		for ( AkUInt32 i = 0; i < uNumLookups; ++i )
+			uChecksum[ 0 ] += (AkUIntPtr)lutBinary.LookupFile( lookups[ i ], lookupFlags[ i ] );
+		AkReal64 fBinaryMs = timer.Stop();
+
+		timer.Start();
+		for ( AkUInt32 i = 0; i < uNumLookups; ++i )
+			uChecksum[ 1 ] += (AkUIntPtr)lutHashed.LookupFile( lookups[ i ], lookupFlags[ i ] );
+		AkReal64 fHashedMs = timer.Stop();
+		bOk = bOk && uChecksum[ 0 ] == uChecksum[ 1 ];
+
+		char szName[ 64 ];
+		printf( "%u files\n", s_aNumFiles[ uSize ] );
+		snprintf( szName, sizeof( szName ), "  binary search" );
+		AkBenchReport( szName, fBinaryMs, uNumLookups, "lookup" );
+		snprintf( szName, sizeof( szName ), "  hash index" );
+		AkBenchReport( szName, fHashedMs, uNumLookups, "lookup" );
+		AkBenchReportSpeedup( "  speedup", fBinaryMs, fHashedMs );
+	}
+
+	printf( bOk ? "Lookups identical: OK\n" : "Lookups identical: FAILED\n" );
+	return bOk ? 0 : 1;
+}
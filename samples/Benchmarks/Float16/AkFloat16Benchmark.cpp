@@ -0,0 +1,320 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkFloat16Benchmark.cpp
+//
+// Checks the error budget of the half-precision voice buffers (see
+// AkInitSettings::bFloat16VoiceBuffers): a float going through
+// AkFloat16::ConvertFromReal32 and back must come out as the nearest
+// half, which is within 2^-11 of it (relative) in the normal range of
+// halves and within 2^-25 below it. Halves must survive the opposite
+// round trip unchanged. The AVX2/F16C conversions must give the same
+// bits as the default ones, and AkFloat16Buffer must be stored in half
+// as much memory as the float buffer it packs. Then times the
+// conversions.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "stdafx.h"
+#include "AkFloat16Buffer.h"
+#include "AkRuntimeEnvironmentMgr.h"
+#include "AkSettings.h"
+#include <AK/SoundEngine/Common/AkSoundEngine.h>
+#include <math.h>
+
+AkInitSettings g_settings;
+
+namespace
+{
+	const AkUInt32 kNumSamples = 4096;
+
+	typedef void( *ConvertFromReal32Func )( const AkReal32 * AK_RESTRICT, AkUInt16 * AK_RESTRICT, AkUInt32 );
+	typedef void( *ConvertToReal32Func )( const AkUInt16 * AK_RESTRICT, AkReal32 * AK_RESTRICT, AkUInt32 );
+
+	// Value of a half, computed without any of the conversions under test.
+	AkReal64 HalfToReal64( AkUInt16 in_uHalf )
+	{
+		AkInt32 iExponent = ( in_uHalf >> 10 ) & 0x1f;
+		AkInt32 iMantissa = in_uHalf & 0x3ff;
+		AkReal64 fMagnitude;
+		if ( iExponent == 0x1f )
+			fMagnitude = iMantissa ? NAN : INFINITY;
+		else if ( iExponent == 0 )
+			fMagnitude = ldexp( (AkReal64)iMantissa, -24 );
+		else
+			fMagnitude = ldexp( (AkReal64)( iMantissa | 0x400 ), iExponent - 25 );
+		return ( in_uHalf & 0x8000 ) ? -fMagnitude : fMagnitude;
+	}
+
+	// Random floats: mostly audio samples, some anywhere in the range of halves (including subnormals and overflow).
+	AkReal32 RandomSample( AkBenchRandom & io_random )
+	{
+		if ( io_random.Next() & 3 )
+			return io_random.NextSigned();
+		return (AkReal32)ldexp( (AkReal64)io_random.NextSigned(), (AkInt32)( io_random.Next() % 48 ) - 30 );
+	}
+
+	// in_fValue converted to in_uHalf must be the nearest half, ties going to the even one, and within the error budget.
+	bool IsNearestHalf( AkReal32 in_fValue, AkUInt16 in_uHalf )
+	{
+		const AkReal64 fValue = in_fValue;
+		const AkReal64 fHalf = HalfToReal64( in_uHalf );
+		const AkUInt16 uSign = in_fValue < 0.f ? 0x8000 : 0;
+		if ( ( in_uHalf & 0x8000 ) != uSign && in_uHalf != 0 )
+			return false;
+
+		// Beyond the largest half (65504) and half its ulp, the result is infinite.
+		if ( fabs( fValue ) >= 65520.0 )
+			return isinf( fHalf );
+		if ( isinf( fHalf ) || isnan( fHalf ) )
+			return false;
+
+		const AkReal64 fError = fabs( fValue - fHalf );
+		const AkUInt16 uMagnitude = in_uHalf & 0x7fff;
+		if ( uMagnitude > 0 && fError > fabs( fValue - HalfToReal64( in_uHalf - 1 ) ) )
+			return false;
+		if ( uMagnitude < 0x7bff )
+		{
+			AkReal64 fNextError = fabs( fValue - HalfToReal64( in_uHalf + 1 ) );
+			if ( fError > fNextError || ( fError == fNextError && ( in_uHalf & 1 ) ) )
+				return false;
+		}
+
+		return fabs( fValue ) >= ldexp( 1.0, -14 )
+			? fError <= fabs( fValue ) * ldexp( 1.0, -11 )
+			: fError <= ldexp( 1.0, -25 );
+	}
+
+	bool CheckRoundTrips( ConvertFromReal32Func in_pfnFrom, ConvertToReal32Func in_pfnTo, AkUInt32 in_uNumBuffers, AkBenchRandom & io_random )
+	{
+		static AkReal32 AK_ALIGN_SIMD( s_afIn[ kNumSamples ] );
+		static AkReal32 AK_ALIGN_SIMD( s_afOut[ kNumSamples ] );
+		static AkUInt16 AK_ALIGN_SIMD( s_auHalf[ kNumSamples ] );
+
+		AkReal64 fMaxAudioError = 0.0;
+		for ( AkUInt32 uBuffer = 0; uBuffer < in_uNumBuffers; ++uBuffer )
+		{
+			// Odd lengths go through the tail of the conversions.
+			AkUInt32 uNumSamples = ( uBuffer & 1 ) ? kNumSamples - ( io_random.Next() & 7 ) : kNumSamples;
+			for ( AkUInt32 i = 0; i < uNumSamples; ++i )
+				s_afIn[ i ] = RandomSample( io_random );
+
+			in_pfnFrom( s_afIn, s_auHalf, uNumSamples );
+			in_pfnTo( s_auHalf, s_afOut, uNumSamples );
+			for ( AkUInt32 i = 0; i < uNumSamples; ++i )
+			{
+				if ( !IsNearestHalf( s_afIn[ i ], s_auHalf[ i ] ) )
+				{
+					printf( "FAILED: %.9g is converted to half 0x%04x (%.9g)\n", s_afIn[ i ], s_auHalf[ i ], HalfToReal64( s_auHalf[ i ] ) );
+					return false;
+				}
+				AkReal64 fHalf = HalfToReal64( s_auHalf[ i ] );
+				if ( s_afOut[ i ] != (AkReal32)fHalf )
+				{
+					printf( "FAILED: half 0x%04x is converted to %.9g instead of %.9g\n", s_auHalf[ i ], s_afOut[ i ], fHalf );
+					return false;
+				}
+				if ( fabsf( s_afIn[ i ] ) <= 1.f )
+					fMaxAudioError = AkMax( fMaxAudioError, fabs( s_afIn[ i ] - fHalf ) );
+			}
+		}
+
+		// Every half, in both directions.
+		for ( AkUInt32 uFirst = 0; uFirst < 0x10000; uFirst += kNumSamples )
+		{
+			for ( AkUInt32 i = 0; i < kNumSamples; ++i )
+				s_auHalf[ i ] = (AkUInt16)( uFirst + i );
+			in_pfnTo( s_auHalf, s_afOut, kNumSamples );
+			static AkUInt16 AK_ALIGN_SIMD( s_auBack[ kNumSamples ] );
+			in_pfnFrom( s_afOut, s_auBack, kNumSamples );
+			for ( AkUInt32 i = 0; i < kNumSamples; ++i )
+			{
+				bool bNaN = ( s_auHalf[ i ] & 0x7c00 ) == 0x7c00 && ( s_auHalf[ i ] & 0x3ff );
+				bool bSame = bNaN ? ( s_auBack[ i ] & 0x7c00 ) == 0x7c00 && ( s_auBack[ i ] & 0x3ff ) : s_auBack[ i ] == s_auHalf[ i ];
+				if ( !bSame )
+				{
+					printf( "FAILED: half 0x%04x comes back as 0x%04x\n", s_auHalf[ i ], s_auBack[ i ] );
+					return false;
+				}
+			}
+		}
+
+		printf( "Largest round trip error on audio samples: %g (%.1f bits)\n", fMaxAudioError, -log2( fMaxAudioError ) );
+		return true;
+	}
+
+#if defined( AKSIMD_AVX2_SUPPORTED )
+	bool CheckAVX2( AkUInt32 in_uNumBuffers, AkBenchRandom & io_random )
+	{
+		static AkReal32 AK_ALIGN_SIMD( s_afIn[ kNumSamples ] );
+		static AkUInt16 AK_ALIGN_SIMD( s_auRef[ kNumSamples ] );
+		static AkUInt16 AK_ALIGN_SIMD( s_auAVX2[ kNumSamples ] );
+		static AkReal32 AK_ALIGN_SIMD( s_afRef[ kNumSamples ] );
+		static AkReal32 AK_ALIGN_SIMD( s_afAVX2[ kNumSamples ] );
+		for ( AkUInt32 uBuffer = 0; uBuffer < in_uNumBuffers; ++uBuffer )
+		{
+			AkUInt32 uNumSamples = ( uBuffer & 1 ) ? kNumSamples - ( io_random.Next() & 7 ) : kNumSamples;
+			for ( AkUInt32 i = 0; i < uNumSamples; ++i )
+				s_afIn[ i ] = RandomSample( io_random );
+
+			AkFloat16::ConvertFromReal32( s_afIn, s_auRef, uNumSamples );
+			ConvertFromReal32ToFloat16_AVX2( s_afIn, s_auAVX2, uNumSamples );
+			AkFloat16::ConvertToReal32( s_auRef, s_afRef, uNumSamples );
+			ConvertFromFloat16ToReal32_AVX2( s_auRef, s_afAVX2, uNumSamples );
+			if ( memcmp( s_auRef, s_auAVX2, uNumSamples * sizeof( AkUInt16 ) ) != 0
+				|| memcmp( s_afRef, s_afAVX2, uNumSamples * sizeof( AkReal32 ) ) != 0 )
+			{
+				printf( "FAILED: the AVX2/F16C conversions differ\n" );
+				return false;
+			}
+		}
+		return true;
+	}
+#endif
+
+	// Packed buffers take half the memory of the float buffers, and unpack to what the conversions give.
+	bool CheckPackedBuffers( AkBenchRandom & io_random )
+	{
+		const AkUInt16 uNumFrames = (AkUInt16)AkAudioLibSettings::g_uNumSamplesPerFrame;
+		for ( AkUInt32 uNumChannels = 1; uNumChannels <= 8; ++uNumChannels )
+		{
+			AkChannelConfig channelConfig;
+			channelConfig.SetAnonymous( uNumChannels );
+
+			AkPipelineBufferBase storage;
+			storage.SetChannelConfig( channelConfig );
+			storage.SetRequestSize( uNumFrames );
+			if ( storage.GetCachedHalfBuffer() != AK_Success )
+				return false;
+			AkUInt16 uHalfFrames = storage.MaxFrames();
+			storage.ReleaseCachedHalfBuffer();
+			if ( uHalfFrames * 2 != uNumFrames )
+			{
+				printf( "FAILED: %u channels of %u half-precision frames are stored in %u float frames\n", uNumChannels, uNumFrames, uHalfFrames );
+				return false;
+			}
+
+			AkPipelineBufferBase in, out;
+			in.SetChannelConfig( channelConfig );
+			in.SetRequestSize( uNumFrames );
+			out.SetChannelConfig( channelConfig );
+			out.SetRequestSize( uNumFrames );
+			if ( in.GetCachedBuffer() != AK_Success || out.GetCachedBuffer() != AK_Success )
+				return false;
+			in.uValidFrames = (AkUInt16)( uNumFrames - ( io_random.Next() % 16 ) );
+			for ( AkUInt32 uChannel = 0; uChannel < uNumChannels; ++uChannel )
+			{
+				for ( AkUInt32 i = 0; i < in.uValidFrames; ++i )
+					in.GetChannel( uChannel )[ i ] = io_random.NextSigned();
+			}
+
+			AkFloat16Buffer packed;
+			if ( packed.Pack( in ) != AK_Success )
+				return false;
+			packed.Unpack( out );
+			packed.ReleaseBuffer();
+
+			bool bOk = out.uValidFrames == in.uValidFrames;
+			for ( AkUInt32 uChannel = 0; bOk && uChannel < uNumChannels; ++uChannel )
+			{
+				for ( AkUInt32 i = 0; bOk && i < in.uValidFrames; ++i )
+				{
+					AkUInt16 uHalf;
+					AkReal32 fExpected;
+					AkFloat16::ConvertFromReal32( in.GetChannel( uChannel ) + i, &uHalf, 1 );
+					AkFloat16::ConvertToReal32( &uHalf, &fExpected, 1 );
+					bOk = out.GetChannel( uChannel )[ i ] == fExpected;
+				}
+			}
+			in.ReleaseCachedBuffer();
+			out.ReleaseCachedBuffer();
+			if ( !bOk )
+			{
+				printf( "FAILED: %u channel buffer does not unpack to its converted samples\n", uNumChannels );
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void Time( const char * in_szName, ConvertFromReal32Func in_pfnFrom, ConvertToReal32Func in_pfnTo, AkUInt32 in_uNumBuffers, AkReal64 * out_pMs )
+	{
+		static AkReal32 AK_ALIGN_SIMD( s_afBuffer[ kNumSamples ] );
+		static AkUInt16 AK_ALIGN_SIMD( s_auHalf[ kNumSamples ] );
+		AkBenchRandom random;
+		for ( AkUInt32 i = 0; i < kNumSamples; ++i )
+			s_afBuffer[ i ] = random.NextSigned();
+
+		const AkUInt64 uNumSamples = (AkUInt64)in_uNumBuffers * kNumSamples;
+		char szName[ 64 ];
+		AkBenchTimer timer;
+		timer.Start();
+		for ( AkUInt32 uBuffer = 0; uBuffer < in_uNumBuffers; ++uBuffer )
+			in_pfnFrom( s_afBuffer, s_auHalf, kNumSamples );
+		out_pMs[ 0 ] = timer.Stop();
+		snprintf( szName, sizeof( szName ), "%s to half", in_szName );
+		AkBenchReport( szName, out_pMs[ 0 ], uNumSamples, "sample" );
+
+		timer.Start();
+		for ( AkUInt32 uBuffer = 0; uBuffer < in_uNumBuffers; ++uBuffer )
+			in_pfnTo( s_auHalf, s_afBuffer, kNumSamples );
+		out_pMs[ 1 ] = timer.Stop();
+		snprintf( szName, sizeof( szName ), "%s from half", in_szName );
+		AkBenchReport( szName, out_pMs[ 1 ], uNumSamples, "sample" );
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 uNumBuffers = bCheckOnly ? 200 : 20000;
+
+	// Until InitConversionFunctTable() is called, AkFloat16 uses the default (4-wide) conversions.
+	AkPipelineBufferBase::InitFreeListBuckets();
+	AkBenchRandom random;
+	bool bOk = CheckRoundTrips( AkFloat16::ConvertFromReal32, AkFloat16::ConvertToReal32, uNumBuffers, random )
+		&& CheckPackedBuffers( random );
+
+	AkReal64 afMs[ 2 ];
+	if ( bOk )
+		Time( "V4F32", AkFloat16::ConvertFromReal32, AkFloat16::ConvertToReal32, uNumBuffers, afMs );
+
+#if defined( AKSIMD_AVX2_SUPPORTED )
+	if ( bOk
+		&& AK::AkRuntimeEnvironmentMgr::Instance()->GetSIMDSupport( AK::AK_SIMD_AVX2 )
+		&& AK::AkRuntimeEnvironmentMgr::Instance()->GetSIMDSupport( AK::AK_SIMD_F16C ) )
+	{
+		bOk = CheckAVX2( uNumBuffers, random );
+		if ( bOk )
+		{
+			AkReal64 afAVX2Ms[ 2 ];
+			Time( "AVX2", ConvertFromReal32ToFloat16_AVX2, ConvertFromFloat16ToReal32_AVX2, uNumBuffers, afAVX2Ms );
+			AkBenchReportSpeedup( "AVX2 speedup to half", afMs[ 0 ], afAVX2Ms[ 0 ] );
+			AkBenchReportSpeedup( "AVX2 speedup from half", afMs[ 1 ], afAVX2Ms[ 1 ] );
+		}
+	}
+	else if ( bOk )
+	{
+		printf( "AVX2 or F16C is not supported by this processor: AVX2 conversions not checked.\n" );
+	}
+#endif
+
+	AkPipelineBufferBase::ClearFreeListBuckets();
+
+	printf( bOk ? "Float16 error budget: OK\n" : "Float16 error budget: FAILED\n" );
+	return bOk ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkFloat16PipelineBenchmark.cpp
+//
+// Checks the output of the sound engine with half-precision voice
+// buffers (see AkInitSettings::bFloat16VoiceBuffers) against the same
+// frames rendered in single precision. Car engines play at different
+// RPMs on several game objects, with the serial task scheduler of the
+// samples, so that the voices run in tasks and hand their output to the
+// busses in half. Each voice sample is rounded once, within 2^-11 of
+// itself: with voices and gains within [-1, 1], an output sample may be
+// off by at most 2^-11 per voice. Then times the frames of both.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "AkBenchEngine.h"
+#include "Wwise_IDs.h"
+#include "../../TaskScheduler/AkTaskScheduler_dummy.h"
+#include <math.h>
+
+namespace
+{
+	const AkGameObjectID kListenerID = 1;
+	const AkGameObjectID kFirstCarID = 100;
+	const AkUInt32 kNumCars = 8;
+	const AkUInt32 kMaxVoicesPerCar = 3;	// Layers of the Engine blend container.
+
+	// Renders in_uNumFrames frames of the cars into out_pSamples (interleaved output) and returns their time in ms,
+	// or a negative value on failure. out_uNumSamples is the number of samples captured.
+	AkReal64 RenderCars( bool in_bFloat16, AkUInt32 in_uNumFrames, AkReal32 * out_pSamples, AkUInt32 in_uMaxSamples, AkUInt32 & out_uNumSamples )
+	{
+		AkInitSettings initSettings;
+		AkPlatformInitSettings platformSettings;
+		AkBenchEngineGetDefaultSettings( initSettings, platformSettings );
+		AkTaskScheduler::InitDesc( initSettings.taskSchedulerDesc );
+		initSettings.bFloat16VoiceBuffers = in_bFloat16;
+
+		AkBankID bankID;
+		bool bOk = AkBenchEngineInit( initSettings, platformSettings );
+		if ( bOk && AK::SoundEngine::LoadBank( "Car.bnk", bankID ) != AK_Success )
+		{
+			printf( "Car.bnk: LoadBank() failed\n" );
+			bOk = false;
+		}
+
+		// Without a listener, the cars are inaudible.
+		if ( bOk && ( AK::SoundEngine::RegisterGameObj( kListenerID ) != AK_Success
+			|| AK::SoundEngine::SetDefaultListeners( &kListenerID, 1 ) != AK_Success ) )
+		{
+			printf( "Could not register the listener\n" );
+			bOk = false;
+		}
+
+		for ( AkUInt32 i = 0; bOk && i < kNumCars; ++i )
+		{
+			AkGameObjectID carID = kFirstCarID + i;
+			if ( AK::SoundEngine::RegisterGameObj( carID ) != AK_Success
+				|| AK::SoundEngine::SetRTPCValue( AK::GAME_PARAMETERS::RPM, (AkRtpcValue)( 1000 + i * 1000 ), carID ) != AK_Success
+				|| AK::SoundEngine::PostEvent( AK::EVENTS::PLAY_ENGINE, carID ) == AK_INVALID_PLAYING_ID )
+			{
+				printf( "Could not start car %u\n", i );
+				bOk = false;
+			}
+		}
+
+		AkReal64 fMs = 0.0;
+		if ( bOk )
+		{
+			AkBenchEngineCaptureOutput( out_pSamples, in_uMaxSamples );
+			AkBenchTimer timer;
+			for ( AkUInt32 uFrame = 0; uFrame < in_uNumFrames; ++uFrame )
+			{
+				timer.Start();
+				AkBenchEngineRenderFrame();
+				fMs += timer.Stop();
+			}
+			out_uNumSamples = AkBenchEngineCaptureOutput( NULL, 0 );
+		}
+
+		AkBenchEngineTerm();
+		return bOk ? fMs : -1.0;
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 uNumFrames = bCheckOnly ? 64 : 1024;
+	const AkUInt32 uMaxSamples = uNumFrames * 1024 * 8;
+
+	AkReal32 * pFloatSamples = (AkReal32 *)malloc( uMaxSamples * sizeof( AkReal32 ) );
+	AkReal32 * pHalfSamples = (AkReal32 *)malloc( uMaxSamples * sizeof( AkReal32 ) );
+	AkUInt32 uNumFloatSamples = 0;
+	AkUInt32 uNumHalfSamples = 0;
+	AkReal64 fFloatMs = RenderCars( false, uNumFrames, pFloatSamples, uMaxSamples, uNumFloatSamples );
+	AkReal64 fHalfMs = fFloatMs >= 0.0 ? RenderCars( true, uNumFrames, pHalfSamples, uMaxSamples, uNumHalfSamples ) : -1.0;
+
+	bool bOk = fFloatMs >= 0.0 && fHalfMs >= 0.0;
+	if ( bOk && ( uNumFloatSamples != uNumHalfSamples || uNumFloatSamples == 0 ) )
+	{
+		printf( "FAILED: %u samples captured in single precision, %u in half precision\n", uNumFloatSamples, uNumHalfSamples );
+		bOk = false;
+	}
+
+	if ( bOk )
+	{
+		const AkReal64 fBudget = kNumCars * kMaxVoicesPerCar * ldexp( 1.0, -11 );
+		AkReal64 fMaxError = 0.0;
+		AkReal64 fSignalEnergy = 0.0;
+		AkReal64 fErrorEnergy = 0.0;
+		for ( AkUInt32 i = 0; i < uNumFloatSamples; ++i )
+		{
+			AkReal64 fError = fabs( (AkReal64)pHalfSamples[ i ] - pFloatSamples[ i ] );
+			fMaxError = AkMax( fMaxError, fError );
+			fSignalEnergy += (AkReal64)pFloatSamples[ i ] * pFloatSamples[ i ];
+			fErrorEnergy += fError * fError;
+		}
+		printf( "Largest output error: %g (budget %g), error level %.1f dB below the output\n",
+			fMaxError, fBudget, 10.0 * log10( fSignalEnergy / AkMax( fErrorEnergy, 1e-30 ) ) );
+		if ( fSignalEnergy == 0.0 )
+		{
+			printf( "FAILED: the output is silent\n" );
+			bOk = false;
+		}
+		else if ( fMaxError > fBudget )
+		{
+			printf( "FAILED: the half-precision output is out of the error budget\n" );
+			bOk = false;
+		}
+	}
+
+	if ( bOk )
+	{
+		AkBenchReport( "RenderAudio, single precision", fFloatMs, uNumFrames, "frame" );
+		AkBenchReport( "RenderAudio, half precision", fHalfMs, uNumFrames, "frame" );
+		AkBenchReportSpeedup( "Half precision speedup", fFloatMs, fHalfMs );
+	}
+
+	free( pFloatSamples );
+	free( pHalfSamples );
+
+	printf( bOk ? "Float16 pipeline error budget: OK\n" : "Float16 pipeline error budget: FAILED\n" );
+	return bOk ? 0 : 1;
+}
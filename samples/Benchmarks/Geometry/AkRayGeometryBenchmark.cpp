@@ -0,0 +1,211 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkRayGeometryBenchmark.cpp
+//
+// Compares the batched distance and angles of emitter-listener rays
+// (CAkListener::ComputeRaysDistanceAndAngles, used by
+// CAkRegistryMgr::UpdateGameObjectPositions) with one call to
+// CAkListener::ComputeRayDistanceAndAngles per ray. Emitters with
+// random positions, orientations and scaling factors each have a ray
+// to two listeners. The check is that both give the same distances and
+// angles, bit for bit. Then times both for 16 to 16384 emitters, with
+// the rays of each emitter queued contiguously, like the engine does.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "AkBenchEngine.h"
+
+#include "Ak3DListener.h"
+#include <math.h>
+
+namespace
+{
+	const AkUInt32 kNumListeners = 2;
+	const AkGameObjectID kFirstListenerID = 10;
+	const AkUInt32 kMaxEmitters = 16384;
+	const AkUInt32 kMaxRays = kMaxEmitters * kNumListeners;
+
+	struct Emitter
+	{
+		AkTransform transform;
+		AkReal32 fScalingFactor;
+	};
+
+	AkTransform RandomTransform( AkBenchRandom & io_random, AkReal32 in_fRange )
+	{
+		// Unit orientation vectors, orthogonal like the game sets them.
+		AkReal32 fYaw = io_random.NextSigned() * PI;
+		AkTransform transform;
+		transform.Set(
+			io_random.NextSigned() * in_fRange, io_random.NextSigned() * in_fRange * 0.1f, io_random.NextSigned() * in_fRange,
+			sinf( fYaw ), 0.f, cosf( fYaw ),
+			0.f, 1.f, 0.f );
+		return transform;
+	}
+
+	bool InitListeners( AkBenchRandom & io_random, const CAkListener ** out_ppListeners )
+	{
+		AkGameObjectID aListenerIDs[ kNumListeners ];
+		for ( AkUInt32 i = 0; i < kNumListeners; ++i )
+		{
+			aListenerIDs[ i ] = kFirstListenerID + i;
+			if ( AK::SoundEngine::RegisterGameObj( aListenerIDs[ i ] ) != AK_Success )
+				return false;
+			AK::SoundEngine::SetPosition( aListenerIDs[ i ], RandomTransform( io_random, 10.f ) );
+			AK::SoundEngine::SetScalingFactor( aListenerIDs[ i ], 1.f + (AkReal32)i );
+		}
+		AK::SoundEngine::SetDefaultListeners( aListenerIDs, kNumListeners );
+
+		// The calls above are queued.
+		AkBenchEngineRenderFrame();
+		for ( AkUInt32 i = 0; i < kNumListeners; ++i )
+		{
+			out_ppListeners[ i ] = CAkListener::GetListenerData( aListenerIDs[ i ] );
+			if ( !out_ppListeners[ i ] )
+				return false;
+		}
+		return true;
+	}
+
+	// Builds the rays of in_uNumEmitters emitters, in the order of CAkEmitter::BuildVolumeRaysHelper: all listeners of an emitter in a row.
+	void InitRays( const Emitter * in_pEmitters, AkUInt32 in_uNumEmitters, const CAkListener * const * in_ppListeners, AkRayVolumeData * out_pRays, AkPendingRay * out_pPending )
+	{
+		AkGameRayParams rayParams;
+		rayParams.obstruction = 0.f;
+		rayParams.occlusion = 0.f;
+		rayParams.spread = 0.f;
+		rayParams.focus = 0.f;
+
+		AkUInt32 uRay = 0;
+		for ( AkUInt32 e = 0; e < in_uNumEmitters; ++e )
+		{
+			for ( AkUInt32 l = 0; l < kNumListeners; ++l, ++uRay )
+			{
+				out_pRays[ uRay ].UpdateRay( in_pEmitters[ e ].transform, rayParams, in_ppListeners[ l ]->ID(), 0 );
+				out_pPending[ uRay ].pRay = &out_pRays[ uRay ];
+				out_pPending[ uRay ].pListener = in_ppListeners[ l ];
+				out_pPending[ uRay ].pEmitter = NULL;
+				out_pPending[ uRay ].fEmitterScalingFactor = in_pEmitters[ e ].fScalingFactor;
+				out_pPending[ uRay ].bDirectOutputListener = true;
+			}
+		}
+	}
+
+	void ComputePerRay( const AkPendingRay * in_pPending, AkUInt32 in_uNumRays )
+	{
+		for ( AkUInt32 i = 0; i < in_uNumRays; ++i )
+			in_pPending[ i ].pListener->ComputeRayDistanceAndAngles( in_pPending[ i ].fEmitterScalingFactor, *in_pPending[ i ].pRay );
+	}
+
+	bool SameRays( const AkRayVolumeData * in_pRays, const AkRayVolumeData * in_pRefRays, AkUInt32 in_uNumRays )
+	{
+		for ( AkUInt32 i = 0; i < in_uNumRays; ++i )
+		{
+			const AkReal32 afRay[] = { in_pRays[ i ].Distance(), in_pRays[ i ].EmitterAngle(), in_pRays[ i ].ListenerAngle(), in_pRays[ i ].scalingFactor };
+			const AkReal32 afRef[] = { in_pRefRays[ i ].Distance(), in_pRefRays[ i ].EmitterAngle(), in_pRefRays[ i ].ListenerAngle(), in_pRefRays[ i ].scalingFactor };
+			if ( memcmp( afRay, afRef, sizeof( afRay ) ) != 0 )
+			{
+				printf( "FAILED: ray %u: distance %g, angles %g %g, scaling %g instead of %g, %g %g, %g\n", i,
+					afRay[ 0 ], afRay[ 1 ], afRay[ 2 ], afRay[ 3 ], afRef[ 0 ], afRef[ 1 ], afRef[ 2 ], afRef[ 3 ] );
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 aNumEmitters[] = { 16, 256, 4096, kMaxEmitters };
+	const AkUInt64 uRaysPerSize = bCheckOnly ? 200000 : 20000000;
+
+	AkInitSettings initSettings;
+	AkPlatformInitSettings platformSettings;
+	AkBenchEngineGetDefaultSettings( initSettings, platformSettings );
+	bool bOk = AkBenchEngineInit( initSettings, platformSettings );
+
+	AkBenchRandom random;
+	const CAkListener * apListeners[ kNumListeners ];
+	if ( bOk && !InitListeners( random, apListeners ) )
+	{
+		printf( "FAILED: could not set up the listeners\n" );
+		bOk = false;
+	}
+
+	Emitter * pEmitters = (Emitter *)malloc( kMaxEmitters * sizeof( Emitter ) );
+	AkRayVolumeData * pRays = new AkRayVolumeData[ kMaxRays ];
+	AkRayVolumeData * pRefRays = new AkRayVolumeData[ kMaxRays ];
+	AkPendingRay * pPending = (AkPendingRay *)malloc( kMaxRays * sizeof( AkPendingRay ) );
+	AkPendingRay * pRefPending = (AkPendingRay *)malloc( kMaxRays * sizeof( AkPendingRay ) );
+
+	if ( bOk )
+	{
+		for ( AkUInt32 e = 0; e < kMaxEmitters; ++e )
+		{
+			pEmitters[ e ].transform = RandomTransform( random, 100.f );
+			pEmitters[ e ].fScalingFactor = 0.5f + random.Next() % 4;
+		}
+		// An emitter on a listener: distance 0, angles 0.
+		pEmitters[ 3 ].transform = apListeners[ 0 ]->GetTransform();
+	}
+
+	for ( AkUInt32 i = 0; bOk && i < sizeof( aNumEmitters ) / sizeof( aNumEmitters[ 0 ] ); ++i )
+	{
+		const AkUInt32 uNumEmitters = aNumEmitters[ i ];
+		const AkUInt32 uNumRays = uNumEmitters * kNumListeners;
+		InitRays( pEmitters, uNumEmitters, apListeners, pRays, pPending );
+		InitRays( pEmitters, uNumEmitters, apListeners, pRefRays, pRefPending );
+
+		CAkListener::ComputeRaysDistanceAndAngles( pPending, uNumRays );
+		ComputePerRay( pRefPending, uNumRays );
+		bOk = SameRays( pRays, pRefRays, uNumRays );
+		if ( !bOk )
+			break;
+
+		const AkUInt32 uNumPasses = (AkUInt32)AkMax( (AkUInt64)1, uRaysPerSize / uNumRays );
+		AkBenchTimer timer;
+		timer.Start();
+		for ( AkUInt32 uPass = 0; uPass < uNumPasses; ++uPass )
+			ComputePerRay( pRefPending, uNumRays );
+		AkReal64 fPerRayMs = timer.Stop();
+
+		timer.Start();
+		for ( AkUInt32 uPass = 0; uPass < uNumPasses; ++uPass )
+			CAkListener::ComputeRaysDistanceAndAngles( pPending, uNumRays );
+		AkReal64 fBatchedMs = timer.Stop();
+
+		char szName[ 64 ];
+		snprintf( szName, sizeof( szName ), "%u emitters, one ray at a time", uNumEmitters );
+		AkBenchReport( szName, fPerRayMs, (AkUInt64)uNumPasses * uNumRays, "ray" );
+		snprintf( szName, sizeof( szName ), "%u emitters, batched", uNumEmitters );
+		AkBenchReport( szName, fBatchedMs, (AkUInt64)uNumPasses * uNumRays, "ray" );
+		AkBenchReportSpeedup( "Speedup", fPerRayMs, fBatchedMs );
+	}
+
+	free( pRefPending );
+	free( pPending );
+	delete[] pRefRays;
+	delete[] pRays;
+	free( pEmitters );
+
+	AkBenchEngineTerm();
+
+	printf( bOk ? "Batched ray geometry matches: OK\n" : "Batched ray geometry matches: FAILED\n" );
+	return bOk ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkLpHpCascadeBenchmark.cpp
+//
+// Compares CAkSrcLpHpFilter::Execute on voices with both the LPF and
+// the HPF active, which runs them in a single block-wise pass, with the
+// two passes over the buffer of a voice with only the LPF followed by a
+// voice with only the HPF. Both filters see the same parameters, so the
+// outputs must match bit for bit. Then times both on mono, stereo and
+// 7.1 voices with steady filters.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "stdafx.h"
+#include "AkSrcLpFilter.h"
+#include <math.h>
+
+namespace
+{
+	const AkUInt16 kNumFrames = 1024;
+	const AkUInt32 kMaxChannels = 8;
+	const AkUInt32 kNumVoices = 16;
+
+	struct Voice
+	{
+		CAkSrcLpHpFilter cascade;	// LPF and HPF.
+		CAkSrcLpHpFilter lpf;		// LPF only.
+		CAkSrcLpHpFilter hpf;		// HPF only.
+		AkReal32 AK_ALIGN_SIMD( afCascade[ kMaxChannels * kNumFrames ] );
+		AkReal32 AK_ALIGN_SIMD( afTwoPasses[ kMaxChannels * kNumFrames ] );
+		AkAudioBuffer cascadeBuffer;
+		AkAudioBuffer twoPassesBuffer;
+	};
+
+	Voice s_aVoices[ kNumVoices ];
+
+	bool InitVoices( AkChannelConfig in_channelConfig )
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+		{
+			if ( s_aVoices[ v ].cascade.Init( in_channelConfig ) != AK_Success
+				|| s_aVoices[ v ].lpf.Init( in_channelConfig ) != AK_Success
+				|| s_aVoices[ v ].hpf.Init( in_channelConfig ) != AK_Success )
+				return false;
+		}
+		return true;
+	}
+
+	void TermVoices()
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+		{
+			s_aVoices[ v ].cascade.Term();
+			s_aVoices[ v ].lpf.Term();
+			s_aVoices[ v ].hpf.Term();
+		}
+	}
+
+	void SetFilterPars( AkUInt32 in_uVoice, AkReal32 in_fLPFPar, AkReal32 in_fHPFPar )
+	{
+		Voice & voice = s_aVoices[ in_uVoice ];
+		voice.cascade.SetLPFPar( in_fLPFPar );
+		voice.cascade.SetHPFPar( in_fHPFPar );
+		voice.lpf.SetLPFPar( in_fLPFPar );
+		voice.lpf.SetHPFPar( 0.f );
+		voice.hpf.SetLPFPar( 0.f );
+		voice.hpf.SetHPFPar( in_fHPFPar );
+	}
+
+	// Fills the buffers of both paths with the same input for one audio frame.
+	void FillInput( AkChannelConfig in_channelConfig, AkUInt16 in_uValidFrames, AkBenchRandom & io_random )
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+		{
+			Voice & voice = s_aVoices[ v ];
+			for ( AkUInt32 i = 0; i < in_channelConfig.uNumChannels * kNumFrames; ++i )
+				voice.afCascade[ i ] = voice.afTwoPasses[ i ] = io_random.NextSigned();
+			voice.cascadeBuffer.AttachContiguousDeinterleavedData( voice.afCascade, kNumFrames, in_uValidFrames, in_channelConfig );
+			voice.twoPassesBuffer.AttachContiguousDeinterleavedData( voice.afTwoPasses, kNumFrames, in_uValidFrames, in_channelConfig );
+		}
+	}
+
+	void RunCascade()
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+		{
+			s_aVoices[ v ].cascade.CheckBypass();
+			s_aVoices[ v ].cascade.Execute( &s_aVoices[ v ].cascadeBuffer );
+		}
+	}
+
+	void RunTwoPasses()
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+		{
+			s_aVoices[ v ].lpf.CheckBypass();
+			s_aVoices[ v ].lpf.Execute( &s_aVoices[ v ].twoPassesBuffer );
+			s_aVoices[ v ].hpf.CheckBypass();
+			s_aVoices[ v ].hpf.Execute( &s_aVoices[ v ].twoPassesBuffer );
+		}
+	}
+
+	bool SameOutput( AkChannelConfig in_channelConfig, AkUInt16 in_uValidFrames, AkUInt32 in_uFrame )
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+		{
+			for ( AkUInt32 c = 0; c < in_channelConfig.uNumChannels; ++c )
+			{
+				const AkReal32 * pCascade = s_aVoices[ v ].cascadeBuffer.GetChannel( c );
+				const AkReal32 * pTwoPasses = s_aVoices[ v ].twoPassesBuffer.GetChannel( c );
+				if ( memcmp( pCascade, pTwoPasses, in_uValidFrames * sizeof( AkReal32 ) ) != 0 )
+				{
+					printf( "FAILED: voice %u, channel %u differs at audio frame %u\n", v, c, in_uFrame );
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	// Active filters whose settings change every few audio frames (so that they interpolate), and buffer lengths which
+	// are sometimes not a multiple of the coefficient update period.
+	bool Check( AkChannelConfig in_channelConfig, AkUInt32 in_uNumAudioFrames, AkBenchRandom & io_random )
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+			SetFilterPars( v, 5.f + (AkReal32)( io_random.Next() % 85 ), 5.f + (AkReal32)( io_random.Next() % 85 ) );
+
+		for ( AkUInt32 uFrame = 0; uFrame < in_uNumAudioFrames; ++uFrame )
+		{
+			if ( ( uFrame & 7 ) == 7 )
+				SetFilterPars( io_random.Next() % kNumVoices, 5.f + (AkReal32)( io_random.Next() % 85 ), 5.f + (AkReal32)( io_random.Next() % 85 ) );
+
+			AkUInt16 uValidFrames = ( io_random.Next() & 15 ) == 0 ? (AkUInt16)( 2 + io_random.Next() % ( kNumFrames - 1 ) ) : kNumFrames;
+			FillInput( in_channelConfig, uValidFrames, io_random );
+			RunCascade();
+			RunTwoPasses();
+			if ( !SameOutput( in_channelConfig, uValidFrames, uFrame ) )
+				return false;
+		}
+		return true;
+	}
+
+	void Time( const char * in_szConfig, AkChannelConfig in_channelConfig, AkUInt32 in_uNumAudioFrames, AkBenchRandom & io_random )
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+			SetFilterPars( v, 5.f + (AkReal32)( io_random.Next() % 85 ), 5.f + (AkReal32)( io_random.Next() % 85 ) );
+		FillInput( in_channelConfig, kNumFrames, io_random );
+		RunCascade();
+		RunTwoPasses();
+
+		// Filtered in place: the buffers keep being filtered, which does not change the cost.
+		const AkUInt64 uNumSamples = (AkUInt64)in_uNumAudioFrames * kNumVoices * kNumFrames * in_channelConfig.uNumChannels;
+		AkBenchTimer timer;
+		timer.Start();
+		for ( AkUInt32 uFrame = 0; uFrame < in_uNumAudioFrames; ++uFrame )
+			RunTwoPasses();
+		AkReal64 fTwoPassesMs = timer.Stop();
+
+		timer.Start();
+		for ( AkUInt32 uFrame = 0; uFrame < in_uNumAudioFrames; ++uFrame )
+			RunCascade();
+		AkReal64 fCascadeMs = timer.Stop();
+
+		char szName[ 64 ];
+		snprintf( szName, sizeof( szName ), "%s, LPF pass + HPF pass", in_szConfig );
+		AkBenchReport( szName, fTwoPassesMs, uNumSamples, "sample" );
+		snprintf( szName, sizeof( szName ), "%s, single pass", in_szConfig );
+		AkBenchReport( szName, fCascadeMs, uNumSamples, "sample" );
+		AkBenchReportSpeedup( "Speedup", fTwoPassesMs, fCascadeMs );
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+
+#if defined AK_CPU_X86 || defined AK_CPU_X86_64
+	// Like the voice tasks of the lower engine.
+	_MM_SET_FLUSH_ZERO_MODE( _MM_FLUSH_ZERO_ON );
+#endif
+
+	struct Config
+	{
+		const char * szName;
+		AkChannelMask uChannelMask;
+	};
+	const Config aConfigs[] =
+	{
+		{ "Mono", AK_SPEAKER_SETUP_MONO },
+		{ "Stereo", AK_SPEAKER_SETUP_STEREO },
+		{ "7.1", AK_SPEAKER_SETUP_7POINT1 },
+	};
+
+	AkBenchRandom random;
+	bool bOk = true;
+	for ( AkUInt32 i = 0; bOk && i < sizeof( aConfigs ) / sizeof( aConfigs[ 0 ] ); ++i )
+	{
+		AkChannelConfig channelConfig;
+		channelConfig.SetStandard( aConfigs[ i ].uChannelMask );
+		if ( !InitVoices( channelConfig ) )
+		{
+			printf( "FAILED: could not initialize the filters\n" );
+			bOk = false;
+		}
+		else
+		{
+			bOk = Check( channelConfig, bCheckOnly ? 100 : 1000, random );
+			if ( bOk )
+				Time( aConfigs[ i ].szName, channelConfig, bCheckOnly ? 50 : 2000, random );
+		}
+		TermVoices();
+	}
+
+	printf( bOk ? "Single pass LPF + HPF output matches: OK\n" : "Single pass LPF + HPF output matches: FAILED\n" );
+	return bOk ? 0 : 1;
+}
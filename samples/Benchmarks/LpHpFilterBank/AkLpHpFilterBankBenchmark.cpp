@@ -0,0 +1,262 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkLpHpFilterBankBenchmark.cpp
+//
+// Compares the voice filters run kMonoBankWidth mono voices at a time
+// by CAkSrcLpHpFilter::ExecuteMonoBank, the way the lower engine groups
+// them, with CAkSrcLpHpFilter::Execute run on each voice. The bank
+// evaluates the biquads in another order, so outputs must match within
+// float rounding rather than bit for bit. Then times both on voices with
+// steady filters.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "stdafx.h"
+#include "AkSrcLpFilter.h"
+#include <math.h>
+
+namespace
+{
+	const AkUInt16 kNumFrames = 1024;
+	const AkUInt32 kNumVoices = 64;
+
+	// Largest difference allowed between the two paths, relative to the recent peak of the reference output (see
+	// SameOutput). The poles of filters with a cutoff of a few tens of Hz are so close to the unit circle that single
+	// precision rounding grows to about 1e-3 of the signal in either path, and takes several buffers to fade out after
+	// the transients caused by parameter changes. A lane mixed up with another voice or a lost filter memory is way above.
+	const AkReal32 kMaxRelativeError = 1e-2f;
+
+	struct Voice
+	{
+		CAkSrcLpHpFilter filter;
+		AkReal32 AK_ALIGN_SIMD( afBuffer[ kNumFrames ] );
+		AkReal32 AK_ALIGN_SIMD( afInput[ kNumFrames ] );
+		AkAudioBuffer buffer;
+		AkReal32 fPeak;
+	};
+
+	Voice s_aRef[ kNumVoices ];
+	Voice s_aBank[ kNumVoices ];
+
+	// A quarter of the filters are bypassed.
+	AkReal32 RandomFilterPar( AkBenchRandom & io_random )
+	{
+		return ( io_random.Next() & 3 ) == 0 ? 0.f : 5.f + (AkReal32)( io_random.Next() % 85 );
+	}
+
+	bool InitVoices()
+	{
+		AkChannelConfig channelConfig;
+		channelConfig.SetStandard( AK_SPEAKER_SETUP_MONO );
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+		{
+			s_aRef[ v ].fPeak = 0.f;
+			if ( s_aRef[ v ].filter.Init( channelConfig ) != AK_Success
+				|| s_aBank[ v ].filter.Init( channelConfig ) != AK_Success )
+				return false;
+		}
+		return true;
+	}
+
+	void TermVoices()
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+		{
+			s_aRef[ v ].filter.Term();
+			s_aBank[ v ].filter.Term();
+		}
+	}
+
+	void SetFilterPars( AkUInt32 in_uVoice, AkReal32 in_fLPFPar, AkReal32 in_fHPFPar )
+	{
+		s_aRef[ in_uVoice ].filter.SetLPFPar( in_fLPFPar );
+		s_aRef[ in_uVoice ].filter.SetHPFPar( in_fHPFPar );
+		s_aBank[ in_uVoice ].filter.SetLPFPar( in_fLPFPar );
+		s_aBank[ in_uVoice ].filter.SetHPFPar( in_fHPFPar );
+	}
+
+	// Fills the buffers of both voice sets with the same input for one audio frame.
+	void FillInput( AkUInt16 in_uValidFrames, AkBenchRandom & io_random )
+	{
+		AkChannelConfig channelConfig;
+		channelConfig.SetStandard( AK_SPEAKER_SETUP_MONO );
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+		{
+			for ( AkUInt32 i = 0; i < in_uValidFrames; ++i )
+				s_aRef[ v ].afInput[ i ] = s_aBank[ v ].afInput[ i ] = io_random.NextSigned();
+			s_aRef[ v ].buffer.AttachInterleavedData( s_aRef[ v ].afBuffer, kNumFrames, in_uValidFrames, channelConfig );
+			s_aBank[ v ].buffer.AttachInterleavedData( s_aBank[ v ].afBuffer, kNumFrames, in_uValidFrames, channelConfig );
+		}
+	}
+
+	// Voices are filtered in place: each pass starts from the input set by FillInput.
+	void RunPerVoice()
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+		{
+			memcpy( s_aRef[ v ].afBuffer, s_aRef[ v ].afInput, s_aRef[ v ].buffer.uValidFrames * sizeof( AkReal32 ) );
+			s_aRef[ v ].filter.CheckBypass();
+			s_aRef[ v ].filter.Execute( &s_aRef[ v ].buffer );
+		}
+	}
+
+	// Groups the voices like CAkLEngine::RunVPLOrHold: voices accepted by PrepareMonoBank are held until the bank is
+	// full, the others are filtered on their own. Returns the number of voices which went through the bank.
+	AkUInt32 RunInBanks()
+	{
+		CAkSrcLpHpFilter * pFilters[ CAkSrcLpHpFilter::kMonoBankWidth ];
+		AkAudioBuffer * pBuffers[ CAkSrcLpHpFilter::kMonoBankWidth ];
+		AkUInt32 uBankSize = 0;
+		AkUInt32 uNumBanked = 0;
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+		{
+			Voice & voice = s_aBank[ v ];
+			memcpy( voice.afBuffer, voice.afInput, voice.buffer.uValidFrames * sizeof( AkReal32 ) );
+			voice.filter.CheckBypass();
+			if ( !voice.filter.PrepareMonoBank( &voice.buffer ) )
+			{
+				voice.filter.Execute( &voice.buffer );
+				continue;
+			}
+
+			pFilters[ uBankSize ] = &voice.filter;
+			pBuffers[ uBankSize ] = &voice.buffer;
+			if ( ++uBankSize == CAkSrcLpHpFilter::kMonoBankWidth )
+			{
+				CAkSrcLpHpFilter::ExecuteMonoBank( pFilters, pBuffers, uBankSize );
+				uNumBanked += uBankSize;
+				uBankSize = 0;
+			}
+		}
+		if ( uBankSize > 0 )
+		{
+			CAkSrcLpHpFilter::ExecuteMonoBank( pFilters, pBuffers, uBankSize );
+			uNumBanked += uBankSize;
+		}
+		return uNumBanked;
+	}
+
+	bool SameOutput( AkUInt16 in_uValidFrames, AkUInt32 in_uFrame )
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+		{
+			// Peak of the reference output, halved at each buffer.
+			AkReal32 fPeak = AkMax( 1.f, 0.5f * s_aRef[ v ].fPeak );
+			for ( AkUInt32 i = 0; i < in_uValidFrames; ++i )
+				fPeak = AkMax( fPeak, fabsf( s_aRef[ v ].afBuffer[ i ] ) );
+			s_aRef[ v ].fPeak = fPeak;
+
+			for ( AkUInt32 i = 0; i < in_uValidFrames; ++i )
+			{
+				AkReal32 fRef = s_aRef[ v ].afBuffer[ i ];
+				AkReal32 fBank = s_aBank[ v ].afBuffer[ i ];
+				if ( fabsf( fRef - fBank ) > kMaxRelativeError * fPeak )
+				{
+					printf( "FAILED: voice %u differs at audio frame %u, sample %u (%g instead of %g)\n", v, in_uFrame, i, fBank, fRef );
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	// Random filter settings which change every few audio frames (so that some voices interpolate and leave the bank),
+	// and buffer lengths which are sometimes not a multiple of 4 frames.
+	bool Check( AkUInt32 in_uNumAudioFrames, AkBenchRandom & io_random )
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+			SetFilterPars( v, RandomFilterPar( io_random ), RandomFilterPar( io_random ) );
+
+		AkUInt64 uNumBanked = 0;
+		for ( AkUInt32 uFrame = 0; uFrame < in_uNumAudioFrames; ++uFrame )
+		{
+			if ( ( uFrame & 7 ) == 7 )
+			{
+				for ( AkUInt32 uChanges = 0; uChanges < kNumVoices / 8; ++uChanges )
+					SetFilterPars( io_random.Next() % kNumVoices, RandomFilterPar( io_random ), RandomFilterPar( io_random ) );
+			}
+
+			AkUInt16 uValidFrames = ( io_random.Next() & 15 ) == 0 ? (AkUInt16)( 1 + io_random.Next() % kNumFrames ) : kNumFrames;
+			FillInput( uValidFrames, io_random );
+			RunPerVoice();
+			uNumBanked += RunInBanks();
+			if ( !SameOutput( uValidFrames, uFrame ) )
+				return false;
+		}
+
+		if ( uNumBanked == 0 )
+		{
+			printf( "FAILED: no voice was filtered in a bank\n" );
+			return false;
+		}
+		printf( "%llu of %llu voice buffers filtered in banks\n", (unsigned long long)uNumBanked, (unsigned long long)in_uNumAudioFrames * kNumVoices );
+		return true;
+	}
+
+	// Steady filters on every voice, both active: all voices go through the bank.
+	void Time( AkUInt32 in_uNumAudioFrames, AkBenchRandom & io_random )
+	{
+		for ( AkUInt32 v = 0; v < kNumVoices; ++v )
+			SetFilterPars( v, 5.f + (AkReal32)( io_random.Next() % 85 ), 5.f + (AkReal32)( io_random.Next() % 85 ) );
+		FillInput( kNumFrames, io_random );
+		RunPerVoice();
+		RunInBanks();
+
+		const AkUInt64 uNumSamples = (AkUInt64)in_uNumAudioFrames * kNumVoices * kNumFrames;
+		AkBenchTimer timer;
+		timer.Start();
+		for ( AkUInt32 uFrame = 0; uFrame < in_uNumAudioFrames; ++uFrame )
+			RunPerVoice();
+		AkReal64 fPerVoiceMs = timer.Stop();
+
+		timer.Start();
+		for ( AkUInt32 uFrame = 0; uFrame < in_uNumAudioFrames; ++uFrame )
+			RunInBanks();
+		AkReal64 fBankMs = timer.Stop();
+
+		AkBenchReport( "Execute per voice", fPerVoiceMs, uNumSamples, "sample" );
+		AkBenchReport( "ExecuteMonoBank", fBankMs, uNumSamples, "sample" );
+		AkBenchReportSpeedup( "Speedup", fPerVoiceMs, fBankMs );
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+
+#if defined AK_CPU_X86 || defined AK_CPU_X86_64
+	// Like the voice tasks of the lower engine.
+	_MM_SET_FLUSH_ZERO_MODE( _MM_FLUSH_ZERO_ON );
+#endif
+
+	if ( !InitVoices() )
+	{
+		printf( "FAILED: could not initialize the filters\n" );
+		return 1;
+	}
+
+	AkBenchRandom random;
+	bool bOk = Check( bCheckOnly ? 200 : 2000, random );
+	if ( bOk )
+		Time( bCheckOnly ? 200 : 5000, random );
+
+	TermVoices();
+
+	printf( bOk ? "Filter bank output matches: OK\n" : "Filter bank output matches: FAILED\n" );
+	return bOk ? 0 : 1;
+}
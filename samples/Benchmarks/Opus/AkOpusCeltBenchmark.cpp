@@ -0,0 +1,265 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkOpusCeltBenchmark.cpp
+//
+// Compares the AVX CELT decoder kernel selected by opus_select_arch()
+// with the versions it replaces. comb_filter_const_avx must match
+// comb_filter_const_sse bit for bit; it adds its terms in the same order
+// as the SSE version, which differs from the C version, so it is only
+// compared with the C version within a small relative error. Then times
+// all of them on the same random input.
+//
+// To put the kernel in context, also times the decoding of one stereo
+// voice: packets encoded by the CELT encoder from a synthetic signal,
+// decoded like CAkCodecWemOpus does, 20 ms at a time. The inverse MDCTs
+// and the pitch post-filter of these frames are timed on their own,
+// which gives their share of the decoding time.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include <math.h>
+
+extern "C"
+{
+#include "config.h"
+#include "celt.h"
+#include "mathops.h"
+#include "modes.h"
+#include "pitch.h"
+#include "x86/x86cpu.h"
+#include "opus_custom.h"
+}
+
+namespace
+{
+	const int kFrameSize = 960;			// 20 ms at 48 kHz: the mode of Opus media.
+	const int kMaxMdctSize = 2 * kFrameSize;
+	const int kArchAVX = 4;				// Value of opus_select_arch() with AVX (see x86cpu.c).
+	const int kNumChannels = 2;
+	const int kPacketSize = 320;		// 128 kbit/s at 20 ms per packet, constant bitrate.
+
+	typedef void( *CombFilterFunc )( opus_val32 *, opus_val32 *, int, int, opus_val16, opus_val16, opus_val16 );
+
+	// Taps of the pitch post-filter (see comb_filter() in celt.c).
+	const AkReal32 s_afTapsetGains[ 3 ][ 3 ] = {
+		{ 0.3066406250f, 0.2170410156f, 0.1296386719f },
+		{ 0.4638671875f, 0.2680664062f, 0.f },
+		{ 0.7998046875f, 0.1000976562f, 0.f }
+	};
+
+	bool BenchCombFilter( AkUInt32 in_uNumCalls, AkBenchRandom & io_random )
+	{
+		const int kMaxPeriod = COMBFILTER_MAXPERIOD + 2;	// Samples read before the first one filtered.
+		const int kBufferSize = kMaxPeriod + kFrameSize;
+		static opus_val32 s_afInput[ kBufferSize ];
+		static opus_val32 s_afOutC[ kBufferSize ];
+		static opus_val32 s_afOutSSE[ kBufferSize ];
+		static opus_val32 s_afOutAVX[ kBufferSize ];
+
+		for ( AkUInt32 uCall = 0; uCall < in_uNumCalls / 10 + 1; ++uCall )
+		{
+			for ( int i = 0; i < kBufferSize; ++i )
+				s_afInput[ i ] = io_random.NextSigned();
+
+			const int iT = COMBFILTER_MINPERIOD + (int)( io_random.Next() % ( COMBFILTER_MAXPERIOD - COMBFILTER_MINPERIOD ) );
+			const int iN = (int)( io_random.Next() % ( kFrameSize / 4 + 1 ) ) * 4;	// Whole vectors: the remainder is for custom modes only.
+			// Gains of the decoder: those of a tapset, scaled by the pitch gain (at most 0.75).
+			const AkReal32 * pTapset = s_afTapsetGains[ io_random.Next() % 3 ];
+			const AkReal32 fGain = ( io_random.NextSigned() + 1.f ) * 0.375f;
+			const opus_val16 g10 = fGain * pTapset[ 0 ], g11 = fGain * pTapset[ 1 ], g12 = fGain * pTapset[ 2 ];
+
+			// The decoder filters out of place and in place.
+			const bool bInPlace = ( uCall & 1 ) != 0;
+			memcpy( s_afOutC, s_afInput, sizeof( s_afInput ) );
+			memcpy( s_afOutSSE, s_afInput, sizeof( s_afInput ) );
+			memcpy( s_afOutAVX, s_afInput, sizeof( s_afInput ) );
+			opus_val32 * pInC = ( bInPlace ? s_afOutC : s_afInput ) + kMaxPeriod;
+			opus_val32 * pInSSE = ( bInPlace ? s_afOutSSE : s_afInput ) + kMaxPeriod;
+			opus_val32 * pInAVX = ( bInPlace ? s_afOutAVX : s_afInput ) + kMaxPeriod;
+			comb_filter_const_c( s_afOutC + kMaxPeriod, pInC, iT, iN, g10, g11, g12 );
+			comb_filter_const_sse( s_afOutSSE + kMaxPeriod, pInSSE, iT, iN, g10, g11, g12 );
+			comb_filter_const_avx( s_afOutAVX + kMaxPeriod, pInAVX, iT, iN, g10, g11, g12 );
+
+			if ( memcmp( s_afOutSSE, s_afOutAVX, sizeof( s_afOutSSE ) ) != 0 )
+			{
+				printf( "FAILED: comb_filter_const_avx differs from the SSE version (T %d, N %d%s)\n", iT, iN, bInPlace ? ", in place" : "" );
+				return false;
+			}
+			for ( int i = 0; i < kBufferSize; ++i )
+			{
+				if ( fabsf( s_afOutAVX[ i ] - s_afOutC[ i ] ) > 1e-5f * ( 1.f + fabsf( s_afOutC[ i ] ) ) )
+				{
+					printf( "FAILED: comb_filter_const_avx differs from the C version (T %d, N %d%s, sample %d)\n", iT, iN, bInPlace ? ", in place" : "", i );
+					return false;
+				}
+			}
+		}
+
+		for ( int i = 0; i < kBufferSize; ++i )
+			s_afInput[ i ] = io_random.NextSigned();
+
+		AkReal64 afMs[ 3 ];
+		CombFilterFunc apfn[ 3 ] = { comb_filter_const_c, comb_filter_const_sse, comb_filter_const_avx };
+		for ( AkUInt32 uVariant = 0; uVariant < 3; ++uVariant )
+		{
+			AkBenchTimer timer;
+			timer.Start();
+			for ( AkUInt32 uCall = 0; uCall < in_uNumCalls; ++uCall )
+				apfn[ uVariant ]( s_afOutC + kMaxPeriod, s_afInput + kMaxPeriod, COMBFILTER_MINPERIOD + (int)( uCall % 64 ), kFrameSize, 0.3f, 0.2f, 0.1f );
+			afMs[ uVariant ] = timer.Stop();
+		}
+
+		const AkUInt64 uNumSamples = (AkUInt64)in_uNumCalls * kFrameSize;
+		AkBenchReport( "comb_filter_const_c", afMs[ 0 ], uNumSamples, "sample" );
+		AkBenchReport( "comb_filter_const_sse", afMs[ 1 ], uNumSamples, "sample" );
+		AkBenchReport( "comb_filter_const_avx", afMs[ 2 ], uNumSamples, "sample" );
+		AkBenchReportSpeedup( "  speedup (SSE to AVX)", afMs[ 1 ], afMs[ 2 ] );
+		return true;
+	}
+
+	// Two voices of harmonics with vibrato, one per channel, over some noise, with a click every half second:
+	// the encoder codes these transients with short blocks.
+	void Synthesize( AkUInt32 in_uFirstFrame, opus_val16 * out_pPcm, AkBenchRandom & io_random )
+	{
+		for ( int i = 0; i < kFrameSize; ++i )
+		{
+			const AkUInt32 uFrame = in_uFirstFrame + i;
+			const AkReal32 fTime = uFrame / 48000.f;
+			const AkReal32 fClick = ( uFrame % 24000 ) < 480 ? expf( -( uFrame % 24000 ) / 60.f ) * io_random.NextSigned() : 0.f;
+			for ( int c = 0; c < kNumChannels; ++c )
+			{
+				const AkReal32 fPitch = ( c == 0 ? 220.f : 330.f ) * ( 1.f + 0.01f * sinf( 2.f * PI * 5.f * fTime ) );
+				AkReal32 fSample = 0.f;
+				for ( int h = 1; h <= 8; ++h )
+					fSample += sinf( 2.f * PI * fPitch * h * fTime ) * 0.3f / h;
+				out_pPcm[ i * kNumChannels + c ] = fSample + 0.01f * io_random.NextSigned() + fClick;
+			}
+		}
+	}
+
+	bool BenchVoice( const CELTMode * in_pMode, AkUInt32 in_uNumPackets, AkUInt32 in_uNumPasses, AkBenchRandom & io_random )
+	{
+		static opus_val16 s_afPcm[ kNumChannels * kFrameSize ];
+		unsigned char * pPackets = (unsigned char *)malloc( in_uNumPackets * kPacketSize );
+		CELTEncoder * pEncoder = (CELTEncoder *)malloc( celt_encoder_get_size( kNumChannels ) );
+		CELTDecoder * pDecoder = (CELTDecoder *)malloc( celt_decoder_get_size( kNumChannels ) );
+		bool bOk = pPackets && pEncoder && pDecoder
+			&& celt_encoder_init( pEncoder, 48000, kNumChannels, opus_select_arch() ) == OPUS_OK
+			&& celt_decoder_init( pDecoder, 48000, kNumChannels ) == OPUS_OK;
+		if ( !bOk )
+			printf( "FAILED: could not create the CELT encoder and decoder\n" );
+
+		for ( AkUInt32 uPacket = 0; bOk && uPacket < in_uNumPackets; ++uPacket )
+		{
+			Synthesize( uPacket * kFrameSize, s_afPcm, io_random );
+			if ( celt_encode_with_ec( pEncoder, s_afPcm, kFrameSize, pPackets + uPacket * kPacketSize, kPacketSize, NULL ) != kPacketSize )
+			{
+				printf( "FAILED: could not encode packet %u\n", uPacket );
+				bOk = false;
+			}
+		}
+
+		AkReal64 fDecodeMs = 0.0;
+		AkBenchTimer timer;
+		for ( AkUInt32 uPass = 0; bOk && uPass < in_uNumPasses; ++uPass )
+		{
+			celt_decoder_ctl( pDecoder, OPUS_RESET_STATE );
+			timer.Start();
+			for ( AkUInt32 uPacket = 0; uPacket < in_uNumPackets; ++uPacket )
+			{
+				if ( celt_decode_with_ec( pDecoder, pPackets + uPacket * kPacketSize, kPacketSize, s_afPcm, kFrameSize, NULL, 0 ) != kFrameSize )
+				{
+					printf( "FAILED: could not decode packet %u\n", uPacket );
+					bOk = false;
+					break;
+				}
+			}
+			fDecodeMs += timer.Stop();
+		}
+
+		if ( bOk )
+		{
+			// Per channel and frame: one long block (short blocks, for transients, take about as long in total),
+			// and the post-filter past the overlap, if the pitch post-filter is on (at most: it is not in all frames).
+			static kiss_fft_scalar AK_ALIGN_SIMD( s_afMdctIn[ kFrameSize ] );
+			static kiss_fft_scalar AK_ALIGN_SIMD( s_afMdctOut[ kMaxMdctSize ] );
+			static opus_val32 s_afCombIn[ COMBFILTER_MAXPERIOD + 2 + kFrameSize ];
+			static opus_val32 s_afCombOut[ COMBFILTER_MAXPERIOD + 2 + kFrameSize ];
+			for ( int i = 0; i < kFrameSize; ++i )
+				s_afMdctIn[ i ] = io_random.NextSigned() * 1000.f;
+			for ( int i = 0; i < COMBFILTER_MAXPERIOD + 2 + kFrameSize; ++i )
+				s_afCombIn[ i ] = io_random.NextSigned();
+
+			const AkUInt32 uNumFrames = in_uNumPackets * in_uNumPasses;
+			timer.Start();
+			for ( AkUInt32 uCall = 0; uCall < uNumFrames * kNumChannels; ++uCall )
+				clt_mdct_backward_c( &in_pMode->mdct, s_afMdctIn, s_afMdctOut, in_pMode->window, in_pMode->overlap, 0, 1, 0 );
+			const AkReal64 fMdctMs = timer.Stop();
+
+			AkReal64 afCombMs[ 2 ];
+			CombFilterFunc apfn[ 2 ] = { comb_filter_const_sse, comb_filter_const_avx };
+			for ( AkUInt32 uVariant = 0; uVariant < 2; ++uVariant )
+			{
+				timer.Start();
+				for ( AkUInt32 uCall = 0; uCall < uNumFrames * kNumChannels; ++uCall )
+					apfn[ uVariant ]( s_afCombOut + COMBFILTER_MAXPERIOD + 2, s_afCombIn + COMBFILTER_MAXPERIOD + 2, COMBFILTER_MINPERIOD + (int)( uCall % 64 ), kFrameSize - in_pMode->overlap, 0.3f, 0.2f, 0.1f );
+				afCombMs[ uVariant ] = timer.Stop();
+			}
+
+			AkBenchReport( "Stereo voice at 128 kbit/s, decode", fDecodeMs, uNumFrames, "frame" );
+			printf( "  %.2f%% of a core per voice (20 ms frames)\n", 100.0 * fDecodeMs / ( uNumFrames * 20.0 ) );
+			AkBenchReport( "  inverse MDCTs", fMdctMs, uNumFrames, "frame" );
+			printf( "  %.1f%% of the decoding time\n", 100.0 * fMdctMs / fDecodeMs );
+			AkBenchReport( "  post-filter, SSE", afCombMs[ 0 ], uNumFrames, "frame" );
+			AkBenchReport( "  post-filter, AVX", afCombMs[ 1 ], uNumFrames, "frame" );
+			printf( "  the AVX post-filter saves at most %.1f%% of the decoding time\n", 100.0 * ( afCombMs[ 0 ] - afCombMs[ 1 ] ) / ( fDecodeMs + afCombMs[ 0 ] - afCombMs[ 1 ] ) );
+		}
+
+		free( pDecoder );
+		free( pEncoder );
+		free( pPackets );
+		return bOk;
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	if ( opus_select_arch() < kArchAVX )
+	{
+		printf( "AVX is not supported by this processor: nothing to compare.\n" );
+		return 0;
+	}
+
+	int iError;
+	const CELTMode * pMode = opus_custom_mode_create( 48000, kFrameSize, &iError );
+	if ( !pMode )
+	{
+		printf( "FAILED: no CELT mode for %d samples at 48 kHz\n", kFrameSize );
+		return 1;
+	}
+
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 uNumCalls = bCheckOnly ? 2000 : 100000;
+
+	AkBenchRandom random;
+	bool bOk = BenchCombFilter( uNumCalls, random );
+	bOk = BenchVoice( pMode, bCheckOnly ? 50 : 500, bCheckOnly ? 1 : 20, random ) && bOk;
+
+	printf( bOk ? "CELT AVX post-filter equivalent: OK\n" : "CELT AVX post-filter equivalent: FAILED\n" );
+	return bOk ? 0 : 1;
+}
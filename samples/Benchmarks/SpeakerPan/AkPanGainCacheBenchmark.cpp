@@ -0,0 +1,203 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkPanGainCacheBenchmark.cpp
+//
+// Measures the hit rate of the 3D panning gain cache (see
+// AkInitSettings::uPanGainCacheSize) against its cost. Mono emitters
+// move around a listener, each at its own speed, on a 7.1 main output;
+// their spread follows their distance. Every frame, the gains of each
+// emitter are computed with CAkSpeakerPan::GetSpeakerVolumes, without
+// the cache, then with caches smaller and larger than the cells the
+// emitters go through. The check is that the RMS difference between the
+// cached gains and the computed ones stays under kMaxRmsGainError. The
+// largest difference is only reported: the spread is sampled with
+// virtual points, so computed gains can jump by a few tenths within a
+// cell, where the cache interpolates.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "AkBenchEngine.h"
+
+#include "AkPrivateTypes.h"
+#include "AkSpeakerPan.h"
+#include "AkOutputMgr.h"
+#include <math.h>
+
+namespace
+{
+	const AkUInt32 kNumEmitters = 64;
+	const AkUInt32 kNumChannels = 8;	// 7.1
+
+	// Cells are 5 degrees and 10% spread apart, and gains are interpolated linearly between them.
+	const AkReal64 kMaxRmsGainError = 0.02;
+
+	struct Emitter
+	{
+		AkReal32 fAzimuth;
+		AkReal32 fAzimuthSpeed;		// Radians per frame.
+		AkReal32 fElevation;
+		AkReal32 fElevationSpeed;
+		AkReal32 fDistancePhase;
+		AkReal32 fDistanceSpeed;
+	};
+
+	void InitEmitters( Emitter * out_pEmitters )
+	{
+		AkBenchRandom random;
+		for ( AkUInt32 i = 0; i < kNumEmitters; ++i )
+		{
+			Emitter & emitter = out_pEmitters[ i ];
+			emitter.fAzimuth = random.NextSigned() * PI;
+			emitter.fAzimuthSpeed = random.NextSigned() * 0.05f;
+			emitter.fElevation = random.NextSigned() * 0.5f;
+			emitter.fElevationSpeed = random.NextSigned() * 0.01f;
+			emitter.fDistancePhase = random.NextSigned() * PI;
+			emitter.fDistanceSpeed = random.NextSigned() * 0.02f;
+		}
+	}
+
+	// Computes the gains of every emitter for in_uNumFrames frames into out_pGains (kNumChannels per emitter and frame).
+	// Returns the time spent in GetSpeakerVolumes() in ms, or a negative value on failure.
+	AkReal64 RenderGains( AkUInt32 in_uCacheSize, AkUInt32 in_uNumFrames, AkReal32 * out_pGains, AkPanGainCacheStats & out_stats )
+	{
+		AkInitSettings initSettings;
+		AkPlatformInitSettings platformSettings;
+		AkBenchEngineGetDefaultSettings( initSettings, platformSettings );
+		initSettings.settingsMainOutput.channelConfig.SetStandard( AK_SPEAKER_SETUP_7POINT1 );
+		initSettings.uPanGainCacheSize = in_uCacheSize;
+
+		AkReal64 fMs = -1.0;
+		AkDevice * pDevice = NULL;
+		if ( AkBenchEngineInit( initSettings, platformSettings ) )
+		{
+			// Init.bnk queues the creation of the main output: render a frame to open it.
+			AkBenchEngineRenderFrame();
+			pDevice = CAkOutputMgr::GetPrimaryDevice();
+		}
+		AkChannelConfig outputConfig;
+		if ( pDevice )
+			outputConfig = pDevice->GetSpeakerConfig();
+
+		if ( !pDevice || outputConfig.uNumChannels != kNumChannels || pDevice->EnsurePanCacheExists( outputConfig ) != AK_Success )
+		{
+			printf( "Could not open a 7.1 output\n" );
+		}
+		else
+		{
+			Emitter aEmitters[ kNumEmitters ];
+			InitEmitters( aEmitters );
+
+			AkChannelConfig configMono;
+			configMono.SetStandard( AK_SPEAKER_SETUP_MONO );
+			static const AkVector vListener = { 0.f, 0.f, 0.f };
+			static const AkReal32 mxListener[ 3 ][ 3 ] = { { 1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, { 0.f, 0.f, 1.f } };
+			AK::SpeakerVolumes::MatrixPtr mxVolumes = (AK::SpeakerVolumes::MatrixPtr)AkAllocaSIMD( AK::SpeakerVolumes::Matrix::GetRequiredSize( 1, kNumChannels ) );
+
+			fMs = 0.0;
+			AkBenchTimer timer;
+			for ( AkUInt32 uFrame = 0; uFrame < in_uNumFrames; ++uFrame )
+			{
+				for ( AkUInt32 i = 0; i < kNumEmitters; ++i )
+				{
+					Emitter & emitter = aEmitters[ i ];
+					AkReal32 fDistance = 5.5f + 4.5f * sinf( emitter.fDistancePhase + emitter.fDistanceSpeed * uFrame );
+					AkReal32 fAzimuth = emitter.fAzimuth + emitter.fAzimuthSpeed * uFrame;
+					AkReal32 fElevation = emitter.fElevation + 0.5f * sinf( emitter.fElevationSpeed * uFrame );
+					AkTransform transform;
+					transform.Set(
+						fDistance * cosf( fElevation ) * sinf( fAzimuth ), fDistance * sinf( fElevation ), fDistance * cosf( fElevation ) * cosf( fAzimuth ),
+						0.f, 0.f, 1.f,
+						0.f, 1.f, 0.f );
+					AkReal32 fSpread = AkMax( 0.f, 100.f - fDistance * 10.f );
+
+					AK::SpeakerVolumes::Matrix::Zero( mxVolumes, 1, kNumChannels );
+					timer.Start();
+					CAkSpeakerPan::GetSpeakerVolumes( transform, 0.f, fSpread, 0.f, mxVolumes, configMono, AK_SPEAKER_SETUP_MONO, outputConfig, vListener, mxListener, pDevice );
+					fMs += timer.Stop();
+					memcpy( out_pGains + ( (AkUInt64)uFrame * kNumEmitters + i ) * kNumChannels, mxVolumes, kNumChannels * sizeof( AkReal32 ) );
+				}
+			}
+		}
+
+		AK::SoundEngine::GetPanGainCacheStats( out_stats );
+		AkBenchEngineTerm();
+		return fMs;
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 uNumFrames = bCheckOnly ? 200 : 4000;
+	const AkUInt32 aCacheSizes[] = { 256, 1024, 4096, 16384 };
+	const AkUInt32 uNumSizes = bCheckOnly ? 2 : sizeof( aCacheSizes ) / sizeof( aCacheSizes[ 0 ] );
+	const AkUInt64 uNumCalls = (AkUInt64)uNumFrames * kNumEmitters;
+	const AkUInt64 uNumGains = uNumCalls * kNumChannels;
+
+	AkReal32 * pRefGains = (AkReal32 *)malloc( uNumGains * sizeof( AkReal32 ) );
+	AkReal32 * pGains = (AkReal32 *)malloc( uNumGains * sizeof( AkReal32 ) );
+
+	AkPanGainCacheStats stats;
+	AkReal64 fRefMs = RenderGains( 0, uNumFrames, pRefGains, stats );
+	bool bOk = fRefMs >= 0.0;
+	if ( bOk )
+		AkBenchReport( "No cache", fRefMs, uNumCalls, "emitter" );
+
+	for ( AkUInt32 uSize = 0; bOk && uSize < uNumSizes; ++uSize )
+	{
+		AkReal64 fMs = RenderGains( aCacheSizes[ uSize ], uNumFrames, pGains, stats );
+		bOk = fMs >= 0.0;
+		if ( !bOk )
+			break;
+
+		AkReal32 fMaxError = 0.f;
+		AkReal64 fSumSquaredErrors = 0.0;
+		for ( AkUInt64 i = 0; i < uNumGains; ++i )
+		{
+			AkReal32 fError = fabsf( pGains[ i ] - pRefGains[ i ] );
+			fMaxError = AkMax( fMaxError, fError );
+			fSumSquaredErrors += fError * fError;
+		}
+		AkReal64 fRmsError = sqrt( fSumSquaredErrors / uNumGains );
+
+		char szName[ 64 ];
+		snprintf( szName, sizeof( szName ), "Cache of %u cells", aCacheSizes[ uSize ] );
+		AkBenchReport( szName, fMs, uNumCalls, "emitter" );
+		AkUInt32 uNumLookups = stats.uNumHits + stats.uNumMisses;
+		printf( "  hit rate %.1f%%, %u cells computed, %u evicted, gain error %.4f RMS, %.3f largest\n",
+			uNumLookups ? 100.0 * stats.uNumHits / uNumLookups : 0.0, stats.uNumCellsComputed, stats.uNumEvictions, fRmsError, fMaxError );
+		AkBenchReportSpeedup( "  speedup", fRefMs, fMs );
+
+		if ( stats.uNumBypasses != 0 || uNumLookups != uNumCalls )
+		{
+			printf( "FAILED: %u of %u gains did not go through the cache\n", (AkUInt32)( uNumCalls - uNumLookups ), (AkUInt32)uNumCalls );
+			bOk = false;
+		}
+		else if ( fRmsError > kMaxRmsGainError )
+		{
+			printf( "FAILED: cached gains are off by %.4f RMS\n", fRmsError );
+			bOk = false;
+		}
+	}
+
+	free( pRefGains );
+	free( pGains );
+
+	printf( bOk ? "Pan gain cache: OK\n" : "Pan gain cache: FAILED\n" );
+	return bOk ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided 
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkVorbisMdctBenchmark.cpp
+//
+// Compares the inverse MDCT of a channel pair (mdct_backward_x2, the AVX
+// version used by mapping_inverse for two channels of the same stream)
+// with two calls to mdct_backward: output must be bit-identical. Then
+// times both on the same random spectra and floors.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AkBenchmark.h"
+#include "AkRuntimeEnvironmentMgr.h"
+#include "mdct.h"
+
+namespace
+{
+	const int kMaxBlockSize = 2048;	// Largest block transformed in pairs (see mapping_inverse).
+
+	// Spectra and floors of one channel pair. Floors are overwritten by the transform.
+	struct PairInput
+	{
+		AkReal32 AK_ALIGN_SIMD( afSpectrum[ 2 ][ kMaxBlockSize ] );
+		AkReal32 AK_ALIGN_SIMD( afFloor[ 2 ][ kMaxBlockSize / 2 + 8 ] );
+		int iEnd;
+	};
+
+	PairInput s_input;
+	AkReal32 AK_ALIGN_SIMD( s_afRef[ 2 ][ kMaxBlockSize ] );
+	AkReal32 AK_ALIGN_SIMD( s_afPair[ 2 ][ kMaxBlockSize ] );
+	AkReal32 AK_ALIGN_SIMD( s_afFloor[ 2 ][ kMaxBlockSize + 8 ] );	// Also the work buffer of the transform, as in mapping_inverse.
+	AkReal32 AK_ALIGN_SIMD( s_afScratch[ 2 * kMaxBlockSize ] );
+
+	// The spectrum is truncated at end like the residue of a packet: zeros past it, in steps of 16.
+	void RandomInput( int in_iBlockSize, AkBenchRandom & io_random )
+	{
+		const int iPoints = in_iBlockSize / 2;
+		s_input.iEnd = iPoints - (int)( io_random.Next() % ( iPoints / 16 ) ) * 16;
+		if ( io_random.Next() & 1 )
+			s_input.iEnd = iPoints;
+
+		for ( int c = 0; c < 2; ++c )
+		{
+			for ( int i = 0; i < iPoints; ++i )
+			{
+				s_input.afSpectrum[ c ][ i ] = i < s_input.iEnd ? io_random.NextSigned() : 0.f;
+				s_input.afFloor[ c ][ i ] = io_random.NextSigned() * 0.5f + 0.5f;
+			}
+		}
+	}
+
+	void RunReference( int in_iBlockSize )
+	{
+		for ( int c = 0; c < 2; ++c )
+		{
+			memcpy( s_afRef[ c ], s_input.afSpectrum[ c ], in_iBlockSize * sizeof( AkReal32 ) );
+			memcpy( s_afFloor[ 0 ], s_input.afFloor[ c ], in_iBlockSize / 2 * sizeof( AkReal32 ) );
+			mdct_backward( in_iBlockSize, s_afRef[ c ], s_afFloor[ 0 ], s_input.iEnd );
+		}
+	}
+
+	// Like mapping_inverse, the floor of the second channel is placed in the scratch buffer.
+	void RunPair( int in_iBlockSize )
+	{
+		for ( int c = 0; c < 2; ++c )
+			memcpy( s_afPair[ c ], s_input.afSpectrum[ c ], in_iBlockSize * sizeof( AkReal32 ) );
+		memcpy( s_afFloor[ 0 ], s_input.afFloor[ 0 ], in_iBlockSize / 2 * sizeof( AkReal32 ) );
+		memcpy( s_afScratch, s_input.afFloor[ 1 ], in_iBlockSize / 2 * sizeof( AkReal32 ) );
+		mdct_backward_x2( in_iBlockSize, s_afPair[ 0 ], s_afPair[ 1 ], s_afFloor[ 0 ], s_afScratch, s_input.iEnd, s_afScratch );
+	}
+
+	bool BenchBlockSize( int in_iBlockSize, AkUInt32 in_uNumCalls, AkBenchRandom & io_random )
+	{
+		for ( AkUInt32 uCall = 0; uCall < in_uNumCalls / 10; ++uCall )
+		{
+			RandomInput( in_iBlockSize, io_random );
+			RunReference( in_iBlockSize );
+			RunPair( in_iBlockSize );
+			if ( memcmp( s_afRef[ 0 ], s_afPair[ 0 ], in_iBlockSize * sizeof( AkReal32 ) ) != 0
+				|| memcmp( s_afRef[ 1 ], s_afPair[ 1 ], in_iBlockSize * sizeof( AkReal32 ) ) != 0 )
+			{
+				printf( "FAILED: mdct_backward_x2 differs (block size %d, end %d)\n", in_iBlockSize, s_input.iEnd );
+				return false;
+			}
+		}
+
+		// Both variants copy their inputs, so the copies are part of the timings.
+		RandomInput( in_iBlockSize, io_random );
+		AkBenchTimer timer;
+		timer.Start();
+		for ( AkUInt32 uCall = 0; uCall < in_uNumCalls; ++uCall )
+			RunReference( in_iBlockSize );
+		AkReal64 fRefMs = timer.Stop();
+
+		timer.Start();
+		for ( AkUInt32 uCall = 0; uCall < in_uNumCalls; ++uCall )
+			RunPair( in_iBlockSize );
+		AkReal64 fPairMs = timer.Stop();
+
+		const AkUInt64 uNumSamples = (AkUInt64)in_uNumCalls * 2 * in_iBlockSize;
+		char szName[ 64 ];
+		snprintf( szName, sizeof( szName ), "mdct_backward x2 (%d)", in_iBlockSize );
+		AkBenchReport( szName, fRefMs, uNumSamples, "sample" );
+		snprintf( szName, sizeof( szName ), "mdct_backward_x2 (%d)", in_iBlockSize );
+		AkBenchReport( szName, fPairMs, uNumSamples, "sample" );
+		AkBenchReportSpeedup( "  speedup", fRefMs, fPairMs );
+		return true;
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	InitMdctFunc();
+	if ( !mdct_backward_x2 )
+	{
+		printf( "AVX is not supported by this processor: nothing to compare.\n" );
+		return 0;
+	}
+
+	const bool bCheckOnly = AkBenchIsCheckOnly( argc, argv );
+	const AkUInt32 uNumCalls = bCheckOnly ? 2000 : 100000;
+
+	AkBenchRandom random;
+	bool bOk = true;
+	for ( int iBlockSize = 256; iBlockSize <= kMaxBlockSize; iBlockSize *= 2 )
+		bOk = BenchBlockSize( iBlockSize, uNumCalls, random ) && bOk;
+
+	printf( bOk ? "Channel pair MDCT output identical: OK\n" : "Channel pair MDCT output identical: FAILED\n" );
+	return bOk ? 0 : 1;
+}
@@ -27,7 +27,9 @@ written agreement between you and Audiokinetic Inc.
 #include "Platform.h"
 #include "Wwise_IDs.h"		// IDs generated by Wwise
 
-#if defined(INTDEMO_DEFERRED_IO)
+#if defined(INTDEMO_MAPPED_IO)
+	#include "AkFilePackageLowLevelIOMapped.h"			// Low level io (memory-mapped packages)
+#elif defined(INTDEMO_DEFERRED_IO)
 	#include "AkFilePackageLowLevelIODeferred.h"		// Low level io (deferred)
 #else
 	#include "AkFilePackageLowLevelIOBlocking.h"		// Low level io
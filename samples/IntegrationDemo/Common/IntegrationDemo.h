@@ -36,7 +36,9 @@ written agreement between you and Audiokinetic Inc.
 #include "Drawing.h"
 #include "UniversalInput.h"
 
-#if defined(INTDEMO_DEFERRED_IO)
+#if defined(INTDEMO_MAPPED_IO)
+#include "AkFilePackageLowLevelIOMapped.h"
+#elif defined(INTDEMO_DEFERRED_IO)
 #include "AkFilePackageLowLevelIODeferred.h"
 #else
 #include "AkFilePackageLowLevelIOBlocking.h"
@@ -55,7 +57,13 @@ static const AkGameObjectID LISTENER_ID = 10000;
 class InputMgr;
 class Menu;
 
-#if defined(INTDEMO_DEFERRED_IO)
+#if defined(INTDEMO_MAPPED_IO) && defined(INTDEMO_DEFERRED_IO)
+class CAkFilePackageLowLevelIODeferredMapped;
+typedef CAkFilePackageLowLevelIODeferredMapped LowLevelIOSystem;
+#elif defined(INTDEMO_MAPPED_IO)
+class CAkFilePackageLowLevelIOBlockingMapped;
+typedef CAkFilePackageLowLevelIOBlockingMapped LowLevelIOSystem;
+#elif defined(INTDEMO_DEFERRED_IO)
 class CAkFilePackageLowLevelIODeferred;
 typedef CAkFilePackageLowLevelIODeferred LowLevelIOSystem;
 #else
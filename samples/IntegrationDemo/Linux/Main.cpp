@@ -29,6 +29,10 @@ written agreement between you and Audiokinetic Inc.
 
 #include <SDL2/SDL.h>
 
+#if defined(INTDEMO_TASK_SCHEDULER)
+#include "../../TaskScheduler/AkTaskScheduler_posix.h"
+#endif
+
 int main( int argc, char *argv[] )
 {
 	AkMemSettings memSettings;
@@ -39,6 +43,11 @@ int main( int argc, char *argv[] )
 	AkMusicSettings musicInit;
 	IntegrationDemo::Instance().GetDefaultSettings(memSettings, stmSettings, deviceSettings, initSettings, platformInitSettings, musicInit);
 
+#if defined(INTDEMO_TASK_SCHEDULER)
+	AkTaskScheduler::Init();
+	AkTaskScheduler::InitDesc(initSettings.taskSchedulerDesc);
+#endif
+
 	// Initialize the various components of the application and show the window
 	int width = 853, height = 480;
 	SDL_Init(SDL_INIT_VIDEO);
@@ -78,6 +87,10 @@ int main( int argc, char *argv[] )
 	// Terminate the various components of the application
 	IntegrationDemo::Instance().Term();
 
+#if defined(INTDEMO_TASK_SCHEDULER)
+	AkTaskScheduler::Term();
+#endif
+
 	return 0;
 }
 
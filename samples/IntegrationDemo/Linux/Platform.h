@@ -45,3 +45,11 @@ written agreement between you and Audiokinetic Inc.
 #define __AK_OSCHAR_SNPRINTF snprintf
 
 #define CODECTYPE_STANDARD	AKCODECID_ADPCM
+
+// Read packaged files straight from memory-mapped packages (see AkFilePackageLowLevelIOMapped.h).
+// Comment out to read them through the package's file handle.
+#define INTDEMO_MAPPED_IO
+
+// Run the sound engine's parallel tasks (voices, busses, spatial audio) on the work-stealing
+// scheduler from samples/TaskScheduler. Comment out to process everything on the audio thread.
+#define INTDEMO_TASK_SCHEDULER
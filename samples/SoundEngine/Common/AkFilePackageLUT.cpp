@@ -36,6 +36,7 @@ written agreement between you and Audiokinetic Inc.
 #include "stdafx.h"
 #include "AkFilePackageLUT.h"
 #include <AK/SoundEngine/Common/AkMemoryMgr.h>
+#include <AK/Tools/Common/AkObject.h>
 #include <AK/SoundEngine/Common/AkSoundEngine.h>	// For string hash.
 #include <AK/Tools/Common/AkPlatformFuncs.h>
 #include <AK/Tools/Common/AkFNVHash.h>
@@ -63,8 +64,57 @@ CAkFilePackageLUT::CAkFilePackageLUT()
 
 CAkFilePackageLUT::~CAkFilePackageLUT()
 {
+	m_soundBanksIndex.Term();
+	m_stmFilesIndex.Term();
+	m_externalsIndex.Term();
 }
 
+// Build the hash index of a file LUT.
+// The number of slots is at least twice the number of files, so that probe sequences stay short.
+template <class T_FILEID>
+AKRESULT CAkFilePackageLUT::FileIndex<T_FILEID>::Build(
+	const FileLUT<T_FILEID> * in_pLut	// LUT to index.
+	)
+{
+	Term();
+	if ( !in_pLut->HasFiles() )
+		return AK_Success;
+
+	AkUInt32 uNumSlots = 2;
+	while ( uNumSlots < 2 * in_pLut->NumFiles() )
+		uNumSlots *= 2;
+
+	m_pSlots = (AkUInt32*)AkAlloc( AkMemID_FilePackage, uNumSlots * sizeof( AkUInt32 ) );
+	if ( !m_pSlots )
+		return AK_InsufficientMemory;
+	memset( m_pSlots, 0, uNumSlots * sizeof( AkUInt32 ) );
+	m_uMask = uNumSlots - 1;
+
+	const AkFileEntry<T_FILEID> * pTable = in_pLut->FileEntries();
+	for ( AkUInt32 uEntry = 0; uEntry < in_pLut->NumFiles(); uEntry++ )
+	{
+		AkUInt32 uSlot = Hash( pTable[ uEntry ].fileID, pTable[ uEntry ].uLanguageID ) & m_uMask;
+		while ( m_pSlots[ uSlot ] )
+			uSlot = ( uSlot + 1 ) & m_uMask;
+		m_pSlots[ uSlot ] = uEntry + 1;
+	}
+	return AK_Success;
+}
+
+template <class T_FILEID>
+void CAkFilePackageLUT::FileIndex<T_FILEID>::Term()
+{
+	if ( m_pSlots )
+	{
+		AkFree( AkMemID_FilePackage, m_pSlots );
+		m_pSlots = NULL;
+	}
+	m_uMask = 0;
+}
+
+template class CAkFilePackageLUT::FileIndex<AkFileID>;
+template class CAkFilePackageLUT::FileIndex<AkUInt64>;
+
 // Create a new LUT from a packaged file header.
 // The LUT sets pointers to appropriate location inside header data (in_pData).
 AKRESULT CAkFilePackageLUT::Setup(
@@ -111,6 +161,11 @@ AKRESULT CAkFilePackageLUT::Setup(
 
 	m_pExternals	= (FileLUT<AkUInt64>*)in_pData;
 
+	// Index the LUTs. If memory is short, lookups use binary search instead.
+	m_soundBanksIndex.Build( m_pSoundBanks );
+	m_stmFilesIndex.Build( m_pStmFiles );
+	m_externalsIndex.Build( m_pExternals );
+
 	return AK_Success;
 }
 
@@ -126,12 +181,12 @@ const CAkFilePackageLUT::AkFileEntry<AkFileID> * CAkFilePackageLUT::LookupFile(
 		&& m_pSoundBanks
 		&& m_pSoundBanks->HasFiles() )
 	{
-		return LookupFile<AkFileID>( in_uID, m_pSoundBanks, in_pFlags->bIsLanguageSpecific );
+		return LookupFile<AkFileID>( in_uID, m_pSoundBanks, m_soundBanksIndex, in_pFlags->bIsLanguageSpecific );
 	}
 	else if ( m_pStmFiles && m_pStmFiles->HasFiles() )
 	{
 		// We assume that the file is a streamed audio file.
-		return LookupFile<AkFileID>( in_uID, m_pStmFiles, in_pFlags->bIsLanguageSpecific );
+		return LookupFile<AkFileID>( in_uID, m_pStmFiles, m_stmFilesIndex, in_pFlags->bIsLanguageSpecific );
 	}
 	// No table loaded.
 	return NULL;
@@ -149,7 +204,7 @@ const CAkFilePackageLUT::AkFileEntry<AkUInt64> * CAkFilePackageLUT::LookupFile(
 		&& m_pExternals 
 		&& m_pExternals->HasFiles() )
 	{
-		return LookupFile<AkUInt64>( in_uID, m_pExternals, in_pFlags->bIsLanguageSpecific );
+		return LookupFile<AkUInt64>( in_uID, m_pExternals, m_externalsIndex, in_pFlags->bIsLanguageSpecific );
 	}
 
 	// No table loaded.
@@ -132,11 +132,57 @@ protected:
 		AkUInt32		m_uNumFiles;
 	};
 
+	//
+	// Hash index over a file LUT.
+	// Open addressing with linear probing, keyed on (file ID, language ID). Built once when the
+	// package is set up; lookups fall back on binary search of the LUT if it could not be allocated.
+	//
+	template <class T_FILEID>
+	class FileIndex
+	{
+	public:
+		FileIndex() : m_pSlots( NULL ), m_uMask( 0 ) {}
+
+		AKRESULT Build( const FileLUT<T_FILEID> * in_pLut );
+		void Term();
+		inline bool IsBuilt() const { return m_pSlots != NULL; }
+
+		inline const AkFileEntry<T_FILEID> * Find(
+			const FileLUT<T_FILEID> *	in_pLut,	// LUT that was indexed.
+			T_FILEID					in_uID,		// File ID.
+			AkUInt32					in_uLangID	// Language ID.
+			) const
+		{
+			const AkFileEntry<T_FILEID> * pTable = in_pLut->FileEntries();
+			AkUInt32 uSlot = Hash( in_uID, in_uLangID ) & m_uMask;
+			while ( m_pSlots[ uSlot ] )
+			{
+				const AkFileEntry<T_FILEID> * pEntry = pTable + m_pSlots[ uSlot ] - 1;
+				if ( pEntry->fileID == in_uID && pEntry->uLanguageID == in_uLangID )
+					return pEntry;
+				uSlot = ( uSlot + 1 ) & m_uMask;
+			}
+			return NULL;
+		}
+
+	private:
+		static inline AkUInt32 Hash( T_FILEID in_uID, AkUInt32 in_uLangID )
+		{
+			// Fibonacci hashing of the combined key; the high bits are the best mixed.
+			AkUInt64 uKey = ( (AkUInt64)in_uID ^ ( (AkUInt64)in_uLangID << 47 ) ) * 0x9E3779B97F4A7C15ULL;
+			return (AkUInt32)( uKey >> 32 );
+		}
+
+		AkUInt32 *		m_pSlots;	// Index of entry in LUT + 1. 0 for empty slots.
+		AkUInt32		m_uMask;	// Number of slots - 1 (power of two).
+	};
+
 	// Helper: Find a file entry by ID.
 	template <class T_FILEID>
 	const AkFileEntry<T_FILEID> * LookupFile(
 		T_FILEID					in_uID,					// File ID.
 		const FileLUT<T_FILEID> *	in_pLut,				// LUT to search.
+		const FileIndex<T_FILEID> &	in_index,				// Hash index of in_pLut.
 		bool						in_bIsLanguageSpecific	// True: match language ID.
 		);
 
@@ -176,6 +222,11 @@ private:
 
 	// External Sources LUT.
     FileLUT<AkUInt64> *			m_pExternals;
+
+	// Hash indices of the LUTs above.
+	FileIndex<AkFileID>			m_soundBanksIndex;
+	FileIndex<AkFileID>			m_stmFilesIndex;
+	FileIndex<AkUInt64>			m_externalsIndex;
 };
 
 // Helper: Find a file entry by ID.
@@ -183,6 +234,7 @@ template <class T_FILEID>
 const CAkFilePackageLUT::AkFileEntry<T_FILEID> * CAkFilePackageLUT::LookupFile(
 	T_FILEID					in_uID,					// File ID.
 	const FileLUT<T_FILEID> *	in_pLut,				// LUT to search.
+	const FileIndex<T_FILEID> &	in_index,				// Hash index of in_pLut.
 	bool						in_bIsLanguageSpecific	// True: match language ID.
 	)
 {
@@ -191,6 +243,9 @@ const CAkFilePackageLUT::AkFileEntry<T_FILEID> * CAkFilePackageLUT::LookupFile(
 	AKASSERT( pTable && in_pLut->HasFiles() );
 	AkUInt16 uLangID = in_bIsLanguageSpecific ? m_curLangID : AK_INVALID_LANGUAGE_ID;
 
+	if ( in_index.IsBuilt() )
+		return in_index.Find( in_pLut, in_uID, uLangID );
+
 	// Binary search. LUT items should be sorted by fileID, then by language ID.
 	AkInt32 uTop = 0, uBottom = in_pLut->NumFiles()-1;
 	do
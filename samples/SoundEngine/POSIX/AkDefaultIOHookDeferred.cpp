@@ -29,8 +29,9 @@ written agreement between you and Audiokinetic Inc.
 // at class CAkDefaultLowLevelIODispatcher).
 //
 // AK::StreamMgr::IAkIOHookDeferred: 
-// Uses standard C IO functions, into seperate thread for async IO.
-// AioFuncRead and AioFuncWrite handle the IO operation asynchronously. 
+// On Linux, transfers are submitted to an io_uring (Linux 5.6+), or to POSIX AIO
+// if io_uring is not available. Elsewhere, AioFuncRead and AioFuncWrite perform 
+// the transfer in the I/O thread.
 // The AK::StreamMgr::IAkIOHookDeferred interface is meant to be used with
 // AK_SCHEDULER_DEFERRED_LINED_UP streaming devices. 
 //
@@ -44,15 +45,36 @@ written agreement between you and Audiokinetic Inc.
 #include "stdafx.h"
 #include "AkDefaultIOHookDeferred.h"
 #include <AK/SoundEngine/Common/AkMemoryMgr.h>
+#include <AK/Tools/Common/AkObject.h>
 #include "AkFileHelpers.h"
 
+#if defined(AK_LINUX)
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <aio.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup)
+#include <linux/io_uring.h>
+#if defined(IORING_FEAT_RW_CUR_POS)	// IORING_OP_READ/IORING_OP_WRITE require Linux 5.6 headers.
+#define AK_IO_URING_SUPPORTED
+#endif
+#endif
+#endif
+
 
 // Device info.
 #define POSIX_DEFERRED_DEVICE_NAME		("POSIX Deferred")	// Default deferred device name.
 
 CAkDefaultIOHookDeferred::CAkDefaultIOHookDeferred()
 : m_deviceID( AK_INVALID_DEVICE_ID )
+, m_pIoUring( NULL )
+, m_pPosixAio( NULL )
 , m_bAsyncOpen( false )
+, m_bDirectIO( false )
 {
 }
 
@@ -66,7 +88,8 @@ CAkDefaultIOHookDeferred::~CAkDefaultIOHookDeferred()
 AKRESULT CAkDefaultIOHookDeferred::Init(
 	const AkDeviceSettings &	in_deviceSettings,			// Device settings.
 	bool						in_bAsyncOpen/*=true*/,		// If true, files are opened asynchronously when possible.
-	AkOSChar * 					in_pszMountPoint/*=NULL*/	// Mount point (optional, can be NULL).
+	AkOSChar * 					in_pszMountPoint/*=NULL*/,	// Mount point (optional, can be NULL).
+	bool						in_bDirectIO/*=false*/		// If true, aligned reads bypass the page cache (O_DIRECT), when supported.
 	)
 {
 	if ( in_deviceSettings.uSchedulerTypeFlags != AK_SCHEDULER_DEFERRED_LINED_UP )
@@ -76,6 +99,21 @@ AKRESULT CAkDefaultIOHookDeferred::Init(
 	}
 	
 	m_bAsyncOpen = in_bAsyncOpen;
+
+#if defined(AK_LINUX)
+	// O_DIRECT transfers are only worth it if the device's requests are normally aligned.
+	if ( in_bDirectIO && ( in_deviceSettings.uGranularity % AK_DIRECT_IO_ALIGNMENT ) == 0 )
+	{
+		if ( in_deviceSettings.pIOMemory )
+			m_bDirectIO = ( (AkUIntPtr)in_deviceSettings.pIOMemory % AK_DIRECT_IO_ALIGNMENT ) == 0;
+		else
+			m_bDirectIO = ( in_deviceSettings.uIOMemoryAlignment % AK_DIRECT_IO_ALIGNMENT ) == 0;
+	}
+#endif
+
+	// Set up the transfer backend before the device is created, as it may start issuing transfers right away.
+	if ( InitIoUring( in_deviceSettings ) != AK_Success )
+		InitPosixAio( in_deviceSettings );
 	
 	// If the Stream Manager's File Location Resolver was not set yet, set this object as the 
 	// File Location Resolver (this I/O hook is also able to resolve file location).
@@ -89,6 +127,8 @@ AKRESULT CAkDefaultIOHookDeferred::Init(
 		return AK_Success;
 	}
 
+	TermIoUring();
+	TermPosixAio();
 	return AK_Fail;
 }
 
@@ -100,6 +140,10 @@ void CAkDefaultIOHookDeferred::Term()
 		AK::StreamMgr::SetFileLocationResolver( NULL );
 	
 	AK::StreamMgr::DestroyDevice( m_deviceID );
+
+	// All transfers have completed with the device: backends can be torn down.
+	TermIoUring();
+	TermPosixAio();
 }
 
 //
@@ -119,10 +163,13 @@ AKRESULT CAkDefaultIOHookDeferred::Open(
 	// client thread. If you want files to be opened asynchronously when it is possible, this device should 
 	// be initialized with the flag in_bAsyncOpen set to true.
 	out_fileDesc.deviceID = m_deviceID;
+	out_fileDesc.pCustomParam = NULL;
 	if ( io_bSyncOpen || !m_bAsyncOpen )
 	{
 		io_bSyncOpen = true;
-		return CAkMultipleFileLocation::Open(in_pszFileName, in_eOpenMode, in_pFlags, true, out_fileDesc);
+		AKRESULT eResult = CAkMultipleFileLocation::Open(in_pszFileName, in_eOpenMode, in_pFlags, true, out_fileDesc);
+		OpenDirect( eResult, in_eOpenMode, out_fileDesc );
+		return eResult;
 	}
 
 	// The client allows us to perform asynchronous opening.
@@ -143,10 +190,13 @@ AKRESULT CAkDefaultIOHookDeferred::Open(
 	// client thread. If you want files to be opened asynchronously when it is possible, this device should 
 	// be initialized with the flag in_bAsyncOpen set to true.
 	out_fileDesc.deviceID = m_deviceID;
+	out_fileDesc.pCustomParam = NULL;
 	if ( io_bSyncOpen || !m_bAsyncOpen )
 	{
 		io_bSyncOpen = true;
-		return CAkMultipleFileLocation::Open(in_fileID, in_eOpenMode, in_pFlags, true, out_fileDesc);
+		AKRESULT eResult = CAkMultipleFileLocation::Open(in_fileID, in_eOpenMode, in_pFlags, true, out_fileDesc);
+		OpenDirect( eResult, in_eOpenMode, out_fileDesc );
+		return eResult;
 	}
 
 	// The client allows us to perform asynchronous opening.
@@ -223,6 +273,11 @@ AKRESULT CAkDefaultIOHookDeferred::Read(
 	)
 {
 	io_transferInfo.pUserData = (void*)&in_fileDesc;
+
+	if ( m_pIoUring )
+		return SubmitIoUring( in_fileDesc, io_transferInfo, false );
+	if ( m_pPosixAio )
+		return SubmitPosixAio( in_fileDesc, io_transferInfo, false );
 	
 	//Call the low level read which takes care of error handling with the callback 
 	AioFuncRead(io_transferInfo);
@@ -238,6 +293,11 @@ AKRESULT CAkDefaultIOHookDeferred::Write(
 	)
 {
 	io_transferInfo.pUserData = (void*)&in_fileDesc;
+
+	if ( m_pIoUring )
+		return SubmitIoUring( in_fileDesc, io_transferInfo, true );
+	if ( m_pPosixAio )
+		return SubmitPosixAio( in_fileDesc, io_transferInfo, true );
 	
 	//Call the low level read which takes care of error handling with the callback 
 	AioFuncWrite(io_transferInfo);
@@ -260,14 +320,22 @@ AKRESULT CAkDefaultIOHookDeferred::Close(
 	AkFileDesc &	in_fileDesc      // File descriptor.
     )
 {
+#if defined(AK_LINUX)
+	if ( in_fileDesc.pCustomParam )
+		close( (int)( (AkUIntPtr)in_fileDesc.pCustomParam - 1 ) );
+#endif
 	return CAkFileHelpers::CloseFile( in_fileDesc.hFile );
 }
 
 // Returns the block size for the file or its storage device. 
 AkUInt32 CAkDefaultIOHookDeferred::GetBlockSize(
-    AkFileDesc &  /*in_fileDesc*/     // File descriptor.
+    AkFileDesc &  in_fileDesc     // File descriptor.
     )
 {
+	// Files that have an O_DIRECT descriptor need aligned transfers to use it.
+	if ( in_fileDesc.pCustomParam )
+		return AK_DIRECT_IO_ALIGNMENT;
+
 	// There is no limitation nor performance degradation with unaligned
 	// seeking on any mount point with asynchronous cell fs API.
     return 1;
@@ -297,3 +365,435 @@ AkUInt32 CAkDefaultIOHookDeferred::GetDeviceData()
 	return ( m_bAsyncOpen ) ? 1 : 0;
 }
 
+
+//
+// Asynchronous transfer backends.
+//-----------------------------------------------------------------------------
+#if defined(AK_LINUX)
+
+// Opens the O_DIRECT descriptor of a file that was just opened, if direct I/O is enabled.
+// It is stored in AkFileDesc::pCustomParam (offset by 1, so that NULL means none), which file packages
+// propagate to the files they contain.
+void CAkDefaultIOHookDeferred::OpenDirect( AKRESULT in_eResult, AkOpenMode in_eOpenMode, AkFileDesc & io_fileDesc )
+{
+	io_fileDesc.pCustomParam = NULL;
+	if ( in_eResult != AK_Success || !m_bDirectIO || in_eOpenMode != AK_OpenModeRead )
+		return;
+
+	char szPath[32];
+	snprintf( szPath, sizeof( szPath ), "/proc/self/fd/%d", fileno( io_fileDesc.hFile ) );
+	int fdDirect = open( szPath, O_RDONLY | O_DIRECT );
+	if ( fdDirect >= 0 )
+		io_fileDesc.pCustomParam = (void*)( (AkUIntPtr)fdDirect + 1 );
+	// Otherwise, the file system does not support O_DIRECT: use the buffered descriptor only.
+}
+
+// Returns the descriptor to use for a transfer: the O_DIRECT one if the file has one and the transfer is aligned.
+static inline int GetTransferFd( const AkFileDesc & in_fileDesc, const AkAsyncIOTransferInfo & in_transferInfo, bool in_bWrite )
+{
+	if ( !in_bWrite && in_fileDesc.pCustomParam
+		&& ( ( (AkUInt64)(AkUIntPtr)in_transferInfo.pBuffer | in_transferInfo.uFilePosition | in_transferInfo.uRequestedSize ) & ( AK_DIRECT_IO_ALIGNMENT - 1 ) ) == 0 )
+	{
+		return (int)( (AkUIntPtr)in_fileDesc.pCustomParam - 1 );
+	}
+	return fileno( in_fileDesc.hFile );
+}
+
+#if defined(AK_IO_URING_SUPPORTED)
+
+// io_uring, used through raw system calls so that liburing is not required.
+struct AkIoUring
+{
+	int						fd;
+
+	void *					pSqRing;
+	size_t					uSqRingSize;
+	void *					pCqRing;		// Same as pSqRing with IORING_FEAT_SINGLE_MMAP.
+	size_t					uCqRingSize;
+	struct io_uring_sqe *	pSqes;
+	size_t					uSqesSize;
+
+	unsigned *				pSqHead;
+	unsigned *				pSqTail;
+	unsigned *				pSqArray;
+	unsigned				uSqMask;
+	unsigned				uSqEntries;
+
+	unsigned *				pCqHead;
+	unsigned *				pCqTail;
+	struct io_uring_cqe *	pCqes;
+	unsigned				uCqMask;
+
+	AkUInt8 *				pFixedBuffer;	// I/O memory registered with the ring, if any.
+	AkUInt32				uFixedBufferSize;
+
+	CAkLock					lockSubmit;
+	AkThread				hCompletionThread;
+};
+
+static inline int AkIoUringEnter( int in_fd, unsigned in_uToSubmit, unsigned in_uMinComplete, unsigned in_uFlags )
+{
+	return (int)syscall( __NR_io_uring_enter, in_fd, in_uToSubmit, in_uMinComplete, in_uFlags, NULL, 0 );
+}
+
+// Pushes one SQE and submits it. Returns AK_Fail if the kernel did not take it, in which case it is withdrawn.
+// Sync: submit lock.
+static AKRESULT AkIoUringSubmit( AkIoUring * in_pRing, AkUInt8 in_uOpcode, int in_fd, void * in_pBuffer, AkUInt32 in_uSize, AkUInt64 in_uOffset, AkUInt64 in_uUserData )
+{
+	unsigned uTail = *in_pRing->pSqTail;
+	if ( uTail - __atomic_load_n( in_pRing->pSqHead, __ATOMIC_ACQUIRE ) >= in_pRing->uSqEntries )
+	{
+		AKASSERT( !"io_uring submission queue full: more transfers than uMaxConcurrentIO" );
+		return AK_Fail;
+	}
+
+	unsigned uIdx = uTail & in_pRing->uSqMask;
+	struct io_uring_sqe * pSqe = &in_pRing->pSqes[uIdx];
+	memset( pSqe, 0, sizeof( struct io_uring_sqe ) );
+	pSqe->opcode = in_uOpcode;
+	pSqe->fd = in_fd;
+	pSqe->off = in_uOffset;
+	pSqe->addr = (AkUInt64)(AkUIntPtr)in_pBuffer;
+	pSqe->len = in_uSize;
+	pSqe->user_data = in_uUserData;
+
+	if ( ( in_uOpcode == IORING_OP_READ || in_uOpcode == IORING_OP_WRITE )
+		&& (AkUInt8*)in_pBuffer >= in_pRing->pFixedBuffer 
+		&& (AkUInt8*)in_pBuffer + in_uSize <= in_pRing->pFixedBuffer + in_pRing->uFixedBufferSize )
+	{
+		pSqe->opcode = ( in_uOpcode == IORING_OP_READ ) ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+		pSqe->buf_index = 0;
+	}
+
+	in_pRing->pSqArray[uIdx] = uIdx;
+	__atomic_store_n( in_pRing->pSqTail, uTail + 1, __ATOMIC_RELEASE );
+
+	int iSubmitted;
+	do 
+	{
+		iSubmitted = AkIoUringEnter( in_pRing->fd, 1, 0, 0 );
+	}
+	while ( iSubmitted < 0 && errno == EINTR );
+
+	if ( iSubmitted != 1 && __atomic_load_n( in_pRing->pSqHead, __ATOMIC_ACQUIRE ) == uTail )
+	{
+		// Not consumed by the kernel: withdraw it, the callback must not be called.
+		__atomic_store_n( in_pRing->pSqTail, uTail, __ATOMIC_RELEASE );
+		return AK_Fail;
+	}
+	return AK_Success;
+}
+
+// Reaps completions and notifies the device. Stops when it gets the NOP (user data 0) pushed by TermIoUring().
+static AK_DECLARE_THREAD_ROUTINE( AkIoUringCompletionThread )
+{
+	AkIoUring * pRing = AK_GET_THREAD_ROUTINE_PARAMETER_PTR( AkIoUring );
+
+	for (;;)
+	{
+		unsigned uHead = *pRing->pCqHead;
+		if ( uHead == __atomic_load_n( pRing->pCqTail, __ATOMIC_ACQUIRE ) )
+		{
+			AkIoUringEnter( pRing->fd, 0, 1, IORING_ENTER_GETEVENTS );
+			continue;
+		}
+
+		struct io_uring_cqe * pCqe = &pRing->pCqes[uHead & pRing->uCqMask];
+		AkUInt64 uUserData = pCqe->user_data;
+		AkInt32 iResult = pCqe->res;
+		__atomic_store_n( pRing->pCqHead, uHead + 1, __ATOMIC_RELEASE );
+
+		if ( !uUserData )
+			break;
+
+		AkAsyncIOTransferInfo * pTransferInfo = (AkAsyncIOTransferInfo*)(AkUIntPtr)uUserData;
+		AKRESULT eResult = ( iResult >= 0 && (AkUInt32)iResult == pTransferInfo->uRequestedSize ) ? AK_Success : AK_Fail;
+		pTransferInfo->pCallback( pTransferInfo, eResult );
+	}
+
+	AkExitThread( AK_RETURN_THREAD_OK );
+}
+
+AKRESULT CAkDefaultIOHookDeferred::InitIoUring( const AkDeviceSettings & in_deviceSettings )
+{
+	struct io_uring_params params;
+	memset( &params, 0, sizeof( params ) );
+
+	// One more entry for the NOP that stops the completion thread.
+	int fd = (int)syscall( __NR_io_uring_setup, in_deviceSettings.uMaxConcurrentIO + 1, &params );
+	if ( fd < 0 )
+		return AK_NotImplemented;
+
+	// IORING_OP_READ/WRITE appeared with IORING_FEAT_RW_CUR_POS (Linux 5.6).
+	if ( !( params.features & IORING_FEAT_RW_CUR_POS ) )
+	{
+		close( fd );
+		return AK_NotImplemented;
+	}
+
+	AkIoUring * pRing = AkNew( AkMemID_Streaming, AkIoUring() );
+	if ( !pRing )
+	{
+		close( fd );
+		return AK_InsufficientMemory;
+	}
+	pRing->fd = fd;
+	AKPLATFORM::AkClearThread( &pRing->hCompletionThread );
+
+	pRing->uSqRingSize = params.sq_off.array + params.sq_entries * sizeof( unsigned );
+	pRing->uCqRingSize = params.cq_off.cqes + params.cq_entries * sizeof( struct io_uring_cqe );
+	if ( params.features & IORING_FEAT_SINGLE_MMAP )
+		pRing->uSqRingSize = pRing->uCqRingSize = AkMax( pRing->uSqRingSize, pRing->uCqRingSize );
+
+	pRing->pSqRing = mmap( NULL, pRing->uSqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING );
+	if ( pRing->pSqRing == MAP_FAILED )
+	{
+		pRing->pSqRing = NULL;
+		m_pIoUring = pRing;
+		TermIoUring();
+		return AK_Fail;
+	}
+
+	if ( params.features & IORING_FEAT_SINGLE_MMAP )
+		pRing->pCqRing = pRing->pSqRing;
+	else
+	{
+		pRing->pCqRing = mmap( NULL, pRing->uCqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING );
+		if ( pRing->pCqRing == MAP_FAILED )
+		{
+			pRing->pCqRing = NULL;
+			m_pIoUring = pRing;
+			TermIoUring();
+			return AK_Fail;
+		}
+	}
+
+	pRing->uSqesSize = params.sq_entries * sizeof( struct io_uring_sqe );
+	pRing->pSqes = (struct io_uring_sqe *)mmap( NULL, pRing->uSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES );
+	if ( pRing->pSqes == MAP_FAILED )
+	{
+		pRing->pSqes = NULL;
+		m_pIoUring = pRing;
+		TermIoUring();
+		return AK_Fail;
+	}
+
+	AkUInt8 * pSq = (AkUInt8*)pRing->pSqRing;
+	pRing->pSqHead = (unsigned*)( pSq + params.sq_off.head );
+	pRing->pSqTail = (unsigned*)( pSq + params.sq_off.tail );
+	pRing->pSqArray = (unsigned*)( pSq + params.sq_off.array );
+	pRing->uSqMask = *(unsigned*)( pSq + params.sq_off.ring_mask );
+	pRing->uSqEntries = *(unsigned*)( pSq + params.sq_off.ring_entries );
+
+	AkUInt8 * pCq = (AkUInt8*)pRing->pCqRing;
+	pRing->pCqHead = (unsigned*)( pCq + params.cq_off.head );
+	pRing->pCqTail = (unsigned*)( pCq + params.cq_off.tail );
+	pRing->pCqes = (struct io_uring_cqe *)( pCq + params.cq_off.cqes );
+	pRing->uCqMask = *(unsigned*)( pCq + params.cq_off.ring_mask );
+
+	// Register user-provided I/O memory, so that transfers into it do not need to map pages on each request.
+	// This may fail (e.g. RLIMIT_MEMLOCK): transfers then use regular reads.
+	if ( in_deviceSettings.pIOMemory && in_deviceSettings.uIOMemorySize )
+	{
+		struct iovec iov;
+		iov.iov_base = in_deviceSettings.pIOMemory;
+		iov.iov_len = in_deviceSettings.uIOMemorySize;
+		if ( syscall( __NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, &iov, 1 ) == 0 )
+		{
+			pRing->pFixedBuffer = (AkUInt8*)in_deviceSettings.pIOMemory;
+			pRing->uFixedBufferSize = in_deviceSettings.uIOMemorySize;
+		}
+	}
+
+	AKPLATFORM::AkCreateThread( AkIoUringCompletionThread, pRing, in_deviceSettings.threadProperties, &pRing->hCompletionThread, "AK::IoUringCompletion" );
+	if ( !AKPLATFORM::AkIsValidThread( &pRing->hCompletionThread ) )
+	{
+		m_pIoUring = pRing;
+		TermIoUring();
+		return AK_Fail;
+	}
+
+	m_pIoUring = pRing;
+	return AK_Success;
+}
+
+void CAkDefaultIOHookDeferred::TermIoUring()
+{
+	AkIoUring * pRing = m_pIoUring;
+	if ( !pRing )
+		return;
+	m_pIoUring = NULL;
+
+	if ( AKPLATFORM::AkIsValidThread( &pRing->hCompletionThread ) )
+	{
+		// Wake up and stop the completion thread.
+		{
+			AkAutoLock<CAkLock> lock( pRing->lockSubmit );
+			while ( AkIoUringSubmit( pRing, IORING_OP_NOP, -1, NULL, 0, 0, 0 ) != AK_Success )
+				AKPLATFORM::AkSleep( 1 );
+		}
+		AKPLATFORM::AkWaitForSingleThread( &pRing->hCompletionThread );
+		AKPLATFORM::AkCloseThread( &pRing->hCompletionThread );
+	}
+
+	if ( pRing->pSqes )
+		munmap( pRing->pSqes, pRing->uSqesSize );
+	if ( pRing->pCqRing && pRing->pCqRing != pRing->pSqRing )
+		munmap( pRing->pCqRing, pRing->uCqRingSize );
+	if ( pRing->pSqRing )
+		munmap( pRing->pSqRing, pRing->uSqRingSize );
+	close( pRing->fd );
+
+	AkDelete( AkMemID_Streaming, pRing );
+}
+
+AKRESULT CAkDefaultIOHookDeferred::SubmitIoUring( AkFileDesc & in_fileDesc, AkAsyncIOTransferInfo & io_transferInfo, bool in_bWrite )
+{
+	AkAutoLock<CAkLock> lock( m_pIoUring->lockSubmit );
+	return AkIoUringSubmit( 
+		m_pIoUring,
+		in_bWrite ? IORING_OP_WRITE : IORING_OP_READ,
+		GetTransferFd( in_fileDesc, io_transferInfo, in_bWrite ),
+		io_transferInfo.pBuffer,
+		io_transferInfo.uRequestedSize,
+		io_transferInfo.uFilePosition,
+		(AkUInt64)(AkUIntPtr)&io_transferInfo );
+}
+
+#else
+
+AKRESULT CAkDefaultIOHookDeferred::InitIoUring( const AkDeviceSettings & ) { return AK_NotImplemented; }
+void CAkDefaultIOHookDeferred::TermIoUring() {}
+AKRESULT CAkDefaultIOHookDeferred::SubmitIoUring( AkFileDesc &, AkAsyncIOTransferInfo &, bool ) { return AK_NotImplemented; }
+
+#endif // AK_IO_URING_SUPPORTED
+
+// POSIX AIO. Requests are taken from a pool of uMaxConcurrentIO control blocks, 
+// and completions are notified on threads managed by the AIO implementation.
+struct AkPosixAioRequest
+{
+	struct aiocb				cb;
+	AkAsyncIOTransferInfo *		pTransferInfo;
+	AkPosixAioRequest *			pNextFree;
+	AkPosixAio *				pOwner;
+};
+
+struct AkPosixAio
+{
+	AkPosixAioRequest *			pRequests;
+	AkPosixAioRequest *			pFreeRequests;
+	CAkLock						lockFreeRequests;
+};
+
+static void AkPosixAioCompletion( union sigval in_value )
+{
+	AkPosixAioRequest * pRequest = (AkPosixAioRequest*)in_value.sival_ptr;
+	AkAsyncIOTransferInfo * pTransferInfo = pRequest->pTransferInfo;
+
+	ssize_t iResult = ( aio_error( &pRequest->cb ) == 0 ) ? aio_return( &pRequest->cb ) : -1;
+	AKRESULT eResult = ( iResult >= 0 && (AkUInt32)iResult == pTransferInfo->uRequestedSize ) ? AK_Success : AK_Fail;
+
+	// Release the request before notifying: the device may issue a new transfer from the callback.
+	{
+		AkPosixAio * pAio = pRequest->pOwner;
+		AkAutoLock<CAkLock> lock( pAio->lockFreeRequests );
+		pRequest->pNextFree = pAio->pFreeRequests;
+		pAio->pFreeRequests = pRequest;
+	}
+
+	pTransferInfo->pCallback( pTransferInfo, eResult );
+}
+
+AKRESULT CAkDefaultIOHookDeferred::InitPosixAio( const AkDeviceSettings & in_deviceSettings )
+{
+	AkUInt32 uNumRequests = in_deviceSettings.uMaxConcurrentIO;
+
+	AkPosixAio * pAio = AkNew( AkMemID_Streaming, AkPosixAio() );
+	if ( !pAio )
+		return AK_InsufficientMemory;
+
+	pAio->pRequests = (AkPosixAioRequest*)AkAlloc( AkMemID_Streaming, uNumRequests * sizeof( AkPosixAioRequest ) );
+	if ( !pAio->pRequests )
+	{
+		AkDelete( AkMemID_Streaming, pAio );
+		return AK_InsufficientMemory;
+	}
+	memset( pAio->pRequests, 0, uNumRequests * sizeof( AkPosixAioRequest ) );
+
+	pAio->pFreeRequests = NULL;
+	for ( AkUInt32 i = 0; i < uNumRequests; i++ )
+	{
+		pAio->pRequests[i].pOwner = pAio;
+		pAio->pRequests[i].pNextFree = pAio->pFreeRequests;
+		pAio->pFreeRequests = &pAio->pRequests[i];
+	}
+
+#if defined(__GLIBC__)
+	// glibc services AIO requests with a thread pool: allow one thread per concurrent transfer.
+	struct aioinit init;
+	memset( &init, 0, sizeof( init ) );
+	init.aio_threads = uNumRequests;
+	init.aio_num = uNumRequests;
+	aio_init( &init );
+#endif
+
+	m_pPosixAio = pAio;
+	return AK_Success;
+}
+
+void CAkDefaultIOHookDeferred::TermPosixAio()
+{
+	if ( !m_pPosixAio )
+		return;
+
+	AkFree( AkMemID_Streaming, m_pPosixAio->pRequests );
+	AkDelete( AkMemID_Streaming, m_pPosixAio );
+	m_pPosixAio = NULL;
+}
+
+AKRESULT CAkDefaultIOHookDeferred::SubmitPosixAio( AkFileDesc & in_fileDesc, AkAsyncIOTransferInfo & io_transferInfo, bool in_bWrite )
+{
+	AkPosixAioRequest * pRequest;
+	{
+		AkAutoLock<CAkLock> lock( m_pPosixAio->lockFreeRequests );
+		pRequest = m_pPosixAio->pFreeRequests;
+		if ( !pRequest )
+		{
+			AKASSERT( !"No free AIO request: more transfers than uMaxConcurrentIO" );
+			return AK_Fail;
+		}
+		m_pPosixAio->pFreeRequests = pRequest->pNextFree;
+	}
+
+	memset( &pRequest->cb, 0, sizeof( pRequest->cb ) );
+	pRequest->cb.aio_fildes = GetTransferFd( in_fileDesc, io_transferInfo, in_bWrite );
+	pRequest->cb.aio_offset = (off_t)io_transferInfo.uFilePosition;
+	pRequest->cb.aio_buf = io_transferInfo.pBuffer;
+	pRequest->cb.aio_nbytes = io_transferInfo.uRequestedSize;
+	pRequest->cb.aio_sigevent.sigev_notify = SIGEV_THREAD;
+	pRequest->cb.aio_sigevent.sigev_notify_function = AkPosixAioCompletion;
+	pRequest->cb.aio_sigevent.sigev_value.sival_ptr = pRequest;
+	pRequest->pTransferInfo = &io_transferInfo;
+
+	int iResult = in_bWrite ? aio_write( &pRequest->cb ) : aio_read( &pRequest->cb );
+	if ( iResult != 0 )
+	{
+		AkAutoLock<CAkLock> lock( m_pPosixAio->lockFreeRequests );
+		pRequest->pNextFree = m_pPosixAio->pFreeRequests;
+		m_pPosixAio->pFreeRequests = pRequest;
+		return AK_Fail;
+	}
+	return AK_Success;
+}
+
+#else
+
+void CAkDefaultIOHookDeferred::OpenDirect( AKRESULT, AkOpenMode, AkFileDesc & ) {}
+AKRESULT CAkDefaultIOHookDeferred::InitIoUring( const AkDeviceSettings & ) { return AK_NotImplemented; }
+void CAkDefaultIOHookDeferred::TermIoUring() {}
+AKRESULT CAkDefaultIOHookDeferred::SubmitIoUring( AkFileDesc &, AkAsyncIOTransferInfo &, bool ) { return AK_NotImplemented; }
+AKRESULT CAkDefaultIOHookDeferred::InitPosixAio( const AkDeviceSettings & ) { return AK_NotImplemented; }
+void CAkDefaultIOHookDeferred::TermPosixAio() {}
+AKRESULT CAkDefaultIOHookDeferred::SubmitPosixAio( AkFileDesc &, AkAsyncIOTransferInfo &, bool ) { return AK_NotImplemented; }
+
+#endif // AK_LINUX
@@ -28,11 +28,21 @@ written agreement between you and Audiokinetic Inc.
 // at class CAkDefaultLowLevelIODispatcher).
 //
 // AK::StreamMgr::IAkIOHookDeferred: 
-// Uses standard C IO functions, into seperate thread for async IO.
-// AioFuncRead and AioFuncWrite handle the IO operation asynchronously. 
+// On Linux, transfers are submitted to an io_uring (Linux 5.6+), or to POSIX AIO
+// if io_uring is not available, so that up to AkDeviceSettings::uMaxConcurrentIO
+// transfers are in flight at once. Completion callbacks are called from the
+// completion thread of the backend. Elsewhere, or if neither is available,
+// AioFuncRead and AioFuncWrite perform the transfer in the I/O thread.
 // The AK::StreamMgr::IAkIOHookDeferred interface is meant to be used with
 // AK_SCHEDULER_DEFERRED_LINED_UP streaming devices. 
 //
+// When in_bDirectIO is set in Init(), files opened for reading get a second,
+// O_DIRECT descriptor, which is used for transfers whose buffer, position and 
+// size are aligned on AK_DIRECT_IO_ALIGNMENT. Direct I/O requires the device's
+// granularity and I/O memory alignment to be multiples of AK_DIRECT_IO_ALIGNMENT.
+// If AkDeviceSettings::pIOMemory is provided, it is registered with the io_uring
+// so that transfers into it avoid per-request page mapping.
+//
 // Init() creates a streaming device (by calling AK::StreamMgr::CreateDevice()).
 // AkDeviceSettings::uSchedulerTypeFlags is set inside to AK_SCHEDULER_DEFERRED_LINED_UP.
 // If there was no AK::StreamMgr::IAkFileLocationResolver previously registered 
@@ -97,6 +107,10 @@ written agreement between you and Audiokinetic Inc.
 #include <AK/Tools/Common/AkAssert.h>
 
 #define AK_MAX_MOUNT_POINT_STRLENGTH	(12)
+#define AK_DIRECT_IO_ALIGNMENT			(4096)	// Alignment of buffers, positions and sizes of O_DIRECT transfers.
+
+struct AkIoUring;
+struct AkPosixAio;
 
 //-----------------------------------------------------------------------------
 // Name: class CAkDefaultIOHookDeferred.
@@ -120,7 +134,8 @@ public:
 	AKRESULT Init(
 		const AkDeviceSettings &	in_deviceSettings,	// Device settings.
 		bool						in_bAsyncOpen=true,	// If true, files are opened asynchronously when possible.
-		AkOSChar * 					in_pszMountPoint=NULL	// Mount point (if NULL, SYS_DEV_HDD0 is used).
+		AkOSChar * 					in_pszMountPoint=NULL,	// Mount point (if NULL, SYS_DEV_HDD0 is used).
+		bool						in_bDirectIO=false	// If true, aligned reads bypass the page cache (O_DIRECT), when supported.
 		);
 	void Term();
 
@@ -190,9 +205,24 @@ public:
 	// Returns custom profiling data: 1 if file opens are asynchronous, 0 otherwise.
 	virtual AkUInt32 GetDeviceData();
 
-protected:	
+protected:
+	// Asynchronous transfer backends.
+	AKRESULT InitIoUring( const AkDeviceSettings & in_deviceSettings );
+	void TermIoUring();
+	AKRESULT SubmitIoUring( AkFileDesc & in_fileDesc, AkAsyncIOTransferInfo & io_transferInfo, bool in_bWrite );
+
+	AKRESULT InitPosixAio( const AkDeviceSettings & in_deviceSettings );
+	void TermPosixAio();
+	AKRESULT SubmitPosixAio( AkFileDesc & in_fileDesc, AkAsyncIOTransferInfo & io_transferInfo, bool in_bWrite );
+
+	// Opens the O_DIRECT descriptor of a file that was just opened, if direct I/O is enabled.
+	void OpenDirect( AKRESULT in_eResult, AkOpenMode in_eOpenMode, AkFileDesc & io_fileDesc );
+
 	AkDeviceID			m_deviceID;
+	AkIoUring *			m_pIoUring;		// io_uring backend, if active.
+	AkPosixAio *		m_pPosixAio;	// POSIX AIO backend, if active.
 	bool				m_bAsyncOpen;	// If true, opens files asynchronously when it can.
+	bool				m_bDirectIO;	// If true, files opened for reading get an O_DIRECT descriptor.
 	
 };
 
@@ -0,0 +1,337 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+//////////////////////////////////////////////////////////////////////
+//
+// AkFilePackageLowLevelIOMapped.h
+//
+// Memory-mapped file packages.
+//
+// CAkMappedPackage maps the whole file package in the address space
+// once its header has been parsed. Reads of files that are part of a
+// mapped package are served directly from the mapping, without system
+// calls, and complete immediately. Packages that cannot be mapped (e.g.
+// they do not fit in the address space) fall back on regular reads
+// through the package's file handle.
+//
+// CAkFilePackageLowLevelIODeferredMapped and CAkFilePackageLowLevelIOBlockingMapped
+// are the memory-mapped counterparts of CAkFilePackageLowLevelIODeferred and
+// CAkFilePackageLowLevelIOBlocking. They also expose GetFileMemory(), which
+// returns a read-only view of a packaged file. Soundbanks can be loaded
+// in place from this view with AK::SoundEngine::LoadBank(const void*, AkUInt32, AkBankID&),
+// without going through the Stream Manager's I/O memory.
+//
+// See AkFilePackageLowLevelIO.h for details on using file packages.
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef _AK_FILE_PACKAGE_LOW_LEVEL_IO_MAPPED_H_
+#define _AK_FILE_PACKAGE_LOW_LEVEL_IO_MAPPED_H_
+
+#include "../Common/AkFilePackageLowLevelIO.h"
+#include "AkDefaultIOHookBlocking.h"
+#include "AkDefaultIOHookDeferred.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//-----------------------------------------------------------------------------
+// Name: CAkMappedPackage
+// Desc: Disk package that is also mapped in memory (read-only, shared).
+//-----------------------------------------------------------------------------
+class CAkMappedPackage : public CAkDiskPackage
+{
+public:
+	// Factory for mapped package. See CAkDiskPackage::Create().
+	// Mapping failure is not an error: the package then behaves like a disk package.
+	static CAkMappedPackage * Create(
+		AkFilePackageReader & in_reader,		// File package reader.
+		const AkOSChar*		in_pszPackageName,	// Name of the file package (for memory monitoring).
+		AkUInt32 			in_uHeaderSize,		// File package header size, including the size of the header chunk AKPK_HEADER_CHUNK_DEF_SIZE.
+		AkUInt32 &			out_uReservedHeaderSize, // Size reserved for header, taking mem align into account.
+		AkUInt8 *&			out_pHeaderBuffer	// Returned address of memory for header.
+		)
+	{
+		CAkMappedPackage * pPackage = CAkFilePackage::Create<CAkMappedPackage>(
+			in_pszPackageName,
+			in_uHeaderSize,
+			in_reader.GetBlockSize(),
+			out_uReservedHeaderSize,
+			out_pHeaderBuffer );
+		if ( pPackage )
+		{
+			pPackage->m_reader = in_reader;				// Copy reader.
+			AkFileDesc* pFileDesc = in_reader.GetFileDesc();
+			pPackage->m_hFile = pFileDesc->hFile;	// Cache handle.
+			pPackage->m_pCustomParam = pFileDesc->pCustomParam;	// Cache custom param.
+			pPackage->Map();
+		}
+		return pPackage;
+	}
+
+	CAkMappedPackage(AkUInt32 in_uPackageID, AkUInt32 in_uHeaderSize, void * in_pToRelease)
+		: CAkDiskPackage(in_uPackageID, in_uHeaderSize, in_pToRelease)
+		, m_pMappedData( NULL )
+		, m_uMappedSize( 0 )
+	{ }
+
+	// Override Destroy(): Unmap before closing.
+	virtual void Destroy()
+	{
+		if ( m_pMappedData )
+			munmap( m_pMappedData, (size_t)m_uMappedSize );
+		m_pMappedData = NULL;
+		CAkDiskPackage::Destroy();
+	}
+
+	inline bool IsMapped() const { return m_pMappedData != NULL; }
+
+	// Returns the address of data at in_uPosition in the package, or NULL if this range is not mapped.
+	inline const AkUInt8 * GetMappedData( AkUInt64 in_uPosition, AkUInt64 in_uSize ) const
+	{
+		if ( !m_pMappedData
+			|| in_uPosition > m_uMappedSize
+			|| in_uSize > m_uMappedSize - in_uPosition )
+			return NULL;
+		return (const AkUInt8*)m_pMappedData + in_uPosition;
+	}
+
+	// Tells the kernel that a range of the package will be needed soon, so that it is paged in ahead of access.
+	inline void WillNeed( AkUInt64 in_uPosition, AkUInt64 in_uSize )
+	{
+		if ( !m_pMappedData || in_uPosition >= m_uMappedSize )
+			return;
+		AkUInt64 uEnd = AkMin( in_uPosition + in_uSize, m_uMappedSize );
+		AkUInt64 uPageSize = (AkUInt64)sysconf( _SC_PAGESIZE );
+		AkUInt64 uStart = in_uPosition - ( in_uPosition % uPageSize );
+		madvise( (AkUInt8*)m_pMappedData + uStart, (size_t)( uEnd - uStart ), MADV_WILLNEED );
+	}
+
+protected:
+	void Map()
+	{
+		struct stat fileStat;
+		int fd = fileno( m_hFile );
+		if ( fstat( fd, &fileStat ) != 0
+			|| fileStat.st_size <= 0
+			|| (AkUInt64)fileStat.st_size > (AkUInt64)( (size_t)-1 ) )
+			return;
+
+		void * pMapped = mmap( NULL, (size_t)fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+		if ( pMapped == MAP_FAILED )
+			return;
+
+		m_pMappedData = pMapped;
+		m_uMappedSize = (AkUInt64)fileStat.st_size;
+	}
+
+	void *				m_pMappedData;	// Base address of the mapping, NULL if the package is not mapped.
+	AkUInt64			m_uMappedSize;	// Size of the mapping (whole package file).
+};
+
+//-----------------------------------------------------------------------------
+// Name: class CAkFilePackageLowLevelIOMapped.
+// Desc: CAkFilePackageLowLevelIO with memory-mapped packages. Services shared by
+//		 the blocking and deferred versions below.
+//-----------------------------------------------------------------------------
+template <class T_LLIOHOOK_FILELOC>
+class CAkFilePackageLowLevelIOMapped
+	: public CAkFilePackageLowLevelIO<T_LLIOHOOK_FILELOC, CAkMappedPackage>
+{
+public:
+	typedef CAkFilePackageLowLevelIO<T_LLIOHOOK_FILELOC, CAkMappedPackage> tBase;
+
+	CAkFilePackageLowLevelIOMapped() {}
+	virtual ~CAkFilePackageLowLevelIOMapped() {}
+
+	// Returns a read-only view of a file that is part of a loaded, mapped package.
+	// The view is valid until the package is unloaded. Returns AK_FileNotFound if the file
+	// is not in a mapped package; use regular streaming in this case.
+	// Note: Files are placed in the package on their block size boundary. Soundbanks must be packaged
+	// with a block size that is a multiple of AK_BANK_PLATFORM_DATA_ALIGNMENT in order to be
+	// loaded in place (AK_DataAlignmentError is returned otherwise).
+	AKRESULT GetFileMemory(
+		AkFileID			in_fileID,		// File ID.
+		AkFileSystemFlags *	in_pFlags,		// Special flags (company ID, codec ID and language).
+		const void *&		out_pData,		// Returned address of file data.
+		AkUInt32 &			out_uSize		// Returned file size.
+		)
+	{
+		AkAutoLock<CAkLock> lock( tBase::m_lock );
+		ListFilePackages::Iterator it = tBase::m_packages.Begin();
+		while ( it != tBase::m_packages.End() )
+		{
+			AKRESULT eResult = _GetFileMemory( (CAkMappedPackage*)(*it), in_fileID, in_pFlags, out_pData, out_uSize );
+			if ( eResult != AK_FileNotFound )
+				return eResult;
+			++it;
+		}
+		return AK_FileNotFound;
+	}
+
+	// Same as above, for soundbanks referenced by name.
+	AKRESULT GetFileMemory(
+		const AkOSChar *	in_pszFileName,	// Soundbank file name.
+		AkFileSystemFlags *	in_pFlags,		// Special flags (company ID, codec ID and language).
+		const void *&		out_pData,		// Returned address of file data.
+		AkUInt32 &			out_uSize		// Returned file size.
+		)
+	{
+		AkAutoLock<CAkLock> lock( tBase::m_lock );
+		ListFilePackages::Iterator it = tBase::m_packages.Begin();
+		while ( it != tBase::m_packages.End() )
+		{
+			AkFileID fileID = (*it)->lut.GetSoundBankID( in_pszFileName );
+			AKRESULT eResult = _GetFileMemory( (CAkMappedPackage*)(*it), fileID, in_pFlags, out_pData, out_uSize );
+			if ( eResult != AK_FileNotFound )
+				return eResult;
+			++it;
+		}
+		return AK_FileNotFound;
+	}
+
+protected:
+	// Serves a read from the package mapping, if the file is part of a mapped package.
+	// Returns false if the read must go through the base hook.
+	bool ReadMapped(
+		AkFileDesc &			in_fileDesc,		// File descriptor.
+		const AkIoHeuristics &	in_heuristics,		// Heuristics for this data transfer.
+		void *					out_pBuffer,		// Buffer to be filled with data.
+		AkUInt64				in_uFilePosition,	// Position in package.
+		AkUInt32				in_uRequestedSize	// Size to read.
+		)
+	{
+		if ( !tBase::IsInPackage( in_fileDesc ) )
+			return false;
+
+		CAkMappedPackage * pPackage = (CAkMappedPackage*)in_fileDesc.pPackage;
+		const AkUInt8 * pData = pPackage->GetMappedData( in_uFilePosition, in_uRequestedSize );
+		if ( !pData )
+			return false;
+
+		// Streams read sequentially. For streams that matter the most, have the next transfer paged
+		// in while this one is consumed. Others rely on the kernel's default read-around.
+		if ( in_heuristics.priority >= AK_DEFAULT_PRIORITY )
+			pPackage->WillNeed( in_uFilePosition, 2 * (AkUInt64)in_uRequestedSize );
+
+		AKPLATFORM::AkMemCpy( out_pBuffer, pData, in_uRequestedSize );
+		return true;
+	}
+
+	template <class T_FILEID>
+	AKRESULT _GetFileMemory(
+		CAkMappedPackage *	in_pPackage,	// Package to search into.
+		T_FILEID			in_fileID,		// File ID.
+		AkFileSystemFlags *	in_pFlags,		// Special flags.
+		const void *&		out_pData,		// Returned address of file data.
+		AkUInt32 &			out_uSize		// Returned file size.
+		)
+	{
+		AKASSERT( in_pFlags );
+		if ( !in_pPackage->IsMapped() )
+			return AK_FileNotFound;
+
+		const CAkFilePackageLUT::AkFileEntry<T_FILEID> * pEntry = in_pPackage->lut.LookupFile( in_fileID, in_pFlags );
+		if ( !pEntry )
+			return AK_FileNotFound;
+
+		AkUInt64 uPosition = (AkUInt64)pEntry->uStartBlock * pEntry->uBlockSize;
+		const AkUInt8 * pData = in_pPackage->GetMappedData( uPosition, pEntry->uFileSize );
+		if ( !pData )
+			return AK_Fail;	// Entry lies outside of the package.
+
+		if ( in_pFlags->uCodecID == AKCODECID_BANK
+			&& ( (AkUIntPtr)pData % AK_BANK_PLATFORM_DATA_ALIGNMENT ) != 0 )
+			return AK_DataAlignmentError;
+
+		// The whole file is about to be read.
+		in_pPackage->WillNeed( uPosition, pEntry->uFileSize );
+
+		out_pData = pData;
+		out_uSize = pEntry->uFileSize;
+		return AK_Success;
+	}
+};
+
+//-----------------------------------------------------------------------------
+// Name: class CAkFilePackageLowLevelIODeferredMapped.
+// Desc: Deferred I/O hook with memory-mapped packages. Reads of mapped files
+//		 complete from within Read().
+//-----------------------------------------------------------------------------
+class CAkFilePackageLowLevelIODeferredMapped
+	: public CAkFilePackageLowLevelIOMapped<CAkDefaultIOHookDeferred>
+{
+public:
+	CAkFilePackageLowLevelIODeferredMapped() {}
+	virtual ~CAkFilePackageLowLevelIODeferredMapped() {}
+
+	// Override Read: Copy from the mapping and notify completion right away.
+	virtual AKRESULT Read(
+		AkFileDesc &			in_fileDesc,        // File descriptor.
+		const AkIoHeuristics &	in_heuristics,		// Heuristics for this data transfer.
+		AkAsyncIOTransferInfo & io_transferInfo		// Asynchronous data transfer info.
+		)
+	{
+		if ( ReadMapped( in_fileDesc, in_heuristics, io_transferInfo.pBuffer, io_transferInfo.uFilePosition, io_transferInfo.uRequestedSize ) )
+		{
+			io_transferInfo.pCallback( &io_transferInfo, AK_Success );
+			return AK_Success;
+		}
+		return CAkDefaultIOHookDeferred::Read( in_fileDesc, in_heuristics, io_transferInfo );
+	}
+
+	// Override Cancel: See CAkFilePackageLowLevelIODeferred::Cancel().
+	void Cancel(
+		AkFileDesc &			in_fileDesc,		// File descriptor.
+		AkAsyncIOTransferInfo & io_transferInfo,	// Transfer info to cancel.
+		bool & io_bCancelAllTransfersForThisFile	// Flag indicating whether all transfers should be cancelled for this file (see notes in function description).
+		)
+	{
+		if ( !IsInPackage( in_fileDesc ) )
+		{
+			CAkDefaultIOHookDeferred::Cancel(
+				in_fileDesc,		// File descriptor.
+				io_transferInfo,	// Transfer info to cancel.
+				io_bCancelAllTransfersForThisFile	// Flag indicating whether all transfers should be cancelled for this file (see notes in function description).
+				);
+		}
+	}
+};
+
+//-----------------------------------------------------------------------------
+// Name: class CAkFilePackageLowLevelIOBlockingMapped.
+// Desc: Blocking I/O hook with memory-mapped packages.
+//-----------------------------------------------------------------------------
+class CAkFilePackageLowLevelIOBlockingMapped
+	: public CAkFilePackageLowLevelIOMapped<CAkDefaultIOHookBlocking>
+{
+public:
+	CAkFilePackageLowLevelIOBlockingMapped() {}
+	virtual ~CAkFilePackageLowLevelIOBlockingMapped() {}
+
+	// Override Read: Copy from the mapping.
+	virtual AKRESULT Read(
+		AkFileDesc &			in_fileDesc,        // File descriptor.
+		const AkIoHeuristics &	in_heuristics,		// Heuristics for this data transfer.
+		void *					out_pBuffer,        // Buffer to be filled with data.
+		AkIOTransferInfo &		io_transferInfo		// Synchronous data transfer info.
+		)
+	{
+		if ( ReadMapped( in_fileDesc, in_heuristics, out_pBuffer, io_transferInfo.uFilePosition, io_transferInfo.uRequestedSize ) )
+			return AK_Success;
+		return CAkDefaultIOHookBlocking::Read( in_fileDesc, in_heuristics, out_pBuffer, io_transferInfo );
+	}
+};
+
+#endif //_AK_FILE_PACKAGE_LOW_LEVEL_IO_MAPPED_H_
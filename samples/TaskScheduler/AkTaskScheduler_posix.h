@@ -0,0 +1,416 @@
+/*******************************************************************************
+The content of this file includes portions of the AUDIOKINETIC Wwise Technology
+released in source code form as part of the SDK installer package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use this file in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Apache License Usage
+
+Alternatively, this file may be used under the Apache License, Version 2.0 (the
+"Apache License"); you may not use this file except in compliance with the
+Apache License. You may obtain a copy of the Apache License at
+http://www.apache.org/licenses/LICENSE-2.0.
+
+Unless required by applicable law or agreed to in writing, software distributed
+under the Apache License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES
+OR CONDITIONS OF ANY KIND, either express or implied. See the Apache License for
+the specific language governing permissions and limitations under the License.
+
+  Version: v2019.2.5  Build: 7349
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+*******************************************************************************/
+
+#pragma once
+
+/// \file
+/// Work-stealing implementation of the Wwise Task Scheduler interface for POSIX platforms (pthreads).
+/// Each participating thread (the caller of ParallelForFunc plus the worker threads) owns a contiguous
+/// sub-range of the work. Owners consume their range from the front, tile by tile; idle threads steal
+/// the back half of another thread's range. Workers spin for a bounded time between jobs, then sleep.
+/// Usage:
+/// \code
+/// AkTaskScheduler::Init();
+/// AkTaskScheduler::InitDesc( initSettings.taskSchedulerDesc );
+/// AK::SoundEngine::Init( &initSettings, &platformInitSettings );
+/// ...
+/// AK::SoundEngine::Term();
+/// AkTaskScheduler::Term();
+/// \endcode
+
+#include <AK/SoundEngine/Common/AkSoundEngine.h>
+#include <AK/SoundEngine/Common/AkAtomic.h>
+#include <AK/Tools/Common/AkPlatformFuncs.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#define AK_TASKSCHEDULER_MAX_THREADS		64		///< Maximum number of participating threads (worker threads + calling thread).
+#define AK_TASKSCHEDULER_TILES_PER_THREAD	4		///< Target number of tiles per participating thread when the tile size is adapted to the range.
+#define AK_TASKSCHEDULER_SPIN_COUNT			4000	///< Number of polls performed by idle workers before going to sleep.
+
+namespace AkTaskScheduler
+{
+	namespace WorkStealing
+	{
+		/// Work range owned by one participating thread, packed as (begin << 32 | end) so that
+		/// the owner (front) and thieves (back) can update it with a single compare-and-swap.
+		struct Range
+		{
+			AK_ALIGN( AkAtomic64 packed, 64 );	// One cache line per range to avoid false sharing.
+		};
+
+		/// Per-worker wake-up state.
+		struct Worker
+		{
+			AK_ALIGN( AkAtomic32 bSleeping, 64 );
+			AkUInt32	uIdxThread;
+			AkThread	hThread;
+			AkEvent		eventWake;
+		};
+
+		/// Description of the parallel-for currently being executed.
+		struct Job
+		{
+			void *				pData;
+			AkParallelForFunc	func;
+			void *				pUserData;
+			AkUInt32			uGrain;
+		};
+
+		struct Pool
+		{
+			Range			ranges[AK_TASKSCHEDULER_MAX_THREADS];
+			Worker			workers[AK_TASKSCHEDULER_MAX_THREADS];
+			Job				job;
+			pthread_mutex_t	lockDispatch;
+			AkAtomic32		iGeneration;	// Incremented each time a job is published (or on termination).
+			AkAtomic32		uPending;		// Number of workers that have not yet released the current job.
+			AkAtomic32		bStop;
+			AkUInt32		uNumThreads;	// Worker threads + calling thread. 0 when not initialized.
+		};
+
+		inline Pool & GetPool()
+		{
+			static Pool s_pool = { };
+			return s_pool;
+		}
+
+		/// Index of the participating thread running the calling code, or -1 on threads that do not belong to the pool.
+		inline AkInt32 & CurrentThreadIndex()
+		{
+			static __thread AkInt32 s_iIdxThread = -1;
+			return s_iIdxThread;
+		}
+
+		inline AkInt64 PackRange( AkUInt32 in_uBegin, AkUInt32 in_uEnd )
+		{
+			return (AkInt64)( ( (AkUInt64)in_uBegin << 32 ) | in_uEnd );
+		}
+
+		inline AkUInt32 RangeBegin( AkInt64 in_packed ) { return (AkUInt32)( (AkUInt64)in_packed >> 32 ); }
+		inline AkUInt32 RangeEnd( AkInt64 in_packed ) { return (AkUInt32)( (AkUInt64)in_packed & 0xFFFFFFFF ); }
+
+		/// Owner side: take up to in_uGrain items from the front of the range.
+		inline bool PopFront( Range & io_range, AkUInt32 in_uGrain, AkUInt32 & out_uBegin, AkUInt32 & out_uEnd )
+		{
+			for ( ;; )
+			{
+				AkInt64 cur = AkAtomicLoad64( &io_range.packed );
+				AkUInt32 uBegin = RangeBegin( cur );
+				AkUInt32 uEnd = RangeEnd( cur );
+				if ( uBegin >= uEnd )
+					return false;
+				AkUInt32 uTake = AkMin( in_uGrain, uEnd - uBegin );
+				if ( AkAtomicCas64( &io_range.packed, PackRange( uBegin + uTake, uEnd ), cur ) )
+				{
+					out_uBegin = uBegin;
+					out_uEnd = uBegin + uTake;
+					return true;
+				}
+			}
+		}
+
+		/// Thief side: take the back half of the range (all of it if a single item remains).
+		inline bool StealBack( Range & io_range, AkUInt32 & out_uBegin, AkUInt32 & out_uEnd )
+		{
+			for ( ;; )
+			{
+				AkInt64 cur = AkAtomicLoad64( &io_range.packed );
+				AkUInt32 uBegin = RangeBegin( cur );
+				AkUInt32 uEnd = RangeEnd( cur );
+				if ( uBegin >= uEnd )
+					return false;
+				AkUInt32 uMid = uBegin + ( uEnd - uBegin ) / 2;
+				if ( AkAtomicCas64( &io_range.packed, PackRange( uBegin, uMid ), cur ) )
+				{
+					out_uBegin = uMid;
+					out_uEnd = uEnd;
+					return true;
+				}
+			}
+		}
+
+		/// Process the current job from participating thread in_uIdxThread until no work remains anywhere.
+		inline void ProcessJob( Pool & in_pool, AkUInt32 in_uIdxThread )
+		{
+			const Job & job = in_pool.job;
+			Range & myRange = in_pool.ranges[in_uIdxThread];
+
+			AkTaskContext ctx;
+			ctx.uIdxThread = in_uIdxThread;
+
+			for ( ;; )
+			{
+				AkUInt32 uBegin, uEnd;
+				while ( PopFront( myRange, job.uGrain, uBegin, uEnd ) )
+					job.func( job.pData, uBegin, uEnd, ctx, job.pUserData );
+
+				// Own range is empty: steal from the others, starting with our neighbour.
+				bool bStole = false;
+				for ( AkUInt32 i = 1; i < in_pool.uNumThreads && !bStole; ++i )
+				{
+					AkUInt32 uVictim = ( in_uIdxThread + i ) % in_pool.uNumThreads;
+					if ( StealBack( in_pool.ranges[uVictim], uBegin, uEnd ) )
+					{
+						// Only the owner writes its empty range back, so a plain store is safe here.
+						AkAtomicStore64( &myRange.packed, PackRange( uBegin, uEnd ) );
+						bStole = true;
+					}
+				}
+
+				if ( !bStole )
+					return;
+			}
+		}
+
+		/// Bounded spin waiting for a new job; returns true if one was published.
+		inline bool SpinForJob( Pool & in_pool, AkInt32 in_iLastGeneration )
+		{
+			for ( AkUInt32 i = 0; i < AK_TASKSCHEDULER_SPIN_COUNT; ++i )
+			{
+				if ( AkAtomicLoad32( &in_pool.iGeneration ) != in_iLastGeneration )
+					return true;
+				if ( ( i & 63 ) == 63 )
+					sched_yield();
+			}
+			return false;
+		}
+
+		inline AK_DECLARE_THREAD_ROUTINE( WorkerThreadFunc )
+		{
+			Worker & worker = *AK_GET_THREAD_ROUTINE_PARAMETER_PTR( Worker );
+			Pool & pool = GetPool();
+			CurrentThreadIndex() = (AkInt32)worker.uIdxThread;
+
+			AkInt32 iLastGeneration = 0;
+			for ( ;; )
+			{
+				if ( !SpinForJob( pool, iLastGeneration ) )
+				{
+					// Go to sleep. Whoever clears bSleeping first decides: if it is the dispatcher, it posts the event
+					// and we must consume it; if it is us (a job arrived in the meantime), nobody posts.
+					AkAtomicStore32( &worker.bSleeping, 1 );
+					AK_ATOMIC_FENCE_FULL_BARRIER();
+					if ( AkAtomicLoad32( &pool.iGeneration ) == iLastGeneration
+						|| AkAtomicExchange32( &worker.bSleeping, 0 ) == 0 )
+					{
+						AKPLATFORM::AkWaitForEvent( worker.eventWake );
+					}
+					if ( AkAtomicLoad32( &pool.iGeneration ) == iLastGeneration )
+						continue;
+				}
+
+				iLastGeneration = AkAtomicLoad32( &pool.iGeneration );
+				if ( AkAtomicLoad32( &pool.bStop ) )
+					break;
+
+				ProcessJob( pool, worker.uIdxThread );
+				AkAtomicDec32( &pool.uPending );
+			}
+
+			AK_THREAD_RETURN( AK_RETURN_THREAD_OK );
+		}
+
+		inline void RunSerial( void * in_pData, AkUInt32 in_uIdxBegin, AkUInt32 in_uIdxEnd, AkParallelForFunc in_func, void * in_pUserData, AkUInt32 in_uIdxThread )
+		{
+			AkTaskContext ctx;
+			ctx.uIdxThread = in_uIdxThread;
+			in_func( in_pData, in_uIdxBegin, in_uIdxEnd, ctx, in_pUserData );
+		}
+	}
+
+	static void ParallelForFunc(
+		void * in_pData,
+		AkUInt32 in_uIdxBegin,
+		AkUInt32 in_uIdxEnd,
+		AkUInt32 in_uTileSize,
+		AkParallelForFunc in_func,
+		void * in_pUserData,
+		const char * /*in_szDebugName*/)
+	{
+		using namespace WorkStealing;
+		Pool & pool = GetPool();
+
+		if ( in_uIdxBegin >= in_uIdxEnd )
+			return;
+
+		// Nested call from a task: run inline on the current worker rather than waiting on the pool we are part of.
+		AkInt32 iIdxThread = CurrentThreadIndex();
+		if ( iIdxThread >= 0 )
+		{
+			RunSerial( in_pData, in_uIdxBegin, in_uIdxEnd, in_func, in_pUserData, (AkUInt32)iIdxThread );
+			return;
+		}
+
+		if ( pool.uNumThreads <= 1 )
+		{
+			RunSerial( in_pData, in_uIdxBegin, in_uIdxEnd, in_func, in_pUserData, 0 );
+			return;
+		}
+
+		// Adapt the tile size to the range so that every thread gets a few tiles to balance with, but never exceed the requested maximum.
+		const AkUInt32 uCount = in_uIdxEnd - in_uIdxBegin;
+		const AkUInt32 uMaxTile = AkMax( in_uTileSize, 1U );
+		AkUInt32 uGrain = uCount / ( pool.uNumThreads * AK_TASKSCHEDULER_TILES_PER_THREAD );
+		uGrain = AkClamp( uGrain, 1U, uMaxTile );
+
+		if ( uCount <= uGrain )
+		{
+			RunSerial( in_pData, in_uIdxBegin, in_uIdxEnd, in_func, in_pUserData, 0 );
+			return;
+		}
+
+		// External callers (e.g. audio thread and spatial audio thread) are serialized: the pool runs one job at a time.
+		pthread_mutex_lock( &pool.lockDispatch );
+		CurrentThreadIndex() = 0;
+
+		pool.job.pData = in_pData;
+		pool.job.func = in_func;
+		pool.job.pUserData = in_pUserData;
+		pool.job.uGrain = uGrain;
+
+		// Initial even split of the range among participating threads.
+		const AkUInt32 uNumThreads = pool.uNumThreads;
+		AkUInt32 uBegin = in_uIdxBegin;
+		for ( AkUInt32 i = 0; i < uNumThreads; ++i )
+		{
+			AkUInt32 uEnd = in_uIdxBegin + (AkUInt32)( ( (AkUInt64)uCount * ( i + 1 ) ) / uNumThreads );
+			AkAtomicStore64( &pool.ranges[i].packed, PackRange( uBegin, uEnd ) );
+			uBegin = uEnd;
+		}
+
+		AkAtomicStore32( &pool.uPending, (AkInt32)( uNumThreads - 1 ) );
+		AkAtomicInc32( &pool.iGeneration );
+		AK_ATOMIC_FENCE_FULL_BARRIER();
+		for ( AkUInt32 i = 1; i < uNumThreads; ++i )
+		{
+			if ( AkAtomicExchange32( &pool.workers[i].bSleeping, 0 ) == 1 )
+				AKPLATFORM::AkSignalEvent( pool.workers[i].eventWake );
+		}
+
+		ProcessJob( pool, 0 );
+
+		// Wait for workers to release the job: they may still be running their last tile, and the job data lives on our stack.
+		for ( AkUInt32 uSpin = 0; AkAtomicLoad32( &pool.uPending ) != 0; ++uSpin )
+		{
+			if ( ( uSpin & 63 ) == 63 )
+				sched_yield();
+		}
+
+		CurrentThreadIndex() = -1;
+		pthread_mutex_unlock( &pool.lockDispatch );
+	}
+
+	/// Start the worker threads.
+	/// \param in_uNumWorkerThreads Number of worker threads to create, not counting the thread calling ParallelForFunc. 0 means one per online CPU minus one.
+	/// \param in_bPinWorkers Pin each worker to its own CPU.
+	inline AKRESULT Init( AkUInt32 in_uNumWorkerThreads = 0, bool in_bPinWorkers = true )
+	{
+		using namespace WorkStealing;
+		Pool & pool = GetPool();
+		AKASSERT( pool.uNumThreads <= 1 );
+
+		long lNumCpus = sysconf( _SC_NPROCESSORS_ONLN );
+		if ( lNumCpus < 1 )
+			lNumCpus = 1;
+		if ( in_uNumWorkerThreads == 0 )
+			in_uNumWorkerThreads = (AkUInt32)lNumCpus - 1;
+		in_uNumWorkerThreads = AkMin( in_uNumWorkerThreads, (AkUInt32)( AK_TASKSCHEDULER_MAX_THREADS - 1 ) );
+
+		pthread_mutex_init( &pool.lockDispatch, NULL );
+		AkAtomicStore32( &pool.iGeneration, 0 );
+		AkAtomicStore32( &pool.uPending, 0 );
+		AkAtomicStore32( &pool.bStop, 0 );
+		pool.uNumThreads = 1;
+
+		AkThreadProperties threadProperties;
+		AKPLATFORM::AkGetDefaultThreadProperties( threadProperties );
+		threadProperties.uSchedPolicy = SCHED_OTHER;
+		threadProperties.nPriority = sched_get_priority_min( SCHED_OTHER );
+
+		for ( AkUInt32 i = 1; i <= in_uNumWorkerThreads; ++i )
+		{
+			Worker & worker = pool.workers[i];
+			worker.uIdxThread = i;
+			AkAtomicStore32( &worker.bSleeping, 0 );
+			if ( AKPLATFORM::AkCreateEvent( worker.eventWake ) != AK_Success )
+				break;
+
+			AKPLATFORM::AkCreateThread( WorkerThreadFunc, &worker, threadProperties, &worker.hThread, "AK::TaskScheduler" );
+			if ( !AKPLATFORM::AkIsValidThread( &worker.hThread ) )
+			{
+				AKPLATFORM::AkDestroyEvent( worker.eventWake );
+				break;
+			}
+			if ( in_bPinWorkers )
+			{
+				// Worker i runs on CPU i; CPU 0 is left to the calling thread.
+				cpu_set_t affinity;
+				CPU_ZERO( &affinity );
+				CPU_SET( i % lNumCpus, &affinity );
+				pthread_setaffinity_np( worker.hThread, sizeof( cpu_set_t ), &affinity );
+			}
+			++pool.uNumThreads;
+		}
+
+		return AK_Success;
+	}
+
+	/// Stop and join the worker threads. The sound engine must be terminated first.
+	inline void Term()
+	{
+		using namespace WorkStealing;
+		Pool & pool = GetPool();
+		if ( pool.uNumThreads == 0 )
+			return;
+
+		AkAtomicStore32( &pool.bStop, 1 );
+		AkAtomicInc32( &pool.iGeneration );
+		AK_ATOMIC_FENCE_FULL_BARRIER();
+		for ( AkUInt32 i = 1; i < pool.uNumThreads; ++i )
+		{
+			if ( AkAtomicExchange32( &pool.workers[i].bSleeping, 0 ) == 1 )
+				AKPLATFORM::AkSignalEvent( pool.workers[i].eventWake );
+		}
+		for ( AkUInt32 i = 1; i < pool.uNumThreads; ++i )
+		{
+			AKPLATFORM::AkWaitForSingleThread( &pool.workers[i].hThread );
+			AKPLATFORM::AkCloseThread( &pool.workers[i].hThread );
+			AKPLATFORM::AkDestroyEvent( pool.workers[i].eventWake );
+		}
+
+		pthread_mutex_destroy( &pool.lockDispatch );
+		pool.uNumThreads = 0;
+	}
+
+	inline void InitDesc(AkTaskSchedulerDesc & io_desc)
+	{
+		io_desc.uNumSchedulerWorkerThreads = AkMax( WorkStealing::GetPool().uNumThreads, 1U );
+		io_desc.fcnParallelFor = ParallelForFunc;
+	}
+}
@@ -81,34 +81,26 @@ struct AkLimiterKey{
 	AkUInt64 key;
 };
 
-struct AkSortedPBIGetKey
-{	
-	static AkForceInline AkPriorityStruct& Get(CAkPBI*& in_item)
-	{
-		return in_item->GetPriorityKey();
-	}
-};
-
 class CAkLimiter;
 template<class OWNER_CLASS>
 struct AkPBIPriorityCompare
 {
 public:	
-	static AkForceInline bool IsNewer(AkPriorityStruct &a, AkPriorityStruct &b)
+	static AkForceInline bool IsNewer(const AkPriorityStruct &a, const AkPriorityStruct &b)
 	{		
 		if(a.seqID == b.seqID)
 			return a.pipelineID > b.pipelineID;	
 		return a.seqID > b.seqID;
 	}
 
-	static AkForceInline bool IsOlder(AkPriorityStruct &a, AkPriorityStruct &b)
+	static AkForceInline bool IsOlder(const AkPriorityStruct &a, const AkPriorityStruct &b)
 	{		
 		if(a.seqID == b.seqID)
 			return a.pipelineID < b.pipelineID;
 		return a.seqID < b.seqID;
 	}
 	
-	static AkForceInline bool Lesser(void* in_pLimiter, AkPriorityStruct &a, AkPriorityStruct &b)
+	static AkForceInline bool Lesser(void* in_pLimiter, const AkPriorityStruct &a, const AkPriorityStruct &b)
 	{
 		if(a.GetPriority() == b.GetPriority())
 		{
@@ -119,20 +111,28 @@ public:
 		}
 		return a.GetPriority() > b.GetPriority();
 	}
+};
 
-	static AkForceInline bool Equal(void* in_pLimiter, AkPriorityStruct &a, AkPriorityStruct &b)
-	{
-		return a == b;
-	}
+// Entry of a CAkLimiter heap.
+struct AkLimiterHeapItem
+{
+	AkPriorityStruct key;	// Copy of the PBI's priority key, so that comparisons do not have to touch the PBI.
+	CAkPBI * pPBI;
+	AkUInt32 * pHeapIdx;	// Where the PBI stores its index in this heap (see CAkPBI::m_LimiterHeapIdx). Kept up to date when the item moves.
 };
 
+typedef AkArray<AkLimiterHeapItem, const AkLimiterHeapItem&, ArrayPoolDefault> AkLimiterHeap;
 
-typedef AkSortedKeyArray<AkPriorityStruct, CAkPBI*, ArrayPoolDefault, AkSortedPBIGetKey, AkGrowByPolicy_DEFAULT, AkAssignmentMovePolicy<CAkPBI*>, AkPBIPriorityCompare<CAkLimiter> > AkSortedPBIPriorityList;
-class CAkLimiter : public AkSortedPBIPriorityList
+// Limiters keep their PBIs in a binary heap indexed from the PBIs, so that priority changes cost O(log n).
+// The item at the top of the heap is the one with the highest priority, that is, the last one to be killed.
+// The heap is not sorted: UpdateFlags() and CAkURenderer::Kick() must not rely on the iteration order of the items.
+class CAkLimiter
 {
 public:
 	CAkLimiter( AkUInt16 in_u16LimiterMax, bool in_bDoesKillNewest, bool in_bAllowUseVirtualBehavior );
 
+	void Term() { m_heap.Term(); }
+
 	void SetKey( AkLimiterKey::LimiterType in_limiterType, AkUInt64 in_depth, AkUInt64 in_shortId )
 	{
 		m_limiterKey.SetKey( in_limiterType, in_depth, in_shortId );
@@ -146,12 +146,16 @@ public:
 		}
 	};
 
-	AKRESULT Add( CAkPBI* in_pPBI );
-	void Remove( CAkPBI* in_pPBI );
-	void Update( AkReal32 in_NewPriority, CAkPBI* in_pPBI );
+	// io_pHeapIdx must remain valid for as long as the PBI is in the limiter. It is set to AK_INVALID_LIMITER_HEAP_IDX if the PBI could not be added.
+	AKRESULT Add( CAkPBI* in_pPBI, AkUInt32* io_pHeapIdx );
+	void Remove( CAkPBI* in_pPBI, AkUInt32 in_uHeapIdx );
+	void Update( AkReal32 in_NewPriority, CAkPBI* in_pPBI, AkUInt32 in_uHeapIdx );
 
 	void UpdateFlags();
 
+	// Frees the traversal memory shared by all limiters' UpdateFlags().
+	static void TermScratch() { s_frontier.Term(); }
+
 	void UpdateMax( AkUInt16 in_u16LimiterMax )
 	{
 		m_u16LimiterMax = in_u16LimiterMax;
@@ -186,6 +190,18 @@ public:
 
 	void DecrementVirtual() { m_u16CurrentVirtual--; }
 
+	bool IsEmpty() const { return m_heap.IsEmpty(); }
+	AkUInt32 Length() const { return m_heap.Length(); }
+
+	// Items, in heap order.
+	const AkLimiterHeapItem & GetItem( AkUInt32 in_uIdx ) const { return m_heap[in_uIdx]; }
+
+	// True if a PBI keyed with in_a is killed after a PBI keyed with in_b.
+	AkForceInline bool Precedes( const AkPriorityStruct & in_a, const AkPriorityStruct & in_b )
+	{
+		return AkPBIPriorityCompare<CAkLimiter>::Lesser( this, in_a, in_b );
+	}
+
 protected:	
 
 	AkUInt16	m_u16LimiterMax;
@@ -198,10 +214,25 @@ public:
 	CAkLimiter *pNextLightItem;	//For AkListBareLight
 
 private:
+	AkForceInline void Place( AkUInt32 in_uIdx, const AkLimiterHeapItem & in_item )
+	{
+		m_heap[in_uIdx] = in_item;
+		*in_item.pHeapIdx = in_uIdx;
+	}
+
+	void SiftUp( AkUInt32 in_uIdx );
+	void SiftDown( AkUInt32 in_uIdx );
+	void Heapify();
+
+	AkLimiterHeap m_heap;
+
 	AkLimiterKey m_limiterKey;
 
 	AkUInt16 m_u16Current;
 	AkUInt16 m_u16CurrentVirtual;
+
+	// Heap indices still to visit in UpdateFlags(), itself ordered as a heap. Shared by all limiters, as they are only processed from the audio thread.
+	static AkArray<AkUInt32, AkUInt32, ArrayPoolDefault> s_frontier;
 };
 
 class CAkParamTargetLimiter: public CAkParameterTarget, public CAkLimiter
@@ -1297,3 +1297,123 @@ AkReal32  CAkListener::ComputeRayDistanceAndAngles(
 	return fScaledDistance;
 }
 
+
+// Only x86 has exact vector square root and division; elsewhere, the approximations of AkSimd.h would alter distances.
+#if defined( AKSIMD_V4F32_SUPPORTED ) && ( defined( AK_CPU_X86 ) || defined( AK_CPU_X86_64 ) )
+
+// Vector version of AkMath::FastACos(), evaluated in the same order.
+static AkForceInline AKSIMD_V4F32 FastACos_V4F32( const AKSIMD_V4F32 & in_vX )
+{
+	const AKSIMD_V4F32 vX = AKSIMD_ABS_V4F32( in_vX );
+	AKSIMD_V4F32 vPoly = AKSIMD_MUL_V4F32( AKSIMD_SET_V4F32( 84.31466202f ), vX );
+	vPoly = AKSIMD_MUL_V4F32( AKSIMD_ADD_V4F32( AKSIMD_SET_V4F32( -242.7199627f ), vPoly ), vX );
+	vPoly = AKSIMD_MUL_V4F32( AKSIMD_ADD_V4F32( AKSIMD_SET_V4F32( 262.8130562f ), vPoly ), vX );
+	vPoly = AKSIMD_MUL_V4F32( AKSIMD_ADD_V4F32( AKSIMD_SET_V4F32( -131.1123477f ), vPoly ), vX );
+	vPoly = AKSIMD_MUL_V4F32( AKSIMD_ADD_V4F32( AKSIMD_SET_V4F32( 29.66153956f ), vPoly ), vX );
+	vPoly = AKSIMD_MUL_V4F32( AKSIMD_ADD_V4F32( AKSIMD_SET_V4F32( -1.451838349f ), vPoly ), vX );
+	vPoly = AKSIMD_ADD_V4F32( AKSIMD_SET_V4F32( 0.032843701f ), vPoly );
+	const AKSIMD_V4F32 vRes = AKSIMD_SUB_V4F32( AKSIMD_SET_V4F32( 1.57079632679f ), vPoly );
+	return AKSIMD_SEL_GTEZ_V4F32( in_vX, vRes, AKSIMD_SUB_V4F32( AKSIMD_SET_V4F32( 3.14159265358979f ), vRes ) );
+}
+
+// Angle between a direction and the [listener,emitter] vector, for lanes where the distance is not 0. Same as ComputeRayDistanceAndAngles().
+static AkForceInline AKSIMD_V4F32 ComputeAngle_V4F32( const AKSIMD_V4F32 & in_vDot, const AKSIMD_V4F32 & in_vDistance, const AKSIMD_V4F32 & in_vHasDistance )
+{
+	AKSIMD_V4F32 vCos = AKSIMD_DIV_V4F32( in_vDot, in_vDistance );
+	vCos = AKSIMD_MIN_V4F32( vCos, AKSIMD_SET_V4F32( 1.f ) );
+	vCos = AKSIMD_MAX_V4F32( vCos, AKSIMD_SET_V4F32( -1.f ) );
+	return AKSIMD_AND_V4F32( FastACos_V4F32( vCos ), in_vHasDistance );
+}
+
+void CAkListener::ComputeRaysDistanceAndAngles(
+	const AkPendingRay * in_pRays,
+	AkUInt32 in_uNumRays
+	)
+{
+	// Rays are gathered four at a time in structure-of-arrays form: one vector per coordinate, one lane per ray.
+	// The last group is padded by repeating its last ray.
+	AK_ALIGN_SIMD( AkReal32 fDiffX[4] );
+	AK_ALIGN_SIMD( AkReal32 fDiffY[4] );
+	AK_ALIGN_SIMD( AkReal32 fDiffZ[4] );
+	AK_ALIGN_SIMD( AkReal32 fEmitterFrontX[4] );
+	AK_ALIGN_SIMD( AkReal32 fEmitterFrontY[4] );
+	AK_ALIGN_SIMD( AkReal32 fEmitterFrontZ[4] );
+	AK_ALIGN_SIMD( AkReal32 fListenerFrontX[4] );
+	AK_ALIGN_SIMD( AkReal32 fListenerFrontY[4] );
+	AK_ALIGN_SIMD( AkReal32 fListenerFrontZ[4] );
+	AK_ALIGN_SIMD( AkReal32 fScalingFactor[4] );
+	AK_ALIGN_SIMD( AkReal32 fScaledDistance[4] );
+	AK_ALIGN_SIMD( AkReal32 fEmitterAngle[4] );
+	AK_ALIGN_SIMD( AkReal32 fListenerAngle[4] );
+
+	const AKSIMD_V4F32 vZero = AKSIMD_SETZERO_V4F32();
+
+	for ( AkUInt32 uRay = 0; uRay < in_uNumRays; uRay += 4 )
+	{
+		const AkUInt32 uNumLanes = AkMin( (AkUInt32)4, in_uNumRays - uRay );
+
+		// Gather.
+		for ( AkUInt32 uLane = 0; uLane < 4; ++uLane )
+		{
+			const AkPendingRay & pending = in_pRays[ uRay + AkMin( uLane, uNumLanes - 1 ) ];
+			const AkTransform & emitter = pending.pRay->emitter;
+			const AkListener & listener = pending.pListener->data;
+
+			fDiffX[uLane] = emitter.Position().X - listener.position.Position().X;
+			fDiffY[uLane] = emitter.Position().Y - listener.position.Position().Y;
+			fDiffZ[uLane] = emitter.Position().Z - listener.position.Position().Z;
+			fEmitterFrontX[uLane] = emitter.OrientationFront().X;
+			fEmitterFrontY[uLane] = emitter.OrientationFront().Y;
+			fEmitterFrontZ[uLane] = emitter.OrientationFront().Z;
+			fListenerFrontX[uLane] = listener.position.OrientationFront().X;
+			fListenerFrontY[uLane] = listener.position.OrientationFront().Y;
+			fListenerFrontZ[uLane] = listener.position.OrientationFront().Z;
+			fScalingFactor[uLane] = pending.fEmitterScalingFactor * listener.fScalingFactor;
+		}
+
+		const AKSIMD_V4F32 vDiffX = AKSIMD_LOAD_V4F32( fDiffX );
+		const AKSIMD_V4F32 vDiffY = AKSIMD_LOAD_V4F32( fDiffY );
+		const AKSIMD_V4F32 vDiffZ = AKSIMD_LOAD_V4F32( fDiffZ );
+
+		const AKSIMD_V4F32 vDistance = AKSIMD_SQRT_V4F32( AKSIMD_ADD_V4F32( AKSIMD_ADD_V4F32( AKSIMD_MUL_V4F32( vDiffX, vDiffX ), AKSIMD_MUL_V4F32( vDiffY, vDiffY ) ), AKSIMD_MUL_V4F32( vDiffZ, vDiffZ ) ) );
+		const AKSIMD_V4F32 vHasDistance = AKSIMD_GT_V4F32( vDistance, vZero );
+
+		AKSIMD_STORE_V4F32( fScaledDistance, AKSIMD_DIV_V4F32( vDistance, AKSIMD_LOAD_V4F32( fScalingFactor ) ) );
+
+		// Emitter cone: negate the projection, since the difference vector goes away from the listener.
+		AKSIMD_V4F32 vDot = AKSIMD_ADD_V4F32( AKSIMD_ADD_V4F32( 
+			AKSIMD_MUL_V4F32( vDiffX, AKSIMD_LOAD_V4F32( fEmitterFrontX ) ), 
+			AKSIMD_MUL_V4F32( vDiffY, AKSIMD_LOAD_V4F32( fEmitterFrontY ) ) ), 
+			AKSIMD_MUL_V4F32( vDiffZ, AKSIMD_LOAD_V4F32( fEmitterFrontZ ) ) );
+		AKSIMD_STORE_V4F32( fEmitterAngle, ComputeAngle_V4F32( AKSIMD_NEG_V4F32( vDot ), vDistance, vHasDistance ) );
+
+		vDot = AKSIMD_ADD_V4F32( AKSIMD_ADD_V4F32( 
+			AKSIMD_MUL_V4F32( vDiffX, AKSIMD_LOAD_V4F32( fListenerFrontX ) ), 
+			AKSIMD_MUL_V4F32( vDiffY, AKSIMD_LOAD_V4F32( fListenerFrontY ) ) ), 
+			AKSIMD_MUL_V4F32( vDiffZ, AKSIMD_LOAD_V4F32( fListenerFrontZ ) ) );
+		AKSIMD_STORE_V4F32( fListenerAngle, ComputeAngle_V4F32( vDot, vDistance, vHasDistance ) );
+
+		// Scatter.
+		for ( AkUInt32 uLane = 0; uLane < uNumLanes; ++uLane )
+		{
+			AkRayVolumeData & ray = *in_pRays[ uRay + uLane ].pRay;
+			ray.scalingFactor = fScalingFactor[uLane];
+			ray.SetDistance( fScaledDistance[uLane] );
+			ray.SetEmitterAngle( fEmitterAngle[uLane] );
+			ray.SetListenerAngle( fListenerAngle[uLane] );
+		}
+	}
+}
+
+#else
+
+void CAkListener::ComputeRaysDistanceAndAngles(
+	const AkPendingRay * in_pRays,
+	AkUInt32 in_uNumRays
+	)
+{
+	for ( AkUInt32 uRay = 0; uRay < in_uNumRays; ++uRay )
+		in_pRays[uRay].pListener->ComputeRayDistanceAndAngles( in_pRays[uRay].fEmitterScalingFactor, *in_pRays[uRay].pRay );
+}
+
+#endif
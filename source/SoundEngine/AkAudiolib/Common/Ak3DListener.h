@@ -26,6 +26,20 @@
 class AkMixConnection;
 class CAkAttenuation;
 class CAkBehavioralCtx;
+class CAkEmitter;
+class CAkListener;
+
+// Emitter-listener ray whose distance and angles are computed in a batch (see CAkListener::ComputeRaysDistanceAndAngles).
+struct AkPendingRay
+{
+	AkRayVolumeData *	pRay;
+	const CAkListener *	pListener;
+	CAkEmitter *		pEmitter;
+	AkReal32			fEmitterScalingFactor;
+	bool				bDirectOutputListener;	// As opposed to an aux-send listener.
+};
+
+typedef AkArray<AkPendingRay, const AkPendingRay&, ArrayPoolDefault> AkPendingRayArray;
 
 class CAkListener : public CAkTrackedGameObjComponent < GameObjComponentIdx_Listener >
 {
@@ -125,6 +139,12 @@ public:
 		AkRayVolumeData & out_ray
 		) const;
 
+	// Same as ComputeRayDistanceAndAngles(), for many rays of any emitter and listener at once.
+	static void ComputeRaysDistanceAndAngles(
+		const AkPendingRay * in_pRays,
+		AkUInt32 in_uNumRays
+		);
+
 private:
 
 
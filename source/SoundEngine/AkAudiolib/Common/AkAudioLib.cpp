@@ -44,6 +44,7 @@
 #include "AkPositionRepository.h"
 #include "AkLayer.h"
 #include "AkOutputMgr.h"
+#include "AkDecodedMediaCache.h"
 #include "AkQueuedMsg.h"
 #include "AkStreamCacheMgmt.h"
 #include "AkMidiDeviceMgr.h"
@@ -469,6 +470,7 @@ void GetDefaultInitSettings(
 	out_settings.pfnAssertHook = NULL;
 	out_settings.uMaxNumPaths = DEFAULT_MAX_NUM_PATHS;
 	out_settings.uCommandQueueSize = COMMAND_QUEUE_SIZE;
+	out_settings.uMaxCommandQueueSize = MAX_COMMAND_QUEUE_SIZE;
 	out_settings.bEnableGameSyncPreparation = false;
 	out_settings.uContinuousPlaybackLookAhead = DEFAULT_CONTINUOUS_PLAYBACK_LOOK_AHEAD;
 
@@ -489,6 +491,11 @@ void GetDefaultInitSettings(
 	out_settings.eFloorPlane = AkFloorPlane_Default;
 	out_settings.taskSchedulerDesc.fcnParallelFor = NULL;
 	out_settings.taskSchedulerDesc.uNumSchedulerWorkerThreads = 1;
+	out_settings.uPanGainCacheSize = 0;
+	out_settings.uVirtualVoiceRefreshInterval = 0;
+	out_settings.fVirtualVoiceRefreshDistance = 0.f;
+	out_settings.bFloat16VoiceBuffers = false;
+	out_settings.uDecodedMediaCacheSize = 0;
 	out_settings.bDebugOutOfRangeCheckEnabled = false;
 	out_settings.fDebugOutOfRangeLimit = 16.f;
 
@@ -1369,6 +1376,81 @@ AKRESULT SetPositionInternal(
 	return AK_InvalidParameter;
 }
 
+AKRESULT SetPositions(
+	AkUInt32 in_uNumGameObjects,
+	const AkGameObjectID * in_pGameObjectIDs,
+	const AkSoundPosition * in_pPositions
+	)
+{
+	AKASSERT(g_pAudioMgr);
+
+	if (in_uNumGameObjects > 0 && (in_pGameObjectIDs == NULL || in_pPositions == NULL))
+		return AK_Fail;
+
+	// Split the update in messages small enough to be written in one reservation, and not to hog the queue.
+	const AkUInt32 uEntrySize = sizeof(AkGameObjectID) + sizeof(AkSoundPosition);
+	AkUInt32 uMaxMsgSize = AkMin(g_pAudioMgr->GetMaximumMsgSize() / 8, (AkUInt32)0xFFFF);	// AkQueuedMsg::size is 16 bits
+	AkUInt32 uMaxPerMsg = AkMax((uMaxMsgSize - AkQueuedMsg::Sizeof_GameObjPositionsBase()) / uEntrySize, (AkUInt32)1);
+
+	AKRESULT eResult = AK_Success;
+	AkUInt32 uNext = 0;
+	while (uNext < in_uNumGameObjects)
+	{
+		// Count the valid entries of this chunk; invalid ones are skipped, and the first error is returned (same codes as SetPosition).
+		AkUInt32 uChunkEnd = uNext;
+		AkUInt32 uNumValid = 0;
+		while (uChunkEnd < in_uNumGameObjects && uNumValid < uMaxPerMsg)
+		{
+			if (in_pGameObjectIDs[uChunkEnd] >= AkGameObjectID_ReservedStart) // omni
+			{
+				if (eResult == AK_Success)
+					eResult = AK_Fail;
+			}
+			else if (!AkMath::IsTransformValid(in_pPositions[uChunkEnd]))
+			{
+				MONITOR_ERRORMSG(AKTEXT("AK::SoundEngine::SetPositions : Invalid transform"));
+				if (eResult == AK_Success)
+					eResult = AK_InvalidParameter;
+			}
+			else
+			{
+				++uNumValid;
+			}
+			++uChunkEnd;
+		}
+
+		if (uNumValid > 0)
+		{
+			AkUInt32 uAllocSize = AkQueuedMsg::Sizeof_GameObjPositionsBase() + uNumValid * uEntrySize;
+			AkQueuedMsg *pItem = g_pAudioMgr->ReserveQueue(QueuedMsgType_GameObjPositions, uAllocSize);
+			if (pItem == NULL)
+				return AK_InvalidParameter;
+
+			pItem->gameObjPositions.uNumGameObjects = uNumValid;
+			AkGameObjectID * pIDs = pItem->gameObjPositions.aGameObjIDs;
+			AkSoundPosition * pPositions = pItem->gameObjPositions.GetPositions();
+
+			AkUInt32 uWritten = 0;
+			for (AkUInt32 i = uNext; i < uChunkEnd; ++i)
+			{
+				if (in_pGameObjectIDs[i] < AkGameObjectID_ReservedStart && AkMath::IsTransformValid(in_pPositions[i]))
+				{
+					pIDs[uWritten] = in_pGameObjectIDs[i];
+					pPositions[uWritten] = in_pPositions[i];
+					++uWritten;
+				}
+			}
+			AKASSERT(uWritten == uNumValid);
+
+			g_pAudioMgr->FinishQueueWrite();
+		}
+
+		uNext = uChunkEnd;
+	}
+
+	return eResult;
+}
+
 //Maximum position coordinate that can be passed.  This is simply sqrt(FLX_MAX/3) which will give FLT_MAX when used in distance calculation.
 #define AK_MAX_DISTANCE 1.065023233e+19F
 
@@ -6275,6 +6357,21 @@ AkUInt32 GetBufferTick()
 	return g_pAudioMgr->GetBufferTick();
 }
 
+void GetCommandQueueStats(AkCommandQueueStats & out_stats)
+{
+	g_pAudioMgr->GetCommandQueueStats(out_stats);
+}
+
+void GetPanGainCacheStats(AkPanGainCacheStats & out_stats)
+{
+	CAkSpeakerPan::GetPanGainCacheStats(out_stats);
+}
+
+void GetDecodedMediaCacheStats(AkDecodedMediaCacheStats & out_stats)
+{
+	AkDecodedMediaCache::GetStats(out_stats);
+}
+
 AKRESULT SetCustomPlatformName(char* in_pCustomPlatformName)
 {
 	if (g_pszCustomPlatformName != NULL)
@@ -81,6 +81,11 @@ AkUInt16 AkQueuedMsg::Sizeof_GameObjMultiPositionBase()
 	return BASE_AKQUEUEMSGSIZE + offsetof( AkQueuedMsg_GameObjMultiplePosition, aMultiPosition );
 }
 
+AkUInt16 AkQueuedMsg::Sizeof_GameObjPositionsBase()
+{
+	return BASE_AKQUEUEMSGSIZE + offsetof( AkQueuedMsg_GameObjPositions, aGameObjIDs );
+}
+
 AkUInt16 AkQueuedMsg::Sizeof_GameObjMultiObstructionBase()
 {
 	return BASE_AKQUEUEMSGSIZE + offsetof( AkQueuedMsg_GameObjMultipleObstruction, pObstructionOcclusionValues );
@@ -167,34 +172,129 @@ inline bool CheckObjAndPlayingID(  const CAkRegisteredObj* in_pObjSearchedFor, A
 //////////////////////////////////////
 
 
+AkLockLessMsgQueue::Ring * AkLockLessMsgQueue::CreateRing( AkMemPoolId in_PoolId, AkUInt32 in_ulSize )
+{
+	// Header and buffer in the same allocation. The header size keeps the buffer cache-aligned.
+	const AkUInt32 uHeaderSize = (sizeof(Ring) + 63) & ~63;
+	AkUInt8 * pMem = (AkUInt8 *)AkMalign( in_PoolId, uHeaderSize + in_ulSize, 64 );
+	if (!pMem)
+		return NULL;
+
+	Ring * pRing = (Ring *)pMem;
+	pRing->pStart = pMem + uHeaderSize;
+	pRing->pEnd = pRing->pStart + in_ulSize;
+	pRing->pRead = pRing->pStart;
+	pRing->pWrite = pRing->pStart;
+	pRing->pSealedWrite = NULL;
+	pRing->pNext = NULL;
+	pRing->uSize = in_ulSize;
+	return pRing;
+}
+
 AKRESULT AkLockLessMsgQueue::Init( AkMemPoolId in_PoolId, AkUInt32 in_ulSize )
 {
-	m_pStart = (AkUInt8 *)AkAlloc( in_PoolId, in_ulSize );
-	if (!m_pStart)
+	m_pFirstRing = CreateRing( in_PoolId, in_ulSize );
+	if (!m_pFirstRing)
 		return AK_Fail;
 
-	m_pRead = m_pStart;
-	m_pWrite = m_pStart;
-
-	m_pEnd = m_pStart + in_ulSize;
-
+	m_pReadRing = m_pFirstRing;
+	m_pWriteRing = m_pFirstRing;
 	m_uQueueSize = in_ulSize;
+	m_uRingSize = in_ulSize;
 
 	return AK_Success;
 }
 
 void AkLockLessMsgQueue::Term( AkMemPoolId in_PoolId )
 {
-	if ( m_pStart )
+	Ring * pRing = m_pFirstRing;
+	while ( pRing )
 	{
-		AkFree( in_PoolId, m_pStart );
-		m_pStart = NULL;
+		Ring * pNext = pRing->pNext;
+		AkFalign( in_PoolId, pRing );
+		pRing = pNext;
+	}
+	m_pFirstRing = NULL;
+	m_pReadRing = NULL;
+	m_pWriteRing = NULL;
+	m_uQueueSize = 0;
+	m_uRingSize = 0;
+}
+
+void AkLockLessMsgQueue::FreeDrainedRings( AkMemPoolId in_PoolId, AkAtomic32 & in_uNumWriters )
+{
+	if ( m_pFirstRing == m_pReadRing )
+		return;
+
+	// Grow() publishes the next ring and the new write ring together: once it is done, no new reservation can see the drained rings.
+	AkAutoLock<CAkLock> lock( m_lockGrow );
+
+	// A producer in the middle of a reservation may still hold a drained ring. Try again at the end of the next frame.
+	if ( AkAtomicLoad32( &in_uNumWriters ) > 0 )
+		return;
+
+	while ( m_pFirstRing != m_pReadRing )
+	{
+		Ring * pNext = m_pFirstRing->pNext;
+		AkAtomicSub32( &m_uQueueSize, m_pFirstRing->uSize );
+		AkFalign( in_PoolId, m_pFirstRing );
+		m_pFirstRing = pNext;
 	}
 }
 
 bool AkLockLessMsgQueue::NeedWraparound()
 {
-	return (m_pRead + Sizeof_QueueWrapAround) > m_pEnd;
+	Ring * pRing = m_pReadRing;
+	return (pRing->pRead + Sizeof_QueueWrapAround) > pRing->pEnd;
+}
+
+AkUInt32 AkLockLessMsgQueue::GetUsageSize()
+{
+	AkUInt32 uUsage = 0;
+	for ( Ring * pRing = m_pReadRing; pRing; pRing = pRing->pNext )
+	{
+		AkUInt8 * pRead = pRing->pRead;
+		AkUInt8 * pWrite = pRing->GetWrite();
+		uUsage += (AkUInt32)(pRead > pWrite ? pRing->uSize - (pRead - pWrite) : (pWrite - pRead));
+	}
+	return uUsage;
+}
+
+bool AkLockLessMsgQueue::Grow( AkMemPoolId in_PoolId, AkUInt32 in_uMinSize, AkUInt32 in_uMaxSize, AkUInt32 in_uNumGrowsSeen )
+{
+	AkAutoLock<CAkLock> lock( m_lockGrow );
+
+	// Another thread grew the queue since the caller failed its reservation.
+	if ( GetNumGrows() != in_uNumGrowsSeen )
+		return true;
+
+	Ring * pRing = m_pWriteRing;
+	AkUInt32 uNewSize = pRing->uSize * 2;
+	while ( uNewSize < in_uMinSize + Sizeof_QueueWrapAround + 4 )
+		uNewSize *= 2;
+	if ( uNewSize > in_uMaxSize )
+		return false;
+
+	Ring * pNewRing = CreateRing( in_PoolId, uNewSize );
+	if ( !pNewRing )
+		return false;
+
+	// Seal the full ring: producers which were about to write in it will fail their CAS and move on to the new ring.
+	AkUInt8 * pWrite;
+	do
+	{
+		pWrite = pRing->pWrite;
+		pRing->pSealedWrite = pWrite;
+		AK_ATOMIC_FENCE_FULL_BARRIER();
+	}
+	while ( !AkAtomicCasPtr( (AkAtomicPtr*)&pRing->pWrite, NULL, pWrite ) );
+
+	AkAtomicStorePtr( (AkAtomicPtr*)&pRing->pNext, pNewRing );
+	AkAtomicStorePtr( (AkAtomicPtr*)&m_pWriteRing, pNewRing );
+	AkAtomicAdd32( &m_uQueueSize, uNewSize );
+	AkAtomicStore32( &m_uRingSize, uNewSize );
+	AkAtomicInc32( &m_uNumGrows );
+	return true;
 }
 
 AkQueuedMsg * CAkAudioMgr::ReserveForWrite(AkUInt32 &io_size)
@@ -218,50 +318,63 @@ void * AkLockLessMsgQueue::ReserveForWrite(AkUInt32 &io_size)
 	io_size &= ~0x03;
 
 tryAgain:
-	AkUInt8* pWriteBegin = m_pWrite;
+	Ring * pRing = (Ring *)AkAtomicLoadPtr((AkAtomicPtr*)&m_pWriteRing);
+	AkUInt8* pWriteBegin = pRing->pWrite;
+	if (!pWriteBegin)
+		goto tryAgain; // Sealed by Grow(), which publishes the new ring right after.
+
 	AkUInt8* pWriteEnd = pWriteBegin;
-	AkUInt8* pRead = m_pRead; // ensure consistency if m_pRead changes while we're doing stuff
+	AkUInt8* pRead = pRing->pRead; // ensure consistency if pRead changes while we're doing stuff
 
 	if ( pRead > pWriteBegin ) // simple case : contiguous free space
 	{
-		// NOTE: in theory the empty space goes to m_pEnd if pRead == m_pVirtualEnd, but
+		// NOTE: in theory the empty space goes to pEnd if pRead == m_pVirtualEnd, but
 		// this breaks our lock-free model.
 		if (io_size + 4 < (AkUIntPtr)(pRead - pWriteBegin))
 		{
 			pWriteEnd += io_size;
-			if (!AkAtomicCasPtr((AkAtomicPtr*)&m_pWrite, pWriteEnd, pWriteBegin))
+			if (!AkAtomicCasPtr((AkAtomicPtr*)&pRing->pWrite, pWriteEnd, pWriteBegin))
+			{
+				AkAtomicInc32(&m_uNumContentions);
 				goto tryAgain;
+			}
 			
 			return pWriteBegin;
 		}
 	}
 	else
 	{
-		if (io_size + 4 < (AkUIntPtr)(m_pEnd - pWriteBegin)) // fits in the remaining space before the end ?
+		if (io_size + 4 < (AkUIntPtr)(pRing->pEnd - pWriteBegin)) // fits in the remaining space before the end ?
 		{
 			pWriteEnd += io_size;
-			if (!AkAtomicCasPtr((AkAtomicPtr*)&m_pWrite, pWriteEnd, pWriteBegin))
+			if (!AkAtomicCasPtr((AkAtomicPtr*)&pRing->pWrite, pWriteEnd, pWriteBegin))
+			{
+				AkAtomicInc32(&m_uNumContentions);
 				goto tryAgain;
+			}
 
 			return pWriteBegin;
 		}
 
-		if (io_size + 4 < (AkUIntPtr)(pRead - m_pStart)) // fits in the space before the read ptr ?
+		if (io_size + 4 < (AkUIntPtr)(pRead - pRing->pStart)) // fits in the space before the read ptr ?
 		{
-			pWriteEnd = m_pStart + io_size;
-			if (!AkAtomicCasPtr((AkAtomicPtr*)&m_pWrite, pWriteEnd, pWriteBegin))
+			pWriteEnd = pRing->pStart + io_size;
+			if (!AkAtomicCasPtr((AkAtomicPtr*)&pRing->pWrite, pWriteEnd, pWriteBegin))
+			{
+				AkAtomicInc32(&m_uNumContentions);
 				goto tryAgain;
+			}
 
 			//Write the tag saying the rest of the buffer is unused.
-			AKASSERT(pWriteBegin <= m_pEnd);
-			if(pWriteBegin + Sizeof_QueueWrapAround <= m_pEnd)
+			AKASSERT(pWriteBegin <= pRing->pEnd);
+			if(pWriteBegin + Sizeof_QueueWrapAround <= pRing->pEnd)
 			{
 				AkQueuedMsg *pMsg = (AkQueuedMsg *)pWriteBegin;
 				pMsg->type = QueuedMsgType_QueueWrapAround;
 				pMsg->size = Sizeof_QueueWrapAround;
 			}
 			//If not enough space, the message loop will detect it anyway.
-			return m_pStart;
+			return pRing->pStart;
 		}
 	}
 	
@@ -282,6 +395,7 @@ CAkAudioMgr::CAkAudioMgr()
 	:
 #ifndef AK_OPTIMIZED
 	m_MsgQueueSizeFilled(0),
+	m_MsgQueueSizeAtFilled(0),
 #endif
 	m_uBufferTick(0),
 	m_iEndOfListCount(0),
@@ -289,6 +403,7 @@ CAkAudioMgr::CAkAudioMgr()
 	m_timeThisBuffer(0),
 	m_uCallsWithoutTicks(0),
 	m_uMsgQueueWriters(0),
+	m_uMsgQueueStalls(0),
 	m_fFractionalBuffer(0.f)
 {
 }
@@ -360,7 +475,7 @@ AKRESULT CAkAudioMgr::RenderAudio(bool in_bAllowSyncRender)
 {
 	AK_INSTRUMENT_SCOPE("CAkAudioMgr::RenderAudio");
 
-	bool bProcess = !m_MsgQueue.IsEmpty(); // do not unnecessarily wake up the audio thread if no events have been enqueued.
+	bool bProcess = !IsMsgQueueEmpty(); // do not unnecessarily wake up the audio thread if no events have been enqueued.
 	if (bProcess)
 	{
 		//Reserve right away to make sure that any other thread logging a new message will go AFTER.		
@@ -399,19 +514,28 @@ void CAkAudioMgr::IncrementBufferTick()
 
 AkQueuedMsg * CAkAudioMgr::ReserveQueue( AkUInt16 in_eType, AkUInt32 in_uSize )
 {
+	AkUInt32 uNumGrows = m_MsgQueue.GetNumGrows();
 	AkQueuedMsg * pData = ReserveForWrite( in_uSize );
 	
-	// Our message queue is full; drain it and wait for the audio thread
+	// Our message queue is full; grow it if allowed, otherwise drain it and wait for the audio thread
 	// to tell us that we can re-enqueue this message
 	while (pData == NULL)
 	{
-		if (AK_EXPECT_FALSE(in_uSize > m_MsgQueue.GetMaxQueueSize()))
+		if (m_MsgQueue.Grow(AkMemID_SoundEngine, in_uSize, g_settings.uMaxCommandQueueSize, uNumGrows))
+		{
+			uNumGrows = m_MsgQueue.GetNumGrows();
+			pData = ReserveForWrite(in_uSize);
+			continue;
+		}
+
+		if (AK_EXPECT_FALSE(in_uSize > m_MsgQueue.GetRingSize()))
 		{
 			MONITOR_ERROR(AK::Monitor::ErrorCode_CommandTooLarge);
 			return NULL;
 		}
 
 		MONITOR_ERROR(AK::Monitor::ErrorCode_CommandQueueFull);
+		AkAtomicInc32(&m_uMsgQueueStalls);
 
 		{
 			CAkFunctionCritical SpaceSetAsCritical;
@@ -436,6 +560,14 @@ AkQueuedMsg * CAkAudioMgr::ReserveQueue( AkUInt16 in_eType, AkUInt32 in_uSize )
 	return pData;
 }
 
+void CAkAudioMgr::GetCommandQueueStats( AkCommandQueueStats & out_stats )
+{
+	out_stats.uQueueSize = m_MsgQueue.GetMaxQueueSize();
+	out_stats.uNumGrows = m_MsgQueue.GetNumGrows();
+	out_stats.uNumStalls = (AkUInt32)AkAtomicLoad32(&m_uMsgQueueStalls);
+	out_stats.uNumContentions = m_MsgQueue.GetNumContentions();
+}
+
 AkUInt32 CAkAudioMgr::ComputeFramesToRender()
 {	
 	AkUInt32 l_uNumBufferToFill = CAkLEngine::GetNumBufferNeededAndSubmit();
@@ -597,6 +729,9 @@ void CAkAudioMgr::Perform()
 	}
 	while ( true );
 
+	// Rings left behind by a command queue grow are no longer read.
+	m_MsgQueue.FreeDrainedRings( AkMemID_SoundEngine, m_uMsgQueueWriters );
+
 	//AK::IAkStreamMgr::Get()->SignalAllDevices();
 
 	_CallGlobalExtensions( AkGlobalCallbackLocation_End );
@@ -867,6 +1002,7 @@ bool CAkAudioMgr::ProcessMsgQueue( bool in_bDrainMsgQueue, bool &out_bDeviceSwit
 	if (m_MsgQueueSizeFilled < uMsgQueueSizeFilled)
 	{
 		m_MsgQueueSizeFilled = uMsgQueueSizeFilled;
+		m_MsgQueueSizeAtFilled = m_MsgQueue.GetMaxQueueSize();
 	}
 #endif
 
@@ -1334,6 +1470,14 @@ bool CAkAudioMgr::ProcessMsgQueue( bool in_bDrainMsgQueue, bool &out_bDeviceSwit
 				}
 				break;
 
+			case QueuedMsgType_GameObjPositions:
+				g_pRegistryMgr->SetPositions(
+					pItem->gameObjPositions.uNumGameObjects,
+					pItem->gameObjPositions.aGameObjIDs,
+					pItem->gameObjPositions.GetPositions()
+					);
+				break;
+
 			case QueuedMsgType_GameObjActiveListeners:
 			{
 				AkAutoTermListenerSet listeners;
@@ -35,23 +35,52 @@ struct AkQueuedMsg_EventPostMIDI;
 struct AkQueuedMsg_EventStopMIDI;
 
 #define COMMAND_QUEUE_SIZE			(1024 * 256)
+#define MAX_COMMAND_QUEUE_SIZE		(COMMAND_QUEUE_SIZE * 4)
 
 typedef void(*AkMsgQueueHandler)(void* pMsg, AkUInt32 uSize);
 
 class AkLockLessMsgQueue
 {
+	// The queue is a chain of ring buffers. When the current ring is full, a producer can seal it and continue in a larger one.
+	// The reader finishes the sealed ring before moving to the next, so messages are always read in reservation order.
+	// Sealed rings are freed by the audio thread at the end of a frame once they are entirely read, if no producer is in the middle
+	// of a reservation (a producer may still hold a pointer to a sealed ring until its reservation completes).
+	// Each message is reserved with its own CAS on the write pointer. Producers do not reserve blocks for several messages:
+	// the reader would stop at the unused end of a block until its producer posts again, holding back the EndOfList that
+	// RenderAudio() reserves after it (see AkCommandQueueBenchmark for the contention of several producers).
+	struct Ring
+	{
+		AkUInt8 * volatile pRead;			// Read position in buffer
+		AkUInt8 * pStart;					// Memory start of buffer
+		AkUInt8 * pEnd;						// Memory end of buffer
+		Ring * volatile pNext;				// Next ring, set when this one is sealed
+		AkUInt32 uSize;
+
+		AK_ALIGN(AkUInt8 * volatile pWrite, 64);	// Write position in buffer, NULL when sealed. On its own cache line: all producers write it.
+		AkUInt8 * volatile pSealedWrite;	// Final write position of a sealed ring
+
+		inline AkUInt8 * GetWrite() const
+		{
+			AkUInt8 * pCurrentWrite = pWrite;
+			return pCurrentWrite ? pCurrentWrite : pSealedWrite;
+		}
+	};
+
 public:
 	AkLockLessMsgQueue()
-		: m_pRead( NULL )
-		, m_pWrite( NULL )
-		, m_pStart( NULL )
-		, m_pEnd( NULL )
+		: m_pReadRing( NULL )
+		, m_pWriteRing( NULL )
+		, m_pFirstRing( NULL )
+		, m_uQueueSize( 0 )
+		, m_uRingSize( 0 )
+		, m_uNumGrows( 0 )
+		, m_uNumContentions( 0 )
 	{
 	}
 
 	~AkLockLessMsgQueue()
 	{
-		AKASSERT( m_pStart == NULL );
+		AKASSERT( m_pFirstRing == NULL );
 	}
 
 	AKRESULT Init( AkMemPoolId in_PoolId, AkUInt32 in_ulSize );
@@ -59,12 +88,17 @@ public:
 
 	bool IsEmpty()
 	{
-		return m_pRead == m_pWrite;
+		Ring * pRing = m_pReadRing;
+		return pRing->pRead == pRing->GetWrite() && pRing->pNext == NULL;
 	}
 
 	void * BeginRead()
 	{
-		return m_pRead;
+		// Move on to the next ring once the sealed one is entirely read.
+		Ring * pRing = m_pReadRing;
+		if ( pRing->pNext && pRing->pRead == pRing->GetWrite() )
+			m_pReadRing = pRing = pRing->pNext;
+		return pRing->pRead;
 	}
 
 	void EndRead( AkUInt32 in_ulSize )
@@ -72,11 +106,12 @@ public:
 		in_ulSize += 3;
 		in_ulSize &= ~0x03; // Data is always aligned to 4 bytes.
 
-		AkUInt8* nextRead = m_pRead + in_ulSize;
-		if (nextRead < m_pEnd)
-			m_pRead = nextRead;
+		Ring * pRing = m_pReadRing;
+		AkUInt8* nextRead = pRing->pRead + in_ulSize;
+		if (nextRead < pRing->pEnd)
+			pRing->pRead = nextRead;
 		else
-			m_pRead = m_pStart;
+			pRing->pRead = pRing->pStart;
 	}
 
 	// Get the next message int the queue without changing the position of the read pointer. 
@@ -93,16 +128,34 @@ public:
 	//Reserves space in the queue.
 	inline void * ReserveForWrite(AkUInt32 &io_size);
 
-	AkUInt32 GetMaxQueueSize() { return m_uQueueSize; }
-	AkUInt32 GetUsageSize() { return (AkUInt32)(m_pRead > m_pWrite ? m_uQueueSize-(m_pRead-m_pWrite):(m_pWrite-m_pRead)); }
+	// Seals the current ring and continues in a larger one. Only blocks other threads which are also growing the queue.
+	// Returns true if the queue was grown since the caller observed in_uNumGrowsSeen.
+	bool Grow( AkMemPoolId in_PoolId, AkUInt32 in_uMinSize, AkUInt32 in_uMaxSize, AkUInt32 in_uNumGrowsSeen );
+
+	// Frees the sealed rings which the reader has left. Audio thread only, with in_uNumWriters the number of producers in a reservation.
+	void FreeDrainedRings( AkMemPoolId in_PoolId, AkAtomic32 & in_uNumWriters );
+
+	// Total size of the queue (all rings not freed yet), in bytes.
+	AkUInt32 GetMaxQueueSize() { return (AkUInt32)AkAtomicLoad32(&m_uQueueSize); }
+	// Size of the ring being written, in bytes: the largest message which can be reserved without growing the queue.
+	AkUInt32 GetRingSize() { return (AkUInt32)AkAtomicLoad32(&m_uRingSize); }
+	AkUInt32 GetUsageSize();
+
+	AkUInt32 GetNumGrows() { return (AkUInt32)AkAtomicLoad32(&m_uNumGrows); }
+	AkUInt32 GetNumContentions() { return (AkUInt32)AkAtomicLoad32(&m_uNumContentions); }
 
 private:
-	AkUInt8 * volatile m_pRead;			// Read position in buffer
-	AkUInt8 * volatile m_pWrite;		// Write position in buffer
+	static Ring * CreateRing( AkMemPoolId in_PoolId, AkUInt32 in_ulSize );
 
-	AkUInt8 * volatile m_pStart;		// Memory start of buffer
-	AkUInt8 * volatile m_pEnd;			// Memory end of buffer
-	AkUInt32 m_uQueueSize;
+	Ring * volatile m_pReadRing;		// Ring being read (audio thread)
+	Ring * volatile m_pWriteRing;		// Ring being written (producers)
+	Ring * m_pFirstRing;				// Oldest ring not freed yet
+
+	CAkLock m_lockGrow;					// Serializes Grow()
+	AkAtomic32 m_uQueueSize;
+	AkAtomic32 m_uRingSize;
+	AkAtomic32 m_uNumGrows;
+	AkAtomic32 m_uNumContentions;
 };
 
 // all what we need to start an action at some later time
@@ -150,6 +203,17 @@ public:
 	struct AkQueuedMsg* ReserveQueue( AkUInt16 in_eType, AkUInt32 in_uSize );
 	void FinishQueueWrite() { AkAtomicDec32(&m_uMsgQueueWriters); }
 
+	// Checks for messages from a producer thread. Counts as a writer so that the ring being read is not freed meanwhile.
+	bool IsMsgQueueEmpty()
+	{
+		AkAtomicInc32(&m_uMsgQueueWriters);
+		bool bEmpty = m_MsgQueue.IsEmpty();
+		AkAtomicDec32(&m_uMsgQueueWriters);
+		return bEmpty;
+	}
+
+	void GetCommandQueueStats( AkCommandQueueStats & out_stats );
+
 	//Enqueues an End-of-list item if there are events to process and wakes up audio thread.
 	AKRESULT RenderAudio( bool in_bAllowSyncRender );
 	
@@ -253,13 +317,15 @@ public:
 
 	// the total size of the queue (in bytes)
 	AkUInt32 GetActualQueueSize() {return m_MsgQueue.GetUsageSize();}
-	AkUInt32 GetMaximumMsgSize() {return m_MsgQueue.GetMaxQueueSize();}
+	AkUInt32 GetMaximumMsgSize() {return m_MsgQueue.GetRingSize();}
 	
 #ifndef AK_OPTIMIZED
 	// 0.0 -> 1.0 (returns the greatest value since the previous query)
-	AkUInt32 GetMaxSizeQueueFilled()
+	// out_uQueueSize is the size of the queue when it was the most filled: the queue may have shrunk since.
+	AkUInt32 GetMaxSizeQueueFilled( AkUInt32 & out_uQueueSize )
 	{
-		AkUInt32 tmp = m_MsgQueueSizeFilled; m_MsgQueueSizeFilled = 0; return tmp;
+		out_uQueueSize = m_MsgQueueSizeAtFilled ? m_MsgQueueSizeAtFilled : m_MsgQueue.GetMaxQueueSize();
+		AkUInt32 tmp = m_MsgQueueSizeFilled; m_MsgQueueSizeFilled = 0; m_MsgQueueSizeAtFilled = 0; return tmp;
 	}
 
 	AkUInt32 GetMaxQueueSize()
@@ -305,6 +371,7 @@ private:
 #ifndef AK_OPTIMIZED
 	// how much of the queue is filled
 	AkUInt32 m_MsgQueueSizeFilled;
+	AkUInt32 m_MsgQueueSizeAtFilled;
 #endif
 
 	// the things that are not ready to be done
@@ -406,6 +473,7 @@ public:
 	AkInt64			m_timeThisBuffer;
 	AkUInt32		m_uCallsWithoutTicks;
 	AkAtomic32		m_uMsgQueueWriters;
+	AkAtomic32		m_uMsgQueueStalls;
 	AkReal32		m_fFractionalBuffer;
 
 	struct AkMsgQueueHandlers
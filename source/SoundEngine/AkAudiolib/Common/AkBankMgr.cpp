@@ -44,6 +44,7 @@
 #include "../../../Codecs/AkVorbisDecoder/Common/AkVorbisInfo.h"
 #include "../../../Codecs/AkOpusDecoder/OpusCommon.h"
 #include "AkVPLSrcNode.h"
+#include "AkDecodedMediaCache.h"
 #include "AkPluginCodec.h"
 
 extern AkExternalBankHandlerCallback g_pExternalBankHandlerCallback;
@@ -886,7 +887,7 @@ AKRESULT CAkBankMgr::LoadBank( AkBankQueueItem in_Item, CAkUsageSlot *& out_pUsa
 				break;
 
 			case BankHierarchyChunkID:
-				eResult = ProcessHircChunk( out_pUsageSlot, bankID );
+				eResult = ProcessHircChunk( out_pUsageSlot, bankID, SubChunkHeader.dwChunkSize );
 				break;
 
 			case BankStrMapChunkID:
@@ -1754,6 +1755,7 @@ AKRESULT CAkBankMgr::MediaSwap( AkBankQueueItem in_Item )
 
 				//Free the Old Outdated Media:
 				pMediaEntry->FreeMedia();
+				AkDecodedMediaCache::Flush( sourceID );
 				//Set the new Media
 				pMediaEntry->SetPreparedData(mediaPtrs.pAllocated, mediaPtrs.uMediaSize, AkMemID_Media);
 
@@ -2061,11 +2063,54 @@ AKRESULT CAkBankMgr::ProcessDataChunk(AkUInt32 in_dwDataChunkSize, CAkUsageSlot*
 	return eResult;
 }
 
-AKRESULT CAkBankMgr::ProcessHircChunk(CAkUsageSlot* in_pUsageSlot, AkUInt32 in_dwBankID)
+// Largest hierarchy chunk of a streamed bank which is buffered in full before its items are built.
+// Larger chunks are read item by item, like the other chunks.
+#define AK_HIRC_MAX_MEMORY_VIEW_SIZE (1024 * 1024)
+
+AKRESULT CAkBankMgr::ProcessHircChunk(CAkUsageSlot* in_pUsageSlot, AkUInt32 in_dwBankID, AkUInt32 in_dwDataChunkSize)
 {
+	AKRESULT eResult = AK_Success;
 	AkUInt32 l_NumReleasableHircItem = 0;
 
-	AKRESULT eResult = m_BankReader.FillDataEx(&l_NumReleasableHircItem, sizeof(l_NumReleasableHircItem));
+	// First pass: read the whole chunk and check the item headers, so that a truncated or corrupt chunk is rejected
+	// before any object is created. The chunks of in-memory banks are viewed in place. Streamed banks with a large
+	// hierarchy chunk skip this pass rather than buffer it: their items are read one at a time.
+	const bool bMemoryView = m_BankReader.IsInMemoryFile() || in_dwDataChunkSize <= AK_HIRC_MAX_MEMORY_VIEW_SIZE;
+	if (bMemoryView)
+	{
+		const AkUInt8* pChunk = (const AkUInt8*)m_BankReader.BeginMemoryView(in_dwDataChunkSize);
+		if (!pChunk)
+			return AK_BankReadError;
+
+		if (in_dwDataChunkSize >= sizeof(l_NumReleasableHircItem))
+		{
+			l_NumReleasableHircItem = ReadUnaligned<AkUInt32>(pChunk);
+
+			AkUInt32 uOffset = sizeof(l_NumReleasableHircItem);
+			for (AkUInt32 i = 0; i < l_NumReleasableHircItem && eResult == AK_Success; ++i)
+			{
+				if (in_dwDataChunkSize - uOffset < sizeof(AKBKSubHircSection))
+				{
+					eResult = AK_InvalidFile;
+					break;
+				}
+				AkUInt32 uSectionSize = ReadUnaligned<AkUInt32>(pChunk + uOffset + offsetof(AKBKSubHircSection, dwSectionSize));
+				uOffset += sizeof(AKBKSubHircSection);
+
+				if (in_dwDataChunkSize - uOffset < uSectionSize)
+					eResult = AK_InvalidFile;
+				uOffset += uSectionSize;
+			}
+		}
+		else
+		{
+			eResult = AK_InvalidFile;
+		}
+	}
+
+	if (eResult == AK_Success)
+		eResult = m_BankReader.FillDataEx(&l_NumReleasableHircItem, sizeof(l_NumReleasableHircItem));
+
 	if( eResult == AK_Success && l_NumReleasableHircItem )
 	{
 		eResult = in_pUsageSlot->m_listLoadedItem.GrowArray( l_NumReleasableHircItem ) ? AK_Success : AK_Fail;
@@ -2073,6 +2118,7 @@ AKRESULT CAkBankMgr::ProcessHircChunk(CAkUsageSlot* in_pUsageSlot, AkUInt32 in_d
 
 	bool bWarnedUnknownContent = false;
 
+	// Second pass: build the items. Each item takes the main lock only while it is created and registered.
 	for( AkUInt32 i = 0; i < l_NumReleasableHircItem && eResult == AK_Success; ++i )
 	{
 		AKBKSubHircSection Section;
@@ -2185,6 +2231,8 @@ AKRESULT CAkBankMgr::ProcessHircChunk(CAkUsageSlot* in_pUsageSlot, AkUInt32 in_d
 			}
 		}
 	}
+	if (bMemoryView)
+		m_BankReader.EndMemoryView();
 
 	return eResult;
 }
@@ -3364,6 +3412,9 @@ void CAkBankMgr::UnloadMedia( CAkUsageSlot* in_pCurrentSlot )
 				rMediaEntry.RemoveAlternateBank( in_pCurrentSlot );
 				MONITOR_MEDIAPREPARED( rMediaEntry );
 
+				// The media may still be in other banks, but the decoded copy may come from this one.
+				AkDecodedMediaCache::Flush( mediaID );
+
 				if( rMediaEntry.Release() == 0 ) // if the memory was released
 				{
 					m_MediaHashTable.Erase( iter );
@@ -3395,6 +3446,7 @@ void CAkBankMgr::UnPrepareMedia( CAkUsageSlot* in_pCurrentSlot )
 				{
 					if( iter.pItem->Assoc.item.Release() == 0 ) // if the memory was released
 					{
+						AkDecodedMediaCache::Flush( mediaID );
 						m_MediaHashTable.Erase( iter );
 					}
 				}
@@ -3435,6 +3487,7 @@ void CAkBankMgr::ReleaseMedia( AkMediaID in_mediaId )
 
 		if( rMediaEntry.Release() == 0 ) // if the memory was released
 		{
+			AkDecodedMediaCache::Flush( in_mediaId );
 			m_MediaHashTable.Erase( iter );
 		}
 	}
@@ -3606,6 +3659,7 @@ void CAkBankMgr::ReleaseSingleMedia( AkUniqueID in_SourceID )
 		AkMediaEntry& rMediaEntry = iter.pItem->Assoc.item;
 		if( rMediaEntry.Release() == 0 ) // if the memory was released
 		{
+			AkDecodedMediaCache::Flush( in_SourceID );
 			m_MediaHashTable.Erase( iter );
 		}
 	}
@@ -3720,6 +3774,7 @@ AkUInt32 CAkBankMgr::ReleaseMediaHashTableEntry(AkMediaEntry* in_pMediaEntryToRe
 	AkUInt32 uRefCount = in_pMediaEntryToRemove->Release();
 	if( uRefCount == 0 ) // if the memory was released
 	{
+		AkDecodedMediaCache::Flush( in_pMediaEntryToRemove->GetSourceID() );
 		m_MediaHashTable.Unset( in_pMediaEntryToRemove->GetSourceID() );
 	}
 
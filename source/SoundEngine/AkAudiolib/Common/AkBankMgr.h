@@ -672,7 +672,7 @@ protected:
 
 	AKRESULT ProcessBankHeader( AkBankHeader& in_rBankHeader, bool& out_bBackwardDataCompatibilityMode );
 	AKRESULT ProcessDataChunk( AkUInt32 in_dwDataChunkSize, CAkUsageSlot* in_pUsageSlot);
-	AKRESULT ProcessHircChunk( CAkUsageSlot* in_pUsageSlot, AkUInt32 in_dwBankID );
+	AKRESULT ProcessHircChunk( CAkUsageSlot* in_pUsageSlot, AkUInt32 in_dwBankID, AkUInt32 in_dwDataChunkSize );
 	AKRESULT ProcessStringMappingChunk( AkUInt32 in_dwDataChunkSize, CAkUsageSlot* in_pUsageSlot );
 	AKRESULT ProcessGlobalSettingsChunk( AkUInt32 in_dwDataChunkSize );
 	AKRESULT ProcessEnvSettingsChunk( AkUInt32 in_dwDataChunkSize );
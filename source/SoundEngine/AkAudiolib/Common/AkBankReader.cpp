@@ -35,6 +35,11 @@ CAkBankReader::CAkBankReader()
 	, m_pStreamBufferMemory(NULL)
 	, m_uDeviceBlockSize(0)
 	, m_pUserReadBuffer(NULL)
+	, m_pViewBuffer(NULL)
+	, m_pViewSavedStream(NULL)
+	, m_pViewSavedMemoryFile(NULL)
+	, m_uViewSavedBytesRemaining(0)
+	, m_bInMemoryView(false)
 	, m_pStream(NULL)
 	, m_pMemoryFile(NULL)
 	, m_bIsInitDone(false)
@@ -315,6 +320,49 @@ void CAkBankReader::ReleaseData()
 	}
 }
 
+const void* CAkBankReader::BeginMemoryView(AkUInt32 in_uSize)
+{
+	AKASSERT(!m_bInMemoryView);
+
+	const void* pData = GetData(in_uSize);
+	if (!pData)
+		return NULL;
+
+	// The view keeps the buffer GetData() may have allocated, so that GetData() can be used within the view.
+	m_pViewBuffer = m_pUserReadBuffer;
+	m_pUserReadBuffer = NULL;
+
+	// Read from the view as from a memory file, with no stream to fall back to.
+	m_pViewSavedStream = m_pStream;
+	m_pViewSavedMemoryFile = m_pMemoryFile;
+	m_uViewSavedBytesRemaining = m_uBufferBytesRemaining[m_uCurrentBufferIdx];
+	m_pStream = NULL;
+	m_pMemoryFile = pData;
+	m_uBufferBytesRemaining[m_uCurrentBufferIdx] = in_uSize;
+	m_bInMemoryView = true;
+
+	return pData;
+}
+
+void CAkBankReader::EndMemoryView()
+{
+	AKASSERT(m_bInMemoryView && !m_pUserReadBuffer);
+
+	// Resume right after the view, whether it was completely read or not.
+	m_pStream = m_pViewSavedStream;
+	m_pMemoryFile = m_pViewSavedMemoryFile;
+	m_uBufferBytesRemaining[m_uCurrentBufferIdx] = m_uViewSavedBytesRemaining;
+	m_pViewSavedStream = NULL;
+	m_pViewSavedMemoryFile = NULL;
+	m_bInMemoryView = false;
+
+	if (m_pViewBuffer)
+	{
+		AkFalign(AkMemID_Object, m_pViewBuffer);
+		m_pViewBuffer = NULL;
+	}
+}
+
 AKRESULT CAkBankReader::FillData(void* in_pDest, AkUInt32 in_uBytesToRead, AkUInt32& out_ruNumBytesRead)
 {
 	AKRESULT eResult = AK_Success;
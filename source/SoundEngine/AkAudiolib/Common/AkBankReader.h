@@ -74,6 +74,15 @@ public:
 	const void * GetData( AkUInt32 in_uSize );
 	void ReleaseData();
 
+	// Reads the next in_uSize bytes at once. Until EndMemoryView(), the following reads are served from them,
+	// without I/O, and cannot go past them. Returns NULL on failure.
+	// Views of in-memory files point to the file itself; views of streamed files are buffered.
+	const void * BeginMemoryView( AkUInt32 in_uSize );
+	void EndMemoryView();
+
+	// True if the file was set from memory: reads do no I/O and GetData() never allocates.
+	inline bool IsInMemoryFile() const { return m_pMemoryFile != NULL; }
+
 private:
 	AkUInt32 GetNextBufferIndex(AkUInt32 bufferIdx);
 	AKRESULT FinalizeStreamInit(AkUInt32 in_uFileOffset);
@@ -91,6 +100,13 @@ private:
 
 	void * m_pUserReadBuffer; // Buffer allocated by GetData and released by ReleaseData
 
+	// State of the reader saved by BeginMemoryView and restored by EndMemoryView
+	void * m_pViewBuffer;
+	AK::IAkStdStream * m_pViewSavedStream;
+	const void* m_pViewSavedMemoryFile;
+	AkUInt32 m_uViewSavedBytesRemaining;
+	bool m_bInMemoryView;
+
     AK::IAkStdStream * m_pStream;
     AkReal32 m_fThroughput;
     AkPriority m_priority;
@@ -26,6 +26,9 @@ Copyright (c) 2006-2020 Audiokinetic Inc.
 #include "AkSpeakerPan.h"
 #include "AkSpatialAudioVoice.h"
 #include "AkPipelineID.h"
+#include "AkPBI.h"
+
+bool CAkBehavioralCtx::s_bAncestorParamsShared = false;
 
 CAkBehavioralCtx::CAkBehavioralCtx(CAkRegisteredObj* in_pGameObj, CAkParameterNodeBase* pSoundNode, bool in_bPlayDirectly)
 	: CAkParameterTarget(in_pGameObj)	
@@ -343,7 +346,7 @@ void CAkBehavioralCtx::UpdateTargetParam(AkRTPC_ParameterID in_eParam, AkReal32
 
 void CAkBehavioralCtx::RecalcNotification(bool in_bLiveEdit, bool in_bLog)
 {
-	m_bAreParametersValid = false;
+	InvalidateParameters();
 	if (in_bLiveEdit)
 		m_bRefreshAllAfterRtpcChange = true;
 
@@ -353,6 +356,12 @@ void CAkBehavioralCtx::RecalcNotification(bool in_bLiveEdit, bool in_bLog)
 #endif
 }
 
+void CAkBehavioralCtx::DropSharedAncestorParams()
+{
+	// Busses may be above any of the cached parents.
+	AkAncestorParamsCache::InvalidateAll();
+}
+
 void CAkBehavioralCtx::RefreshParameters(AkInitialSoundParams* in_pInitialSoundParams)
 {
 	// Default implementation does nothing.
@@ -256,8 +256,8 @@ public:
 	
 	//CAkRTPCTarget inteface
 	virtual void UpdateTargetParam(AkRTPC_ParameterID in_eParam, AkReal32 in_fValue, AkReal32 in_fDelta);
-	virtual void NotifyParamChanged(bool in_bLiveEdit, AkRTPC_ParameterID in_rtpcID) { m_bAreParametersValid = false; }
-	virtual void NotifyParamsChanged(bool in_bLiveEdit, const AkRTPCBitArray& in_bitArray) { m_bAreParametersValid = false; }
+	virtual void NotifyParamChanged(bool in_bLiveEdit, AkRTPC_ParameterID in_rtpcID) { InvalidateParameters(); }
+	virtual void NotifyParamsChanged(bool in_bLiveEdit, const AkRTPCBitArray& in_bitArray) { InvalidateParameters(); }
 	virtual AkRTPCBitArray GetTargetedParamsSet()	{ return AkRTPCBitArray(RTPC_PBI_PARAMS_BITFIELD); }
 	virtual bool RegisterToBusHierarchy()
 	{
@@ -309,14 +309,28 @@ public:
 	// Voice-specific data that needs to be accessed quickly from the lower engine.
 	inline bool IsForcedVirtualized() { return m_bIsForcedToVirtualizeForLimiting || m_bIsVirtualizedForInterruption; }
 	
-	inline void ForceParametersDirty() { m_bAreParametersValid = false; }
+	inline void ForceParametersDirty() { InvalidateParameters(); }
+	inline bool HasPendingParameterChanges() const { return !m_bAreParametersValid || m_bFadeRatioDirty || m_bIsAutomationOrAttenuationDirty; }
 
 	AkForceInline AkPipelineID GetPipelineID() const { return m_PipelineID; }
 
 	// Must be called if spatial audio params (other than send volumes) on the parameter node have changed.
 	void SpatialAudioParamsUpdated();
+
+	// Set while AkAncestorParamsCache is open, so that invalidated contexts drop the ancestor parameters they may share.
+	static AkForceInline void SetAncestorParamsShared(bool in_bShared) { s_bAncestorParamsShared = in_bShared; }
 protected:
 
+	AkForceInline void InvalidateParameters()
+	{
+		m_bAreParametersValid = false;
+		if (s_bAncestorParamsShared)
+			DropSharedAncestorParams();
+	}
+
+	// Drops the entries of AkAncestorParamsCache that may depend on what changed for this context (all of them by default).
+	virtual void DropSharedAncestorParams();
+
 	AKRESULT CacheEmitterPosition();
 
 	AkReal32 Scale3DUserDefRTPCValue(AkReal32 in_fValue);
@@ -373,6 +387,8 @@ protected:
 private:
 	AkReal32			m_fCachedOutputBusVolumeLin; // used to avoid recomputing dBToLin when not necessary
 	AkReal32			m_fLastOutputBusVolume;    // used to avoid recomputing dBToLin when not necessary
+
+	static bool			s_bAncestorParamsShared;
 };
 
 #endif
\ No newline at end of file
@@ -29,23 +29,53 @@ extern AkInitSettings g_settings;
 #define AK_PIPELINE_BUFFER_FREELIST_MAX_CHANNELS 8
 
 static AkAtomicPtr sBufferFreeListBuckets[ AK_PIPELINE_BUFFER_FREELIST_MAX_CHANNELS ];
+static AkAtomicPtr sHalfBufferFreeListBuckets[ AK_PIPELINE_BUFFER_FREELIST_MAX_CHANNELS ];
 
-void AkPipelineBufferBase::InitFreeListBuckets() {
-	AKPLATFORM::AkMemSet( sBufferFreeListBuckets, 0, sizeof( sBufferFreeListBuckets ) );
+static AkForceInline void * PopFreeBuffer( AkAtomicPtr * in_pBucketFreeListHead ) {
+	for ( ; ; ) {
+		void * pFreeBuffer = AkAtomicLoadPtr( in_pBucketFreeListHead );
+		if ( !pFreeBuffer ) {
+			return NULL;
+		}
+		void* pNextBuffer = ( void* )*( uintptr_t* )AkAtomicLoadPtr( ( AkAtomicPtr * )&pFreeBuffer );
+		if ( AkAtomicCasPtr( in_pBucketFreeListHead, pNextBuffer, pFreeBuffer ) ) {
+			return pFreeBuffer;
+		}
+	}
 }
 
-void AkPipelineBufferBase::ClearFreeListBuckets() {
+static AkForceInline void PushFreeBuffer( AkAtomicPtr * in_pBucketFreeListHead, void * in_pBuffer ) {
+	for ( ; ; ) {
+		void * pNextBuffer = AkAtomicLoadPtr( in_pBucketFreeListHead );
+		AkAtomicStorePtr( ( AkAtomicPtr * )in_pBuffer, pNextBuffer );
+		if ( AkAtomicCasPtr( in_pBucketFreeListHead, in_pBuffer, pNextBuffer ) ) {
+			break;
+		}
+	}
+}
+
+static void ClearFreeLists( AkAtomicPtr * in_pBuckets ) {
 	for ( AkInt32 i = 0; i < AK_PIPELINE_BUFFER_FREELIST_MAX_CHANNELS; ++i ) {
-		void * pBuffer = ( void* )sBufferFreeListBuckets[ i ];
+		void * pBuffer = ( void* )in_pBuckets[ i ];
 		while ( pBuffer ) {
 			void* pNextBuffer = ( void * )*( uintptr_t * )pBuffer;
 			AkFalign( AkMemID_Processing, pBuffer );
 			pBuffer = pNextBuffer;
 		}
-		sBufferFreeListBuckets[ i ] = NULL;
+		in_pBuckets[ i ] = NULL;
 	}
 }
 
+void AkPipelineBufferBase::InitFreeListBuckets() {
+	AKPLATFORM::AkMemSet( sBufferFreeListBuckets, 0, sizeof( sBufferFreeListBuckets ) );
+	AKPLATFORM::AkMemSet( sHalfBufferFreeListBuckets, 0, sizeof( sHalfBufferFreeListBuckets ) );
+}
+
+void AkPipelineBufferBase::ClearFreeListBuckets() {
+	ClearFreeLists( sBufferFreeListBuckets );
+	ClearFreeLists( sHalfBufferFreeListBuckets );
+}
+
 AKRESULT AkPipelineBufferBase::GetCachedBuffer( )
 {
 	AkUInt32 uNumChannels = NumChannels();
@@ -60,20 +90,7 @@ AKRESULT AkPipelineBufferBase::GetCachedBuffer( )
 	void * pBuffer = NULL;
 
 	if ( uMaxFrames == AkAudioLibSettings::g_uNumSamplesPerFrame && uNumChannels <= AK_PIPELINE_BUFFER_FREELIST_MAX_CHANNELS ) {
-		AkUInt32 uFreeListBucketIndex = uNumChannels - 1;
-		AkAtomicPtr * pBucketFreeListHead = &sBufferFreeListBuckets[ uFreeListBucketIndex ];
-
-		for ( ; ; ) {
-			void * pFreeBuffer = AkAtomicLoadPtr( pBucketFreeListHead );
-			if ( !pFreeBuffer ) {
-				break;
-			}
-			void* pNextBuffer = ( void* )*( uintptr_t* )AkAtomicLoadPtr( ( AkAtomicPtr * )&pFreeBuffer );
-			if ( AkAtomicCasPtr( pBucketFreeListHead, pNextBuffer, pFreeBuffer ) ) {
-				pBuffer = pFreeBuffer;
-				break;
-			}
-		}
+		pBuffer = PopFreeBuffer( &sBufferFreeListBuckets[ uNumChannels - 1 ] );
 	}
 
 	if ( !pBuffer ) {
@@ -94,16 +111,52 @@ void AkPipelineBufferBase::ReleaseCachedBuffer()
 	AkUInt32 uNumChannels = NumChannels();
 	AKASSERT( pData && uNumChannels > 0 );
 	if (uMaxFrames == AkAudioLibSettings::g_uNumSamplesPerFrame && uNumChannels <= AK_PIPELINE_BUFFER_FREELIST_MAX_CHANNELS ) {
-		AkUInt32 uFreeListBucketIndex = uNumChannels - 1;
-		AkAtomicPtr * pBucketFreeListHead = &sBufferFreeListBuckets[ uFreeListBucketIndex ];
+		PushFreeBuffer( &sBufferFreeListBuckets[ uNumChannels - 1 ], pData );
+	} else {
+		AkFalign( AkMemID_Processing, pData );
+	}
 
-		for ( ; ; ) {
-			void * pNextBuffer = AkAtomicLoadPtr( pBucketFreeListHead );
-			AkAtomicStorePtr( ( AkAtomicPtr * )pData, pNextBuffer );
-			if ( AkAtomicCasPtr( pBucketFreeListHead, pData, pNextBuffer ) ) {
-				break;
-			}
+	pData = NULL;
+	uMaxFrames = 0;
+}
+
+AKRESULT AkPipelineBufferBase::GetCachedHalfBuffer()
+{
+	AkUInt32 uNumChannels = NumChannels();
+	AKASSERT( !pData || !"When the buffer is consumed, it must be set to null" );
+	AKASSERT( uNumChannels || !"Channel mask must be set before allocating audio buffer" );
+
+	if (uMaxFrames < AkAudioLibSettings::g_uNumSamplesPerFrame)
+	{
+		uMaxFrames = (AkUInt16)AkAudioLibSettings::g_uNumSamplesPerFrame;
+	}
+	uMaxFrames = (AkUInt16)( ( uMaxFrames + 1 ) / 2 );
+
+	void * pBuffer = NULL;
+
+	if ( uMaxFrames * 2 == AkAudioLibSettings::g_uNumSamplesPerFrame && uNumChannels <= AK_PIPELINE_BUFFER_FREELIST_MAX_CHANNELS ) {
+		pBuffer = PopFreeBuffer( &sHalfBufferFreeListBuckets[ uNumChannels - 1 ] );
+	}
+
+	if ( !pBuffer ) {
+		AkUInt32 uAllocSize = uMaxFrames * sizeof( AkReal32 ) * uNumChannels;
+		pBuffer = AkMalign( AkMemID_Processing, uAllocSize, AK_BUFFER_ALIGNMENT );
+		if ( !pBuffer ) {
+			return AK_InsufficientMemory;
 		}
+	}
+
+	pData = pBuffer;
+	uValidFrames = 0;
+	return AK_Success;
+}
+
+void AkPipelineBufferBase::ReleaseCachedHalfBuffer()
+{
+	AkUInt32 uNumChannels = NumChannels();
+	AKASSERT( pData && uNumChannels > 0 );
+	if ( uMaxFrames * 2 == AkAudioLibSettings::g_uNumSamplesPerFrame && uNumChannels <= AK_PIPELINE_BUFFER_FREELIST_MAX_CHANNELS ) {
+		PushFreeBuffer( &sHalfBufferFreeListBuckets[ uNumChannels - 1 ], pData );
 	} else {
 		AkFalign( AkMemID_Processing, pData );
 	}
@@ -112,6 +165,202 @@ void AkPipelineBufferBase::ReleaseCachedBuffer()
 	uMaxFrames = 0;
 }
 
+AKRESULT AkPipelineBufferBase::GetScratchBuffer()
+{
+	AkUInt32 uNumChannels = NumChannels();
+	AKASSERT( !pData || !"When the buffer is consumed, it must be set to null" );
+	AKASSERT( uNumChannels || !"Channel mask must be set before allocating audio buffer" );
+
+	if (uMaxFrames < AkAudioLibSettings::g_uNumSamplesPerFrame)
+	{
+		uMaxFrames = (AkUInt16)AkAudioLibSettings::g_uNumSamplesPerFrame;
+	}
+
+	// Without an arena, or when it is full, use the pipeline buffer cache rather than the heap.
+	pData = AkProcessingArenas::TryAlloc( uMaxFrames * sizeof( AkReal32 ) * uNumChannels );
+	if ( !pData )
+		return GetCachedBuffer();
+
+	uValidFrames = 0;
+	return AK_Success;
+}
+
+void AkPipelineBufferBase::ReleaseScratchBuffer()
+{
+	AKASSERT( pData && NumChannels() > 0 );
+	if ( !AkProcessingArenas::Owns( pData ) )
+	{
+		ReleaseCachedBuffer();
+		return;
+	}
+
+	AkProcessingArenas::Free( pData, uMaxFrames * sizeof( AkReal32 ) * NumChannels() );
+	pData = NULL;
+	uMaxFrames = 0;
+}
+
+//-----------------------------------------------------------------------------
+// AkProcessingArenas
+//-----------------------------------------------------------------------------
+
+struct AkProcessingArena
+{
+	AK_ALIGN( AkUInt32 uUsed, 64 );			// Bytes allocated from the start of the arena.
+	AkUInt32	uDepth;								// Number of nested BeginTask() calls of the owner.
+	AkAtomic32	bOwned;
+	AkThreadID	owner;								// Thread currently using the arena, valid when bOwned is set.
+};
+
+AkUInt32 AkProcessingArenas::s_uNumArenas = 0;
+static AkUInt32 s_uArenaSize = 0;
+static AkUInt8 * s_pArenaMemory = NULL;			// s_uNumArenas contiguous arenas of s_uArenaSize bytes.
+static AkProcessingArena * s_pArenas = NULL;
+
+static AkForceInline AkUInt32 AlignArenaSize( AkUInt32 in_uSize )
+{
+	return ( in_uSize + AK_BUFFER_ALIGNMENT - 1 ) & ~( AK_BUFFER_ALIGNMENT - 1 );
+}
+
+AKRESULT AkProcessingArenas::Init( AkUInt32 in_uArenaSize, AkUInt32 in_uNumWorkerThreads )
+{
+	AKASSERT( s_pArenas == NULL );
+
+	if ( in_uArenaSize == 0 )
+		return AK_Success;
+
+	AkUInt32 uNumArenas = in_uNumWorkerThreads + 1;
+	AkUInt32 uArenaSize = AlignArenaSize( in_uArenaSize );
+
+	s_pArenas = (AkProcessingArena*)AkMalign( AkMemID_Processing, uNumArenas * sizeof( AkProcessingArena ), 64 );
+	s_pArenaMemory = (AkUInt8*)AkMalign( AkMemID_Processing, uNumArenas * uArenaSize, AK_BUFFER_ALIGNMENT );
+	if ( !s_pArenas || !s_pArenaMemory )
+	{
+		Term();
+		return AK_InsufficientMemory;
+	}
+
+	AKPLATFORM::AkMemSet( s_pArenas, 0, uNumArenas * sizeof( AkProcessingArena ) );
+	s_uArenaSize = uArenaSize;
+	s_uNumArenas = uNumArenas;
+	return AK_Success;
+}
+
+void AkProcessingArenas::Term()
+{
+	if ( s_pArenaMemory )
+		AkFalign( AkMemID_Processing, s_pArenaMemory );
+	if ( s_pArenas )
+		AkFalign( AkMemID_Processing, s_pArenas );
+	s_pArenaMemory = NULL;
+	s_pArenas = NULL;
+	s_uArenaSize = 0;
+	s_uNumArenas = 0;
+}
+
+void AkProcessingArenas::BeginTask( AkUInt32 in_uIdxThread )
+{
+	if ( in_uIdxThread < s_uNumArenas )
+	{
+		AkProcessingArena & arena = s_pArenas[ in_uIdxThread ];
+		AkThreadID currentThread = AKPLATFORM::CurrentThread();
+
+		// A task may run nested tasks on the same thread (e.g. a serial scheduler): they share the arena until the outermost task ends.
+		if ( AkAtomicLoad32( &arena.bOwned ) && arena.owner == currentThread )
+		{
+			++arena.uDepth;
+			return;
+		}
+
+		AKASSERT( !AkAtomicLoad32( &arena.bOwned ) || !"Two threads are using the same task scheduler thread index" );
+		arena.owner = currentThread;
+		arena.uDepth = 1;
+		AkAtomicStore32( &arena.bOwned, 1 );
+	}
+}
+
+void AkProcessingArenas::EndTask( AkUInt32 in_uIdxThread )
+{
+	if ( in_uIdxThread < s_uNumArenas )
+	{
+		AkProcessingArena & arena = s_pArenas[ in_uIdxThread ];
+		AKASSERT( AkAtomicLoad32( &arena.bOwned ) && arena.uDepth > 0 );
+		if ( --arena.uDepth == 0 )
+			AkAtomicStore32( &arena.bOwned, 0 );
+	}
+}
+
+bool AkProcessingArenas::Owns( const void * in_pMem )
+{
+	return s_pArenaMemory 
+		&& (const AkUInt8*)in_pMem >= s_pArenaMemory 
+		&& (AkUIntPtr)( (const AkUInt8*)in_pMem - s_pArenaMemory ) < (AkUIntPtr)s_uNumArenas * s_uArenaSize;
+}
+
+void * AkProcessingArenas::Alloc( AkUInt32 in_uSize )
+{
+	void * pMem = TryAlloc( in_uSize );
+	if ( pMem )
+		return pMem;
+
+	return AkMalign( AkMemID_Processing, in_uSize, AK_BUFFER_ALIGNMENT );
+}
+
+void * AkProcessingArenas::TryAlloc( AkUInt32 in_uSize )
+{
+	if ( s_pArenas )
+	{
+		// Few arenas: a linear search for the calling thread is much cheaper than the heap.
+		AkThreadID currentThread = AKPLATFORM::CurrentThread();
+		AkProcessingArena * pArena = NULL;
+		for ( AkUInt32 i = 0; i < s_uNumArenas; ++i )
+		{
+			if ( AkAtomicLoad32( &s_pArenas[ i ].bOwned ) && s_pArenas[ i ].owner == currentThread )
+			{
+				pArena = &s_pArenas[ i ];
+				break;
+			}
+		}
+
+		if ( pArena )
+		{
+			AkUInt32 uSize = AlignArenaSize( in_uSize );
+			if ( uSize <= s_uArenaSize - pArena->uUsed )
+			{
+				void * pMem = s_pArenaMemory + ( pArena - s_pArenas ) * s_uArenaSize + pArena->uUsed;
+				pArena->uUsed += uSize;
+				return pMem;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+void AkProcessingArenas::Free( void * in_pMem, AkUInt32 in_uSize )
+{
+	if ( Owns( in_pMem ) )
+	{
+		AkUIntPtr uOffset = (AkUInt8*)in_pMem - s_pArenaMemory;
+		// Only the last allocation can be given back; the others are reclaimed at the end of the frame.
+		AkProcessingArena & arena = s_pArenas[ uOffset / s_uArenaSize ];
+		AkUInt32 uSize = AlignArenaSize( in_uSize );
+		if ( uOffset % s_uArenaSize + uSize == arena.uUsed )
+			arena.uUsed -= uSize;
+		return;
+	}
+
+	AkFalign( AkMemID_Processing, in_pMem );
+}
+
+void AkProcessingArenas::FrameEnd()
+{
+	for ( AkUInt32 i = 0; i < s_uNumArenas; ++i )
+	{
+		AKASSERT( !AkAtomicLoad32( &s_pArenas[ i ].bOwned ) );
+		s_pArenas[ i ].uUsed = 0;
+	}
+}
+
 
 bool AkAudioBuffer::CheckValidSamples()
 {
@@ -142,6 +142,16 @@ public:
 	AKRESULT GetCachedBuffer();
 	void ReleaseCachedBuffer();
 
+	// Like GetCachedBuffer, but with half as many frames as requested (rounded up), for data which stores two samples
+	// in each float (see AkFloat16Buffer). Buffers of half an audio frame have their own free lists.
+	AKRESULT GetCachedHalfBuffer();
+	void ReleaseCachedHalfBuffer();
+
+	// Deinterleaved temporary buffer, taken from the processing arenas (see AkProcessingArenas), or from the cached buffers 
+	// when the calling thread has no arena or its arena is full. Must be released by the same thread, before the end of the frame.
+	AKRESULT GetScratchBuffer();
+	void ReleaseScratchBuffer();
+
 	AkForceInline void SetChannelConfig( AkChannelConfig in_channelConfig )
 	{
 		AKASSERT( !pData || channelConfig.uNumChannels == 0 || channelConfig.uNumChannels == in_channelConfig.uNumChannels );
@@ -149,6 +159,44 @@ public:
 	}
 };
 
+//-----------------------------------------------------------------------------
+// Name: class AkProcessingArenas
+// Desc: Frame-scoped linear allocators for short-lived AkMemID_Processing memory.
+//       There is one arena per task scheduler worker, plus one for the audio thread.
+//       Memory must be freed by the thread that allocated it, before FrameEnd().
+//       Allocations that do not fit, or are made outside of a claimed arena, go to the heap.
+//       The lower engine sizes them for its scratch buffers (see CAkLEngine::SoftwareInit).
+//-----------------------------------------------------------------------------
+class AkProcessingArenas
+{
+public:
+	static AKRESULT Init( AkUInt32 in_uArenaSize, AkUInt32 in_uNumWorkerThreads );
+	static void Term();
+
+	// Claim/release the arena of worker in_uIdxThread for the calling thread, for the duration of a task.
+	// Calls may be nested on the same thread: the arena is released by the outermost EndTask().
+	static void BeginTask( AkUInt32 in_uIdxThread );
+	static void EndTask( AkUInt32 in_uIdxThread );
+
+	// Claim/release the audio thread's arena.
+	static void BeginAudioThread() { BeginTask( s_uNumArenas - 1 ); }
+	static void EndAudioThread() { EndTask( s_uNumArenas - 1 ); }
+
+	// Aligned on AK_BUFFER_ALIGNMENT. Releasing the last allocation of an arena makes its memory available again.
+	static void * Alloc( AkUInt32 in_uSize );
+	static void Free( void * in_pMem, AkUInt32 in_uSize );
+
+	// Same as Alloc(), but returns NULL instead of going to the heap.
+	static void * TryAlloc( AkUInt32 in_uSize );
+	static bool Owns( const void * in_pMem );
+
+	// Reset all arenas. No arena may be in use.
+	static void FrameEnd();
+
+private:
+	static AkUInt32 s_uNumArenas;
+};
+
 class AkPipelineBuffer
 	: public AkPipelineBufferBase
 {
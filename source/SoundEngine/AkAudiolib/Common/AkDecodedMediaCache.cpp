@@ -0,0 +1,382 @@
+/***********************************************************************
+  The content of this file includes source code for the sound engine
+  portion of the AUDIOKINETIC Wwise Technology and constitutes "Level
+  Two Source Code" as defined in the Source Code Addendum attached
+  with this file.  Any use of the Level Two Source Code shall be
+  subject to the terms and conditions outlined in the Source Code
+  Addendum and the End User License Agreement for Wwise(R).
+
+  Version:  Build:
+  Copyright (c) 2006-2019 Audiokinetic Inc.
+ ***********************************************************************/
+
+//////////////////////////////////////////////////////////////////////
+//
+// AkDecodedMediaCache.cpp
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "AkDecodedMediaCache.h"
+#include <AK/Tools/Common/AkHashList.h>
+#include <AK/Tools/Common/AkLock.h>
+#include <AK/Tools/Common/AkAutoLock.h>
+
+// Number of recently missed media remembered for admission.
+#define AK_DECODED_MEDIA_NUM_CANDIDATES	(64)
+
+// Only media that fit this many times in the budget are cached.
+#define AK_DECODED_MEDIA_MIN_ENTRIES	(4)
+
+typedef AkHashListBare<AkUniqueID, AkDecodedMedia> AkDecodedMediaList;
+
+static CAkLock s_lock;
+static AkDecodedMediaList s_media;
+static AkUInt32 s_uMemoryUsed = 0;			// Cached media, and the media being recorded.
+static AkUInt32 s_uFlushCount = 0;
+static AkDecodedMediaCacheStats s_stats = { 0, 0, 0, 0, 0, 0, 0 };
+
+// Media not in use, least recently used first.
+static AkDecodedMedia * s_pLruFirst = NULL;
+static AkDecodedMedia * s_pLruLast = NULL;
+
+// Ring of media that missed once. Media missing a second time are recorded.
+static AkDecodedMediaKey s_candidates[AK_DECODED_MEDIA_NUM_CANDIDATES];
+static AkUInt32 s_uNumCandidates = 0;
+static AkUInt32 s_uNextCandidate = 0;
+
+void AkDecodedMedia::CopyFrames( AkUInt32 in_uStartFrame, AkUInt32 in_uNumFrames, AkReal32 * out_pData, AkUInt32 in_uDstStride ) const
+{
+	AKASSERT( in_uStartFrame + in_uNumFrames <= m_uNumFrames );
+	for ( AkUInt32 i = 0; i < m_uNumChannels; ++i )
+		AKPLATFORM::AkMemCpy( out_pData + i * in_uDstStride, GetChannel( i ) + in_uStartFrame, in_uNumFrames * sizeof(AkReal32) );
+}
+
+void AkDecodedMediaCache::Init()
+{
+	AKPLATFORM::AkMemSet( &s_stats, 0, sizeof( s_stats ) );
+	s_uMemoryUsed = 0;
+	s_uFlushCount = 0;
+	s_pLruFirst = NULL;
+	s_pLruLast = NULL;
+	s_uNumCandidates = 0;
+	s_uNextCandidate = 0;
+}
+
+void AkDecodedMediaCache::Term()
+{
+	AkAutoLock<CAkLock> lock( s_lock );
+
+	AkDecodedMediaList::IteratorEx it = s_media.BeginEx();
+	while ( it != s_media.End() )
+	{
+		AkDecodedMedia * pMedia = *it;
+		AKASSERT( pMedia->m_cRef == 0 || !"Decoded media still in use" );
+		it = s_media.Erase( it );
+		Free( pMedia );
+	}
+	s_media.Term();
+	s_uMemoryUsed = 0;
+	s_pLruFirst = NULL;
+	s_pLruLast = NULL;
+	s_uNumCandidates = 0;
+}
+
+bool AkDecodedMediaCache::IsCacheableFormat( AkUInt16 in_uFormatTag )
+{
+	return in_uFormatTag == AK_WAVE_FORMAT_VORBIS
+		|| in_uFormatTag == AK_WAVE_FORMAT_OPUS_WEM;
+}
+
+const AkDecodedMedia * AkDecodedMediaCache::Acquire( const AkDecodedMediaKey & in_key )
+{
+	AkAutoLock<CAkLock> lock( s_lock );
+
+	AkDecodedMedia * pMedia = s_media.Exists( in_key.mediaID );
+	if ( pMedia && pMedia->m_key == in_key )
+	{
+		if ( pMedia->m_cRef++ == 0 )
+			LruRemove( pMedia );
+		++s_stats.uNumHits;
+		return pMedia;
+	}
+
+	++s_stats.uNumMisses;
+	return NULL;
+}
+
+void AkDecodedMediaCache::Release( const AkDecodedMedia * in_pMedia )
+{
+	AkAutoLock<CAkLock> lock( s_lock );
+	AkDecodedMedia * pMedia = const_cast<AkDecodedMedia*>( in_pMedia );
+	AKASSERT( pMedia->m_cRef > 0 );
+	if ( --pMedia->m_cRef == 0 )
+	{
+		if ( pMedia->m_bFlushed )
+		{
+			s_uMemoryUsed -= GetSize( pMedia->m_uNumFrames, pMedia->m_uNumChannels );
+			Free( pMedia );
+		}
+		else
+		{
+			LruAdd( pMedia );
+		}
+	}
+}
+
+AkDecodedMedia * AkDecodedMediaCache::BeginRecording(
+	const AkDecodedMediaKey & in_key,
+	AkUInt32 in_uNumFrames,
+	AkUInt32 in_uNumChannels,
+	AkUInt32 in_uSampleRate,
+	AkUInt8 in_uChannelOrdering
+	)
+{
+	AkUInt64 uSize = (AkUInt64)in_uNumFrames * in_uNumChannels * sizeof(AkReal32);
+	if ( in_uNumFrames == 0 || uSize > g_settings.uDecodedMediaCacheSize / AK_DECODED_MEDIA_MIN_ENTRIES )
+		return NULL;
+
+	AkUInt32 uFlushCount;
+	{
+		AkAutoLock<CAkLock> lock( s_lock );
+		uFlushCount = s_uFlushCount;
+
+		bool bAdmit = false;
+		for ( AkUInt32 i = 0; i < s_uNumCandidates; ++i )
+		{
+			if ( s_candidates[i] == in_key )
+			{
+				// Second miss: record it, and forget it as a candidate.
+				s_candidates[i] = s_candidates[--s_uNumCandidates];
+				bAdmit = true;
+				break;
+			}
+		}
+
+		if ( !bAdmit )
+		{
+			if ( s_uNumCandidates < AK_DECODED_MEDIA_NUM_CANDIDATES )
+			{
+				s_candidates[s_uNumCandidates++] = in_key;
+			}
+			else
+			{
+				s_candidates[s_uNextCandidate] = in_key;
+				s_uNextCandidate = ( s_uNextCandidate + 1 ) % AK_DECODED_MEDIA_NUM_CANDIDATES;
+			}
+			return NULL;
+		}
+
+		// Recordings are charged to the budget from the start, so that sources recording at the same time cannot exceed it.
+		if ( !MakeRoom( (AkUInt32)uSize ) )
+		{
+			++s_stats.uNumRejections;
+			return NULL;
+		}
+		s_uMemoryUsed += (AkUInt32)uSize;
+	}
+
+	AkDecodedMedia * pMedia = AkNew( AkMemID_Media, AkDecodedMedia() );
+	if ( pMedia )
+	{
+		pMedia->m_pData = (AkReal32*)AkMalign( AkMemID_Media, (AkUInt32)uSize, AK_BUFFER_ALIGNMENT );
+		if ( !pMedia->m_pData )
+		{
+			AkDelete( AkMemID_Media, pMedia );
+			pMedia = NULL;
+		}
+	}
+
+	if ( !pMedia )
+	{
+		AkAutoLock<CAkLock> lock( s_lock );
+		s_uMemoryUsed -= (AkUInt32)uSize;
+		return NULL;
+	}
+
+	pMedia->key = in_key.mediaID;
+	pMedia->pNextItem = NULL;
+	pMedia->m_key = in_key;
+	pMedia->m_uNumFrames = in_uNumFrames;
+	pMedia->m_uSampleRate = in_uSampleRate;
+	pMedia->m_uNumFramesRecorded = 0;
+	pMedia->m_uFlushCount = uFlushCount;
+	pMedia->m_pPrevLru = NULL;
+	pMedia->m_pNextLru = NULL;
+	pMedia->m_cRef = 0;
+	pMedia->m_uNumChannels = (AkUInt16)in_uNumChannels;
+	pMedia->m_uChannelOrdering = in_uChannelOrdering;
+	pMedia->m_bFlushed = false;
+	return pMedia;
+}
+
+void AkDecodedMediaCache::Record(
+	AkDecodedMedia *& io_pRecording,
+	AkUInt32 in_uStartFrame,
+	const AkReal32 * in_pData,
+	AkUInt32 in_uSrcStride,
+	AkUInt32 in_uNumFrames
+	)
+{
+	AkDecodedMedia * pMedia = io_pRecording;
+	if ( in_uStartFrame != pMedia->m_uNumFramesRecorded
+		|| in_uStartFrame + in_uNumFrames > pMedia->m_uNumFrames )
+	{
+		CancelRecording( io_pRecording );
+		return;
+	}
+
+	for ( AkUInt32 i = 0; i < pMedia->m_uNumChannels; ++i )
+		AKPLATFORM::AkMemCpy( pMedia->m_pData + i * pMedia->m_uNumFrames + in_uStartFrame, in_pData + i * in_uSrcStride, in_uNumFrames * sizeof(AkReal32) );
+	pMedia->m_uNumFramesRecorded += in_uNumFrames;
+
+	if ( pMedia->m_uNumFramesRecorded == pMedia->m_uNumFrames )
+	{
+		io_pRecording = NULL;
+		Commit( pMedia );
+	}
+}
+
+void AkDecodedMediaCache::CancelRecording( AkDecodedMedia *& io_pRecording )
+{
+	if ( io_pRecording )
+	{
+		AkAutoLock<CAkLock> lock( s_lock );
+		DiscardRecording( io_pRecording );
+		io_pRecording = NULL;
+	}
+}
+
+void AkDecodedMediaCache::Flush( AkUniqueID in_mediaID )
+{
+	if ( !IsEnabled() )
+		return;
+
+	AkAutoLock<CAkLock> lock( s_lock );
+
+	// Recordings in progress may be of the unloaded data; there is no telling which, so drop them all.
+	++s_uFlushCount;
+
+	AkDecodedMedia * pMedia = s_media.Exists( in_mediaID );
+	if ( pMedia )
+		Remove( pMedia );
+
+	for ( AkUInt32 i = 0; i < s_uNumCandidates; )
+	{
+		if ( s_candidates[i].mediaID == in_mediaID )
+			s_candidates[i] = s_candidates[--s_uNumCandidates];
+		else
+			++i;
+	}
+}
+
+void AkDecodedMediaCache::GetStats( AkDecodedMediaCacheStats & out_stats )
+{
+	AkAutoLock<CAkLock> lock( s_lock );
+	out_stats = s_stats;
+	out_stats.uNumEntries = s_media.Length();
+	out_stats.uMemoryUsed = s_uMemoryUsed;
+}
+
+void AkDecodedMediaCache::Commit( AkDecodedMedia * in_pMedia )
+{
+	AkAutoLock<CAkLock> lock( s_lock );
+
+	if ( in_pMedia->m_uFlushCount != s_uFlushCount )
+	{
+		// Media were unloaded while this one was recorded: it may have been decoded from them.
+		DiscardRecording( in_pMedia );
+		return;
+	}
+
+	// Media with the same ID but a different format is stale: replace it.
+	AkDecodedMedia * pOther = s_media.Exists( in_pMedia->key );
+	if ( pOther )
+	{
+		if ( pOther->m_key == in_pMedia->m_key )
+		{
+			// Recorded first by another source.
+			DiscardRecording( in_pMedia );
+			return;
+		}
+		Remove( pOther );
+	}
+
+	// Its memory was taken from the budget by BeginRecording().
+	if ( !s_media.Set( in_pMedia ) )
+	{
+		++s_stats.uNumRejections;
+		DiscardRecording( in_pMedia );
+		return;
+	}
+
+	LruAdd( in_pMedia );
+	++s_stats.uNumInsertions;
+}
+
+// Frees a recording that was not added to the cache, and gives its memory back to the budget.
+void AkDecodedMediaCache::DiscardRecording( AkDecodedMedia * in_pMedia )
+{
+	s_uMemoryUsed -= GetSize( in_pMedia->m_uNumFrames, in_pMedia->m_uNumChannels );
+	Free( in_pMedia );
+}
+
+// Evicts the least recently used media that are not in use until in_uSize more bytes fit in the budget.
+bool AkDecodedMediaCache::MakeRoom( AkUInt32 in_uSize )
+{
+	while ( s_uMemoryUsed + in_uSize > g_settings.uDecodedMediaCacheSize )
+	{
+		if ( !s_pLruFirst )
+			return false;
+
+		Remove( s_pLruFirst );
+		++s_stats.uNumEvictions;
+	}
+	return true;
+}
+
+// Removes media from the cache. Media in use are only freed on their last Release().
+void AkDecodedMediaCache::Remove( AkDecodedMedia * in_pMedia )
+{
+	s_media.Unset( in_pMedia->key );
+	if ( in_pMedia->m_cRef > 0 )
+	{
+		in_pMedia->m_bFlushed = true;
+		return;
+	}
+
+	LruRemove( in_pMedia );
+	s_uMemoryUsed -= GetSize( in_pMedia->m_uNumFrames, in_pMedia->m_uNumChannels );
+	Free( in_pMedia );
+}
+
+void AkDecodedMediaCache::LruAdd( AkDecodedMedia * in_pMedia )
+{
+	in_pMedia->m_pPrevLru = s_pLruLast;
+	in_pMedia->m_pNextLru = NULL;
+	if ( s_pLruLast )
+		s_pLruLast->m_pNextLru = in_pMedia;
+	else
+		s_pLruFirst = in_pMedia;
+	s_pLruLast = in_pMedia;
+}
+
+void AkDecodedMediaCache::LruRemove( AkDecodedMedia * in_pMedia )
+{
+	if ( in_pMedia->m_pPrevLru )
+		in_pMedia->m_pPrevLru->m_pNextLru = in_pMedia->m_pNextLru;
+	else
+		s_pLruFirst = in_pMedia->m_pNextLru;
+	if ( in_pMedia->m_pNextLru )
+		in_pMedia->m_pNextLru->m_pPrevLru = in_pMedia->m_pPrevLru;
+	else
+		s_pLruLast = in_pMedia->m_pPrevLru;
+	in_pMedia->m_pPrevLru = NULL;
+	in_pMedia->m_pNextLru = NULL;
+}
+
+void AkDecodedMediaCache::Free( AkDecodedMedia * in_pMedia )
+{
+	AkFalign( AkMemID_Media, in_pMedia->m_pData );
+	AkDelete( AkMemID_Media, in_pMedia );
+}
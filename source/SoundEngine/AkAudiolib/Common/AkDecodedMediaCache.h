@@ -0,0 +1,155 @@
+/***********************************************************************
+  The content of this file includes source code for the sound engine
+  portion of the AUDIOKINETIC Wwise Technology and constitutes "Level
+  Two Source Code" as defined in the Source Code Addendum attached
+  with this file.  Any use of the Level Two Source Code shall be
+  subject to the terms and conditions outlined in the Source Code
+  Addendum and the End User License Agreement for Wwise(R).
+
+  Version:  Build:
+  Copyright (c) 2006-2019 Audiokinetic Inc.
+ ***********************************************************************/
+
+//////////////////////////////////////////////////////////////////////
+//
+// AkDecodedMediaCache.h
+//
+// Engine-wide cache of decoded in-memory media (see AkInitSettings::uDecodedMediaCacheSize).
+//
+//////////////////////////////////////////////////////////////////////
+#ifndef _AK_DECODED_MEDIA_CACHE_H_
+#define _AK_DECODED_MEDIA_CACHE_H_
+
+#include <AK/SoundEngine/Common/AkSoundEngine.h>
+
+extern AkInitSettings g_settings;
+
+// Identifies the decoded media: a media ID, and enough of its format to tell apart
+// different media that were given the same ID (e.g. by different versions of a bank).
+struct AkDecodedMediaKey
+{
+	AkUniqueID	mediaID;
+	AkUInt32	uMediaSize;			// Size of the encoded media, header included.
+	AkUInt32	uSampleRate;		// As found in the media header.
+	AkUInt32	uChannelConfig;		// Serialized AkChannelConfig.
+	AkUInt16	uFormatTag;			// AK_WAVE_FORMAT_*
+
+	bool operator==( const AkDecodedMediaKey & in_other ) const
+	{
+		return mediaID == in_other.mediaID
+			&& uMediaSize == in_other.uMediaSize
+			&& uSampleRate == in_other.uSampleRate
+			&& uChannelConfig == in_other.uChannelConfig
+			&& uFormatTag == in_other.uFormatTag;
+	}
+};
+
+//-----------------------------------------------------------------------------
+// Name: class AkDecodedMedia
+// Desc: Whole decoded media, deinterleaved: channel i starts at i * NumFrames().
+//       Channels are in the order the decoder produces them (see GetChannelOrdering()).
+//-----------------------------------------------------------------------------
+class AkDecodedMedia
+{
+public:
+	AkForceInline const AkDecodedMediaKey & GetKey() const { return m_key; }
+	AkForceInline AkUInt32 NumFrames() const { return m_uNumFrames; }
+	AkForceInline AkUInt32 NumChannels() const { return m_uNumChannels; }
+	AkForceInline AkUInt32 SampleRate() const { return m_uSampleRate; }
+	AkForceInline AkUInt8 GetChannelOrdering() const { return m_uChannelOrdering; }
+	AkForceInline const AkReal32 * GetChannel( AkUInt32 in_uChannel ) const { return m_pData + in_uChannel * m_uNumFrames; }
+
+	// Copies in_uNumFrames frames of all channels, starting at frame in_uStartFrame, to out_pData
+	// (channel i at out_pData + i * in_uDstStride).
+	void CopyFrames( AkUInt32 in_uStartFrame, AkUInt32 in_uNumFrames, AkReal32 * out_pData, AkUInt32 in_uDstStride ) const;
+
+	// AkHashListBare
+	AkUniqueID			key;
+	AkDecodedMedia *	pNextItem;
+
+private:
+	friend class AkDecodedMediaCache;
+
+	AkDecodedMediaKey	m_key;
+	AkReal32 *			m_pData;
+	AkUInt32			m_uNumFrames;
+	AkUInt32			m_uSampleRate;			// Of the decoded samples.
+	AkUInt32			m_uNumFramesRecorded;	// Frames written so far while recording.
+	AkUInt32			m_uFlushCount;			// Value of the flush counter of the cache when recording began.
+	AkDecodedMedia *	m_pPrevLru;				// Links in the LRU list of the cache, which only holds media not in use.
+	AkDecodedMedia *	m_pNextLru;
+	AkInt32				m_cRef;
+	AkUInt16			m_uNumChannels;
+	AkUInt8				m_uChannelOrdering;
+	bool				m_bFlushed;				// Removed from the cache while in use: freed on last Release().
+};
+
+//-----------------------------------------------------------------------------
+// Name: class AkDecodedMediaCache
+// Desc: Decoded media shared by all sources, within a memory budget.
+//       A source first tries to Acquire() its media. On a miss, it may then BeginRecording(): media
+//       is only recorded on its second miss, so that media played once do not push others out.
+//       A recording is charged to the budget when it begins, evicting the least recently used media that
+//       are not in use; it is refused if the media in use and the other recordings leave no room for it.
+//       The source then Record()s every buffer it decodes. Once the recording holds all frames of the
+//       media it is added to the cache.
+//       Recordings are owned by their source, and may be written from any thread without locking.
+//       The bank manager flushes media as it unloads them, since their ID may then be given to other data.
+//-----------------------------------------------------------------------------
+class AkDecodedMediaCache
+{
+public:
+	static void Init();
+	static void Term();
+
+	AkForceInline static bool IsEnabled() { return g_settings.uDecodedMediaCacheSize != 0; }
+
+	// Only the output of some decoders is worth caching.
+	static bool IsCacheableFormat( AkUInt16 in_uFormatTag );
+
+	// Returns the decoded media, which must be released with Release(), or NULL on a miss.
+	static const AkDecodedMedia * Acquire( const AkDecodedMediaKey & in_key );
+	static void Release( const AkDecodedMedia * in_pMedia );
+
+	// Returns a new recording if the media should be added to the cache, NULL otherwise.
+	static AkDecodedMedia * BeginRecording(
+		const AkDecodedMediaKey & in_key,
+		AkUInt32 in_uNumFrames,
+		AkUInt32 in_uNumChannels,
+		AkUInt32 in_uSampleRate,
+		AkUInt8 in_uChannelOrdering
+		);
+
+	// Appends in_uNumFrames decoded frames, starting at frame in_uStartFrame of the media
+	// (channel i at in_pData + i * in_uSrcStride). A gap or overlap with the frames already recorded
+	// cancels the recording. Once all frames are recorded, the recording is added to the cache.
+	// In both cases, io_pRecording is set to NULL.
+	static void Record(
+		AkDecodedMedia *& io_pRecording,
+		AkUInt32 in_uStartFrame,
+		const AkReal32 * in_pData,
+		AkUInt32 in_uSrcStride,
+		AkUInt32 in_uNumFrames
+		);
+
+	// Discards an unfinished recording. Sets io_pRecording to NULL.
+	static void CancelRecording( AkDecodedMedia *& io_pRecording );
+
+	// Removes the decoded media of in_mediaID. Media in use are freed once released, and recordings
+	// begun before the flush are discarded instead of being added to the cache.
+	static void Flush( AkUniqueID in_mediaID );
+
+	static void GetStats( AkDecodedMediaCacheStats & out_stats );
+
+private:
+	static void Commit( AkDecodedMedia * in_pMedia );
+	static void DiscardRecording( AkDecodedMedia * in_pMedia );
+	static bool MakeRoom( AkUInt32 in_uSize );
+	static void Remove( AkDecodedMedia * in_pMedia );
+	static void LruAdd( AkDecodedMedia * in_pMedia );
+	static void LruRemove( AkDecodedMedia * in_pMedia );
+	static void Free( AkDecodedMedia * in_pMedia );
+	static AkUInt32 GetSize( AkUInt32 in_uNumFrames, AkUInt32 in_uNumChannels ) { return in_uNumFrames * in_uNumChannels * sizeof(AkReal32); }
+};
+
+#endif // _AK_DECODED_MEDIA_CACHE_H_
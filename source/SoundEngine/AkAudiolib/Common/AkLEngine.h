@@ -33,6 +33,8 @@
 #include "AkLEngineCmds.h"
 
 
+struct AkVPLSrcBank;
+
 #if (defined AK_ANDROID && !defined AK_LUMIN)
 class CAkAndroidSystem;
 #endif
@@ -176,6 +178,9 @@ public:
 
 	// Execution.
 	static void					RunVPL(CAkVPLSrcCbxNode * in_pCbx, AkVPLState & io_state);
+	static bool					RunVPLUpstream(CAkVPLSrcCbxNode * in_pCbx, AkVPLState & io_state);
+	static void					RunVPLDownstream(CAkVPLSrcCbxNode * in_pCbx, AkVPLState & io_state);
+	static void					RunVPLBank(CAkVPLSrcCbxNode ** in_ppCbx, AkUInt32 in_uNumCbx);
 	static void					AnalyzeMixingGraph();
 	static void					FinishRun(CAkVPLSrcCbxNode * in_pCbx, AkVPLState & io_state);
 	static void					PreprocessSources(bool in_bRender, AkUInt32 &out_idxFirstHwVoice, AkUInt32 &out_idxFirstLLVoice);
@@ -183,6 +188,7 @@ public:
 	static void					ProcessSources(bool in_bRender);
 	static void					PerformMixing(bool in_bRender);
 	static AkAudioBuffer * TransferBuffer(AkVPL* in_pVPL);	// Returns buffer if it needs propagating to mix connections
+	static AkAudioBuffer * PushBuffer(AkVPL* in_pVPL, AkAudioBuffer* in_pBuffer);	// Same as TransferBuffer(), with the bus effects already processed
 	static void					ProcessVPLList(AkArrayVPL& in_VPLList);
 	static void					HandleStarvation();
 	static void					ResetMixingVoiceCount();
@@ -204,9 +210,41 @@ private:
     static void VoiceRangeTask(void* in_pData, AkUInt32 in_uIdxBegin, AkUInt32 in_uIdxEnd, AkTaskContext in_ctx, void* in_pUserData);
 	static void BusRangeTask(void* in_pData, AkUInt32 in_uIdxBegin, AkUInt32 in_uIdxEnd, AkTaskContext in_ctx, void* in_pUserData);
 
+	static void GraphTask(void* in_pData, AkUInt32 in_uIdxBegin, AkUInt32 in_uIdxEnd, AkTaskContext in_ctx, void* in_pUserData);
+
+	// Mono voices filtered together by one SIMD filter bank (see RunVPLBank). Each caller finishes the voices it held
+	// in its own way: VoiceRangeTask, GraphTask and ProcessSources run their banks with RunVoiceBank, RunGraphBank and
+	// RunSourceBank respectively.
+	typedef void (*RunVPLSrcBankFunc)(AkVPLSrcBank & io_bank);
+	static bool RunVPLOrHold(CAkVPLSrcCbxNode * in_pSrc, AkInt32 in_iSrc, AkVPLSrcBank & io_bank, RunVPLSrcBankFunc in_fcnRunBank);
+	static void RunVoiceBank(AkVPLSrcBank & io_bank);
+	static void RunGraphBank(AkVPLSrcBank & io_bank);
+	static void RunSourceBank(AkVPLSrcBank & io_bank);
+	static void MixSource(CAkVPLSrcCbxNode * in_pCbx);
+	static void FinishSource(CAkVPLSrcCbxNode * in_pCbx);
+
 	static void BusTask(AkVPL * in_pVPL);
+	static void ConsumeBusInputs(AkVPL * in_pVPL);
 	static void FeedbackTask(AkVPL * in_pVPL);
 
+	// Pipelined output: top-level busses are mixed at the end of the frame, but their effects run during the next frame.
+	// ProcessPendingOutputFx() runs on one graph task and only touches the pending top-level busses (mix buffer, effects, mixer plugins, 
+	// meters, base volume). Voices connected to a pending top-level bus read its context and mixer plugin while computing their volumes, 
+	// so they wait for m_iGraphOutputDone. The device output (sinks, capture, device and master volume) stays on the audio thread: 
+	// OutputStage() pushes the pending busses and ends the previous device frame after the graph tasks are joined, then the top-level 
+	// busses of the current frame are mixed.
+	static void ProcessPendingOutputFx();
+	static void FlushPendingOutput();
+	static void OutputStage();
+	static void EndOutputFrame();
+
+	// Dependency-driven execution of voices and non-top-level busses.
+	static bool PrepareGraph(AkUInt32 in_uNumVoices);
+	static void ReleaseGraphDependents(AkInt32 in_iProducer);
+	static AkVPL * PopReadyBus();
+	static void PushReadyBus(AkVPL * in_pVPL);
+	static bool IsBusGraphSchedulable();
+
 	static void VPLRefreshDepth(AkVPL * in_pVPL, AkInt32 in_iDepth, AkInt32 & io_iMaxDepth, bool & io_bHasCycles);
 	static AKRESULT SortVPLs();
 	
@@ -216,6 +254,23 @@ private:
 	static AkArrayInt32			m_arrayVPLDepthCnt;           // Number of VPLs in each depth bin.
 	static AkArrayBool			m_arrayVPLDepthInterconnects; // Same-depth connections in each depth bin.
 	static bool					m_bVPLsHaveCycles;            // True if there are cycles (feedback loops) in the VPL graph
+	static bool					m_bVPLsSchedulable;           // True if busses can be dispatched from dependency counts (non-feedback connections form a DAG)
+
+	static AkArrayVPL			m_arrayGraphDependents;       // Busses depending on each producer (voices, then busses) in the current frame.
+	static AkArrayInt32			m_arrayGraphDependentsIdx;    // Offset of each producer's dependents in m_arrayGraphDependents (one extra entry at the end).
+	static AkArrayVPL			m_arrayGraphReady;            // Busses whose inputs are all processed, in dispatch order.
+	static AkUInt32				m_uGraphNumVoices;            // Number of voices in the current graph. Busses are producers m_uGraphNumVoices and up.
+	static AkAtomic32			m_iGraphNextVoice;            // Next voice to be claimed by a graph task.
+	static AkAtomic32			m_iGraphReadyWrite;           // Write position in m_arrayGraphReady.
+	static AkAtomic32			m_iGraphReadyRead;            // Read position in m_arrayGraphReady.
+	static AkAtomic32			m_iGraphBussesLeft;           // Number of busses not yet processed in the current graph.
+	static bool					m_bPipelinedOutput;           // AkPlatformInitSettings::bPipelinedMixing, where supported.
+	static bool					m_bGraphOutputStage;          // True if a graph task must run ProcessPendingOutputFx() in the current frame.
+	static AkAtomic32			m_iGraphOutputClaimed;        // Set by the graph task which runs ProcessPendingOutputFx().
+	static AkAtomic32			m_iGraphOutputDone;           // Set once ProcessPendingOutputFx() has returned in the current frame (or was not deferred to a graph task).
+	static AkArrayVPL			m_arrayOutputPending;         // Top-level busses mixed in the previous frame, waiting for their effects and device output.
+	static bool					m_bOutputFxDone;              // True once ProcessPendingOutputFx() has run on m_arrayOutputPending.
+	static bool					m_bOutputFramePending;        // True if the devices' FrameEnd() was deferred to the next OutputStage().
 	static bool					m_bVPLsDirty;                 // True if m_arrayVPLs need re-sorting (after insertion/deletion/reconnection)
 	static bool					m_bFullReevaluation;
 
@@ -92,13 +92,13 @@ AkRTPCBitArray CAkMixBusCtx::GetTargetedParamsSet()
 
 void CAkMixBusCtx::NotifyParamChanged(bool in_bLiveEdit, AkRTPC_ParameterID in_rtpcID)
 {
-	m_bAreParametersValid = false;
+	InvalidateParameters();
 	GetBus()->SetHdrCompressorDirty();
 }
 
 void CAkMixBusCtx::NotifyParamsChanged( bool in_bLiveEdit, const AkRTPCBitArray& in_bitArray )
 {
-	m_bAreParametersValid = false;
+	InvalidateParameters();
 	GetBus()->SetHdrCompressorDirty();
 }
 
@@ -479,6 +479,8 @@ AKRESULT AkDevice::SetSpeakerAngles(
 		m_spreadCache.RemoveAll();
 	}
 
+	FlushPanGainCaches();
+
 	return eResult;
 }
 
@@ -518,6 +520,47 @@ const CAkSpeakerPan::ArraySimdVector * AkDevice::CreateSpreadCache(
 	return NULL;
 }
 
+CAkSpeakerPan::PanGainCache * AkDevice::GetPanGainCache(
+	AkChannelConfig		in_outputConfig		// config of bus to which this signal is routed.
+	)
+{
+	CAkSpeakerPan::MapConfig2PanGainCache::Iterator it = m_panGainCache.FindEx(in_outputConfig);
+	if (it != m_panGainCache.End())
+		return (*it).item;
+
+	if (g_settings.uPanGainCacheSize == 0)
+		return NULL;
+
+	CAkSpeakerPan::PanGainCache * pCache = AkNew(AkMemID_Object, CAkSpeakerPan::PanGainCache());
+	if (pCache)
+	{
+		if (pCache->Init(g_settings.uPanGainCacheSize, in_outputConfig.uNumChannels) == AK_Success)
+		{
+			CAkSpeakerPan::PanGainCache ** ppCache = m_panGainCache.Set(in_outputConfig);
+			if (ppCache)
+			{
+				*ppCache = pCache;
+				return pCache;
+			}
+			pCache->Term();
+		}
+		AkDelete(AkMemID_Object, pCache);
+	}
+	return NULL;
+}
+
+void AkDevice::FlushPanGainCaches()
+{
+	AkAutoLock<CAkLock> lock(m_lockPanGainCache);
+
+	CAkSpeakerPan::MapConfig2PanGainCache::Iterator it = m_panGainCache.Begin();
+	while (it != m_panGainCache.End())
+	{
+		(*it).item->Flush();
+		++it;
+	}
+}
+
 void AkDevice::DestroyPanCaches()
 {
 	{
@@ -549,6 +592,17 @@ void AkDevice::DestroyPanCaches()
 		}
 		m_spreadCache.Term();
 	}
+
+	{
+		CAkSpeakerPan::MapConfig2PanGainCache::Iterator it = m_panGainCache.Begin();
+		while (it != m_panGainCache.End())
+		{
+			(*it).item->Term();
+			AkDelete(AkMemID_Object, (*it).item);
+			++it;
+		}
+		m_panGainCache.Term();
+	}
 }
 
 AKRESULT AkDevice::CreateDummy(DeviceState in_eDummyState)
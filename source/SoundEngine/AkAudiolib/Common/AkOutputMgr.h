@@ -65,7 +65,7 @@ public:
 		AkReal32 			in_fHeightAngle		// Elevation of the height layer, in degrees relative to the plane.
 		);
 
-	inline void SetPanningRule( AkPanningRule in_ePanningRule ) { ePanningRule = in_ePanningRule; }
+	inline void SetPanningRule( AkPanningRule in_ePanningRule ) { ePanningRule = in_ePanningRule; FlushPanGainCaches(); }
 
 	AKRESULT InitDefaultAngles();
 
@@ -114,6 +114,16 @@ public:
 		CAkSpeakerPan::ConfigIn2d3d key
 		);
 
+	// Memoized 3D panning gains (see AkInitSettings::uPanGainCacheSize). Creates the cache of the output config if it doesn't exist.
+	// Must be called with GetPanGainCacheLock() held. Returns NULL if the cache is disabled or could not be allocated.
+	CAkSpeakerPan::PanGainCache * GetPanGainCache(
+		AkChannelConfig		in_outputConfig		// config of bus to which this signal is routed.
+		);
+	inline CAkLock & GetPanGainCacheLock() { return m_lockPanGainCache; }
+
+	// Empty the pan gain caches, when the panning rule or speaker angles change.
+	void FlushPanGainCaches();
+
 	inline AKRESULT EnsurePanCacheExists(
 		AkChannelConfig	in_outputConfig	// config of bus to which this signal is routed.
 		)
@@ -233,6 +243,8 @@ protected:
 	CAkLock m_lockPanCache;
 	CAkSpeakerPan::MapConfig2Spread   m_spreadCache;
 	CAkLock m_lockSpreadCache;
+	CAkSpeakerPan::MapConfig2PanGainCache m_panGainCache;
+	CAkLock m_lockPanGainCache;
 
 	AkSinkPluginParams	sink;
 	AkRamp				m_fVolume;		// Volume at device-scope (currently only set via SDK). In dB.
@@ -162,7 +162,9 @@ CAkPBI::CAkPBI(	AkPBIParams&				in_params,
 	, m_bNeedsFadeIn( in_params.bNeedsFadeIn )
 	, m_ePitchShiftType( PitchShiftType_LinearInterpolate )
 	, m_bFisrtInSequence( in_params.bIsFirst )
+	, m_bPriorityDistanceCached( false )
 	, m_PriorityInfoCurrent( in_rPriority )
+	, m_uPriorityPositionVersion( 0 )
 	, m_ulPauseCount( 0 )
 	, m_iFrameOffset( in_params.uFrameOffset )
 	, m_pDataPtr( NULL )
@@ -233,10 +235,7 @@ AKRESULT CAkPBI::Init()
 	if (!m_bPlayDirectly)
 	{
 		m_LimiterArray.AddLast(&CAkURenderer::GetGlobalLimiter());
-		for (AkLimiters::Iterator it = m_LimiterArray.Begin(); it != m_LimiterArray.End(); ++it)
-		{
-			(*it)->Add(this);
-		}
+		JoinLimiters();
 	}
 
 	AKRESULT eResult = AK_Fail;
@@ -275,6 +274,7 @@ CAkPBI::~CAkPBI()
 {
 	AKASSERT( m_pMidiNote == NULL );
 	m_LimiterArray.Term();
+	m_LimiterHeapIdx.Term();
 }
 
 void CAkPBI::Term( bool /*in_bFailedToInit*/ )
@@ -357,10 +357,10 @@ void CAkPBI::UpdateLimiters()
 
 
 		m_LimiterArray.AddLast(&CAkURenderer::GetGlobalLimiter());
-		for (AkLimiters::Iterator it = m_LimiterArray.Begin(); it != m_LimiterArray.End(); ++it)
+		JoinLimiters();
+		if ( m_bIsVirtual )
 		{
-			(*it)->Add(this);
-			if ( m_bIsVirtual )
+			for (AkLimiters::Iterator it = m_LimiterArray.Begin(); it != m_LimiterArray.End(); ++it)
 				(*it)->IncrementVirtual();
 		}
 	}
@@ -1034,11 +1034,12 @@ void CAkPBI::DecrementPlayCount()
 	{
 		m_bWasPlayCountDecremented = true;
 
-		for (AkLimiters::Iterator it = m_LimiterArray.Begin(); it != m_LimiterArray.End(); ++it)
+		for (AkUInt32 i = 0; i < m_LimiterArray.Length(); ++i)
 		{
-			(*it)->Remove( this );
+			m_LimiterArray[i]->Remove( this, GetLimiterHeapIdx(i) );
 		}
 		m_LimiterArray.RemoveAll();
+		m_LimiterHeapIdx.RemoveAll();
 
 		CounterParameters counterParams;
 		counterParams.pGameObj = GetGameObjectPtr();
@@ -1268,8 +1269,20 @@ void CAkPBI::GetFX( AkUInt32 in_uFXIndex, AkFXDesc & out_rFXInfo )
 	}
 }
 
+void CAkPBI::DropSharedAncestorParams()
+{
+	if (m_pParamNode->Parent())
+		AkAncestorParamsCache::Invalidate(m_pParamNode->Parent(), GetRTPCKey());
+}
+
 void CAkPBI::RefreshParameters(AkInitialSoundParams* in_pInitialSoundParams)
 {		
+	// Refreshing a playing sound: the parameters of its ancestors may be shared with other sounds of the same parent.
+	// Ranges are only collected on the first update, and live edits retrigger modulators, so these need a complete walk.
+	const AkInitialSoundParams* pAncestorParams = NULL;
+	if (!in_pInitialSoundParams && m_bGetAudioParamsCalled && !m_bRefreshAllAfterRtpcChange && !m_bPlayDirectly && m_pParamNode->Parent())
+		pAncestorParams = AkAncestorParamsCache::Get(m_pParamNode->Parent(), GetRTPCKey());
+
 	OpenSoundBrace();
 
 	CAkParameterNodeBase* pGetParamsUpToNodes = NULL; //NULL means up to top.
@@ -1299,6 +1312,21 @@ void CAkPBI::RefreshParameters(AkInitialSoundParams* in_pInitialSoundParams)
 				m_mapMutedNodes[i] = in_pInitialSoundParams->mutedMap[i];
 		}
 	}
+	else if (pAncestorParams && pCtrlBus == pAncestorParams->pCtrlBusUsed)
+	{
+#ifdef AK_DELTAMONITOR_ENABLED
+		AkDeltaMonitor::LogUsePrecomputedParams(pAncestorParams->pParamsValidFromNode->ID());
+#endif
+
+		if (pCtrlBus)
+			bDoBusCheck = false;
+		pGetParamsUpToNodes = pAncestorParams->pParamsValidFromNode;
+		m_EffectiveParams = pAncestorParams->soundParams;
+
+		RemoveAllVolatileMuteItems();
+		for (AkMutedMap::Iterator it = pAncestorParams->mutedMap.Begin(); it != pAncestorParams->mutedMap.End(); ++it)
+			m_mapMutedNodes.Set((*it).key, (*it).item);
+	}
 	else
 	{
 		m_EffectiveParams.ClearEx();
@@ -1391,6 +1419,7 @@ void CAkPBI::RefreshParameters(AkInitialSoundParams* in_pInitialSoundParams)
 			m_PriorityInfoCurrent.Reset( priorityInfo );
 			UpdatePriority( priorityInfo.GetPriority() );
 		}
+		m_bPriorityDistanceCached = false;	// Priority or attenuation may have changed: the distance offset must be computed again.
 
 		// Update modulators if they have changed during a live edit.  
 		//	Note that we do not trigger them here under normal triggering circumstances, but CAkURenderer explicity calls TriggerModulators().
@@ -1419,9 +1448,9 @@ void CAkPBI::UpdatePriority( AkReal32 in_NewPriority )
 	AkReal32 fLastPriority = GetPriorityFloat();
 	if( fLastPriority != in_NewPriority )
 	{
-		for (AkLimiters::Iterator it = m_LimiterArray.Begin(); it != m_LimiterArray.End(); ++it)
+		for (AkUInt32 i = 0; i < m_LimiterArray.Length(); ++i)
 		{
-			(*it)->Update(in_NewPriority, this);
+			m_LimiterArray[i]->Update(in_NewPriority, this, GetLimiterHeapIdx(i));
 		}
 
 		m_PriorityInfoCurrent.SetCurrent( in_NewPriority );
@@ -1434,6 +1463,7 @@ void CAkPBI::UpdatePriorityWithDistance(
 {
 	// Priority changes based on distance to listener
 	AKASSERT(in_pAttenuation);
+	m_bPriorityDistanceCached = false;
 	CAkAttenuation::AkAttenuationCurve* pVolumeDryCurve = in_pAttenuation->GetCurve( AttenuationCurveID_VolumeDry );
 	if (pVolumeDryCurve)
 	{
@@ -1504,10 +1534,18 @@ void CAkPBI::VirtualPositionUpdate()
 		/// REVIEW Only done when not Hold, or worse, if !m_bGameObjPositionCached, is very suspicious.
 		if( !m_posParams.settings.m_bHoldEmitterPosAndOrient || !m_bGameObjPositionCached )
 		{
-			const AkSoundPositionRef & posEntry = GetEmitter()->GetPosition();
-			AkReal32 fMinDistance = CAkURenderer::GetMinDistance(posEntry, GetGameObjectPtr()->GetListeners()) / GetEmitter()->GetScalingFactor();
-				
-			UpdatePriorityWithDistance(pAttenuation, fMinDistance);
+			// Only recompute the distance if the emitter, its listeners or their scaling changed since the last update.
+			CAkEmitter * pEmitter = GetEmitter();
+			AkUInt32 uPositionVersion = pEmitter->GetPositionVersion();
+			if ( !m_bPriorityDistanceCached || uPositionVersion != m_uPriorityPositionVersion || !pEmitter->IsPositionCached() )
+			{
+				const AkSoundPositionRef & posEntry = pEmitter->GetPosition();
+				AkReal32 fMinDistance = CAkURenderer::GetMinDistance(posEntry, GetGameObjectPtr()->GetListeners()) / pEmitter->GetScalingFactor();
+
+				UpdatePriorityWithDistance(pAttenuation, fMinDistance);
+				m_bPriorityDistanceCached = pEmitter->IsPositionCached();
+				m_uPriorityPositionVersion = uPositionVersion;
+			}
 		}
 	}
 
@@ -1902,6 +1940,141 @@ void AkPBIParams::PopulateInitialSoundParams(CAkParameterNodeBase* in_pFromNode)
 	}
 }
 
+AkAncestorParamsCache::EntryArray AkAncestorParamsCache::s_entries;
+AkUInt32 AkAncestorParamsCache::s_uNumEntries = 0;
+AkAncestorParamsCache::EntryMap AkAncestorParamsCache::s_map;
+bool AkAncestorParamsCache::s_bOpen = false;
+
+void AkAncestorParamsCache::Open()
+{
+	InvalidateAll();
+	s_bOpen = true;
+	CAkBehavioralCtx::SetAncestorParamsShared(true);
+}
+
+void AkAncestorParamsCache::Close()
+{
+	CAkBehavioralCtx::SetAncestorParamsShared(false);
+	s_bOpen = false;
+	InvalidateAll();
+}
+
+void AkAncestorParamsCache::Term()
+{
+	AKASSERT(!s_bOpen);
+	InvalidateAll();
+	s_map.Term();
+	for (EntryArray::Iterator it = s_entries.Begin(); it != s_entries.End(); ++it)
+		AkDelete(AkMemID_Object, *it);
+	s_entries.Term();
+}
+
+const AkInitialSoundParams* AkAncestorParamsCache::Get(CAkParameterNodeBase* in_pParent, const AkRTPCKey& in_rtpcKey)
+{
+	if (!s_bOpen)
+		return NULL;
+
+	AkAncestorParamsKey scopeKey(in_pParent, AkRTPCKey(), false);
+	Entry* pEntry = s_map.Exists(scopeKey);
+	if (!pEntry)
+	{
+		pEntry = AddEntry(scopeKey, GetScope(in_pParent));
+		if (!pEntry)
+			return NULL;
+	}
+
+	if (pEntry->eScope == AkAudioParamsScope_Global)
+		return &pEntry->params;
+	else if (pEntry->eScope == AkAudioParamsScope_Voice)
+		return NULL;
+
+	AkAncestorParamsKey key(in_pParent, in_rtpcKey, true);
+	pEntry = s_map.Exists(key);
+	if (!pEntry)
+		pEntry = AddEntry(key, AkAudioParamsScope_RTPCKey);
+	return pEntry ? &pEntry->params : NULL;
+}
+
+void AkAncestorParamsCache::Invalidate(CAkParameterNodeBase* in_pParent, const AkRTPCKey& in_rtpcKey)
+{
+	// Whatever changed above in_pParent also invalidated every other PBI it affects, which drop their own entries.
+	// The handed out entries stay allocated until the end of the pass.
+	s_map.Unset(AkAncestorParamsKey(in_pParent, AkRTPCKey(), false));
+	s_map.Unset(AkAncestorParamsKey(in_pParent, in_rtpcKey, true));
+}
+
+void AkAncestorParamsCache::InvalidateAll()
+{
+	for (EntryMap::IteratorEx it = s_map.BeginEx(); it != s_map.End(); )
+		it = s_map.Erase(it);
+	s_uNumEntries = 0;
+}
+
+AkAncestorParamsCache::Entry* AkAncestorParamsCache::AddEntry(const AkAncestorParamsKey& in_key, AkAudioParamsScope in_eScope)
+{
+	Entry* pEntry = NULL;
+	if (s_uNumEntries < s_entries.Length())
+	{
+		pEntry = s_entries[s_uNumEntries];
+	}
+	else
+	{
+		pEntry = AkNew(AkMemID_Object, Entry());
+		if (!pEntry)
+			return NULL;
+		if (!s_entries.AddLast(pEntry))
+		{
+			AkDelete(AkMemID_Object, pEntry);
+			return NULL;
+		}
+	}
+
+	pEntry->key = in_key;
+	pEntry->eScope = in_eScope;
+	if (!s_map.Set(pEntry))
+		return NULL;
+	++s_uNumEntries;
+
+	AkInitialSoundParams& params = pEntry->params;
+	params.Clear();
+	params.pParamsValidFromNode = in_key.pParent;
+
+	// Scope entries of parents whose parameters depend on the RTPC key or the voice only record the scope.
+	if (in_key.bKeyed || in_eScope == AkAudioParamsScope_Global)
+	{
+		CAkParameterNodeBase* pParent = in_key.pParent;
+		AkDeltaMonitor::OpenPrecomputedParamsBrace(pParent->ID());
+
+		params.soundParams.ResetServicedFlags();
+		params.soundParams.Request.EnableDefaultProps();
+		pParent->GetAudioParameters(params.soundParams, params.mutedMap, in_key.rtpcKey, NULL, NULL);
+
+		params.pCtrlBusUsed = pParent->GetControlBus();
+		if (params.pCtrlBusUsed)
+			params.pCtrlBusUsed->GetNonMixingBusParameters(params.soundParams, AkRTPCKey());
+
+		AkDeltaMonitor::ClosePrecomputedParamsBrace();
+	}
+
+	return pEntry;
+}
+
+AkAudioParamsScope AkAncestorParamsCache::GetScope(CAkParameterNodeBase* in_pParent)
+{
+	// Visits every node GetAudioParameters() may walk from in_pParent: its ancestors and the output busses they override.
+	AkAudioParamsScope eScope = AkAudioParamsScope_Global;
+	for (CAkParameterNodeBase* pNode = in_pParent; pNode && eScope != AkAudioParamsScope_Voice; pNode = pNode->Parent())
+	{
+		for (CAkParameterNodeBase* pScopeNode = pNode; pScopeNode && eScope != AkAudioParamsScope_Voice; pScopeNode = pScopeNode->ParentBus())
+		{
+			AkAudioParamsScope eNodeScope = pScopeNode->GetAudioParamsScope();
+			if (eNodeScope > eScope)
+				eScope = eNodeScope;
+		}
+	}
+	return eScope;
+}
+
 void CAkPBI::VirtualizeForInterruption()
 {
 	m_bIsVirtualizedForInterruption = true;
@@ -1933,13 +2106,27 @@ bool CAkPBI::ShouldChangeVirtualBehaviourForInterruption()
 
 void CAkPBI::ClearLimiters()
 {
-	for (AkLimiters::Iterator it = m_LimiterArray.Begin(); it != m_LimiterArray.End(); ++it)
+	for (AkUInt32 i = 0; i < m_LimiterArray.Length(); ++i)
 	{
-		(*it)->Remove(this);
+		m_LimiterArray[i]->Remove(this, GetLimiterHeapIdx(i));
 		if (m_bIsVirtual)
-			(*it)->DecrementVirtual();
+			m_LimiterArray[i]->DecrementVirtual();
 	}
 	m_LimiterArray.RemoveAll();
+	m_LimiterHeapIdx.RemoveAll();
+}
+
+void CAkPBI::JoinLimiters()
+{
+	// The limiters keep pointers to the heap indices: size the array once, before adding this PBI to any of them.
+	// If this fails, the PBI is simply not limited (see GetLimiterHeapIdx()), like when CAkLimiter::Add() fails.
+	if (!m_LimiterHeapIdx.Resize(m_LimiterArray.Length()))
+		return;
+
+	for (AkUInt32 i = 0; i < m_LimiterArray.Length(); ++i)
+	{
+		m_LimiterArray[i]->Add(this, &m_LimiterHeapIdx[i]);
+	}
 }
 
 void CAkPBI::OnPathAdded(CAkPath* pPBPath)
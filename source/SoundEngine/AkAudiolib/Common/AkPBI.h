@@ -27,6 +27,7 @@
 #include "AkTransportAware.h"
 #include "ITransitionable.h"
 #include "AkMidiStructs.h"
+#include <AK/Tools/Common/AkHashList.h>
 
 class CAkBus;
 class CAkSoundBase;
@@ -45,6 +46,7 @@ extern AkReal32 g_fVolumeThreshold;
 extern AkReal32 g_fVolumeThresholdDB;
 
 #define AK_INVALID_SEQUENCE_ID 0
+#define AK_INVALID_LIMITER_HEAP_IDX ((AkUInt32)-1)
 
 enum AkCtxState
 {
@@ -320,6 +322,77 @@ private:
 	}
 };
 
+// Key of AkAncestorParamsCache entries.
+struct AkAncestorParamsKey
+{
+	AkAncestorParamsKey(CAkParameterNodeBase* in_pParent, const AkRTPCKey& in_rtpcKey, bool in_bKeyed)
+		: pParent(in_pParent)
+		, rtpcKey(in_rtpcKey)
+		, bKeyed(in_bKeyed)
+	{
+		rtpcKey.PBI() = NULL;
+	}
+
+	bool operator==(const AkAncestorParamsKey& in_other) const
+	{
+		return pParent == in_other.pParent && bKeyed == in_other.bKeyed && rtpcKey == in_other.rtpcKey;
+	}
+
+	CAkParameterNodeBase*	pParent;
+	AkRTPCKey				rtpcKey;	// Without PBI. Empty in the scope entry of pParent (bKeyed false).
+	bool					bKeyed;
+};
+
+inline AkHashType AkHash(const AkAncestorParamsKey& in_key)
+{
+	const AkRTPCKey& rtpcKey = in_key.rtpcKey;
+	AkUIntPtr uHash = ((AkUIntPtr)in_key.pParent >> 4) ^ (((AkUIntPtr)rtpcKey.GameObj() >> 4) * 31);
+	uHash ^= (AkUIntPtr)rtpcKey.PlayingID() * 17 + rtpcKey.MidiTargetID() + ((AkUIntPtr)rtpcKey.MidiChannelNo() << 8) + rtpcKey.MidiNoteNo();
+	return (AkHashType)uHash;
+}
+
+// Parameters of the parent of a sound and everything above it (actor-mixer and bus hierarchies), shared between the
+// PBIs refreshed while the cache is open, so that each of them only needs to walk its own node (see CAkPBI::RefreshParameters).
+// Each parent has a scope entry. When the ancestors have RTPCs or game object-specific values, the parameters are kept in
+// one entry per RTPC key (without PBI) instead. Parents that may depend on the voice itself are not cached.
+// An invalidated PBI drops the entries of its parent and RTPC key; an invalidated bus drops all entries.
+// Must only be used from the audio thread, between Open() and Close().
+class AkAncestorParamsCache
+{
+public:
+	static void Open();
+	static void Close();
+	static void Term();
+
+	// Returns the parameters of in_pParent and its ancestors for in_rtpcKey, or NULL if they cannot be shared.
+	// pParamsValidFromNode is in_pParent; ranges and modulators are not collected.
+	static const AkInitialSoundParams* Get(CAkParameterNodeBase* in_pParent, const AkRTPCKey& in_rtpcKey);
+
+	static void Invalidate(CAkParameterNodeBase* in_pParent, const AkRTPCKey& in_rtpcKey);
+	static void InvalidateAll();
+
+private:
+	struct Entry
+	{
+		Entry() : key(NULL, AkRTPCKey(), false), pNextItem(NULL), eScope(AkAudioParamsScope_Global) {}
+
+		AkAncestorParamsKey		key;
+		Entry*					pNextItem;	// AkHashListBare
+		AkInitialSoundParams	params;
+		AkAudioParamsScope		eScope;
+	};
+
+	static Entry* AddEntry(const AkAncestorParamsKey& in_key, AkAudioParamsScope in_eScope);
+	static AkAudioParamsScope GetScope(CAkParameterNodeBase* in_pParent);
+
+	typedef AkArray<Entry*, Entry*, ArrayPoolDefault> EntryArray;
+	typedef AkHashListBare<AkAncestorParamsKey, Entry> EntryMap;
+	static EntryArray	s_entries;				// Allocated entries are kept between passes.
+	static AkUInt32		s_uNumEntries;			// Entries handed out in this pass, including the invalidated ones.
+	static EntryMap		s_map;					// Valid entries.
+	static bool			s_bOpen;
+};
+
 struct DelayContinuousParams
 {
 	DelayContinuousParams()
@@ -409,6 +482,7 @@ struct AkPBIParams
 };
 
 typedef AkArray< CAkLimiter*, CAkLimiter*, AkHybridAllocator< sizeof( CAkLimiter* ) > > AkLimiters;
+typedef AkArray< AkUInt32, AkUInt32, AkHybridAllocator< 2 * sizeof( AkUInt32 ) > > AkLimiterHeapIndices;
 
 // class corresponding to a Playback instance
 //
@@ -813,6 +887,7 @@ protected:
 
 	// Overridable methods.
 	virtual void RefreshParameters(AkInitialSoundParams* in_pInitialSoundParams);
+	virtual void DropSharedAncestorParams();
 
 	//Pause the PBI
 	//
@@ -933,8 +1008,10 @@ protected:
 	AkPitchShiftType	m_ePitchShiftType			:3;
 
 	AkUInt8				m_bFisrtInSequence			:1;
+	AkUInt8				m_bPriorityDistanceCached	:1;	// True when the distance priority offset was last computed by VirtualPositionUpdate() for m_uPriorityPositionVersion.
 	
 	PriorityInfoCurrent m_PriorityInfoCurrent;
+	AkUInt32			m_uPriorityPositionVersion;	// Emitter position version (see CAkEmitter::GetPositionVersion()) of the last distance priority update.
 
 	AkUInt32			m_ulPauseCount;
 
@@ -964,9 +1041,15 @@ public:
 	static AkUniqueID GetNewSequenceID(){ return m_CalSeqID++; }
 	
 	AkLimiters m_LimiterArray;
+	AkLimiterHeapIndices m_LimiterHeapIdx;	// Index of this PBI in the heap of each limiter of m_LimiterArray. Sized once when joining the limiters, as the limiters point into it.
 
 
 	void ClearLimiters();
+	void JoinLimiters();	// Adds this PBI to all the limiters of m_LimiterArray.
+	AkForceInline AkUInt32 GetLimiterHeapIdx( AkUInt32 in_uLimiter ) const
+	{
+		return in_uLimiter < m_LimiterHeapIdx.Length() ? m_LimiterHeapIdx[in_uLimiter] : AK_INVALID_LIMITER_HEAP_IDX;
+	}
 
 protected:
 
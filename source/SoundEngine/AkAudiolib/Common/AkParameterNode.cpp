@@ -933,6 +933,15 @@ bool CAkParameterNode::GetBypassAllFX(
 	return bOverrideOrTopNode;
 }
 
+AkAudioParamsScope CAkParameterNode::GetAudioParamsScope()
+{
+	// Layers may apply RTPCs and crossfading mutes of any scope.
+	if (m_pAssociatedLayers)
+		return AkAudioParamsScope_Voice;
+
+	return CAkParameterNodeBase::GetAudioParamsScope();
+}
+
 AKRESULT CAkParameterNode::AssociateLayer( CAkLayer* in_pLayer )
 {
 	if( !m_pAssociatedLayers )
@@ -198,6 +198,8 @@ public:
 		CAkParameterNodeBase*		in_pStopAtNode = NULL
 		);
 
+	virtual AkAudioParamsScope GetAudioParamsScope();
+
 	AKRESULT PlayAndContinueAlternate( AkPBIParams& in_rPBIParams );
 
 	virtual void ExecuteActionExceptParentCheck( ActionParamsExcept& in_rAction );
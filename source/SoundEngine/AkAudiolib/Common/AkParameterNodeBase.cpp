@@ -167,29 +167,56 @@ void CAkParamTargetLimiter::Init( CAkParameterNodeBase* in_pNode, CAkRegisteredO
 	SetKey( limiterType, in_pNode->GetDepth(), in_pNode->ID() );
 }
 
-AKRESULT CAkLimiter::Add( CAkPBI* in_pPBI )
+AkArray<AkUInt32, AkUInt32, ArrayPoolDefault> CAkLimiter::s_frontier;
+
+AKRESULT CAkLimiter::Add( CAkPBI* in_pPBI, AkUInt32* io_pHeapIdx )
 {
-	// Must call AddNoSetKey to avoid the key to be changed now.
-	// Multiple limitors would all try to update the same key otherwise.
 	bool bAddInSystemChecker = IsEmpty();
-	CAkPBI** ppPBI = NULL;
-	ppPBI = AddNoSetKey(in_pPBI->GetPriorityKey());	
-	if( ppPBI )
+	AkLimiterHeapItem * pItem = m_heap.AddLast();
+	if( !pItem )
 	{
-		if( bAddInSystemChecker )
-		{
-			CAkURenderer::AddLimiter( this );
-		}
-		*ppPBI = in_pPBI;
-		m_u16Current++;
-		return AK_Success;
+		*io_pHeapIdx = AK_INVALID_LIMITER_HEAP_IDX;
+		return AK_Fail;
 	}
-	return AK_Fail;
+
+	if( bAddInSystemChecker )
+	{
+		CAkURenderer::AddLimiter( this );
+	}
+
+	pItem->key = in_pPBI->GetPriorityKey();
+	pItem->pPBI = in_pPBI;
+	pItem->pHeapIdx = io_pHeapIdx;
+	*io_pHeapIdx = m_heap.Length() - 1;
+	SiftUp( m_heap.Length() - 1 );
+	m_u16Current++;
+	return AK_Success;
 }
 
-void CAkLimiter::Remove( CAkPBI* in_pPBI )
+void CAkLimiter::Remove( CAkPBI* in_pPBI, AkUInt32 in_uHeapIdx )
 {
-	bool bFound = Unset(in_pPBI->GetPriorityKey());	
+	bool bFound = in_uHeapIdx < m_heap.Length();
+	if ( bFound )
+	{
+		AKASSERT( m_heap[in_uHeapIdx].pPBI == in_pPBI );
+		*m_heap[in_uHeapIdx].pHeapIdx = AK_INVALID_LIMITER_HEAP_IDX;
+
+		// Fill the hole with the last item, and move it to where it belongs.
+		AkUInt32 uLastIdx = m_heap.Length() - 1;
+		if ( in_uHeapIdx != uLastIdx )
+		{
+			AkLimiterHeapItem last = m_heap[uLastIdx];
+			m_heap.RemoveLast();
+			Place( in_uHeapIdx, last );
+			SiftUp( in_uHeapIdx );
+			SiftDown( *last.pHeapIdx );
+		}
+		else
+		{
+			m_heap.RemoveLast();
+		}
+	}
+
 	if( IsEmpty() )
 	{
 		CAkURenderer::RemoveLimiter( this );
@@ -201,27 +228,102 @@ void CAkLimiter::Remove( CAkPBI* in_pPBI )
 	}
 }
 
-void CAkLimiter::Update( AkReal32 in_NewPriority, CAkPBI* in_pPBI )
+void CAkLimiter::Update( AkReal32 in_NewPriority, CAkPBI* in_pPBI, AkUInt32 in_uHeapIdx )
 {
-	AkPriorityStruct newKey;
-	newKey.SetPriority(in_NewPriority);
-	newKey.pipelineID = in_pPBI->GetPriorityKey().pipelineID;
-	newKey.seqID = in_pPBI->GetPriorityKey().seqID;
-	Reorder(in_pPBI->GetPriorityKey(), newKey, in_pPBI);
+	if ( in_uHeapIdx >= m_heap.Length() )
+		return;	// Was not added.
+
+	AkLimiterHeapItem & item = m_heap[in_uHeapIdx];
+	AKASSERT( item.pPBI == in_pPBI );
+	AkReal32 fOldPriority = item.key.GetPriority();
+	item.key.SetPriority( in_NewPriority );
+	if ( in_NewPriority > fOldPriority )
+		SiftUp( in_uHeapIdx );
+	else
+		SiftDown( in_uHeapIdx );
+}
+
+void CAkLimiter::SiftUp( AkUInt32 in_uIdx )
+{
+	AkLimiterHeapItem item = m_heap[in_uIdx];
+	while ( in_uIdx > 0 )
+	{
+		AkUInt32 uParent = ( in_uIdx - 1 ) / 2;
+		if ( !Precedes( item.key, m_heap[uParent].key ) )
+			break;
+		Place( in_uIdx, m_heap[uParent] );
+		in_uIdx = uParent;
+	}
+	Place( in_uIdx, item );
+}
+
+void CAkLimiter::SiftDown( AkUInt32 in_uIdx )
+{
+	AkUInt32 uLength = m_heap.Length();
+	AkLimiterHeapItem item = m_heap[in_uIdx];
+	for ( ;; )
+	{
+		AkUInt32 uChild = 2 * in_uIdx + 1;
+		if ( uChild >= uLength )
+			break;
+		if ( uChild + 1 < uLength && Precedes( m_heap[uChild + 1].key, m_heap[uChild].key ) )
+			++uChild;
+		if ( !Precedes( m_heap[uChild].key, item.key ) )
+			break;
+		Place( in_uIdx, m_heap[uChild] );
+		in_uIdx = uChild;
+	}
+	Place( in_uIdx, item );
+}
+
+void CAkLimiter::Heapify()
+{
+	for ( AkUInt32 i = m_heap.Length() / 2; i > 0; --i )
+		SiftDown( i - 1 );
 }
 
 void CAkLimiter::UpdateFlags()
 {
 	AkUInt16 u16Max = GetMaxInstances();
+	AkUInt32 uLength = m_heap.Length();
 
-	if( u16Max != 0 && Length() > u16Max )
+	if( u16Max != 0 && uLength > u16Max )
 	{
+		// Visit the items in priority order, starting from the top of the heap, until u16Max of them are accepted.
+		// The items that are left to visit are then the frontier and all their descendants.
+		// Never more than uLength items are in the frontier; if it cannot be allocated, limiting is retried next frame.
+		s_frontier.RemoveAll();
+		if ( s_frontier.Reserved() < uLength && !s_frontier.GrowArray( uLength - s_frontier.Reserved() ) )
+			return;
+		s_frontier.AddLast( 0 );
+
 		AkUInt32 uAccepted = 0;
-		AkSortedPBIPriorityList::Iterator it = Begin();
-		AkSortedPBIPriorityList::Iterator itEnd = End();
-		while( it != itEnd && uAccepted < u16Max )
-		{
-			CAkPBI* pPBI = *it;
+		while( s_frontier.Length() > 0 && uAccepted < u16Max )
+		{
+			// Pop the frontier's highest priority item.
+			AkUInt32 uIdx = s_frontier[0];
+			AkUInt32 uLastFrontier = s_frontier.Last();
+			s_frontier.RemoveLast();
+			AkUInt32 uNumFrontier = s_frontier.Length();
+			if ( uNumFrontier > 0 )
+			{
+				AkUInt32 uHole = 0;
+				for ( ;; )
+				{
+					AkUInt32 uChild = 2 * uHole + 1;
+					if ( uChild >= uNumFrontier )
+						break;
+					if ( uChild + 1 < uNumFrontier && Precedes( m_heap[s_frontier[uChild + 1]].key, m_heap[s_frontier[uChild]].key ) )
+						++uChild;
+					if ( !Precedes( m_heap[s_frontier[uChild]].key, m_heap[uLastFrontier].key ) )
+						break;
+					s_frontier[uHole] = s_frontier[uChild];
+					uHole = uChild;
+				}
+				s_frontier[uHole] = uLastFrontier;
+			}
+
+			CAkPBI* pPBI = m_heap[uIdx].pPBI;
 			if (!pPBI->IsExemptedFromLimiter() && !pPBI->WasKicked() && !pPBI->IsForcedVirtualized())// don't count if it was already kicked
 			{
 				if ((pPBI->GetCbx() && pPBI->GetCbx()->IsAudible()) || pPBI->GetUnsafeUnderThresholdBehavior() == AkBelowThresholdBehavior_ContinueToPlay )
@@ -230,29 +332,50 @@ void CAkLimiter::UpdateFlags()
 				}
 			}
 
-			++it;
+			// Push the children.
+			for ( AkUInt32 uChild = 2 * uIdx + 1; uChild <= 2 * uIdx + 2 && uChild < uLength; ++uChild )
+			{
+				AkUInt32 uHole = s_frontier.Length();
+				s_frontier.AddLast( uChild );
+				while ( uHole > 0 )
+				{
+					AkUInt32 uParent = ( uHole - 1 ) / 2;
+					if ( !Precedes( m_heap[uChild].key, m_heap[s_frontier[uParent]].key ) )
+						break;
+					s_frontier[uHole] = s_frontier[uParent];
+					uHole = uParent;
+				}
+				s_frontier[uHole] = uChild;
+			}
 		}
 
 		// The remaining are not allowed to play.
-		while( it != itEnd )
+		KickFrom eReason = KickFrom_OverNodeLimit;
+		if( this == &CAkURenderer::GetGlobalLimiter() )
+			eReason = KickFrom_OverGlobalLimit;
+
+		for ( AkUInt32 uFrontier = 0; uFrontier < s_frontier.Length(); ++uFrontier )
 		{
-			CAkPBI* pPBI = *it;
-			if (!pPBI->WasKicked() && !pPBI->IsExemptedFromLimiter())// No use to virtualize a sound that was kicked: let it die.
+			// Walk the subtree level by level: the descendants of node i at depth d are [ (i+1)*2^d - 1, (i+2)*2^d - 2 ].
+			for ( AkUInt32 uFirst = s_frontier[uFrontier], uLast = uFirst; uFirst < uLength; uFirst = 2 * uFirst + 1, uLast = 2 * uLast + 2 )
 			{
-				KickFrom eReason = KickFrom_OverNodeLimit;
-				if( this == &CAkURenderer::GetGlobalLimiter() )
-					eReason = KickFrom_OverGlobalLimit;
-
-				if( m_bAllowUseVirtualBehavior )
-				{
-					pPBI->ForceVirtualize( eReason );
-				}
-				else
+				AkUInt32 uEnd = AkMin( uLast + 1, uLength );
+				for ( AkUInt32 uIdx = uFirst; uIdx < uEnd; ++uIdx )
 				{
-					pPBI->Kick( eReason );
+					CAkPBI* pPBI = m_heap[uIdx].pPBI;
+					if (!pPBI->WasKicked() && !pPBI->IsExemptedFromLimiter())// No use to virtualize a sound that was kicked: let it die.
+					{
+						if( m_bAllowUseVirtualBehavior )
+						{
+							pPBI->ForceVirtualize( eReason );
+						}
+						else
+						{
+							pPBI->Kick( eReason );
+						}
+					}
 				}
 			}
-			++it;
 		}
 	}
 }
@@ -260,7 +383,7 @@ void CAkLimiter::UpdateFlags()
 void CAkLimiter::SwapOrdering()
 {
 	m_bDoesKillNewest = !m_bDoesKillNewest;
-	ReSortArray();	
+	Heapify();
 }
 
 ///////////////////////////////////////////////////////////////////
@@ -1469,6 +1592,19 @@ AkInt16 CAkParameterNodeBase::_GetBypassAllFX(CAkRegisteredObj * in_GameObjPtr)
 	return iBypass;
 }
 
+AkAudioParamsScope CAkParameterNodeBase::GetAudioParamsScope()
+{
+	// Voice-scoped modulators are evaluated with the PBI in the RTPC key.
+	if (HasModulator())
+		return AkAudioParamsScope_Voice;
+
+	// RTPCs and game object-specific SIS (including the FX bypass) are read with the game object of the key.
+	if (GetAllRtpcBits() != 0 || m_pMapSIS != NULL)
+		return AkAudioParamsScope_RTPCKey;
+
+	return AkAudioParamsScope_Global;
+}
+
 void CAkParameterNodeBase::GetAttachedPropFX( 
 	AkFXDesc& out_rFXInfo 
 	)
@@ -427,6 +427,9 @@ public:
 		CAkParameterNodeBase*	in_pStopAtNode = NULL
 		) = 0;
 
+	// Scope of the parameters this node alone contributes in GetAudioParameters(), excluding its parent and output bus.
+	virtual AkAudioParamsScope GetAudioParamsScope();
+
 	// Set a runtime property value (SIS)
 	virtual void SetAkProp(
 		AkPropID in_eProp, 
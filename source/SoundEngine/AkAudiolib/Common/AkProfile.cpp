@@ -167,9 +167,10 @@ void AkPerf::TickAudio()
 			creator.m_pData->audioPerfData.timers.fInterval = fInterval;
 		
 			// Message queue stats
-			AkUInt32 maxQueueSizeUsed = g_pAudioMgr->GetMaxSizeQueueFilled();
+			AkUInt32 uQueueSize;
+			AkUInt32 maxQueueSizeUsed = g_pAudioMgr->GetMaxSizeQueueFilled(uQueueSize);
 			creator.m_pData->audioPerfData.uCommandQueueActualSize = maxQueueSizeUsed;
-			creator.m_pData->audioPerfData.fCommandQueuePercentageUsed = (maxQueueSizeUsed*100.0f / g_pAudioMgr->GetMaxQueueSize());
+			creator.m_pData->audioPerfData.fCommandQueuePercentageUsed = (maxQueueSizeUsed*100.0f / uQueueSize);
 
 			// Update DSP usage
 #if defined(AK_PS4)
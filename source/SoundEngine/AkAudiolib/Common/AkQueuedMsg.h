@@ -91,6 +91,8 @@ enum AkQueuedMsgType
 
 	QueuedMsgType_DynamicSequenceSeek,
 
+	QueuedMsgType_GameObjPositions,
+
 	// WARNING : When adding a new message type, also add the matching string to s_cApiFunctionToText.
 
 	QueuedMsgType_QueueWrapAround,		//Tag to let the reader thread (audio thread) that the rest of the message buffer is unused.
@@ -248,6 +250,15 @@ struct AkQueuedMsg_GameObjMultiplePosition
 	AkChannelEmitter					aMultiPosition[1];
 };
 
+// Positions of many game objects, stored as two arrays: uNumGameObjects IDs, followed by uNumGameObjects positions.
+struct AkQueuedMsg_GameObjPositions
+{
+	AkUInt32							uNumGameObjects;
+	AkGameObjectID						aGameObjIDs[1];
+
+	AkSoundPosition * GetPositions() { return (AkSoundPosition*)(aGameObjIDs + uNumGameObjects); }
+};
+
 struct AkQueuedMsg_GameObjActiveListeners
 	:	public AkQueuedMsg_GameObjectBase, 
 		public AkQueuedMsg_ListenerIDs
@@ -574,6 +585,7 @@ struct AkQueuedMsg
 		AkQueuedMsg_UnregisterGameObj unreggameobj;
 		AkQueuedMsg_GameObjPosition gameobjpos;
 		AkQueuedMsg_GameObjMultiplePosition gameObjMultiPos;
+		AkQueuedMsg_GameObjPositions gameObjPositions;
 		AkQueuedMsg_GameObjActiveListeners gameobjactlist;
 		AkQueuedMsg_GameObjActiveControllers gameobjactcontroller;
 		AkQueuedMsg_DefaultActiveListeners defaultactlist;
@@ -631,6 +643,7 @@ struct AkQueuedMsg
 static AkUInt16 _NAME_()
 
 	static AkUInt16 Sizeof_GameObjMultiPositionBase();
+	static AkUInt16 Sizeof_GameObjPositionsBase();
 	static AkUInt16 Sizeof_GameObjMultiObstructionBase();
 	static AkUInt16 Sizeof_EventPostMIDIBase();
 
@@ -760,7 +773,8 @@ static const AkOSChar* s_cApiFunctionToText[] =
 	// AKTEXT("ApiExtension"), Here we should manage API extensions properly, there is only one extension for the moment, just assign it to SpatialAudio
 	AKTEXT("SpatialAudio"),
 	AKTEXT("ExecuteActionOnPlayingID"),
-	AKTEXT("DynamicSequenceSeek")
+	AKTEXT("DynamicSequenceSeek"),
+	AKTEXT("SetPositions"),
 	AKTEXT(""),	//WrapAround.  Not printed.
 	AKTEXT("Invalid")
 
@@ -804,6 +818,7 @@ inline void ValidateMessageQueueTypes()
 	AkStaticAssert<sizeof(AkQueuedMsg_UnregisterGameObj) == 8>::Assert(); //If you get an error here, it means you changed Queue Message.  Read the rules above!
 	AkStaticAssert<sizeof(AkQueuedMsg_GameObjPosition) == 44>::Assert(); //If you get an error here, it means you changed Queue Message.  Read the rules above!
 	AkStaticAssert<sizeof(AkQueuedMsg_GameObjMultiplePosition) == 56>::Assert(); //If you get an error here, it means you changed Queue Message.  Read the rules above!
+	AkStaticAssert<sizeof(AkQueuedMsg_GameObjPositions) == 12>::Assert(); //If you get an error here, it means you changed Queue Message.  Read the rules above!
 	AkStaticAssert<sizeof(AkQueuedMsg_GameObjActiveListeners) == 24>::Assert(); //If you get an error here, it means you changed Queue Message.  Read the rules above!
 	AkStaticAssert<sizeof(AkQueuedMsg_GameObjActiveControllers) == 12>::Assert(); //If you get an error here, it means you changed Queue Message.  Read the rules above!
 	AkStaticAssert<sizeof(AkQueuedMsg_ListenerSpatialization) == 24>::Assert(); //If you get an error here, it means you changed Queue Message.  Read the rules above!
@@ -843,6 +858,6 @@ inline void ValidateMessageQueueTypes()
 	AkStaticAssert<sizeof(AkQueuedMsg_InitSinkPlugin) == 16>::Assert(); //If you get an error here, it means you changed Queue Message.  Read the rules above!
 	AkStaticAssert<sizeof(AkQueuedMsg_ApiExtension) == 4>::Assert(); //If you get an error here, it means you changed Queue Message.  Read the rules above!	
 
-	AkStaticAssert<QueuedMsgType_Invalid == 59>::Assert();	//This is a reminder: Go in MonitoringMgrDataItem.cpp@CreateApiSubFunctionDataItem add your new message in the Monitoring.  Then change the number.
-	AkStaticAssert<sizeof(s_cApiFunctionToText) / sizeof(AkOSChar*) == QueuedMsgType_Invalid>::Assert();	//You need to provide a proper string in the s_cApiFunctionToText array.
+	AkStaticAssert<QueuedMsgType_Invalid == 60>::Assert();	//This is a reminder: Go in MonitoringMgrDataItem.cpp@CreateApiSubFunctionDataItem add your new message in the Monitoring.  Then change the number.
+	AkStaticAssert<sizeof(s_cApiFunctionToText) / sizeof(AkOSChar*) == QueuedMsgType_Invalid + 1>::Assert();	//You need to provide a proper string in the s_cApiFunctionToText array.
 }
\ No newline at end of file
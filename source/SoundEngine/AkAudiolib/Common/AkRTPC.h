@@ -69,6 +69,14 @@ enum AkRtpcAccum
 	AkRtpcAccum_MaxNum							= 8
 };
 
+// Narrowest RTPC key scope that the result of GetAudioParameters() depends on.
+enum AkAudioParamsScope
+{
+	AkAudioParamsScope_Global = 0,	// Same for all voices.
+	AkAudioParamsScope_RTPCKey,		// Depends on the game object, playing ID and MIDI fields of the key.
+	AkAudioParamsScope_Voice		// May depend on the voice itself (modulators, crossfading layers).
+};
+
 // ** If you change this enum ** 
 //		-Run the python script 'Scripts\UpdateAudioEnginePropertyIds.py' to update WOBjects.xml
 //
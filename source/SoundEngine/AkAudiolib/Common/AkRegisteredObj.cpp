@@ -219,6 +219,7 @@ AKRESULT CAkModifiedNodes::SetNodeAsModified(CAkParameterNodeBase* in_pNode)
 
 CAkEmitter::CAkEmitter() : CAkTrackedGameObjComponent<GameObjComponentIdx_Emitter>()
 	, m_fScalingFactor( 1.0f )
+	, m_uPositionVersion( 0 )
 	, m_bPositionDirty( true )
 {
 }
@@ -250,7 +251,7 @@ void CAkEmitter::SetPosition(
 #endif
 }
 
-void CAkEmitter::BuildVolumeRaysHelper(AkVolumeDataArray& out_arVolumeData, const AkListenerSet& in_listeners, const CAkConnectedListeners& connectedListeners, const AkRayVolumeData*& io_pShortestRay, const CAkListener*& io_pClosestListener)
+void CAkEmitter::BuildVolumeRaysHelper(AkVolumeDataArray& out_arVolumeData, const AkListenerSet& in_listeners, const CAkConnectedListeners& connectedListeners, const AkRayVolumeData*& io_pShortestRay, const CAkListener*& io_pClosestListener, AkPendingRayArray* io_pPendingRays)
 {
 	AkReal32 fMinDist = AK_UPPER_MAX_DISTANCE;
 
@@ -262,6 +263,18 @@ void CAkEmitter::BuildVolumeRaysHelper(AkVolumeDataArray& out_arVolumeData, cons
 	if (!out_arVolumeData.Resize(origLen + uNumRays))
 		return;// BAIL!
 
+	// When a pending array is provided, distances and angles are computed later by the caller, along with those of other emitters.
+	// Compute them right away if the pending array cannot hold this emitter's rays.
+	if (io_pPendingRays)
+	{
+		AkUInt32 uNumPending = io_pPendingRays->Length();
+		if (uNumPending + uNumRays > io_pPendingRays->Reserved())
+			io_pPendingRays->GrowArray(AkMax(uNumRays, io_pPendingRays->Reserved()));
+
+		if (uNumPending + uNumRays > io_pPendingRays->Reserved())
+			io_pPendingRays = NULL;
+	}
+
 	const AkChannelEmitter * posEmitter = GetPosition().GetPositions();
 	AkGameRayParams * arRayParams = (AkGameRayParams *)AkAlloca(uNumPosition * sizeof(AkGameRayParams));
 
@@ -280,6 +293,19 @@ void CAkEmitter::BuildVolumeRaysHelper(AkVolumeDataArray& out_arVolumeData, cons
 			for (AkUInt32 posIdx = 0; posIdx < uNumPosition; posIdx++, ++pRay)
 			{
 				pRay->UpdateRay(posEmitter[posIdx].position, arRayParams[posIdx], pListener->ID(), posEmitter[posIdx].uInputChannels);
+
+				if (io_pPendingRays)
+				{
+					AkPendingRay * pPending = io_pPendingRays->AddLast();
+					AKASSERT(pPending); // Reserved above.
+					pPending->pRay = pRay;
+					pPending->pListener = pListener;
+					pPending->pEmitter = this;
+					pPending->fEmitterScalingFactor = GetScalingFactor();
+					pPending->bDirectOutputListener = isDirectOutputListener;
+					continue;
+				}
+
 				AkReal32 fScaledDistance = pListener->ComputeRayDistanceAndAngles(GetScalingFactor(), *pRay);
 
 				// For priority handling.
@@ -294,7 +320,7 @@ void CAkEmitter::BuildVolumeRaysHelper(AkVolumeDataArray& out_arVolumeData, cons
 	}
 }
 
-void CAkEmitter::BuildCachedVolumeRays()
+void CAkEmitter::BuildCachedVolumeRays(AkPendingRayArray* io_pPendingRays)
 {
 	const CAkListener * pClosestListener = NULL;
 	const AkRayVolumeData * pShortestRay = NULL;
@@ -303,8 +329,9 @@ void CAkEmitter::BuildCachedVolumeRays()
 	const AkListenerSet & listeners = connectedListeners.GetListeners();
 
 	m_arCachedEmitListPairs.RemoveAll();
+	++m_uPositionVersion;
 	
-	BuildVolumeRaysHelper(m_arCachedEmitListPairs, listeners, connectedListeners, pShortestRay, pClosestListener);
+	BuildVolumeRaysHelper(m_arCachedEmitListPairs, listeners, connectedListeners, pShortestRay, pClosestListener, io_pPendingRays);
 
 	if (pClosestListener && pShortestRay)
 	{
@@ -324,7 +351,7 @@ void CAkEmitter::BuildVolumeRays(AkVolumeDataArray& out_arVolumeData, AkListener
 
 	AkSubtraction(listeners, in_excludedListeners);
 
-	BuildVolumeRaysHelper(out_arVolumeData, listeners, connectedListeners, pShortestRay, pClosestListener);
+	BuildVolumeRaysHelper(out_arVolumeData, listeners, connectedListeners, pShortestRay, pClosestListener, NULL);
 
 	// Note that the build in game parameters are not updated by this function.
 }
@@ -333,12 +360,44 @@ void CAkEmitter::UpdateCachedPositions()
 {
 	if (m_bPositionDirty)
  	{
-		BuildCachedVolumeRays();
+		BuildCachedVolumeRays(NULL);
+
+		m_bPositionDirty = false;
+	}
+}
+
+void CAkEmitter::UpdateCachedPositions(AkPendingRayArray& io_pendingRays)
+{
+	if (m_bPositionDirty)
+ 	{
+		BuildCachedVolumeRays(&io_pendingRays);
 
 		m_bPositionDirty = false;
 	}
 }
 
+void CAkEmitter::UpdateBuiltInParamValues(const AkPendingRay* in_pRays, AkUInt32 in_uNumRays)
+{
+	// Same selection of the closest direct-output ray as BuildVolumeRaysHelper().
+	AkReal32 fMinDist = AK_UPPER_MAX_DISTANCE;
+	const AkPendingRay * pShortest = NULL;
+
+	for (AkUInt32 i = 0; i < in_uNumRays; ++i)
+	{
+		AKASSERT(in_pRays[i].pEmitter == this);
+		if (in_pRays[i].bDirectOutputListener && in_pRays[i].pRay->Distance() < fMinDist)
+		{
+			fMinDist = in_pRays[i].pRay->Distance();
+			pShortest = &in_pRays[i];
+		}
+	}
+
+	if (pShortest)
+	{
+		UpdateBuiltInParamValues(*pShortest->pRay, *pShortest->pListener);
+	}
+}
+
 AKRESULT CAkEmitter::SetObjectObstructionAndOcclusion(
 		AkGameObjectID		in_uListenerID,
 		AkReal32			in_fObstructionValue,
@@ -162,6 +162,9 @@ public:
 	
 	void UpdateCachedPositions();
 
+	// Same as UpdateCachedPositions(), but the distances and angles of the rebuilt rays are left to the caller: see CAkRegistryMgr::UpdateGameObjectPositions().
+	void UpdateCachedPositions(AkPendingRayArray& io_pendingRays);
+
 	AKRESULT SetObjectObstructionAndOcclusion( 
 		AkGameObjectID		in_uListenerID,
 		AkReal32			in_fObstructionValue,
@@ -175,6 +178,8 @@ public:
 		);
 
 	AkForceInline bool IsPositionCached() { return !m_bPositionDirty; }
+	// Incremented every time the cached emitter-listener pairs are rebuilt, i.e. when the emitter, its listeners or their scaling changed.
+	AkForceInline AkUInt32 GetPositionVersion() const { return m_uPositionVersion; }
 	AkForceInline void NotifyPositionDirty(){ m_bPositionDirty = true; }
 	AkForceInline void NotifyPositionUpdated() { m_bPositionDirty = false; }
 
@@ -185,14 +190,18 @@ public:
 
 	void UpdateBuiltInParamValues(const AkRayVolumeData& in_volumeRay, const CAkListener& in_listener);
 
+	// Update built-in parameters from this emitter's pending rays, once their distances and angles are computed.
+	void UpdateBuiltInParamValues(const AkPendingRay* in_pRays, AkUInt32 in_uNumRays);
+
 private:
-	void BuildCachedVolumeRays();
+	void BuildCachedVolumeRays(AkPendingRayArray* io_pPendingRays);
 	void BuildVolumeRaysHelper(	
 		AkVolumeDataArray& out_arVolumeData, 
 		const AkListenerSet& in_listeners, 
 		const CAkConnectedListeners& connectedListeners, 
 		const AkRayVolumeData*& io_pShortestRay, 
-		const CAkListener*& io_pClosestListener
+		const CAkListener*& io_pClosestListener,
+		AkPendingRayArray* io_pPendingRays
 	);
 	
 	AkPositionStore		m_PositionRegistry;
@@ -201,6 +210,8 @@ private:
 
 	AkReal32				m_fScalingFactor;
 
+	AkUInt32				m_uPositionVersion;
+
 	AkUInt32				m_bPositionDirty	:1;
 };
 #endif
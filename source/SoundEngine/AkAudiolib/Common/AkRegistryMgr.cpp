@@ -27,6 +27,7 @@
 #include "AkConnectedListeners.h"
 #include "AkQueuedMsg.h"
 #include "AkSpatialAudioComponent.h"
+#include <AK/SoundEngine/Common/AkSimd.h>
 
 // -------------------------------------------------------------
 // Globals
@@ -61,6 +62,7 @@ void CAkRegistryMgr::Term()
 	UnregisterObject(AkGameObjectID_Transport);
 	m_mapRegisteredObj.Term();
 	m_listModifiedNodes.Term();
+	m_arPendingRays.Term();
 }
 
 CAkRegisteredObj * CAkRegistryMgr::GetObjAndAddref(AkGameObjectID in_GameObjectID)
@@ -298,6 +300,63 @@ AKRESULT CAkRegistryMgr::SetPosition(
 	return res;
 }
 
+// Number of game objects looked up ahead of the ones being updated, so that their components are in cache when used.
+#define AK_SETPOSITIONS_BATCH_SIZE 16
+
+void CAkRegistryMgr::SetPositions(
+	AkUInt32 in_uNumGameObjects,
+	const AkGameObjectID * in_pGameObjectIDs,
+	const AkSoundPosition * in_pPositions
+	)
+{
+	CAkRegisteredObj * apObjs[AK_SETPOSITIONS_BATCH_SIZE];
+
+	for (AkUInt32 uBatchStart = 0; uBatchStart < in_uNumGameObjects; uBatchStart += AK_SETPOSITIONS_BATCH_SIZE)
+	{
+		AkUInt32 uBatchSize = AkMin(in_uNumGameObjects - uBatchStart, (AkUInt32)AK_SETPOSITIONS_BATCH_SIZE);
+
+		// First pass: hash lookups only, prefetching each object so the second pass does not stall on it.
+		for (AkUInt32 i = 0; i < uBatchSize; ++i)
+		{
+			CAkRegisteredObj ** ppObj = m_mapRegisteredObj.Exists(in_pGameObjectIDs[uBatchStart + i]);
+			apObjs[i] = ppObj ? *ppObj : NULL;
+			if (apObjs[i])
+				AKSIMD_PREFETCHMEMORY(0, apObjs[i]);
+		}
+
+		// Second pass: same as SetPosition() with a single source.
+		for (AkUInt32 i = 0; i < uBatchSize; ++i)
+		{
+			const AkSoundPosition & position = in_pPositions[uBatchStart + i];
+			bool bFound = false;
+			if (apObjs[i])
+			{
+				CAkEmitter* pEmitter = apObjs[i]->GetComponent<CAkEmitter>();
+				if (pEmitter)
+				{
+					AkChannelEmitter emitter;
+					emitter.position = position;
+					emitter.uInputChannels = AK_SPEAKER_SETUP_ALL_SPEAKERS;
+					pEmitter->SetPosition(&emitter, 1, AK::SoundEngine::MultiPositionType_SingleSource);
+					bFound = true;
+				}
+
+				CAkListener* pListener = apObjs[i]->GetComponent<CAkListener>();
+				if (pListener)
+				{
+					pListener->SetPosition(position);
+					bFound = true;
+				}
+			}
+
+			if (AK_EXPECT_FALSE(!bFound))
+			{
+				MONITOR_ERROR_PARAM(AK::Monitor::ErrorCode_UnknownGameObject, QueuedMsgType_GameObjPositions, AK_INVALID_PLAYING_ID, in_pGameObjectIDs[uBatchStart + i], AK_INVALID_UNIQUE_ID, false);
+			}
+		}
+	}
+}
+
 void CAkRegistryMgr::UpdateListeners( AkGameObjectID in_GameObjectID, const AkListenerSet& in_listeners, AkListenerOp in_operation )
 {	
 	CAkRegisteredObj** ppObj = m_mapRegisteredObj.Exists(in_GameObjectID);
@@ -834,11 +893,31 @@ void CAkRegistryMgr::UpdateGameObjectPositions()
 {
 	WWISE_SCOPED_PROFILE_MARKER("CAkRegistryMgr::UpdateGameObjectPositions");
 
+	// Gather: rebuild the rays of all emitters that moved, leaving their distances and angles pending.
+	m_arPendingRays.RemoveAll();
 	for (CAkEmitter::tList::Iterator it = CAkEmitter::List().Begin(); it != CAkEmitter::List().End(); ++it)
 	{
 		CAkEmitter* pEmitter = ((CAkEmitter*)*it);
 		if (pEmitter->GetOwner()->IsActive() || pEmitter->GetOwner()->HasComponent<CAkListener>())
-			pEmitter->UpdateCachedPositions();
+			pEmitter->UpdateCachedPositions(m_arPendingRays);
+	}
+
+	// Compute all pending rays at once.
+	const AkPendingRay * pRays = m_arPendingRays.Data();
+	const AkUInt32 uNumRays = m_arPendingRays.Length();
+	CAkListener::ComputeRaysDistanceAndAngles(pRays, uNumRays);
+
+	// Scatter: the rays of each emitter are contiguous.
+	AkUInt32 uFirst = 0;
+	while (uFirst < uNumRays)
+	{
+		CAkEmitter * pEmitter = pRays[uFirst].pEmitter;
+		AkUInt32 uEnd = uFirst + 1;
+		while (uEnd < uNumRays && pRays[uEnd].pEmitter == pEmitter)
+			++uEnd;
+
+		pEmitter->UpdateBuiltInParamValues(pRays + uFirst, uEnd - uFirst);
+		uFirst = uEnd;
 	}
 }
 
@@ -103,6 +103,13 @@ public:
 		AK::SoundEngine::MultiPositionType in_eMultiPositionType
 		);
 
+	// Set the current single position of many game objects
+	void SetPositions(
+		AkUInt32 in_uNumGameObjects,
+		const AkGameObjectID * in_pGameObjectIDs,
+		const AkSoundPosition * in_pPositions
+		);
+
 	void UpdateListeners(
 		AkGameObjectID in_GameObjectID,
 		const AkListenerSet& in_uListeners,
@@ -266,6 +273,8 @@ private:
 	
 	AkMapRegisteredObj m_mapRegisteredObj; //map of all actually registered objects
 
+	AkPendingRayArray m_arPendingRays; // Rays of the emitters updated by UpdateGameObjectPositions(), kept across frames to avoid reallocating.
+
 #ifndef AK_OPTIMIZED
 	void ClearSoloMuteGameObj(AkGameObjectID in_GameObjectID);
 public:
@@ -29,6 +29,8 @@
 #include "AkFXMemAlloc.h"
 #include "Ak3DListener.h"
 
+extern AkInitSettings g_settings;
+
 //#include <tchar.h> //test traces
 
 //====================================================================================================
@@ -857,8 +859,12 @@ static AkReal32 * s_encoder_t[AK_MAX_AMBISONICS_ORDER+1] =
 
 #define DECODER_IDX(row,col,NCOL) ((col)+(NCOL*(row)))
 
+static void ResetPanGainCacheCounters();
+
 void CAkSpeakerPan::Init()
 {
+	ResetPanGainCacheCounters();
+
 	for (AkUInt32 order = 0; order < AK_MAX_AMBISONICS_ORDER+1; order++)
 	{
 		s_decoder3D[order] = NULL;
@@ -1675,7 +1681,31 @@ static inline void GenPointsForZeroSpread(
 }
 
 // Compute speaker matrix for 3D panning with spread.
-void CAkSpeakerPan::GetSpeakerVolumes( 
+void CAkSpeakerPan::GetSpeakerVolumes(
+	const AkTransform & in_emitter,
+	AkReal32			in_fDivergenceCenter,
+	AkReal32			in_fSpread,
+	AkReal32			in_fFocus,
+	AK::SpeakerVolumes::MatrixPtr out_pVolumes,	// Returned volume matrix. Assumes it is preinitialized with zeros.
+	AkChannelConfig		in_supportedInputConfig, // LFE and height channels not supported with standard configs.
+	AkChannelMask		in_uSelInputChannelMask, // Mask of selected input channels
+	AkChannelConfig		in_outputConfig,	// config of bus to which this signal is routed.
+	const AkVector &	in_vListPosition,	// listener position
+	const AkReal32		in_mxListRot[3][3],
+	AkDevice *			in_pDevice
+	)
+{
+	if (g_settings.uPanGainCacheSize > 0
+		&& GetCachedSpeakerVolumes(in_emitter, in_fDivergenceCenter, in_fSpread, in_fFocus, out_pVolumes, in_supportedInputConfig, in_uSelInputChannelMask, in_outputConfig, in_vListPosition, in_mxListRot, in_pDevice))
+	{
+		return;
+	}
+
+	ComputeSpeakerVolumes(in_emitter, in_fDivergenceCenter, in_fSpread, in_fFocus, out_pVolumes, in_supportedInputConfig, in_uSelInputChannelMask, in_outputConfig, in_vListPosition, in_mxListRot, in_pDevice);
+}
+
+// Compute speaker matrix for 3D panning with spread, bypassing the pan gain cache.
+void CAkSpeakerPan::ComputeSpeakerVolumes( 
 	const AkTransform & in_emitter, 
 	AkReal32			in_fDivergenceCenter,
 	AkReal32			in_fSpread,
@@ -2371,6 +2401,360 @@ void CAkSpeakerPan::GetSpeakerVolumes(
 	}
 }
 
+//
+// Pan gain cache.
+//
+
+// Grid of the pan gain cache. Azimuth wraps around; elevation includes both poles.
+static const AkUInt32 k_uPanGainAzimuthCells = 72;		// 5 degrees
+static const AkUInt32 k_uPanGainElevationCells = 37;	// 5 degrees
+static const AkUInt32 k_uPanGainSpreadCells = 11;		// 10%
+static const AkUInt32 k_uPanGainFocusCells = 11;		// 10%
+static const AkUInt32 k_uPanGainCenterCells = 11;		// 10%
+
+#define AK_PAN_GAIN_KEY(_azim, _elev, _spread, _focus, _center) ((_azim) | ((_elev) << 7) | ((_spread) << 13) | ((_focus) << 17) | ((_center) << 21))
+
+struct AkPanGainCacheCounters
+{
+	AkAtomic32 uNumHits;
+	AkAtomic32 uNumMisses;
+	AkAtomic32 uNumBypasses;
+	AkAtomic32 uNumCellsComputed;
+	AkAtomic32 uNumFlushes;
+	AkAtomic32 uNumEvictions;
+};
+static AkPanGainCacheCounters s_panGainCacheCounters = { 0, 0, 0, 0, 0, 0 };
+
+static void ResetPanGainCacheCounters()
+{
+	AkAtomicStore32(&s_panGainCacheCounters.uNumHits, 0);
+	AkAtomicStore32(&s_panGainCacheCounters.uNumMisses, 0);
+	AkAtomicStore32(&s_panGainCacheCounters.uNumBypasses, 0);
+	AkAtomicStore32(&s_panGainCacheCounters.uNumCellsComputed, 0);
+	AkAtomicStore32(&s_panGainCacheCounters.uNumFlushes, 0);
+	AkAtomicStore32(&s_panGainCacheCounters.uNumEvictions, 0);
+}
+
+void CAkSpeakerPan::GetPanGainCacheStats(AkPanGainCacheStats & out_stats)
+{
+	out_stats.uNumHits = AkAtomicLoad32(&s_panGainCacheCounters.uNumHits);
+	out_stats.uNumMisses = AkAtomicLoad32(&s_panGainCacheCounters.uNumMisses);
+	out_stats.uNumBypasses = AkAtomicLoad32(&s_panGainCacheCounters.uNumBypasses);
+	out_stats.uNumCellsComputed = AkAtomicLoad32(&s_panGainCacheCounters.uNumCellsComputed);
+	out_stats.uNumFlushes = AkAtomicLoad32(&s_panGainCacheCounters.uNumFlushes);
+	out_stats.uNumEvictions = AkAtomicLoad32(&s_panGainCacheCounters.uNumEvictions);
+}
+
+AKRESULT CAkSpeakerPan::PanGainCache::Init(
+	AkUInt32 in_uMaxCells,		// Maximum number of cells.
+	AkUInt32 in_uNumChannels	// Number of output channels (including LFE).
+	)
+{
+	AKASSERT(!m_pKeys && in_uMaxCells > 0 && in_uNumChannels > 0);
+
+	// Keep the load factor under 1/2 so that probe sequences stay short.
+	AkUInt32 uNumSlots = 2;
+	while (uNumSlots < 2 * in_uMaxCells)
+		uNumSlots *= 2;
+
+	m_uStride = AK::SpeakerVolumes::Vector::GetRequiredSize(in_uNumChannels) / sizeof(AkReal32);
+	m_pKeys = (AkUInt32*)AkAlloc(AkMemID_Object, uNumSlots * sizeof(AkUInt32));
+	m_pReferenced = (AkUInt8*)AkAlloc(AkMemID_Object, uNumSlots * sizeof(AkUInt8));
+	m_pGains = (AkReal32*)AkMalign(AkMemID_Object, uNumSlots * m_uStride * sizeof(AkReal32), AK_SIMD_ALIGNMENT);
+	if (!m_pKeys || !m_pReferenced || !m_pGains)
+	{
+		Term();
+		return AK_InsufficientMemory;
+	}
+
+	for (AkUInt32 uSlot = 0; uSlot < uNumSlots; uSlot++)
+		m_pKeys[uSlot] = k_uEmptySlot;
+	m_uMask = uNumSlots - 1;
+	m_uNumCells = 0;
+	m_uMaxCells = in_uMaxCells;
+	m_uNumChannels = in_uNumChannels;
+	m_uClockHand = 0;
+	return AK_Success;
+}
+
+void CAkSpeakerPan::PanGainCache::Term()
+{
+	if (m_pKeys)
+	{
+		AkFree(AkMemID_Object, m_pKeys);
+		m_pKeys = NULL;
+	}
+	if (m_pReferenced)
+	{
+		AkFree(AkMemID_Object, m_pReferenced);
+		m_pReferenced = NULL;
+	}
+	if (m_pGains)
+	{
+		AkFalign(AkMemID_Object, m_pGains);
+		m_pGains = NULL;
+	}
+	m_uMask = 0;
+	m_uNumCells = 0;
+	m_uMaxCells = 0;
+}
+
+void CAkSpeakerPan::PanGainCache::Flush()
+{
+	if (m_uNumCells > 0)
+	{
+		for (AkUInt32 uSlot = 0; uSlot <= m_uMask; uSlot++)
+			m_pKeys[uSlot] = k_uEmptySlot;
+		m_uNumCells = 0;
+		AkAtomicInc32(&s_panGainCacheCounters.uNumFlushes);
+	}
+}
+
+AK::SpeakerVolumes::VectorPtr CAkSpeakerPan::PanGainCache::Find(AkUInt32 in_uKey)
+{
+	AkUInt32 uSlot = Hash(in_uKey) & m_uMask;
+	while (m_pKeys[uSlot] != k_uEmptySlot)
+	{
+		if (m_pKeys[uSlot] == in_uKey)
+		{
+			m_pReferenced[uSlot] = 1;
+			return m_pGains + uSlot * m_uStride;
+		}
+		uSlot = (uSlot + 1) & m_uMask;
+	}
+	return NULL;
+}
+
+AK::SpeakerVolumes::VectorPtr CAkSpeakerPan::PanGainCache::Insert(AkUInt32 in_uKey)
+{
+	if (m_uNumCells >= m_uMaxCells)
+		Evict();
+
+	AkUInt32 uSlot = Hash(in_uKey) & m_uMask;
+	while (m_pKeys[uSlot] != k_uEmptySlot)
+	{
+		AKASSERT(m_pKeys[uSlot] != in_uKey);
+		uSlot = (uSlot + 1) & m_uMask;
+	}
+	m_pKeys[uSlot] = in_uKey;
+	m_pReferenced[uSlot] = 0;	// Spared only once it is found again.
+	++m_uNumCells;
+	return m_pGains + uSlot * m_uStride;
+}
+
+void CAkSpeakerPan::PanGainCache::Evict()
+{
+	AKASSERT(m_uNumCells > 0);
+	for (;;)
+	{
+		AkUInt32 uSlot = m_uClockHand;
+		m_uClockHand = (m_uClockHand + 1) & m_uMask;
+		if (m_pKeys[uSlot] == k_uEmptySlot)
+			continue;
+		if (m_pReferenced[uSlot])
+		{
+			m_pReferenced[uSlot] = 0;
+			continue;
+		}
+
+		RemoveSlot(uSlot);
+		AkAtomicInc32(&s_panGainCacheCounters.uNumEvictions);
+		return;
+	}
+}
+
+// Backward shift deletion: move up the cells that probed past the hole, so that lookups never stop short of them.
+void CAkSpeakerPan::PanGainCache::RemoveSlot(AkUInt32 in_uSlot)
+{
+	AkUInt32 uHole = in_uSlot;
+	AkUInt32 uSlot = (uHole + 1) & m_uMask;
+	while (m_pKeys[uSlot] != k_uEmptySlot)
+	{
+		AkUInt32 uHome = Hash(m_pKeys[uSlot]) & m_uMask;
+		if (((uSlot - uHome) & m_uMask) >= ((uSlot - uHole) & m_uMask))
+		{
+			m_pKeys[uHole] = m_pKeys[uSlot];
+			m_pReferenced[uHole] = m_pReferenced[uSlot];
+			AK::SpeakerVolumes::Vector::Copy(m_pGains + uHole * m_uStride, m_pGains + uSlot * m_uStride, m_uNumChannels);
+			uHole = uSlot;
+		}
+		uSlot = (uSlot + 1) & m_uMask;
+	}
+	m_pKeys[uHole] = k_uEmptySlot;
+	--m_uNumCells;
+}
+
+// Interpolate the speaker matrix of a mono input out of the pan gain cache of the device, computing the missing cells.
+bool CAkSpeakerPan::GetCachedSpeakerVolumes(
+	const AkTransform & in_emitter,
+	AkReal32			in_fDivergenceCenter,
+	AkReal32			in_fSpread,
+	AkReal32			in_fFocus,
+	AK::SpeakerVolumes::MatrixPtr out_pVolumes,	// Returned volume matrix. Assumes it is preinitialized with zeros.
+	AkChannelConfig		in_supportedInputConfig,
+	AkChannelMask		in_uSelInputChannelMask,
+	AkChannelConfig		in_outputConfig,
+	const AkVector &	in_vListPosition,
+	const AkReal32		in_mxListRot[3][3],
+	AkDevice *			in_pDevice
+	)
+{
+	// Only mono inputs are cached: their spread prototypes (full circle or sphere) make gains depend on direction only.
+	// Mono and anonymous outputs are trivial and not worth caching.
+	bool bSupportedOutput = in_outputConfig.eConfigType == AK_ChannelConfigType_Ambisonic
+		|| (in_outputConfig.eConfigType == AK_ChannelConfigType_Standard && in_outputConfig.RemoveLFE().uNumChannels > 1);
+	if (!in_pDevice
+		|| !bSupportedOutput
+		|| in_supportedInputConfig.eConfigType != AK_ChannelConfigType_Standard
+		|| in_supportedInputConfig.uNumChannels != 1
+		|| (in_supportedInputConfig.uChannelMask & ~in_uSelInputChannelMask) != 0)
+	{
+		AkAtomicInc32(&s_panGainCacheCounters.uNumBypasses);
+		return false;
+	}
+
+	// Direction of the emitter, relative to the listener.
+	AkVector vRelPosition;
+	{
+		AkVector vPosition;
+		vPosition.X = in_emitter.Position().X - in_vListPosition.X;
+		vPosition.Y = in_emitter.Position().Y - in_vListPosition.Y;
+		vPosition.Z = in_emitter.Position().Z - in_vListPosition.Z;
+		AkMath::UnrotateVector(vPosition, &(in_mxListRot[0][0]), vRelPosition);
+	}
+	AkReal32 fDistance = AkMath::Magnitude(vRelPosition);
+	if (!(fDistance > 0.f))
+	{
+		AkAtomicInc32(&s_panGainCacheCounters.uNumBypasses);
+		return false;
+	}
+	AkReal32 fAzimuth, fElevation;
+	CartesianToSpherical(vRelPosition.X, vRelPosition.Z, vRelPosition.Y, fDistance, fAzimuth, fElevation);
+
+	// Surrounding cells and interpolation weights. Focus and center% take the nearest cell.
+	AkReal32 fAzimuthCell = AkMax((fAzimuth + PI) * (k_uPanGainAzimuthCells / TWOPI), 0.f);
+	AkUInt32 uAzimuth = AkMin((AkUInt32)fAzimuthCell, k_uPanGainAzimuthCells);
+	AkReal32 fWeightAzimuth = AkClamp(fAzimuthCell - uAzimuth, 0.f, 1.f);
+	AkUInt32 arAzimuth[2] = { uAzimuth % k_uPanGainAzimuthCells, (uAzimuth + 1) % k_uPanGainAzimuthCells };
+
+	AkReal32 fElevationCell = (fElevation + PIOVERTWO) * ((k_uPanGainElevationCells - 1) / PI);
+	AkUInt32 uElevation = AkMin((AkUInt32)AkMax(fElevationCell, 0.f), k_uPanGainElevationCells - 2);
+	AkReal32 fWeightElevation = AkClamp(fElevationCell - uElevation, 0.f, 1.f);
+
+	AkReal32 fSpreadCell = AkClamp(in_fSpread, 0.f, 100.f) * ((k_uPanGainSpreadCells - 1) / 100.f);
+	AkUInt32 uSpread = AkMin((AkUInt32)fSpreadCell, k_uPanGainSpreadCells - 2);
+	AkReal32 fWeightSpread = AkClamp(fSpreadCell - uSpread, 0.f, 1.f);
+
+	AkUInt32 uFocus = (AkUInt32)(AkClamp(in_fFocus, 0.f, 100.f) * ((k_uPanGainFocusCells - 1) / 100.f) + 0.5f);
+	AkUInt32 uCenter = (AkUInt32)(AkClamp(in_fDivergenceCenter, 0.f, 1.f) * (k_uPanGainCenterCells - 1) + 0.5f);
+
+	AkUInt32 uNumChannels = in_outputConfig.uNumChannels;
+	AkUInt32 arKeys[8];
+	AkReal32 arWeights[8];
+	for (AkUInt32 uCorner = 0; uCorner < 8; uCorner++)
+	{
+		AkUInt32 uA = uCorner & 1, uE = (uCorner >> 1) & 1, uS = (uCorner >> 2) & 1;
+		arKeys[uCorner] = AK_PAN_GAIN_KEY(arAzimuth[uA], uElevation + uE, uSpread + uS, uFocus, uCenter);
+		arWeights[uCorner] = (uA ? fWeightAzimuth : 1.f - fWeightAzimuth)
+			* (uE ? fWeightElevation : 1.f - fWeightElevation)
+			* (uS ? fWeightSpread : 1.f - fWeightSpread);
+	}
+
+	// Not only the audio thread: mixer plug-ins pan their inputs with IAkMixerPluginContext::Compute3DPositioning(),
+	// from the bus tasks of the task scheduler. Lookups also update the cache (reference bits, evictions).
+	AkAutoLock<CAkLock> lock(in_pDevice->GetPanGainCacheLock());
+
+	PanGainCache * pCache = in_pDevice->GetPanGainCache(in_outputConfig);
+	if (!pCache || pCache->MaxCells() < 8)
+	{
+		AkAtomicInc32(&s_panGainCacheCounters.uNumBypasses);
+		return false;
+	}
+	AKASSERT(pCache->NumChannels() == uNumChannels);
+
+	AK::SpeakerVolumes::VectorPtr arCells[8];
+	AkUInt32 uNumMissing = 0;
+	for (AkUInt32 uCorner = 0; uCorner < 8; uCorner++)
+	{
+		arCells[uCorner] = pCache->Find(arKeys[uCorner]);
+		if (!arCells[uCorner])
+			++uNumMissing;
+	}
+
+	if (uNumMissing > 0)
+	{
+		// Inserting may evict and move cells: work on copies of the cells.
+		AkUInt32 uCellSize = AK::SpeakerVolumes::Vector::GetRequiredSize(uNumChannels);
+		AkReal32 * pCellCopies = (AkReal32*)AkAllocaSIMD(8 * uCellSize);
+		for (AkUInt32 uCorner = 0; uCorner < 8; uCorner++)
+		{
+			AK::SpeakerVolumes::VectorPtr pCopy = (AK::SpeakerVolumes::VectorPtr)((AkUInt8*)pCellCopies + uCorner * uCellSize);
+			if (arCells[uCorner])
+				AK::SpeakerVolumes::Vector::Copy(pCopy, arCells[uCorner], uNumChannels);
+			else
+				AK::SpeakerVolumes::Vector::Zero(pCopy, uNumChannels);
+		}
+
+		// Compute the missing cells, with a level emitter at the cell direction, around an unrotated listener at the origin.
+		static const AkVector vOrigin = { 0.f, 0.f, 0.f };
+		static const AkReal32 mxIdentity[3][3] = { { 1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, { 0.f, 0.f, 1.f } };
+		AkChannelConfig configMono;
+		configMono.SetStandard(AK_SPEAKER_SETUP_MONO);
+
+		for (AkUInt32 uCorner = 0; uCorner < 8; uCorner++)
+		{
+			AK::SpeakerVolumes::VectorPtr pCopy = (AK::SpeakerVolumes::VectorPtr)((AkUInt8*)pCellCopies + uCorner * uCellSize);
+			if (arCells[uCorner])
+			{
+				arCells[uCorner] = pCopy;
+				continue;
+			}
+
+			AkUInt32 uA = uCorner & 1, uE = (uCorner >> 1) & 1, uS = (uCorner >> 2) & 1;
+			AkReal32 fCellAzimuth = arAzimuth[uA] * (TWOPI / k_uPanGainAzimuthCells) - PI;
+			AkReal32 fCellElevation = (uElevation + uE) * (PI / (k_uPanGainElevationCells - 1)) - PIOVERTWO;
+			AkReal32 fCosElevation = cosf(fCellElevation);
+			AkTransform emitter;
+			emitter.Set(
+				fCosElevation * sinf(fCellAzimuth), sinf(fCellElevation), fCosElevation * cosf(fCellAzimuth),
+				0.f, 0.f, 1.f,
+				0.f, 1.f, 0.f);
+
+			// The mono input is row 0: the matrix is the cell.
+			ComputeSpeakerVolumes(
+				emitter,
+				uCenter / (AkReal32)(k_uPanGainCenterCells - 1),
+				(uSpread + uS) * (100.f / (k_uPanGainSpreadCells - 1)),
+				uFocus * (100.f / (k_uPanGainFocusCells - 1)),
+				pCopy,
+				configMono,
+				AK_SPEAKER_SETUP_MONO,
+				in_outputConfig,
+				vOrigin,
+				mxIdentity,
+				in_pDevice);
+
+			AK::SpeakerVolumes::Vector::Copy(pCache->Insert(arKeys[uCorner]), pCopy, uNumChannels);
+			arCells[uCorner] = pCopy;
+		}
+
+		AkAtomicAdd32(&s_panGainCacheCounters.uNumCellsComputed, uNumMissing);
+		AkAtomicInc32(&s_panGainCacheCounters.uNumMisses);
+	}
+	else
+	{
+		AkAtomicInc32(&s_panGainCacheCounters.uNumHits);
+	}
+
+	// The mono input is row 0.
+	AK::SpeakerVolumes::VectorPtr pChanIn = AK::SpeakerVolumes::Matrix::GetChannel(out_pVolumes, 0, uNumChannels);
+	for (AkUInt32 uCorner = 0; uCorner < 8; uCorner++)
+	{
+		AK::SpeakerVolumes::Matrix::MAdd(pChanIn, arCells[uCorner], 1, uNumChannels, arWeights[uCorner]);
+	}
+	return true;
+}
+
 //
 // Panning functions.
 // 
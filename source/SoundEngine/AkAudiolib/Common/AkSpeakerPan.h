@@ -25,6 +25,7 @@
 #include <AK/SoundEngine/Common/AkSpeakerVolumes.h>
 
 class AkDevice;
+struct AkPanGainCacheStats;
 
 //====================================================================================================
 // speaker pan
@@ -137,6 +138,60 @@ public:
 	};
 	typedef CAkKeyArray<ConfigIn2d3d, ArraySimdVector, ArrayPoolDefault, AkGrowByPolicy_DEFAULT, AkCacheItemMovePolicy > MapConfig2Spread;
 
+	// Memoized 3D panning gains of mono inputs, for one output configuration (see AkInitSettings::uPanGainCacheSize).
+	// Cells are keyed on quantized azimuth, elevation, spread, focus and center%, and hold one gain per output channel.
+	// Open addressing with linear probing. When the cache is full, cells are evicted one at a time with the clock
+	// algorithm: a hand sweeps the slots, sparing the cells found since it last passed, and removing the first other one.
+	class PanGainCache
+	{
+	public:
+		PanGainCache() : m_pKeys(NULL), m_pReferenced(NULL), m_pGains(NULL), m_uMask(0), m_uNumCells(0), m_uMaxCells(0), m_uNumChannels(0), m_uStride(0), m_uClockHand(0) {}
+
+		AKRESULT Init(
+			AkUInt32 in_uMaxCells,		// Maximum number of cells.
+			AkUInt32 in_uNumChannels	// Number of output channels (including LFE).
+			);
+		void Term();
+		void Flush();
+
+		// Returns the gains of a cell, or NULL if it was not computed yet. Marks the cell as referenced.
+		AK::SpeakerVolumes::VectorPtr Find(AkUInt32 in_uKey);
+
+		// Returns the storage of a new cell, evicting a cell if the cache is full.
+		// Evicting may move other cells: pointers returned previously are invalidated.
+		AK::SpeakerVolumes::VectorPtr Insert(AkUInt32 in_uKey);
+
+		inline AkUInt32 NumCells() const { return m_uNumCells; }
+		inline AkUInt32 MaxCells() const { return m_uMaxCells; }
+		inline AkUInt32 NumChannels() const { return m_uNumChannels; }
+
+	private:
+		static AkForceInline AkUInt32 Hash(AkUInt32 in_uKey)
+		{
+			AkUInt32 uHash = in_uKey * 0x9E3779B1;
+			return uHash ^ (uHash >> 16);
+		}
+
+		void Evict();
+		void RemoveSlot(AkUInt32 in_uSlot);
+
+		AkUInt32 *	m_pKeys;		// Cell key per slot, or k_uEmptySlot.
+		AkUInt8 *	m_pReferenced;	// Per slot, non-zero if the cell was found since the clock hand last passed.
+		AkReal32 *	m_pGains;		// Cell gains per slot, m_uStride floats each.
+		AkUInt32	m_uMask;		// Number of slots - 1.
+		AkUInt32	m_uNumCells;
+		AkUInt32	m_uMaxCells;
+		AkUInt32	m_uNumChannels;
+		AkUInt32	m_uStride;
+		AkUInt32	m_uClockHand;	// Next slot considered for eviction.
+
+		static const AkUInt32 k_uEmptySlot = 0xFFFFFFFF;
+	};
+	typedef CAkKeyArray<AkChannelConfig, PanGainCache*> MapConfig2PanGainCache;
+
+	// Statistics of all pan gain caches, accumulated since initialization.
+	static void GetPanGainCacheStats(AkPanGainCacheStats & out_stats);
+
 	static AKRESULT CreateSpreadCache(
 		ConfigIn2d3d		key,				// Plane or 3D config
 		AkReal32			in_fOneOverMinAngleBetweenSpeakers,		// 1 / min angle between speakers ("PAN_CIRCLE" degrees).
@@ -492,6 +547,37 @@ public:
 		void *&				io_pPanPairs		// Allocated or unallocated array of pan gain pairs, allocated herein if needed and returned filled with values.
 		);
 
+	// Compute speaker matrix for 3D panning with spread, bypassing the pan gain cache.
+	static void ComputeSpeakerVolumes(
+		const AkTransform & in_emitter,
+		AkReal32			in_fDivergenceCenter,
+		AkReal32			in_fSpread,
+		AkReal32			in_fFocus,
+		AK::SpeakerVolumes::MatrixPtr out_pVolumes,
+		AkChannelConfig		in_supportedInputConfig,
+		AkChannelMask		in_uSelInputChannelMask,
+		AkChannelConfig		in_outputConfig,
+		const AkVector &	in_listPosition,
+		const AkReal32		in_listRot[3][3],
+		AkDevice *			in_pDevice
+		);
+
+	// Interpolate the speaker matrix of a mono input out of the pan gain cache of the device, computing the missing cells.
+	// Returns false if the input, output or geometry is not supported by the cache; the matrix must then be computed directly.
+	static bool GetCachedSpeakerVolumes(
+		const AkTransform & in_emitter,
+		AkReal32			in_fDivergenceCenter,
+		AkReal32			in_fSpread,
+		AkReal32			in_fFocus,
+		AK::SpeakerVolumes::MatrixPtr out_pVolumes,
+		AkChannelConfig		in_supportedInputConfig,
+		AkChannelMask		in_uSelInputChannelMask,
+		AkChannelConfig		in_outputConfig,
+		const AkVector &	in_listPosition,
+		const AkReal32		in_listRot[3][3],
+		AkDevice *			in_pDevice
+		);
+
 	// Makes identity matrix to up to min(numchannels_in,numchannels_out), zeros the additional rows/columns.
 	static void GetSpeakerVolumesDirectNoMask(
 		AkChannelConfig		in_inputConfig,
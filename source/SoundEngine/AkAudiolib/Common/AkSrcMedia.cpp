@@ -17,6 +17,120 @@
 #include "AkSrcMediaCodecPCM.h"
 #include "AkVPLSrcCbxNode.h"
 #include "AkPositionRepository.h"
+#include "AkDecodedMediaCache.h"
+
+/// Plays media from the decoded media cache, in place of its actual codec
+class CAkSrcMediaCodecDecoded : public IAkSrcMediaCodec
+{
+public:
+	CAkSrcMediaCodecDecoded(const AkDecodedMedia * in_pMedia)
+		: m_pMedia(in_pMedia)
+		, m_Position{}
+	{
+		m_OutputBuffer.Clear();
+	}
+
+	virtual Result Init(const AK::SrcMedia::Header &in_header, AK::SrcMedia::CodecInfo &out_codec, AkUInt16 uLoopCnt) override
+	{
+		AkChannelConfig channelConfig;
+		channelConfig.Deserialize(m_pMedia->GetKey().uChannelConfig);
+		out_codec.format.SetAll(
+			m_pMedia->SampleRate(),
+			channelConfig,
+			32,
+			channelConfig.uNumChannels * sizeof(AkReal32),
+			AK_FLOAT,
+			AK_NONINTERLEAVED);
+
+		out_codec.uSourceSampleRate = m_pMedia->SampleRate();
+		out_codec.uTotalSamples = m_pMedia->NumFrames();
+		out_codec.heuristics.fThroughput = (AkReal32)in_header.uDataSize * m_pMedia->SampleRate() / (m_pMedia->NumFrames() * 1000.f);
+		out_codec.heuristics.uLoopStart = in_header.uDataOffset;
+		out_codec.heuristics.uLoopEnd = in_header.uDataOffset + in_header.uDataSize;
+		out_codec.uMinimalBufferSize = 1;
+		out_codec.uAttributes = 0;
+		out_codec.eOrdering = (AK::SrcMedia::ChannelOrdering)m_pMedia->GetChannelOrdering();
+
+		AK::SrcMedia::Position::Init(&m_Position, in_header, out_codec, uLoopCnt);
+		if (m_Position.uPCMLoopEnd == 0) m_Position.uPCMLoopEnd = m_pMedia->NumFrames() - 1;
+		return AK_Success;
+	}
+
+	virtual void Term() override
+	{
+		VirtualOn();
+		if (m_pMedia)
+		{
+			AkDecodedMediaCache::Release(m_pMedia);
+			m_pMedia = nullptr;
+		}
+	}
+
+	virtual Result Warmup(AK::SrcMedia::Stream::State* pStream) override { return AK_Success; } // no-op
+
+	virtual Result PrepareNextBuffer(AK::SrcMedia::Stream::State* pStream, const AK::SrcMedia::Position::State &position, const PitchInfo &pitch) override { return AK_Success; } // no-op
+
+	virtual Result GetBuffer(AK::SrcMedia::Stream::State* pStream, AkUInt16 uMaxFrames, BufferInfo &out_buffer) override
+	{
+		if (!m_OutputBuffer.HasData())
+		{
+			AkChannelConfig channelConfig;
+			channelConfig.Deserialize(m_pMedia->GetKey().uChannelConfig);
+			m_OutputBuffer.SetChannelConfig(channelConfig);
+			m_OutputBuffer.SetRequestSize(uMaxFrames);
+			if (m_OutputBuffer.GetCachedBuffer() != AK_Success)
+				return AK_Fail;
+		}
+
+		// Samples are not read from the stream: the media is entirely decoded.
+		AkUInt32 uFrames = AkMin(uMaxFrames, m_OutputBuffer.MaxFrames());
+		AK::SrcMedia::Position::ClampFrames(&m_Position, uFrames);
+		m_pMedia->CopyFrames(m_Position.uCurSample, uFrames, (AkReal32*)m_OutputBuffer.GetInterleavedData(), m_OutputBuffer.MaxFrames());
+
+		out_buffer.Buffer.AttachInterleavedData(m_OutputBuffer.GetInterleavedData(), m_OutputBuffer.MaxFrames(), (AkUInt16)uFrames);
+		out_buffer.uSrcFrames = (AkUInt16)uFrames;
+
+		bool bLoop;
+		AK::SrcMedia::Position::Forward(&m_Position, uFrames, bLoop);
+		return AK_DataReady;
+	}
+
+	virtual void ReleaseBuffer(AK::SrcMedia::Stream::State* pStream) override {} // no-op
+
+	virtual void VirtualOn() override
+	{
+		if (m_OutputBuffer.HasData())
+			m_OutputBuffer.ReleaseCachedBuffer();
+	}
+
+	virtual Result VirtualOff() override { return AK_Success; } // no-op
+
+	virtual Result FindClosestFileOffset(AkUInt32 in_uDesiredSample, SeekInfo &out_SeekInfo) override
+	{
+		// Any sample can be played directly.
+		out_SeekInfo.uPCMOffset = in_uDesiredSample;
+		out_SeekInfo.uSkipLength = 0;
+		out_SeekInfo.uFileOffset = 0;
+		return AK_Success;
+	}
+
+	virtual Result Seek(AK::SrcMedia::Stream::State* pStream, const SeekInfo &seek, AkUInt32 uNumFramesInRange, AkUInt16 uLoopCnt) override
+	{
+		m_Position.uCurSample = seek.uPCMOffset;
+		m_Position.uLoopCnt = uLoopCnt;
+		return AK_Success;
+	}
+
+	virtual void StopLooping(const AK::SrcMedia::Position::State &position) override
+	{
+		m_Position.uLoopCnt = position.uLoopCnt;
+	}
+
+private:
+	const AkDecodedMedia *        m_pMedia;
+	AkPipelineBuffer              m_OutputBuffer;
+	AK::SrcMedia::Position::State m_Position;
+};
 
 CAkSrcMedia::CAkSrcMedia(CAkPBI * pCtx, AkCreateSrcMediaCodecCallback pCodecFactory)
 	: IAkSoftwareCodec(pCtx)
@@ -25,6 +139,7 @@ CAkSrcMedia::CAkSrcMedia(CAkPBI * pCtx, AkCreateSrcMediaCodecCallback pCodecFact
 	, m_Envelope{}
 	, m_pCodecFactory(pCodecFactory)
 	, m_pCodec(nullptr)
+	, m_pRecording(nullptr)
 	, m_uDataOffset(0)
 	, m_uSourceSampleRate(0)
 	, m_uCodecAttributes(0)
@@ -122,6 +237,8 @@ AKRESULT CAkSrcMedia::StartStream(AkUInt8 * in_pBuffer, AkUInt32 ulBufferSize)
 
 void CAkSrcMedia::StopStream()
 {
+	AkDecodedMediaCache::CancelRecording(m_pRecording);
+
 	if (m_pCodec != nullptr)
 	{
 		m_pCodec->Term();
@@ -177,6 +294,14 @@ void CAkSrcMedia::GetBuffer(AkVPLState & io_state)
 
 		LeavePreBufferingState();
 
+		if (m_pRecording)
+		{
+			if (buffer.uSrcFrames == buffer.Buffer.uValidFrames)
+				AkDecodedMediaCache::Record(m_pRecording, m_Position.uCurSample, (AkReal32*)buffer.Buffer.GetInterleavedData(), buffer.Buffer.MaxFrames(), buffer.Buffer.uValidFrames);
+			else
+				AkDecodedMediaCache::CancelRecording(m_pRecording);
+		}
+
 		io_state.AttachInterleavedData(buffer.Buffer.GetInterleavedData(), buffer.Buffer.MaxFrames(), buffer.Buffer.uValidFrames);
 
 		// Setup pipeline buffer properly; we have some frames to send out
@@ -265,6 +390,8 @@ void CAkSrcMedia::VirtualOn(AkVirtualQueueBehavior eBehavior)
 	if (eBehavior == AkVirtualQueueBehavior_FromElapsedTime
 		|| eBehavior == AkVirtualQueueBehavior_FromBeginning)
 	{
+		AkDecodedMediaCache::CancelRecording(m_pRecording);
+
 		if (m_StreamState.uSizeLeft != 0)
 		{
 			AK::SrcMedia::Stream::ReleaseStreamBuffer(&m_StreamState);
@@ -473,9 +600,40 @@ AKRESULT CAkSrcMedia::InitCodec(AkUInt8 * in_pBuffer, AkUInt32 in_uBufferSize, A
 {
 	IAkSrcMediaCodec::Result eResult;
 
-	m_pCodec = m_pCodecFactory(&io_header);
+	// In-memory media may already be decoded in the cache, or be worth recording for it.
+	AkDecodedMediaKey key;
+	const AkMediaInformation & mediaInfo = m_pCtx->GetSrcTypeInfo()->mediaInfo;
+	bool bCacheable = AkDecodedMediaCache::IsEnabled()
+		&& m_StreamState.bIsMemoryStream
+		&& !mediaInfo.bExternallySupplied
+		&& AkDecodedMediaCache::IsCacheableFormat(io_header.FormatInfo.pFormat->wFormatTag);
+	if (bCacheable)
+	{
+		key.mediaID = mediaInfo.sourceID;
+		key.uMediaSize = io_header.uDataOffset + io_header.uDataSize;
+		key.uSampleRate = io_header.FormatInfo.pFormat->nSamplesPerSec;
+		key.uChannelConfig = io_header.FormatInfo.pFormat->GetChannelConfig().Serialize();
+		key.uFormatTag = io_header.FormatInfo.pFormat->wFormatTag;
+
+		const AkDecodedMedia * pMedia = AkDecodedMediaCache::Acquire(key);
+		if (pMedia)
+		{
+			m_pCodec = AkNew(AkMemID_Processing, CAkSrcMediaCodecDecoded(pMedia));
+			if (m_pCodec == nullptr)
+			{
+				AkDecodedMediaCache::Release(pMedia);
+				return AK_InsufficientMemory;
+			}
+			bCacheable = false;
+		}
+	}
+
 	if (m_pCodec == nullptr)
-		return AK_InsufficientMemory;
+	{
+		m_pCodec = m_pCodecFactory(&io_header);
+		if (m_pCodec == nullptr)
+			return AK_InsufficientMemory;
+	}
 
 	AkUInt16 uLoopCnt = m_pCtx->GetLooping();
 	AK::SrcMedia::CodecInfo codec{};
@@ -519,6 +677,18 @@ AKRESULT CAkSrcMedia::InitCodec(AkUInt8 * in_pBuffer, AkUInt32 in_uBufferSize, A
 	m_uCodecAttributes = codec.uAttributes;
 	m_eOrdering = codec.eOrdering;
 
+	// Only record plays of the whole media without looping: around loop points, the codec output
+	// differs from the one of a straight play.
+	if (bCacheable && uLoopCnt == LOOPING_ONE_SHOT && !m_pCtx->RequiresSourceSeek())
+	{
+		m_pRecording = AkDecodedMediaCache::BeginRecording(
+			key,
+			codec.uTotalSamples,
+			codec.format.channelConfig.uNumChannels,
+			codec.format.uSampleRate,
+			(AkUInt8)codec.eOrdering);
+	}
+
 	return AK_Success;
 }
 
@@ -619,6 +789,9 @@ AKRESULT CAkSrcMedia::SeekTo(AkUInt32 uSeekOffset, AkUInt16 uLoopCnt)
 
 	AKRESULT eSeekResult;
 
+	// Decoding resumes from a seekable point, so the output no longer matches a straight play.
+	AkDecodedMediaCache::CancelRecording(m_pRecording);
+
 	// Resolve the point in the media file most suitable for seeking to uSourceOffset
 	IAkSrcMediaCodec::SeekInfo seek;
 	eSeekResult = m_pCodec->FindClosestFileOffset(uSeekOffset, seek);
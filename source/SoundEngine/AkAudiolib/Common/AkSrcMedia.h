@@ -87,6 +87,8 @@ public:
 	virtual void StopLooping(const AK::SrcMedia::Position::State &position) = 0;
 };
 
+class AkDecodedMedia;
+
 AK_CALLBACK( IAkSrcMediaCodec*, AkCreateSrcMediaCodecCallback )( const AK::SrcMedia::Header * in_pHeader );
 
 /// A source node that reads from a media file produced by Wwise
@@ -183,6 +185,7 @@ private:
 
 	AkCreateSrcMediaCodecCallback m_pCodecFactory;
 	IAkSrcMediaCodec * m_pCodec;
+	AkDecodedMedia * m_pRecording;     // Set while the codec output is recorded for the decoded media cache.
 
 	AkUInt32 m_uDataOffset;
 	AkUInt32 m_uSourceSampleRate;
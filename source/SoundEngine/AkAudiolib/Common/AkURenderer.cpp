@@ -110,6 +110,7 @@ void CAkURenderer::Term()
 	CAkLEngine::Term();
 
 	DestroyAllPBIs();
+	AkAncestorParamsCache::Term();
 
 	m_listCtxs.Term();
 
@@ -119,6 +120,7 @@ void CAkURenderer::Term()
 
 	m_GlobalLimiter.Term(); // Must be terminated before m_Limiters.
 	m_Limiters.Term();
+	CAkLimiter::TermScratch();
 } // Term
 
 PriorityInfoCurrent CAkURenderer::_CalcInitialPriority( CAkSoundBase * in_pSound, CAkRegisteredObj * in_pGameObj, AkReal32& out_fMaxRadius )
@@ -700,16 +702,20 @@ AKRESULT CAkURenderer::Kick(
 		return AK_Success;
 
 	WeakestPBI l_Weakest;
+	AkPriorityStruct weakestKey;
 
 	AkUInt16 uPlayingCount = 0;
 	bool bIAmHigherPriorityThanAContinueToPlay = false;
 
-	// Cycle through PBI list; PBIs are orderer by priority, then by oldest/newest
-	CAkLimiter::Iterator itPBI = in_pLimiter->Begin();
-	CAkLimiter::Iterator itEnd = in_pLimiter->End();
-	for( ; itPBI != itEnd; ++itPBI )
+	// The limiter is a heap, so the items are not visited in priority order:
+	// the weakest is the one that comes last in priority order, then by oldest/newest.
+	// A ContinueToPlay candidate only protects the caller if it is within the first in_uMaxInstances playing PBIs;
+	// it is enough to check the one that comes first.
+	const AkLimiterHeapItem * pFirstContinueToPlay = NULL;
+	for( AkUInt32 uItem = 0; uItem < in_pLimiter->Length(); ++uItem )
 	{
-		CAkPBI* pPBI = *itPBI;
+		const AkLimiterHeapItem & item = in_pLimiter->GetItem( uItem );
+		CAkPBI* pPBI = item.pPBI;
 
 		if( in_pGameObj == NULL || pPBI->GetGameObjectPtr() == in_pGameObj )
 		{
@@ -729,19 +735,41 @@ AKRESULT CAkURenderer::Kick(
 						virtualBehavior = pPBI->GetVirtualBehavior( _unused );
 						if( AkBelowThresholdBehavior_ContinueToPlay == virtualBehavior )
 						{
-							if( uPlayingCount <= in_uMaxInstances)
-								bIAmHigherPriorityThanAContinueToPlay = true;
+							if ( !pFirstContinueToPlay || in_pLimiter->Precedes( item.key, pFirstContinueToPlay->key ) )
+								pFirstContinueToPlay = &item;
 							// Not a candidate to be kicked, continue.
 							continue;
 						}
 					}
 					// Found a new weakest, remember it.
-					l_Weakest.Set( pPBI, virtualBehavior, pbiPriority );
+					if ( !l_Weakest.Get() || in_pLimiter->Precedes( weakestKey, item.key ) )
+					{
+						l_Weakest.Set( pPBI, virtualBehavior, pbiPriority );
+						weakestKey = item.key;
+					}
 				}
 			}
 		}
 	}
 
+	if ( pFirstContinueToPlay )
+	{
+		// Rank of the first ContinueToPlay candidate among the playing PBIs.
+		AkUInt32 uRank = 1;
+		for( AkUInt32 uItem = 0; uItem < in_pLimiter->Length(); ++uItem )
+		{
+			const AkLimiterHeapItem & item = in_pLimiter->GetItem( uItem );
+			CAkPBI* pPBI = item.pPBI;
+			if( ( in_pGameObj == NULL || pPBI->GetGameObjectPtr() == in_pGameObj )
+				&& !pPBI->WasKicked() && !pPBI->VoiceNotLimited()
+				&& in_pLimiter->Precedes( item.key, pFirstContinueToPlay->key ) )
+			{
+				++uRank;
+			}
+		}
+		bIAmHigherPriorityThanAContinueToPlay = ( uRank <= in_uMaxInstances );
+	}
+
 	// If there aren't enough playing PBIs then there's no reason to kick anyone!
 	if( (uPlayingCount + 1) <= in_uMaxInstances )
 		return AK_Success;
@@ -1037,6 +1065,8 @@ void CAkURenderer::RemoveLimiter( CAkLimiter* in_pLimiter )
 
 void CAkURenderer::ProcessLimiters()
 {
+	WWISE_SCOPED_PROFILE_MARKER("CAkURenderer::ProcessLimiters");
+
 	bool bProcessLimiters = m_bLimitersDirty && !m_bBusInvalid;
 	if (bProcessLimiters)
 	{
@@ -28,6 +28,8 @@ class AkVPL
 public:
 	AkVPL()
 		: m_iDepth(INT_MAX)
+		, m_iGraphPendingInputs(0)
+		, m_iGraphIdx(-1)
 		, m_bRecurseVisit(false)
 		, m_bReferenced(false)
 		, m_bIsHDR(false)
@@ -110,6 +112,8 @@ public:
 	CAkVPLMixBusNode		m_MixBus;			// Mix bus node.
 
 	AkInt32					m_iDepth;
+	AkAtomic32				m_iGraphPendingInputs;	// Number of producers (voices and busses) this bus still waits for in the current frame.
+	AkInt32					m_iGraphIdx;			// Producer index of this bus in the current frame's dependency graph.
 	AkUInt8					m_bRecurseVisit : 1; // Recursive visit bit for DFS
 
 	AkUInt8					m_bReferenced	:1;	// True when bus should be kept alive despite no connections or playback (such as during HDR window release).
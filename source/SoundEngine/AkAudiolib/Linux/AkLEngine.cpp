@@ -231,6 +231,7 @@ void CAkLEngine::GetDefaultPlatformInitSettings(
 	out_pPlatformSettings.uNumRefillsInVoice = AK_DEFAULT_NUM_REFILLS_IN_VOICE_BUFFER;
 	out_pPlatformSettings.uSampleRate = DEFAULT_NATIVE_FREQUENCY;
 	out_pPlatformSettings.sampleType = AK_DEFAULT_SAMPLE_TYPE;
+	out_pPlatformSettings.bPipelinedMixing = false;
 }
 
 void CAkLEngine::GetDefaultOutputSettings( AkOutputSettings & out_settings )
@@ -274,6 +275,7 @@ AKRESULT CAkLEngine::Init()
 	}
 
 	AkAudioLibSettings::SetAudioBufferSettings(g_PDSettings.uSampleRate, g_settings.uNumSamplesPerFrame);
+	m_bPipelinedOutput = g_PDSettings.bPipelinedMixing;
 	return SoftwareInit();
 } // Init
 
@@ -0,0 +1,72 @@
+/***********************************************************************
+  The content of this file includes source code for the sound engine
+  portion of the AUDIOKINETIC Wwise Technology and constitutes "Level
+  Two Source Code" as defined in the Source Code Addendum attached
+  with this file.  Any use of the Level Two Source Code shall be
+  subject to the terms and conditions outlined in the Source Code
+  Addendum and the End User License Agreement for Wwise(R).
+
+  Version:  Build: 
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+ ***********************************************************************/
+
+//////////////////////////////////////////////////////////////////////
+//
+// AkFloat16AVX2.cpp
+// 
+// AVX2/F16C specific implementations of half-precision conversions.
+// Both instruction sets must be supported at runtime.
+//
+/////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h" 
+#include "AkFloat16Buffer.h"
+#include <AK/SoundEngine/Common/AkSimd.h>
+#include <AK/SoundEngine/Platforms/SSE/AkSimdAvx2.h>
+
+void ConvertFromReal32ToFloat16_AVX2(const AkReal32 * AK_RESTRICT in_pSrc, AkUInt16 * AK_RESTRICT out_pDst, AkUInt32 in_uNumSamples)
+{
+	const AkReal32 * AK_RESTRICT pSrcEnd = in_pSrc + (in_uNumSamples & ~7);
+	while (in_pSrc < pSrcEnd)
+	{
+		AKSIMD_STOREU_V4I32((AKSIMD_V4I32*)out_pDst, AKSIMD_CONVERT_V8F32_TO_V8F16(AKSIMD_LOAD_V8F32(in_pSrc)));
+		in_pSrc += 8;
+		out_pDst += 8;
+	}
+
+	// Remaining samples go through a zero-padded vector.
+	AkUInt32 uRemaining = in_uNumSamples & 7;
+	if (uRemaining)
+	{
+		AK_ALIGN_SIMD(AkReal32 aIn[8]) = { 0.f };
+		AK_ALIGN_SIMD(AkUInt16 aOut[8]);
+		for (AkUInt32 i = 0; i < uRemaining; ++i)
+			aIn[i] = in_pSrc[i];
+		AKSIMD_STORE_V4I32((AKSIMD_V4I32*)aOut, AKSIMD_CONVERT_V8F32_TO_V8F16(AKSIMD_LOAD_V8F32(aIn)));
+		for (AkUInt32 i = 0; i < uRemaining; ++i)
+			out_pDst[i] = aOut[i];
+	}
+}
+
+void ConvertFromFloat16ToReal32_AVX2(const AkUInt16 * AK_RESTRICT in_pSrc, AkReal32 * AK_RESTRICT out_pDst, AkUInt32 in_uNumSamples)
+{
+	const AkUInt16 * AK_RESTRICT pSrcEnd = in_pSrc + (in_uNumSamples & ~7);
+	while (in_pSrc < pSrcEnd)
+	{
+		AKSIMD_STORE_V8F32(out_pDst, AKSIMD_CONVERT_V8F16_TO_V8F32(AKSIMD_LOADU_V4I32((AKSIMD_V4I32*)in_pSrc)));
+		in_pSrc += 8;
+		out_pDst += 8;
+	}
+
+	AkUInt32 uRemaining = in_uNumSamples & 7;
+	if (uRemaining)
+	{
+		AK_ALIGN_SIMD(AkUInt16 aIn[8]) = { 0 };
+		AK_ALIGN_SIMD(AkReal32 aOut[8]);
+		for (AkUInt32 i = 0; i < uRemaining; ++i)
+			aIn[i] = in_pSrc[i];
+		AKSIMD_STORE_V8F32(aOut, AKSIMD_CONVERT_V8F16_TO_V8F32(AKSIMD_LOAD_V4I32((AKSIMD_V4I32*)aIn)));
+		for (AkUInt32 i = 0; i < uRemaining; ++i)
+			out_pDst[i] = aOut[i];
+	}
+}
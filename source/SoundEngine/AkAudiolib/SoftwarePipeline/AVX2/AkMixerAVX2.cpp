@@ -0,0 +1,270 @@
+/***********************************************************************
+  The content of this file includes source code for the sound engine
+  portion of the AUDIOKINETIC Wwise Technology and constitutes "Level
+  Two Source Code" as defined in the Source Code Addendum attached
+  with this file.  Any use of the Level Two Source Code shall be
+  subject to the terms and conditions outlined in the Source Code
+  Addendum and the End User License Agreement for Wwise(R).
+
+  Version:  Build: 
+  Copyright (c) 2006-2020 Audiokinetic Inc.
+ ***********************************************************************/
+
+//////////////////////////////////////////////////////////////////////
+//
+// AkMixerAVX2.cpp
+// 
+// AVX2 specific implementations of Mixer functions.
+// Gains are ramped exactly like the V4F32 versions (which process 2 vectors of 4 frames per step),
+// so that both produce the same output.
+//
+/////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h" 
+#include "AkMath.h"
+#include "AkMixer.h"
+#include "AkMixerCommon.h"
+#include <AK/SoundEngine/Common/AkSimd.h>
+#include <AK/SoundEngine/Platforms/SSE/AkSimdAvx2.h>
+#include "AudiolibDefs.h"
+
+// Number of floats in vectors.
+static const AkUInt32	ulVectorSize = 8;
+
+// Assumes usMaxFrames % 8 == 0
+void ApplyGainMono_AVX2(
+	AkAudioBuffer* in_pInputBuffer,
+	AkAudioBuffer* in_pOutputBuffer,
+	AkRamp in_gain)
+{
+	AkUInt16 usMaxFrames = in_pInputBuffer->MaxFrames();
+	AkReal32* AK_RESTRICT pSourceData = in_pInputBuffer->GetChannel(0);
+	AkReal32* AK_RESTRICT pDestData = in_pOutputBuffer->GetChannel(0);
+	AkReal32* AK_RESTRICT pSourceEnd = pSourceData + usMaxFrames;
+
+	BUILD_VOLUME_DELTA_VECTOR(vVolumes, vVolumesDelta, in_gain, usMaxFrames);
+
+	AKASSERT(!(usMaxFrames % 8));
+	if (in_gain.fNext == in_gain.fPrev)
+	{
+		AKSIMD_V8F32 vVolumes8 = AKSIMD_SET_V2F128(vVolumes, vVolumes);
+		do
+		{
+			AKSIMD_V8F32 vSrc = AKSIMD_LOAD_V8F32(pSourceData);
+			pSourceData += ulVectorSize;
+
+			AKSIMD_STORE_V8F32(pDestData, AKSIMD_MUL_V8F32(vSrc, vVolumes8));
+			pDestData += ulVectorSize;
+		} while (pSourceData < pSourceEnd);
+	}
+	else // has volume delta
+	{
+		AKSIMD_V8F32 vVolumes8 = AKSIMD_SET_V2F128(vVolumes, AKSIMD_ADD_V4F32(vVolumes, vVolumesDelta));
+		vVolumesDelta = AKSIMD_ADD_V4F32(vVolumesDelta, vVolumesDelta);
+		AKSIMD_V8F32 vVolumesDelta8 = AKSIMD_SET_V2F128(vVolumesDelta, vVolumesDelta);
+
+		do
+		{
+			AKSIMD_V8F32 vSrc = AKSIMD_LOAD_V8F32(pSourceData);
+			pSourceData += ulVectorSize;
+
+			AKSIMD_STORE_V8F32(pDestData, AKSIMD_MUL_V8F32(vSrc, vVolumes8));
+			pDestData += ulVectorSize;
+
+			vVolumes8 = AKSIMD_ADD_V8F32(vVolumes8, vVolumesDelta8);
+		} while (pSourceData < pSourceEnd);
+	}
+}
+
+// Converts 8 floats to saturated 16-bit integers, like AKSIMD_PACKS_V4I32 of their two halves.
+static AkForceInline AKSIMD_V4I32 TruncateAndPackAVX2(AKSIMD_V8F32 in_vfSamples)
+{
+	AKSIMD_V8I32 viSamples = AKSIMD_TRUNCATE_V8F32_TO_V8I32(in_vfSamples);
+	return AKSIMD_PACKS_V4I32(AKSIMD_EXTRACT_V2I128(viSamples, 0), AKSIMD_EXTRACT_V2I128(viSamples, 1));
+}
+
+void ApplyGainNInt16_AVX2(
+	AkAudioBuffer* in_pInputBuffer,
+	AkAudioBuffer* in_pOutputBuffer,
+	AkRamp in_gain)
+{
+	const AkUInt32 VecWidth = 4;
+
+	AkReal32* AK_RESTRICT pSrc = (AkReal32*)in_pInputBuffer->GetInterleavedData();
+	AkInt16* AK_RESTRICT pDest = (AkInt16*)in_pOutputBuffer->GetInterleavedData();
+	const AkUInt32 uChannelCount = in_pOutputBuffer->GetChannelConfig().uNumChannels;
+	const AkUInt32 uFrames = in_pInputBuffer->MaxFrames();
+
+	if (in_gain.fPrev == in_gain.fNext)
+	{
+		const AkUInt32 uSteps = (uFrames * uChannelCount) / VecWidth;
+		AkUInt32 uCurrentStep = 0;
+
+		// If there is no gain delta we have an easy codepath
+		AKSIMD_V8F32 vfGain = AKSIMD_SET_V8F32(in_gain.fPrev * DENORMALIZEFACTORI16);
+		while (uCurrentStep < uSteps)
+		{
+			AKSIMD_V8F32 vfDest = AKSIMD_MUL_V8F32(AKSIMD_LOAD_V8F32(pSrc), vfGain);
+			AKSIMD_STORE_V4I32((AKSIMD_V4I32*)pDest, TruncateAndPackAVX2(vfDest));
+
+			pSrc += VecWidth * 2;
+			pDest += VecWidth * 2;
+			uCurrentStep += 2;
+		}
+	}
+	else
+	{
+		AkRamp denormalizeGain = in_gain;
+		denormalizeGain.fPrev *= DENORMALIZEFACTORI16;
+		denormalizeGain.fNext *= DENORMALIZEFACTORI16;
+		BUILD_VOLUME_DELTA_VECTOR(vBaseVolumes, vBaseVolumesDelta, denormalizeGain, uFrames);
+
+		AKSIMD_V4F32 vVolumesDelta = AKSIMD_ADD_V4F32(vBaseVolumesDelta, vBaseVolumesDelta);
+		AKSIMD_V8F32 vVolumesDelta8 = AKSIMD_SET_V2F128(vVolumesDelta, vVolumesDelta);
+
+		const AkUInt32 uSteps = uFrames / VecWidth;
+		AkUInt32 uCurrentChannel = 0;
+		while (uCurrentChannel < uChannelCount)
+		{
+			AkUInt32 uCurrentStep = 0;
+			AKSIMD_V8F32 vfGain = AKSIMD_SET_V2F128(vBaseVolumes, AKSIMD_ADD_V4F32(vBaseVolumes, vBaseVolumesDelta));
+
+			while (uCurrentStep < uSteps)
+			{
+				AKSIMD_V8F32 vfDest = AKSIMD_MUL_V8F32(AKSIMD_LOAD_V8F32(pSrc), vfGain);
+				AKSIMD_STORE_V4I32((AKSIMD_V4I32*)pDest, TruncateAndPackAVX2(vfDest));
+
+				pSrc += VecWidth * 2;
+				pDest += VecWidth * 2;
+				uCurrentStep += 2;
+
+				vfGain = AKSIMD_ADD_V8F32(vfGain, vVolumesDelta8);
+			}
+			uCurrentChannel++;
+		}
+	}
+}
+
+void ApplyGainN_AVX2(
+	AkAudioBuffer* in_pInputBuffer,
+	AkAudioBuffer* in_pOutputBuffer,
+	AkRamp in_gain)
+{
+	const AkUInt32 VecWidth = 4;
+
+	const AkUInt32 uChannelCount = in_pOutputBuffer->GetChannelConfig().uNumChannels;
+	const AkUInt32 uFrames = in_pInputBuffer->MaxFrames();
+	const AkUInt32 uSteps = uFrames / VecWidth;
+
+	if (in_gain.fPrev == in_gain.fNext)
+	{
+		// If there is no gain delta we have an easy codepath
+		AKSIMD_V8F32 vfGain = AKSIMD_SET_V8F32(in_gain.fPrev);
+		AkUInt32 uCurrentChannel = 0;
+		while (uCurrentChannel < uChannelCount)
+		{
+			AkUInt32 uCurrentStep = 0;
+			AkReal32* AK_RESTRICT pSrc = (AkReal32*)in_pInputBuffer->GetChannel(uCurrentChannel);
+			AkReal32* AK_RESTRICT pDest = (AkReal32*)in_pOutputBuffer->GetChannel(uCurrentChannel);
+
+			while (uCurrentStep < uSteps)
+			{
+				AKSIMD_STORE_V8F32(pDest, AKSIMD_MUL_V8F32(AKSIMD_LOAD_V8F32(pSrc), vfGain));
+
+				pSrc += VecWidth * 2;
+				pDest += VecWidth * 2;
+				uCurrentStep += 2;
+			}
+			uCurrentChannel++;
+		}
+	}
+	else
+	{
+		BUILD_VOLUME_DELTA_VECTOR(vBaseVolumes, vBaseVolumesDelta, in_gain, uFrames);
+
+		AKSIMD_V4F32 vVolumesDelta = AKSIMD_ADD_V4F32(vBaseVolumesDelta, vBaseVolumesDelta);
+		AKSIMD_V8F32 vVolumesDelta8 = AKSIMD_SET_V2F128(vVolumesDelta, vVolumesDelta);
+
+		AkUInt32 uCurrentChannel = 0;
+		while (uCurrentChannel < uChannelCount)
+		{
+			AkUInt32 uCurrentStep = 0;
+			AKSIMD_V8F32 vfGain = AKSIMD_SET_V2F128(vBaseVolumes, AKSIMD_ADD_V4F32(vBaseVolumes, vBaseVolumesDelta));
+
+			AkReal32* AK_RESTRICT pSrc = (AkReal32*)in_pInputBuffer->GetChannel(uCurrentChannel);
+			AkReal32* AK_RESTRICT pDest = (AkReal32*)in_pOutputBuffer->GetChannel(uCurrentChannel);
+
+			while (uCurrentStep < uSteps)
+			{
+				AKSIMD_STORE_V8F32(pDest, AKSIMD_MUL_V8F32(AKSIMD_LOAD_V8F32(pSrc), vfGain));
+
+				pSrc += VecWidth * 2;
+				pDest += VecWidth * 2;
+				uCurrentStep += 2;
+
+				vfGain = AKSIMD_ADD_V8F32(vfGain, vVolumesDelta8);
+			}
+			uCurrentChannel++;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// Assumes in_uNumSamples % 8 == 0
+void MixChannel_AVX2(
+	AkReal32*	in_pSourceData,
+	AkReal32*	in_pDestData,
+	AkReal32	in_fVolume,
+	AkReal32	in_fVolumeDelta,
+	AkUInt32	in_uNumSamples
+)
+{
+	AkReal32* AK_RESTRICT pSourceData = in_pSourceData;
+	AkReal32* AK_RESTRICT pDestData = in_pDestData;
+	AkReal32* AK_RESTRICT pSourceEnd = pSourceData + in_uNumSamples;
+
+	if (in_fVolumeDelta == 0.0f)
+	{
+		if (in_fVolume == 0.0f)
+		{
+			//everything is done over a previous cleared buffer, so if volume=0 we have nothing to do
+			return;
+		}
+
+		AKASSERT(!(in_uNumSamples % 8));
+		BUILD_VOLUME_VECTOR(vVolumes, in_fVolume, 0.0f);
+		AKSIMD_V8F32 vVolumes8 = AKSIMD_SET_V2F128(vVolumes, vVolumes);
+		do
+		{
+			AKSIMD_V8F32 vSum = AKSIMD_MUL_V8F32(AKSIMD_LOAD_V8F32(pSourceData), vVolumes8);
+			pSourceData += ulVectorSize;
+
+			AKSIMD_STORE_V8F32(pDestData, AKSIMD_ADD_V8F32(AKSIMD_LOAD_V8F32(pDestData), vSum));
+			pDestData += ulVectorSize;
+		} while (pSourceData < pSourceEnd);
+	}
+	else // has volume delta
+	{
+		AKASSERT(!(in_uNumSamples % 8));
+		AkReal32 fVolumesDelta = in_fVolumeDelta * 4;
+		AKSIMD_V4F32 vVolumesDelta = AKSIMD_LOAD1_V4F32(fVolumesDelta);
+
+		BUILD_VOLUME_VECTOR(vVolumes, in_fVolume, in_fVolumeDelta);
+		AKSIMD_V8F32 vVolumes8 = AKSIMD_SET_V2F128(vVolumes, AKSIMD_ADD_V4F32(vVolumes, vVolumesDelta));
+
+		vVolumesDelta = AKSIMD_ADD_V4F32(vVolumesDelta, vVolumesDelta);
+		AKSIMD_V8F32 vVolumesDelta8 = AKSIMD_SET_V2F128(vVolumesDelta, vVolumesDelta);
+
+		do
+		{
+			AKSIMD_V8F32 vSum = AKSIMD_MUL_V8F32(AKSIMD_LOAD_V8F32(pSourceData), vVolumes8);
+			pSourceData += ulVectorSize;
+
+			AKSIMD_STORE_V8F32(pDestData, AKSIMD_ADD_V8F32(AKSIMD_LOAD_V8F32(pDestData), vSum));
+			pDestData += ulVectorSize;
+
+			vVolumes8 = AKSIMD_ADD_V8F32(vVolumes8, vVolumesDelta8);
+		} while (pSourceData < pSourceEnd);
+	}
+}
@@ -612,3 +612,355 @@ AKRESULT Fixed_I16_NChanAVX2(AkAudioBuffer * io_pInBuffer,
 	PITCH_SAVE_NEXT_I16_NCHAN(uIndexFP);
 	PITCH_FIXED_DSP_TEARDOWN(uIndexFP);
 }
+
+/********************* INTERPOLATING RESAMPLING DSP ROUTINES **********************/
+
+// The interpolating routines below produce exactly the same output as their scalar counterparts:
+// the frame skip ramp and the fixed-point index are computed with the same integer operations, 8 frames at a time.
+static_assert(PITCHRAMPLENGTH == (1 << 10), "Interpolating AVX2 routines divide by PITCHRAMPLENGTH with a shift");
+
+// Computes the fixed-point input index of the next 8 output frames (see RESAMPLING_FACTOR_INTERPOLATE() and FP_INDEX_ADVANCE()).
+// Returns the index and frame skip that follow the 8th frame, without updating the state.
+static AkForceInline AKSIMD_V8I32 InterpolatingIndexFPAVX2(	AkUInt32 in_uIndexFP,
+															AkUInt32 in_uRampCount,
+															AkUInt32 in_uRampInc,
+															AkInt32 in_iScaledStartFrameSkip,
+															AkInt32 in_iFrameSkipDiff,
+															AkUInt32 & out_uNextIndexFP,
+															AkUInt32 & out_uNextFrameSkipFP )
+{
+	// Frame skips applied after each of the 8 frames; ramp counts are (uRampCount + k*uRampInc), k in [1,8]
+	AKSIMD_V8I32 viRampCount = AKSIMD_ADD_V8I32(
+		AKSIMD_SET_V8I32(in_uRampCount),
+		AKSIMD_MULLO_V8I32(AKSIMD_SET_V8I32(in_uRampInc), AKSIMD_SETV_V8I32(8, 7, 6, 5, 4, 3, 2, 1)));
+	AKSIMD_V8I32 viFrameSkipFP = AKSIMD_SHIFTRIGHT_V8I32(
+		AKSIMD_ADD_V8I32(AKSIMD_SET_V8I32(in_iScaledStartFrameSkip), AKSIMD_MULLO_V8I32(AKSIMD_SET_V8I32(in_iFrameSkipDiff), viRampCount)),
+		10);
+
+	// Inclusive prefix sum of the frame skips: within each 128-bit lane, then carry the low lane's total into the high lane
+	AKSIMD_V8I32 viSkipSum = AKSIMD_ADD_V8I32(viFrameSkipFP, AKSIMD_SHIFTLEFTBYTES_V8I32(viFrameSkipFP, 4));
+	viSkipSum = AKSIMD_ADD_V8I32(viSkipSum, AKSIMD_SHIFTLEFTBYTES_V8I32(viSkipSum, 8));
+	AKSIMD_V8I32 viLowLaneSum = AKSIMD_PERMUTE_2X128_V8I32(viSkipSum, viSkipSum, 0x08); // ( B A ) -> ( A 0 )
+	viSkipSum = AKSIMD_ADD_V8I32(viSkipSum, AKSIMD_SPLAT_V8I32(viLowLaneSum, 3));
+
+	out_uNextIndexFP = in_uIndexFP + (AkUInt32)AKSIMD_EXTRACT_V8I32(viSkipSum, 7);
+	out_uNextFrameSkipFP = (AkUInt32)AKSIMD_EXTRACT_V8I32(viFrameSkipFP, 7);
+
+	// Frame k is read before its own frame skip is applied
+	return AKSIMD_SUB_V8I32(AKSIMD_ADD_V8I32(AKSIMD_SET_V8I32(in_uIndexFP), viSkipSum), viFrameSkipFP);
+}
+
+// Same as LINEAR_INTERP_I16(), for 8 frames.
+static AkForceInline AKSIMD_V8F32 LinearInterpI16AVX2( AKSIMD_V8I32 in_viPrevious, AKSIMD_V8I32 in_viNext, AKSIMD_V8I32 in_viInterpLocFP )
+{
+	AKSIMD_V8I32 viDiff = AKSIMD_SUB_V8I32(in_viNext, in_viPrevious);
+	AKSIMD_V8I32 viInterp = AKSIMD_ADD_V8I32(AKSIMD_SHIFTLEFT_V8I32(in_viPrevious, FPBITS), AKSIMD_MULLO_V8I32(viDiff, in_viInterpLocFP));
+	return AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32_TO_V8F32(viInterp), AKSIMD_SET_V8F32(NORMALIZEFACTORI16 / FPMUL));
+}
+
+// Same as LINEAR_INTERP_NATIVE(), for 8 frames.
+static AkForceInline AKSIMD_V8F32 LinearInterpNativeAVX2( AKSIMD_V8F32 in_vfPrevious, AKSIMD_V8F32 in_vfNext, AKSIMD_V8I32 in_viInterpLocFP )
+{
+	static const AkReal32 fScale = 1.f / SINGLEFRAMEDISTANCE;
+	AKSIMD_V8F32 vfDiff = AKSIMD_SUB_V8F32(in_vfNext, in_vfPrevious);
+	AKSIMD_V8F32 vfInterpLoc = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32_TO_V8F32(in_viInterpLocFP), AKSIMD_SET_V8F32(fScale));
+	return AKSIMD_ADD_V8F32(in_vfPrevious, AKSIMD_MUL_V8F32(vfInterpLoc, vfDiff));
+}
+
+// Runs the 8-frame loop of the interpolating routines. __PROCESS8__ is a statement that produces 8 output frames
+// from aPreviousFrameIndex and viInterpLocFP, and advances pfOutBuf.
+#define PITCH_INTERPOLATING_AVX2_LOOP( __PROCESS8__ ) \
+	while ( uIterFrames >= 8 ) \
+	{ \
+		AkUInt32 uNextIndexFP, uNextFrameSkipFP; \
+		AKSIMD_V8I32 viIndexFP = InterpolatingIndexFPAVX2( uIndexFP, uRampCount, uRampInc, iScaledStartFrameSkip, iFrameSkipDiff, uNextIndexFP, uNextFrameSkipFP ); \
+		/* Leave the last frames to the scalar loop if the 8th frame would go past the input buffer */ \
+		if ( ( ( uNextIndexFP - uNextFrameSkipFP ) >> FPBITS ) > uLastValidPreviousIndex ) \
+			break; \
+		AkUInt32 aPreviousFrameIndex[8]; \
+		AKSIMD_STORE_V8I32( (AKSIMD_V8I32*)aPreviousFrameIndex, AKSIMD_SHIFTRIGHT_V8I32( viIndexFP, FPBITS ) ); \
+		AKSIMD_V8I32 viInterpLocFP = AKSIMD_AND_V8I32( viIndexFP, AKSIMD_SET_V8I32( FPMASK ) ); \
+		__PROCESS8__ \
+		uIndexFP = uNextIndexFP; \
+		uFrameSkipFP = uNextFrameSkipFP; \
+		uRampCount += 8 * uRampInc; \
+		uIterFrames -= 8; \
+	} \
+	uPreviousFrameIndex = uIndexFP >> FPBITS; \
+	uInterpLocFP = uIndexFP & FPMASK;
+
+// Interpolating resampling (pitch changes) with INTERLEAVED signed 16-bit samples, optimized for one channel signals.
+AKRESULT Interpolating_I16_1ChanAVX2(	AkAudioBuffer * io_pInBuffer,
+										AkAudioBuffer * io_pOutBuffer,
+										AkUInt32 uRequestedSize,
+										AkInternalPitchState * io_pPitchState )
+{
+	PITCH_INTERPOLATING_DSP_SETUP( );
+	
+	// Minus one to compensate for offset of 1 due to zero == previous
+	AkInt16 * AK_RESTRICT pInBuf = (AkInt16 * AK_RESTRICT) io_pInBuffer->GetInterleavedData( ) + io_pPitchState->uInFrameOffset - 1; 
+	AkReal32 * AK_RESTRICT pfOutBuf = (AkReal32 * AK_RESTRICT) io_pOutBuffer->GetChannel( 0 ) + io_pPitchState->uOutFrameOffset;
+	const AkReal32 * pfOutBufStart = pfOutBuf;
+	const AkReal32 * pfOutBufEnd = pfOutBuf + uOutBufferFrames;
+
+	PITCH_INTERPOLATION_SETUP( );
+
+	// Use stored value as left value, while right index is on the first sample
+	AkInt16 iPreviousFrame = *io_pPitchState->iLastValue;
+	AkUInt32 uMaxNumIter = (AkUInt32) (pfOutBufEnd - pfOutBuf);		// Not more than output frames
+	uMaxNumIter = AkMin( uMaxNumIter, (PITCHRAMPLENGTH-uRampCount)/uRampInc );	// Not longer than interpolation ramp length
+	while ( uPreviousFrameIndex == 0 && uMaxNumIter-- )
+	{
+		AkInt32 iSampleDiff = pInBuf[1] - iPreviousFrame;
+		*pfOutBuf++ = LINEAR_INTERP_I16( iPreviousFrame, iSampleDiff );	
+		RESAMPLING_FACTOR_INTERPOLATE();
+		FP_INDEX_ADVANCE();
+	}
+
+	FP_INDEX_ADVANCE_COMPILER_PATCH();
+
+	// For all other sample frames that need interpolation
+	const AkUInt32 uLastValidPreviousIndex = uInBufferFrames-1;
+	AkUInt32 uIterFrames = (AkUInt32) (pfOutBufEnd - pfOutBuf);			// No more than the output buffer length
+	uIterFrames = AkMin( uIterFrames, (PITCHRAMPLENGTH-uRampCount)/uRampInc );	// No more than the interpolation ramp length
+
+	PITCH_INTERPOLATING_AVX2_LOOP(
+	{
+		// Each 32-bit load gets the previous frame in its low half and the next one in its high half
+		AKSIMD_V8I32 viFrames = AKSIMD_GATHER_EPI32( pInBuf, [&aPreviousFrameIndex](int i) { return aPreviousFrameIndex[i]; } );
+		AKSIMD_V8I32 viPrevious = AKSIMD_SHIFTRIGHTARITH_V8I32( AKSIMD_SHIFTLEFT_V8I32( viFrames, 16 ), 16 );
+		AKSIMD_V8I32 viNext = AKSIMD_SHIFTRIGHTARITH_V8I32( viFrames, 16 );
+		AKSIMD_STORE_V8F32( pfOutBuf, LinearInterpI16AVX2( viPrevious, viNext, viInterpLocFP ) );
+		pfOutBuf += 8;
+	} );
+
+	while ( uPreviousFrameIndex <= uLastValidPreviousIndex && uIterFrames-- )
+	{
+		iPreviousFrame = pInBuf[uPreviousFrameIndex];
+		AkInt32 iSampleDiff = pInBuf[uPreviousFrameIndex+1] - iPreviousFrame;	
+		*pfOutBuf++ = LINEAR_INTERP_I16( iPreviousFrame, iSampleDiff );
+		RESAMPLING_FACTOR_INTERPOLATE();	
+		FP_INDEX_ADVANCE();
+	}
+
+	FP_INDEX_ADVANCE_COMPILER_PATCH();
+
+	PITCH_INTERPOLATION_TEARDOWN( );
+	PITCH_SAVE_NEXT_I16_1CHAN();
+	AkUInt32 uFramesProduced = (AkUInt32)(pfOutBuf - pfOutBufStart);
+	PITCH_INTERPOLATING_DSP_TEARDOWN( uIndexFP );
+}
+
+// Interpolating resampling (pitch changes) with INTERLEAVED signed 16-bit samples optimized for 2 channel signals.
+AKRESULT Interpolating_I16_2ChanAVX2(	AkAudioBuffer * io_pInBuffer,
+										AkAudioBuffer * io_pOutBuffer,
+										AkUInt32 uRequestedSize,
+										AkInternalPitchState * io_pPitchState )
+{
+	PITCH_INTERPOLATING_DSP_SETUP( );
+	AkUInt32 uMaxFrames = io_pOutBuffer->MaxFrames();
+
+	// Minus one to compensate for offset of 1 due to zero == previous
+	AkInt16 * AK_RESTRICT pInBuf = (AkInt16 * AK_RESTRICT) io_pInBuffer->GetInterleavedData() + 2*io_pPitchState->uInFrameOffset - 2; 
+	AkReal32 * AK_RESTRICT pfOutBuf = (AkReal32 * AK_RESTRICT) io_pOutBuffer->GetChannel( 0 ) + io_pPitchState->uOutFrameOffset;
+	const AkReal32 * pfOutBufStart = pfOutBuf;
+	const AkReal32 * pfOutBufEnd = pfOutBuf + uOutBufferFrames;
+
+	PITCH_INTERPOLATION_SETUP( );
+
+	// Use stored value as left value, while right index is on the first sample
+	AkInt16 iPreviousFrameL = io_pPitchState->iLastValue[0];
+	AkInt16 iPreviousFrameR = io_pPitchState->iLastValue[1];
+	AkUInt32 uMaxNumIter = (AkUInt32) (pfOutBufEnd - pfOutBuf);		// Not more than output frames
+	uMaxNumIter = AkMin( uMaxNumIter, (PITCHRAMPLENGTH-uRampCount)/uRampInc );	// Not longer than interpolation ramp length
+	while ( uPreviousFrameIndex == 0 && uMaxNumIter-- )
+	{
+		AkInt32 iSampleDiffL = pInBuf[2] - iPreviousFrameL;
+		AkInt32 iSampleDiffR = pInBuf[3] - iPreviousFrameR;
+		*pfOutBuf = LINEAR_INTERP_I16( iPreviousFrameL, iSampleDiffL );
+		pfOutBuf[uMaxFrames] = LINEAR_INTERP_I16( iPreviousFrameR, iSampleDiffR );
+		++pfOutBuf;
+		RESAMPLING_FACTOR_INTERPOLATE();
+		FP_INDEX_ADVANCE();
+	}
+
+	FP_INDEX_ADVANCE_COMPILER_PATCH();
+
+	// For all other sample frames that need interpolation
+	const AkUInt32 uLastValidPreviousIndex = uInBufferFrames-1;
+	AkUInt32 uIterFrames = (AkUInt32) (pfOutBufEnd - pfOutBuf);
+	uIterFrames = AkMin( uIterFrames, (PITCHRAMPLENGTH-uRampCount)/uRampInc );	// No more than the interpolation ramp length
+
+	PITCH_INTERPOLATING_AVX2_LOOP(
+	{
+		// Each 32-bit load gets both channels of a frame
+		AKSIMD_V8I32 viPreviousLR = AKSIMD_GATHER_EPI32( pInBuf, [&aPreviousFrameIndex](int i) { return 2 * aPreviousFrameIndex[i]; } );
+		AKSIMD_V8I32 viNextLR = AKSIMD_GATHER_EPI32( pInBuf, [&aPreviousFrameIndex](int i) { return 2 * aPreviousFrameIndex[i] + 2; } );
+		AKSIMD_V8I32 viPreviousL = AKSIMD_SHIFTRIGHTARITH_V8I32( AKSIMD_SHIFTLEFT_V8I32( viPreviousLR, 16 ), 16 );
+		AKSIMD_V8I32 viNextL = AKSIMD_SHIFTRIGHTARITH_V8I32( AKSIMD_SHIFTLEFT_V8I32( viNextLR, 16 ), 16 );
+		AKSIMD_V8I32 viPreviousR = AKSIMD_SHIFTRIGHTARITH_V8I32( viPreviousLR, 16 );
+		AKSIMD_V8I32 viNextR = AKSIMD_SHIFTRIGHTARITH_V8I32( viNextLR, 16 );
+		AKSIMD_STORE_V8F32( pfOutBuf, LinearInterpI16AVX2( viPreviousL, viNextL, viInterpLocFP ) );
+		AKSIMD_STORE_V8F32( pfOutBuf + uMaxFrames, LinearInterpI16AVX2( viPreviousR, viNextR, viInterpLocFP ) );
+		pfOutBuf += 8;
+	} );
+
+	while ( uPreviousFrameIndex <= uLastValidPreviousIndex && uIterFrames-- )
+	{
+		AkUInt32 uPreviousFrameSamplePosL = uPreviousFrameIndex*2;
+		iPreviousFrameL = pInBuf[uPreviousFrameSamplePosL];
+		iPreviousFrameR = pInBuf[uPreviousFrameSamplePosL+1];
+		AkInt32 iSampleDiffL = pInBuf[uPreviousFrameSamplePosL+2] - iPreviousFrameL;
+		AkInt32 iSampleDiffR = pInBuf[uPreviousFrameSamplePosL+3] - iPreviousFrameR;
+		*pfOutBuf = LINEAR_INTERP_I16( iPreviousFrameL, iSampleDiffL );
+		pfOutBuf[uMaxFrames] = LINEAR_INTERP_I16( iPreviousFrameR, iSampleDiffR );
+		++pfOutBuf;
+		RESAMPLING_FACTOR_INTERPOLATE();
+		FP_INDEX_ADVANCE();
+	}
+
+	FP_INDEX_ADVANCE_COMPILER_PATCH();
+
+	PITCH_INTERPOLATION_TEARDOWN( );
+	PITCH_SAVE_NEXT_I16_2CHAN();
+	AkUInt32 uFramesProduced = (AkUInt32)(pfOutBuf - pfOutBufStart);
+	PITCH_INTERPOLATING_DSP_TEARDOWN( uIndexFP );
+}
+
+// Interpolating resampling (pitch changes) with DEINTERLEAVED floating point samples optimized for one channel signals.
+AKRESULT Interpolating_Native_1ChanAVX2(	AkAudioBuffer * io_pInBuffer,
+											AkAudioBuffer * io_pOutBuffer,
+											AkUInt32 uRequestedSize,
+											AkInternalPitchState * io_pPitchState )
+{
+	PITCH_INTERPOLATING_DSP_SETUP( );
+
+	// Minus one to compensate for offset of 1 due to zero == previous
+	AkReal32 * AK_RESTRICT pInBuf = (AkReal32 * AK_RESTRICT) io_pInBuffer->GetChannel( 0 ) + io_pPitchState->uInFrameOffset - 1; 
+	AkReal32 * AK_RESTRICT pfOutBuf = (AkReal32 * AK_RESTRICT) io_pOutBuffer->GetChannel( 0 ) + io_pPitchState->uOutFrameOffset;
+	const AkReal32 * pfOutBufStart = pfOutBuf;
+	const AkReal32 * pfOutBufEnd = pfOutBuf + uOutBufferFrames;
+
+	PITCH_INTERPOLATION_SETUP( );
+
+	// Use stored value as left value, while right index is on the first sample
+	static const AkReal32 fScale = 1.f / SINGLEFRAMEDISTANCE;
+	AkReal32 fLeftSample = *io_pPitchState->fLastValue;
+	AkUInt32 uMaxNumIter = (AkUInt32) (pfOutBufEnd - pfOutBuf);		// Not more than output frames
+	uMaxNumIter = AkMin( uMaxNumIter, (PITCHRAMPLENGTH-uRampCount)/uRampInc );	// Not longer than interpolation ramp length
+	while ( uPreviousFrameIndex == 0 && uMaxNumIter-- )
+	{
+		AkReal32 fSampleDiff = pInBuf[1] - fLeftSample;
+		*pfOutBuf++ = LINEAR_INTERP_NATIVE( fLeftSample, fSampleDiff );
+		RESAMPLING_FACTOR_INTERPOLATE();
+		FP_INDEX_ADVANCE();
+	}
+
+	FP_INDEX_ADVANCE_COMPILER_PATCH();
+
+	// For all other sample frames that need interpolation
+	const AkUInt32 uLastValidPreviousIndex = uInBufferFrames-1;
+	AkUInt32 uIterFrames = (AkUInt32) (pfOutBufEnd - pfOutBuf);
+	uIterFrames = AkMin( uIterFrames, (PITCHRAMPLENGTH-uRampCount)/uRampInc );	// No more than the interpolation ramp length
+
+	PITCH_INTERPOLATING_AVX2_LOOP(
+	{
+		AKSIMD_V8F32 vfPrevious = AKSIMD_CAST_V8I32_TO_V8F32( AKSIMD_GATHER_EPI32( pInBuf, [&aPreviousFrameIndex](int i) { return aPreviousFrameIndex[i]; } ) );
+		AKSIMD_V8F32 vfNext = AKSIMD_CAST_V8I32_TO_V8F32( AKSIMD_GATHER_EPI32( pInBuf, [&aPreviousFrameIndex](int i) { return aPreviousFrameIndex[i] + 1; } ) );
+		AKSIMD_STORE_V8F32( pfOutBuf, LinearInterpNativeAVX2( vfPrevious, vfNext, viInterpLocFP ) );
+		pfOutBuf += 8;
+	} );
+
+	while ( uPreviousFrameIndex <= uLastValidPreviousIndex && uIterFrames-- )
+	{
+		fLeftSample = pInBuf[uPreviousFrameIndex];
+		AkReal32 fSampleDiff = pInBuf[uPreviousFrameIndex+1] - fLeftSample;
+		*pfOutBuf++ = LINEAR_INTERP_NATIVE( fLeftSample, fSampleDiff );
+		RESAMPLING_FACTOR_INTERPOLATE();
+		FP_INDEX_ADVANCE();
+	}
+
+	FP_INDEX_ADVANCE_COMPILER_PATCH();
+
+	PITCH_INTERPOLATION_TEARDOWN( );
+	PITCH_SAVE_NEXT_NATIVE_1CHAN();
+	AkUInt32 uFramesProduced = (AkUInt32)(pfOutBuf - pfOutBufStart);
+	PITCH_INTERPOLATING_DSP_TEARDOWN( uIndexFP );
+}
+
+//  Interpolating resampling (pitch changes) with DEINTERLEAVED floating point samples optimized for 2 channel signals.
+AKRESULT Interpolating_Native_2ChanAVX2(	AkAudioBuffer * io_pInBuffer,
+											AkAudioBuffer * io_pOutBuffer,
+											AkUInt32 uRequestedSize,
+											AkInternalPitchState * io_pPitchState )
+{
+	PITCH_INTERPOLATING_DSP_SETUP( );
+	AkUInt32 uMaxFramesIn = io_pInBuffer->MaxFrames();
+	AkUInt32 uMaxFramesOut = io_pOutBuffer->MaxFrames();
+
+	// Minus one to compensate for offset of 1 due to zero == previous
+	AkReal32 * AK_RESTRICT pInBuf = (AkReal32 * AK_RESTRICT) io_pInBuffer->GetChannel( 0 ) + io_pPitchState->uInFrameOffset - 1; 
+	AkReal32 * AK_RESTRICT pfOutBuf = (AkReal32 * AK_RESTRICT) io_pOutBuffer->GetChannel( 0 ) + io_pPitchState->uOutFrameOffset;
+	const AkReal32 * pfOutBufStart = pfOutBuf;
+	const AkReal32 * pfOutBufEnd = pfOutBuf + uOutBufferFrames;
+
+	PITCH_INTERPOLATION_SETUP( );
+
+	// Use stored value as left value, while right index is on the first sample
+	AkReal32 fPreviousFrameL = io_pPitchState->fLastValue[0];
+	AkReal32 fPreviousFrameR = io_pPitchState->fLastValue[1];
+	static const AkReal32 fScale = 1.f / SINGLEFRAMEDISTANCE;
+	AkUInt32 uMaxNumIter = (AkUInt32) (pfOutBufEnd - pfOutBuf);		// Not more than output frames
+	uMaxNumIter = AkMin( uMaxNumIter, (PITCHRAMPLENGTH-uRampCount)/uRampInc );	// Not longer than interpolation ramp length
+	while ( uPreviousFrameIndex == 0 && uMaxNumIter-- )
+	{
+		AkReal32 fSampleDiffL = pInBuf[1] - fPreviousFrameL;
+		AkReal32 fSampleDiffR = pInBuf[1+uMaxFramesIn] - fPreviousFrameR;
+		*pfOutBuf = LINEAR_INTERP_NATIVE( fPreviousFrameL, fSampleDiffL );
+		pfOutBuf[uMaxFramesOut] = LINEAR_INTERP_NATIVE( fPreviousFrameR, fSampleDiffR );
+		++pfOutBuf;
+		RESAMPLING_FACTOR_INTERPOLATE();
+		FP_INDEX_ADVANCE();
+	}
+
+	FP_INDEX_ADVANCE_COMPILER_PATCH();
+
+	// For all other sample frames that need interpolation
+	const AkUInt32 uLastValidPreviousIndex = uInBufferFrames-1;
+	AkUInt32 uIterFrames = (AkUInt32) (pfOutBufEnd - pfOutBuf);
+	uIterFrames = AkMin( uIterFrames, (PITCHRAMPLENGTH-uRampCount)/uRampInc );	// No more than the interpolation ramp length
+
+	const AkReal32 * AK_RESTRICT pInBufR = pInBuf + uMaxFramesIn;
+	PITCH_INTERPOLATING_AVX2_LOOP(
+	{
+		AKSIMD_V8F32 vfPreviousL = AKSIMD_CAST_V8I32_TO_V8F32( AKSIMD_GATHER_EPI32( pInBuf, [&aPreviousFrameIndex](int i) { return aPreviousFrameIndex[i]; } ) );
+		AKSIMD_V8F32 vfNextL = AKSIMD_CAST_V8I32_TO_V8F32( AKSIMD_GATHER_EPI32( pInBuf, [&aPreviousFrameIndex](int i) { return aPreviousFrameIndex[i] + 1; } ) );
+		AKSIMD_V8F32 vfPreviousR = AKSIMD_CAST_V8I32_TO_V8F32( AKSIMD_GATHER_EPI32( pInBufR, [&aPreviousFrameIndex](int i) { return aPreviousFrameIndex[i]; } ) );
+		AKSIMD_V8F32 vfNextR = AKSIMD_CAST_V8I32_TO_V8F32( AKSIMD_GATHER_EPI32( pInBufR, [&aPreviousFrameIndex](int i) { return aPreviousFrameIndex[i] + 1; } ) );
+		AKSIMD_STORE_V8F32( pfOutBuf, LinearInterpNativeAVX2( vfPreviousL, vfNextL, viInterpLocFP ) );
+		AKSIMD_STORE_V8F32( pfOutBuf + uMaxFramesOut, LinearInterpNativeAVX2( vfPreviousR, vfNextR, viInterpLocFP ) );
+		pfOutBuf += 8;
+	} );
+
+	while ( uPreviousFrameIndex <= uLastValidPreviousIndex && uIterFrames-- )
+	{
+		// Linear interpolation and index advance
+		AkUInt32 uPreviousFrameR = uPreviousFrameIndex+uMaxFramesIn;
+		fPreviousFrameL = pInBuf[uPreviousFrameIndex];
+		AkReal32 fSampleDiffL = pInBuf[uPreviousFrameIndex+1] - fPreviousFrameL;
+		fPreviousFrameR = pInBuf[uPreviousFrameR];	
+		AkReal32 fSampleDiffR = pInBuf[uPreviousFrameR+1] - fPreviousFrameR;	
+		*pfOutBuf = LINEAR_INTERP_NATIVE( fPreviousFrameL, fSampleDiffL );
+		pfOutBuf[uMaxFramesOut] = LINEAR_INTERP_NATIVE( fPreviousFrameR, fSampleDiffR );
+		++pfOutBuf;
+		RESAMPLING_FACTOR_INTERPOLATE();
+		FP_INDEX_ADVANCE();
+	}
+
+	FP_INDEX_ADVANCE_COMPILER_PATCH();
+
+	PITCH_INTERPOLATION_TEARDOWN( );
+	PITCH_SAVE_NEXT_NATIVE_2CHAN();
+	AkUInt32 uFramesProduced = (AkUInt32)(pfOutBuf - pfOutBufStart);
+	PITCH_INTERPOLATING_DSP_TEARDOWN( uIndexFP );
+}
@@ -22,6 +22,7 @@
 #include "stdafx.h"
 #include "AkADPCMCodec.h"
 #include "AkFileParserBase.h"
+#include <AK/SoundEngine/Common/AkSimd.h>
 
 // This array is used by NextStepIndex to determine the next step index to use.  
 // The step index is an index to the m_asStep[] array, below.
@@ -151,6 +152,140 @@ bool CAkADPCMCodec::Decode(	unsigned char * pbSrc,
     return true;
 }
 
+// Decode all channels to 16 bit integer PCM
+void CAkADPCMCodec::DecodeAllChannels( unsigned char * pbSrc,
+									   unsigned char * pbDst,
+									   AkUInt32 cBlocks,
+									   AkUInt32 nChannels )
+{
+	// Channel blocks follow each other: channel block u is the block of channel u % nChannels
+	// in frame block u / nChannels.
+	AkUInt32 cChannelBlocks = cBlocks * nChannels;
+	AkUInt32 uBlock = 0;
+
+#ifdef AKSIMD_V4F32_SUPPORTED
+	for ( ; uBlock + 4 <= cChannelBlocks; uBlock += 4 )
+	{
+		unsigned char * apbSrc[4];
+		AkInt16 * apsDst[4];
+		for ( AkUInt32 uLane = 0; uLane < 4; ++uLane )
+		{
+			AkUInt32 uChannelBlock = uBlock + uLane;
+			apbSrc[uLane] = pbSrc + uChannelBlock * ADPCM_BLOCK_SIZE;
+			apsDst[uLane] = reinterpret_cast<AkInt16*>( pbDst )
+				+ ( uChannelBlock / nChannels ) * ADPCM_SAMPLES_PER_BLOCK * nChannels
+				+ uChannelBlock % nChannels;
+		}
+		DecodeLanes( apbSrc, apsDst, nChannels );
+	}
+#endif
+
+	for ( ; uBlock < cChannelBlocks; ++uBlock )
+	{
+		AkInt16 * psDst = reinterpret_cast<AkInt16*>( pbDst )
+			+ ( uBlock / nChannels ) * ADPCM_SAMPLES_PER_BLOCK * nChannels
+			+ uBlock % nChannels;
+		Decode( pbSrc + uBlock * ADPCM_BLOCK_SIZE, reinterpret_cast<unsigned char*>( psDst ), 1, ADPCM_BLOCK_SIZE * nChannels, nChannels );
+	}
+}
+
+#ifdef AKSIMD_V4F32_SUPPORTED
+// Multiplication, min and max of 32-bit lanes holding signed 16-bit values.
+#if defined( AK_CPU_ARM_NEON )
+#define AK_ADPCM_MUL16_V4I32( a, b ) vmulq_s32( a, b )
+#define AK_ADPCM_MIN16_V4I32( a, b ) vminq_s32( a, b )
+#define AK_ADPCM_MAX16_V4I32( a, b ) vmaxq_s32( a, b )
+#else
+#define AK_ADPCM_MUL16_V4I32( a, b ) _mm_madd_epi16( a, b )
+#define AK_ADPCM_MIN16_V4I32( a, b ) _mm_min_epi16( a, b )
+#define AK_ADPCM_MAX16_V4I32( a, b ) _mm_max_epi16( a, b )
+#endif
+
+// Same as Decode() for one block per lane. The step indices and the predicted samples are computed in the
+// SIMD lanes, and only the step size table lookups are done for each lane.
+void CAkADPCMCodec::DecodeLanes( unsigned char * const * in_ppbSrc, AkInt16 * const * in_ppsDst, AkUInt32 nChannels )
+{
+	const AkUInt32 cSamples = ADPCM_SAMPLES_PER_BLOCK - 1;
+	AK_ALIGN_SIMD( AkInt32 aEncSamples[cSamples + 1][4] );
+	AK_ALIGN_SIMD( AkInt32 aStepSizes[cSamples][4] );
+	AK_ALIGN_SIMD( AkInt32 aPredSamples[cSamples + 1][4] );
+	AK_ALIGN_SIMD( AkInt32 aStepIndices[4] );
+
+	// Block header, and encoded samples
+	for ( AkUInt32 uLane = 0; uLane < 4; ++uLane )
+	{
+		unsigned char *	pbBlock = in_ppbSrc[uLane];
+		aPredSamples[0][uLane] = *(AkInt16 *)pbBlock;
+		aStepIndices[uLane] = pbBlock[sizeof(AkInt16)];
+		pbBlock += 2 * sizeof(AkInt16);
+
+		// The high nibble of the last byte is padding.
+		for ( AkUInt32 uSample = 0; uSample < cSamples; uSample += 2 )
+		{
+			unsigned char bSample = *pbBlock++;
+			aEncSamples[uSample][uLane] = ( bSample & 0x0F );
+			aEncSamples[uSample + 1][uLane] = ( bSample >> 4 );
+		}
+	}
+
+	const AKSIMD_V4I32 vOne = AKSIMD_SET_V4I32( 1 );
+	const AKSIMD_V4I32 vSeven = AKSIMD_SET_V4I32( 7 );
+
+	// Step indices, as in NextStepIndex(). They are stored in place of the step sizes until looked up.
+	{
+		const AKSIMD_V4I32 vZero = AKSIMD_SETZERO_V4I32();
+		const AKSIMD_V4I32 vMaxStepIndex = AKSIMD_SET_V4I32( NUMSTEPINDVALMINUSONE );
+		AKSIMD_V4I32 vStepIndex = AKSIMD_LOAD_V4I32( (AKSIMD_V4I32*)aStepIndices );
+		for ( AkUInt32 uSample = 0; uSample < cSamples; ++uSample )
+		{
+			AKSIMD_STORE_V4I32( (AKSIMD_V4I32*)aStepSizes[uSample], vStepIndex );
+
+			// m_asNextStep[nEncSample] is 2*(nEncSample & 7)-6 when bit 2 is set, and -1 otherwise.
+			AKSIMD_V4I32 vEncSample = AKSIMD_LOAD_V4I32( (AKSIMD_V4I32*)aEncSamples[uSample] );
+			AKSIMD_V4I32 vBit2 = AKSIMD_SHIFTRIGHTARITH_V4I32( AKSIMD_SHIFTLEFT_V4I32( vEncSample, 29 ), 31 );
+			AKSIMD_V4I32 vNextStep = AKSIMD_SUB_V4I32( AKSIMD_SHIFTLEFT_V4I32( AKSIMD_AND_V4I32( vEncSample, vSeven ), 1 ), AKSIMD_SET_V4I32( 5 ) );
+			vNextStep = AKSIMD_SUB_V4I32( AKSIMD_AND_V4I32( vNextStep, vBit2 ), vOne );
+			vStepIndex = AKSIMD_ADD_V4I32( vStepIndex, vNextStep );
+			vStepIndex = AK_ADPCM_MIN16_V4I32( AK_ADPCM_MAX16_V4I32( vStepIndex, vZero ), vMaxStepIndex );
+		}
+	}
+
+	for ( AkUInt32 uSample = 0; uSample < cSamples; ++uSample )
+	{
+		for ( AkUInt32 uLane = 0; uLane < 4; ++uLane )
+			aStepSizes[uSample][uLane] = m_asStep[aStepSizes[uSample][uLane]];
+	}
+
+	AKSIMD_V4I32 vPredSample = AKSIMD_LOAD_V4I32( (AKSIMD_V4I32*)aPredSamples[0] );
+	for ( AkUInt32 uSample = 0; uSample < cSamples; ++uSample )
+	{
+		// Same as DecodeSample().
+		AKSIMD_V4I32 vEncSample = AKSIMD_LOAD_V4I32( (AKSIMD_V4I32*)aEncSamples[uSample] );
+		AKSIMD_V4I32 vStepSize = AKSIMD_LOAD_V4I32( (AKSIMD_V4I32*)aStepSizes[uSample] );
+		AKSIMD_V4I32 vFactor = AKSIMD_ADD_V4I32( AKSIMD_SHIFTLEFT_V4I32( AKSIMD_AND_V4I32( vEncSample, vSeven ), 1 ), vOne );
+		AKSIMD_V4I32 vDifference = AKSIMD_SHIFTRIGHTARITH_V4I32( AK_ADPCM_MUL16_V4I32( vFactor, vStepSize ), 3 );
+		AKSIMD_V4I32 vSign = AKSIMD_SHIFTRIGHTARITH_V4I32( AKSIMD_SHIFTLEFT_V4I32( vEncSample, 28 ), 31 );
+		vDifference = AKSIMD_SUB_V4I32( AKSIMD_XOR_V4I32( vDifference, vSign ), vSign );
+
+		// Clip to 16 bits by packing with saturation, then sign-extending back.
+		vPredSample = AKSIMD_ADD_V4I32( vPredSample, vDifference );
+		AKSIMD_V4I32 vPacked = AKSIMD_PACKS_V4I32( vPredSample, vPredSample );
+		vPredSample = AKSIMD_SHIFTRIGHTARITH_V4I32( AKSIMD_UNPACKLO_VECTOR8I16( vPacked, vPacked ), 16 );
+		AKSIMD_STORE_V4I32( (AKSIMD_V4I32*)aPredSamples[uSample + 1], vPredSample );
+	}
+
+	for ( AkUInt32 uLane = 0; uLane < 4; ++uLane )
+	{
+		AkInt16 * psDst = in_ppsDst[uLane];
+		for ( AkUInt32 uSample = 0; uSample < ADPCM_SAMPLES_PER_BLOCK; ++uSample )
+		{
+			*psDst = (AkInt16)aPredSamples[uSample][uLane];
+			psDst += nChannels;
+		}
+	}
+}
+#endif
+
 // Computes the next step index
 int CAkADPCMCodec::NextStepIndex(int nEncodedSample, int nStepIndex)
 {
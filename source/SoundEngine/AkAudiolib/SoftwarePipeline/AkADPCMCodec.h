@@ -43,6 +43,13 @@ public:
 							AkUInt32 nBlockAlignment,
 							AkUInt32 nChannels );
 
+	// Decodes cBlocks blocks of all nChannels channels. Channel blocks are independent, so they are
+	// decoded 4 at a time in SIMD lanes where available.
+	static void DecodeAllChannels( unsigned char * pbSrc,
+							unsigned char * pbDst,
+							AkUInt32 cBlocks,
+							AkUInt32 nChannels );
+
 private:
 	CAkADPCMCodec(); // class should not be instantiated
 
@@ -56,6 +63,11 @@ private:
 										int nPredictedSample, 
 										int nStepSize );
 
+#ifdef AKSIMD_V4F32_SUPPORTED
+	// Decodes one channel block in each of 4 lanes
+	static void DecodeLanes( unsigned char * const * in_ppbSrc, AkInt16 * const * in_ppsDst, AkUInt32 nChannels );
+#endif
+
 private:
 	static const AkInt32	m_asNextStep[16];           // Step increment array
 	static const AkInt32	m_asStep[89];               // Step value array
@@ -0,0 +1,169 @@
+/***********************************************************************
+  The content of this file includes source code for the sound engine
+  portion of the AUDIOKINETIC Wwise Technology and constitutes "Level
+  Two Source Code" as defined in the Source Code Addendum attached
+  with this file.  Any use of the Level Two Source Code shall be
+  subject to the terms and conditions outlined in the Source Code
+  Addendum and the End User License Agreement for Wwise(R).
+
+  Version:  Build:
+  Copyright (c) 2006-2019 Audiokinetic Inc.
+ ***********************************************************************/
+
+//////////////////////////////////////////////////////////////////////
+//
+// AkFloat16Buffer.cpp
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "AkFloat16Buffer.h"
+#include "AkRuntimeEnvironmentMgr.h"
+#include <AK/SoundEngine/Common/AkSimd.h>
+
+// Concatenates the 4 half-precision values held in the lower 64 bits of a and of b.
+#if defined( AK_CPU_ARM_NEON )
+#define AK_COMBINE_V4F16( a, b ) vcombine_s32( vget_low_s32( a ), vget_low_s32( b ) )
+#else
+#define AK_COMBINE_V4F16( a, b ) _mm_unpacklo_epi64( a, b )
+#endif
+
+static void ConvertFromReal32ToFloat16_V4F32(const AkReal32 * AK_RESTRICT in_pSrc, AkUInt16 * AK_RESTRICT out_pDst, AkUInt32 in_uNumSamples)
+{
+	const AkReal32 * AK_RESTRICT pSrcEnd = in_pSrc + (in_uNumSamples & ~7);
+	while (in_pSrc < pSrcEnd)
+	{
+		AKSIMD_V4I32 vLo = AKSIMD_CONVERT_V4F32_TO_V4F16(AKSIMD_LOADU_V4F32(in_pSrc));
+		AKSIMD_V4I32 vHi = AKSIMD_CONVERT_V4F32_TO_V4F16(AKSIMD_LOADU_V4F32(in_pSrc + 4));
+		AKSIMD_STOREU_V4I32((AKSIMD_V4I32*)out_pDst, AK_COMBINE_V4F16(vLo, vHi));
+		in_pSrc += 8;
+		out_pDst += 8;
+	}
+
+	// Remaining samples go through a zero-padded vector.
+	AkUInt32 uRemaining = in_uNumSamples & 7;
+	if (uRemaining)
+	{
+		AK_ALIGN_SIMD(AkReal32 aIn[8]) = { 0.f };
+		AK_ALIGN_SIMD(AkUInt16 aOut[8]);
+		for (AkUInt32 i = 0; i < uRemaining; ++i)
+			aIn[i] = in_pSrc[i];
+		ConvertFromReal32ToFloat16_V4F32(aIn, aOut, 8);
+		for (AkUInt32 i = 0; i < uRemaining; ++i)
+			out_pDst[i] = aOut[i];
+	}
+}
+
+static void ConvertFromFloat16ToReal32_V4F32(const AkUInt16 * AK_RESTRICT in_pSrc, AkReal32 * AK_RESTRICT out_pDst, AkUInt32 in_uNumSamples)
+{
+	const AkUInt16 * AK_RESTRICT pSrcEnd = in_pSrc + (in_uNumSamples & ~7);
+	while (in_pSrc < pSrcEnd)
+	{
+		AKSIMD_V4I32 vIn = AKSIMD_LOADU_V4I32((AKSIMD_V4I32*)in_pSrc);
+		AKSIMD_STOREU_V4F32(out_pDst, AKSIMD_CONVERT_V4F16_TO_V4F32_LO(vIn));
+		AKSIMD_STOREU_V4F32(out_pDst + 4, AKSIMD_CONVERT_V4F16_TO_V4F32_HI(vIn));
+		in_pSrc += 8;
+		out_pDst += 8;
+	}
+
+	AkUInt32 uRemaining = in_uNumSamples & 7;
+	if (uRemaining)
+	{
+		AK_ALIGN_SIMD(AkUInt16 aIn[8]) = { 0 };
+		AK_ALIGN_SIMD(AkReal32 aOut[8]);
+		for (AkUInt32 i = 0; i < uRemaining; ++i)
+			aIn[i] = in_pSrc[i];
+		ConvertFromFloat16ToReal32_V4F32(aIn, aOut, 8);
+		for (AkUInt32 i = 0; i < uRemaining; ++i)
+			out_pDst[i] = aOut[i];
+	}
+}
+
+namespace AkFloat16
+{
+
+typedef void(*ConvertFromReal32FuncPtr) (
+	const AkReal32 * AK_RESTRICT in_pSrc,
+	AkUInt16 * AK_RESTRICT out_pDst,
+	AkUInt32 in_uNumSamples);
+
+typedef void(*ConvertToReal32FuncPtr) (
+	const AkUInt16 * AK_RESTRICT in_pSrc,
+	AkReal32 * AK_RESTRICT out_pDst,
+	AkUInt32 in_uNumSamples);
+
+static ConvertFromReal32FuncPtr ConvertFromReal32Func = ConvertFromReal32ToFloat16_V4F32;
+static ConvertToReal32FuncPtr ConvertToReal32Func = ConvertFromFloat16ToReal32_V4F32;
+
+void InitConversionFunctTable()
+{
+	ConvertFromReal32Func = ConvertFromReal32ToFloat16_V4F32;
+	ConvertToReal32Func = ConvertFromFloat16ToReal32_V4F32;
+
+#if defined( AKSIMD_AVX2_SUPPORTED )
+	if (AK::AkRuntimeEnvironmentMgr::Instance()->GetSIMDSupport(AK::AK_SIMD_AVX2)
+		&& AK::AkRuntimeEnvironmentMgr::Instance()->GetSIMDSupport(AK::AK_SIMD_F16C))
+	{
+		ConvertFromReal32Func = ConvertFromReal32ToFloat16_AVX2;
+		ConvertToReal32Func = ConvertFromFloat16ToReal32_AVX2;
+	}
+#endif
+}
+
+void ConvertFromReal32(const AkReal32 * AK_RESTRICT in_pSrc, AkUInt16 * AK_RESTRICT out_pDst, AkUInt32 in_uNumSamples)
+{
+	ConvertFromReal32Func(in_pSrc, out_pDst, in_uNumSamples);
+}
+
+void ConvertToReal32(const AkUInt16 * AK_RESTRICT in_pSrc, AkReal32 * AK_RESTRICT out_pDst, AkUInt32 in_uNumSamples)
+{
+	ConvertToReal32Func(in_pSrc, out_pDst, in_uNumSamples);
+}
+
+} // namespace AkFloat16
+
+AKRESULT AkFloat16Buffer::Pack(AkAudioBuffer & in_buffer)
+{
+	AKASSERT(!m_pData);
+
+	AkUInt32 uNumChannels = in_buffer.NumChannels();
+	AkUInt16 uMaxFrames = in_buffer.MaxFrames();
+
+	// Two half-precision frames fit in each float frame of the storage, which has as many channels as in_buffer.
+	AkChannelConfig storageConfig;
+	storageConfig.SetAnonymous(uNumChannels);
+	m_storage.SetChannelConfig(storageConfig);
+	m_storage.SetRequestSize(uMaxFrames);
+	AKRESULT eResult = m_storage.GetCachedHalfBuffer();
+	if (eResult != AK_Success)
+		return eResult;
+	AKASSERT(m_storage.MaxFrames() * 2 >= uMaxFrames);
+
+	m_pData = (AkUInt16*)m_storage.GetContiguousDeinterleavedData();
+	m_channelConfig = in_buffer.GetChannelConfig();
+	m_uMaxFrames = uMaxFrames;
+	m_uValidFrames = in_buffer.uValidFrames;
+
+	for (AkUInt32 i = 0; i < uNumChannels; ++i)
+		AkFloat16::ConvertFromReal32(in_buffer.GetChannel(i), m_pData + i * uMaxFrames, m_uValidFrames);
+
+	return AK_Success;
+}
+
+void AkFloat16Buffer::Unpack(AkAudioBuffer & out_buffer) const
+{
+	AKASSERT(m_pData);
+	AKASSERT(out_buffer.NumChannels() == m_channelConfig.uNumChannels && out_buffer.MaxFrames() >= m_uMaxFrames);
+
+	for (AkUInt32 i = 0; i < m_channelConfig.uNumChannels; ++i)
+		AkFloat16::ConvertToReal32(m_pData + i * m_uMaxFrames, out_buffer.GetChannel(i), m_uValidFrames);
+
+	out_buffer.uValidFrames = m_uValidFrames;
+}
+
+void AkFloat16Buffer::ReleaseBuffer()
+{
+	AKASSERT(m_pData);
+	m_storage.ReleaseCachedHalfBuffer();
+	m_pData = NULL;
+}
@@ -0,0 +1,85 @@
+/***********************************************************************
+  The content of this file includes source code for the sound engine
+  portion of the AUDIOKINETIC Wwise Technology and constitutes "Level
+  Two Source Code" as defined in the Source Code Addendum attached
+  with this file.  Any use of the Level Two Source Code shall be
+  subject to the terms and conditions outlined in the Source Code
+  Addendum and the End User License Agreement for Wwise(R).
+
+  Version:  Build:
+  Copyright (c) 2006-2019 Audiokinetic Inc.
+ ***********************************************************************/
+
+//////////////////////////////////////////////////////////////////////
+//
+// AkFloat16Buffer.h
+//
+// Half-precision storage of pipeline buffers (see AkInitSettings::bFloat16VoiceBuffers).
+//
+//////////////////////////////////////////////////////////////////////
+#ifndef _AK_FLOAT16_BUFFER_H_
+#define _AK_FLOAT16_BUFFER_H_
+
+#include "AkCommon.h"
+
+namespace AkFloat16
+{
+	// Must be called at init to use the conversion functions
+	void InitConversionFunctTable();
+
+	// Round-to-nearest-even conversion of in_uNumSamples floats to half-precision.
+	void ConvertFromReal32(const AkReal32 * AK_RESTRICT in_pSrc, AkUInt16 * AK_RESTRICT out_pDst, AkUInt32 in_uNumSamples);
+
+	// Exact conversion of in_uNumSamples half-precision values to floats.
+	void ConvertToReal32(const AkUInt16 * AK_RESTRICT in_pSrc, AkReal32 * AK_RESTRICT out_pDst, AkUInt32 in_uNumSamples);
+}
+
+// 8-wide variants of the above, producing the same results. Runtime support for AVX2 and F16C must be checked before using them.
+#if defined( AKSIMD_AVX2_SUPPORTED )
+void ConvertFromReal32ToFloat16_AVX2(const AkReal32 * AK_RESTRICT in_pSrc, AkUInt16 * AK_RESTRICT out_pDst, AkUInt32 in_uNumSamples);
+void ConvertFromFloat16ToReal32_AVX2(const AkUInt16 * AK_RESTRICT in_pSrc, AkReal32 * AK_RESTRICT out_pDst, AkUInt32 in_uNumSamples);
+#endif
+
+//-----------------------------------------------------------------------------
+// Name: class AkFloat16Buffer
+// Desc: Half-precision copy of the valid frames of a deinterleaved buffer, with the same layout
+//       (channel i starts at i * MaxFrames()).
+//       Its memory comes from the pipeline buffer free lists (a buffer of half as many float frames, see
+//       GetCachedHalfBuffer), so, unlike scratch buffers, it may be released by another thread than the one that packed it.
+//-----------------------------------------------------------------------------
+class AkFloat16Buffer
+{
+public:
+	AkFloat16Buffer()
+		: m_pData(NULL)
+		, m_uMaxFrames(0)
+		, m_uValidFrames(0)
+	{}
+
+	~AkFloat16Buffer()
+	{
+		AKASSERT(!m_pData || !"Buffer must be released");
+	}
+
+	// Allocates storage and converts the valid frames of in_buffer.
+	AKRESULT Pack(AkAudioBuffer & in_buffer);
+
+	// Converts back into out_buffer, which must have the same channel configuration and at least MaxFrames() frames.
+	// Sets its valid frames.
+	void Unpack(AkAudioBuffer & out_buffer) const;
+
+	void ReleaseBuffer();
+
+	AkForceInline bool HasData() const { return m_pData != NULL; }
+	AkForceInline AkChannelConfig GetChannelConfig() const { return m_channelConfig; }
+	AkForceInline AkUInt16 MaxFrames() const { return m_uMaxFrames; }
+
+private:
+	AkPipelineBufferBase	m_storage;
+	AkUInt16 *				m_pData;
+	AkChannelConfig			m_channelConfig;
+	AkUInt16				m_uMaxFrames;
+	AkUInt16				m_uValidFrames;
+};
+
+#endif // _AK_FLOAT16_BUFFER_H_
@@ -49,6 +49,8 @@
 #include "AkPipelineID.h"
 #include "AkMonitor.h"
 #include "AkCustomPluginDataStore.h"
+#include "AkFloat16Buffer.h"
+#include "AkDecodedMediaCache.h"
 
 extern AkPlatformInitSettings g_PDSettings;
 extern AkInitSettings		g_settings;
@@ -57,6 +59,7 @@ AKRESULT CAkLEngine::SoftwareInit()
 {
 	CAkResampler::InitDSPFunctTable();
 	AkMixer::InitMixerFunctTable();
+	AkFloat16::InitConversionFunctTable();
 
 	// Check memory manager.
 	if ( !AK::MemoryMgr::IsInitialized() )
@@ -88,6 +91,14 @@ AKRESULT CAkLEngine::SoftwareInit()
 
 	eResult = CAkOutputMgr::Init();
 	if(eResult != AK_Success) return eResult;
+
+	AkDecodedMediaCache::Init();
+
+	// Scratch arenas: one per task scheduler worker, plus the audio thread. A thread holds at most two scratch buffers at once
+	// (a float16 unpack and the out-of-place copy of a mixer plug-in bus); they fit up to 7.1, wider ones use the buffer cache.
+	eResult = AkProcessingArenas::Init(
+		2 * LE_MAX_FRAMES_PER_BUFFER * 8 * sizeof(AkReal32),
+		g_settings.taskSchedulerDesc.fcnParallelFor ? g_settings.taskSchedulerDesc.uNumSchedulerWorkerThreads : 0);
 	
 	return eResult;
 }
@@ -101,37 +112,48 @@ void CAkLEngine::SoftwareTerm()
 	m_arrayVPLs.Term();
 	m_arrayVPLDepthCnt.Term();
 	m_arrayVPLDepthInterconnects.Term();
+	m_arrayGraphDependents.Term();
+	m_arrayGraphDependentsIdx.Term();
+	m_arrayGraphReady.Term();
+	m_arrayOutputPending.Term();
 	m_Sources.Term();
 
 	CAkEffectsMgr::Term();
 
 	AkCustomPluginDataStore::TermPluginCustomGameData();
 
+	AkProcessingArenas::Term();
+
+	AkDecodedMediaCache::Term();
+
 	TermPlatformContext();
 }
 
 AkAudioBuffer* CAkLEngine::TransferBuffer(AkVPL* in_pVPL)
 {
-	CAkVPLMixBusNode& mixBus = in_pVPL->m_MixBus;
-
 	// Get the resulting buffer for this bus
-	AkAudioBuffer* pBuffer = mixBus.GetResultingBuffer();
+	return PushBuffer(in_pVPL, in_pVPL->m_MixBus.GetResultingBuffer());
+}
+
+AkAudioBuffer* CAkLEngine::PushBuffer(AkVPL* in_pVPL, AkAudioBuffer* in_pBuffer)
+{
+	CAkVPLMixBusNode& mixBus = in_pVPL->m_MixBus;
 
 	// Add this buffer to the parent mix node
 	// Call ConsumeBuffer() even if no frames in order to keep bus alive.
 	if (mixBus.HasConnections())
 	{
-		return pBuffer;
+		return in_pBuffer;
 	}
 	else
 	{
-		if ( AK_EXPECT_FALSE( pBuffer->uValidFrames == 0 || !in_pVPL->IsTopLevelNode() ) )	// Do not push data to device if no frames ready.
+		if ( AK_EXPECT_FALSE( in_pBuffer->uValidFrames == 0 || !in_pVPL->IsTopLevelNode() ) )	// Do not push data to device if no frames ready.
 			return NULL;
 
 		// Push to device.
 		AkDevice* pDevice = CAkOutputMgr::FindDevice(in_pVPL->GetBusContext());
 		if(pDevice)
-			pDevice->PushData(pBuffer, mixBus.GetBaseVolume());
+			pDevice->PushData(in_pBuffer, mixBus.GetBaseVolume());
 	}
 	return NULL;
 }
@@ -152,6 +174,22 @@ CAkLEngine::AkArrayVPLSrcs CAkLEngine::m_Sources;
 CAkLEngine::AkArrayInt32   CAkLEngine::m_arrayVPLDepthCnt;
 CAkLEngine::AkArrayBool    CAkLEngine::m_arrayVPLDepthInterconnects;
 bool                       CAkLEngine::m_bVPLsHaveCycles = false;
+bool                       CAkLEngine::m_bVPLsSchedulable = true;
+CAkLEngine::AkArrayVPL     CAkLEngine::m_arrayGraphDependents;
+CAkLEngine::AkArrayInt32   CAkLEngine::m_arrayGraphDependentsIdx;
+CAkLEngine::AkArrayVPL     CAkLEngine::m_arrayGraphReady;
+AkUInt32                   CAkLEngine::m_uGraphNumVoices = 0;
+AkAtomic32                 CAkLEngine::m_iGraphNextVoice = 0;
+AkAtomic32                 CAkLEngine::m_iGraphReadyWrite = 0;
+AkAtomic32                 CAkLEngine::m_iGraphReadyRead = 0;
+AkAtomic32                 CAkLEngine::m_iGraphBussesLeft = 0;
+bool                       CAkLEngine::m_bPipelinedOutput = false;
+bool                       CAkLEngine::m_bGraphOutputStage = false;
+AkAtomic32                 CAkLEngine::m_iGraphOutputClaimed = 0;
+AkAtomic32                 CAkLEngine::m_iGraphOutputDone = 0;
+CAkLEngine::AkArrayVPL     CAkLEngine::m_arrayOutputPending;
+bool                       CAkLEngine::m_bOutputFxDone = false;
+bool                       CAkLEngine::m_bOutputFramePending = false;
 bool                       CAkLEngine::m_bVPLsDirty = false;
 bool                       CAkLEngine::m_bFullReevaluation = false;
 
@@ -1032,6 +1070,8 @@ void CAkLEngine::RefreshMonitoringMuteSolo()
 
 void CAkLEngine::StopMixBussesUsingThisSlot( const CAkUsageSlot* in_pSlot )
 {
+	FlushPendingOutput();
+
 	// Stop any bus currently using this slot.
 	for( AkArrayVPL::Iterator iterVPL = m_arrayVPLs.Begin(); iterVPL != m_arrayVPLs.End(); ++iterVPL )
 	{
@@ -1043,6 +1083,8 @@ void CAkLEngine::StopMixBussesUsingThisSlot( const CAkUsageSlot* in_pSlot )
 
 void CAkLEngine::ResetAllEffectsUsingThisMedia( const AkUInt8* in_pData )
 {
+	FlushPendingOutput();
+
 	// Stop any bus currently using this slot.
 	for( AkArrayVPL::Iterator iterVPL = m_arrayVPLs.Begin(); iterVPL != m_arrayVPLs.End(); ++iterVPL )
 	{
@@ -1053,6 +1095,8 @@ void CAkLEngine::ResetAllEffectsUsingThisMedia( const AkUInt8* in_pData )
 
 void CAkLEngine::UpdateMixBusFX( AkUniqueID in_MixBusID, AkUInt32 in_uFXIndex )
 {
+	FlushPendingOutput();
+
 	for( AkArrayVPL::Iterator iterVPL = m_arrayVPLs.Begin(); iterVPL != m_arrayVPLs.End(); ++iterVPL )
 	{
 		AkVPL * l_pMixBus = *iterVPL;
@@ -1491,6 +1535,8 @@ AkVPL * CAkLEngine::CreateVPLMixBus( CAkBusCtx in_BusCtx, AkVPL* in_pParentBus )
 
 void CAkLEngine::DestroyAllVPLMixBusses()
 {
+	m_arrayOutputPending.RemoveAll();
+
 	// Destroy from end of array so that child busses are destroyed before their parents
 	for ( int iVPL = m_arrayVPLs.Length() - 1; iVPL >= 0; --iVPL )
 		AkDelete( AkMemID_Processing, m_arrayVPLs[ iVPL ] );
@@ -1597,6 +1643,8 @@ void CAkLEngine::ReevaluateGraph(bool bDestroyAll)
 		return;
 
 	m_bFullReevaluation = true;
+	FlushPendingOutput();
+
 	for (AkArrayVPL::Iterator it = m_arrayVPLs.Begin(); it != m_arrayVPLs.End(); )
 	{
 		AkVPL* pVpl = (*it);
@@ -1787,11 +1835,14 @@ void CAkLEngine::AnalyzeMixingGraph()
 		}
 #endif
 		// Compute volume for sources.  Aux Bus pertaining to each source will be updated too.
+		// Sources whose parameters need to be refreshed share the parameters of their common ancestors.
+		AkAncestorParamsCache::Open();
 		for (CAkLEngine::AkArrayVPLSrcs::Iterator itSrc = m_Sources.Begin(); itSrc != m_Sources.End(); ++itSrc)
 		{
 			if ( (*itSrc)->GetState() == NodeStatePlay )
 				(*itSrc)->ComputeVolumeRays();
 		}
+		AkAncestorParamsCache::Close();
 
 		// Evaluate all the busses that have aux sends.  This may create more vpl bus nodes or remove old ones.
 		CAkMixBusCtx::ManageAuxRoutableBusses();
@@ -1825,7 +1876,7 @@ void CAkLEngine::AnalyzeMixingGraph()
 	// Process all sources
 	for ( CAkLEngine::AkArrayVPLSrcs::Iterator itSrc = m_Sources.Begin(); itSrc != m_Sources.End(); ++itSrc)
 	{
-		if ( (*itSrc)->GetState() == NodeStatePlay )
+		if ( (*itSrc)->GetState() == NodeStatePlay && !(*itSrc)->IsColdVirtualVoice() )
 			(*itSrc)->UpdateConnections(true);
 	}
 
@@ -1841,7 +1892,7 @@ void CAkLEngine::AnalyzeMixingGraph()
 	// UpdateHDR() Has to be done begore Processing Limiters.
 	for (CAkLEngine::AkArrayVPLSrcs::Iterator itSrc = m_Sources.Begin(); itSrc != m_Sources.End(); ++itSrc)
 	{
-		if ((*itSrc)->GetState() == NodeStatePlay)
+		if ((*itSrc)->GetState() == NodeStatePlay && !(*itSrc)->IsColdVirtualVoice())
 			(*itSrc)->UpdateHDR();
 	}
 
@@ -2126,6 +2177,10 @@ void CAkLEngine::RemoveMixBusses()
 	{
 		AkVPL * pVPL = m_arrayVPLs[ iVPL ];
 
+		// A top-level bus may still hold the output of this frame (pipelined output). Push it now: this also refreshes the bus state.
+		if ( !m_arrayOutputPending.IsEmpty() && pVPL->IsTopLevelNode() && pVPL->CanDestroy() )
+			FlushPendingOutput();
+
 		// Delete the bus if it is not in tail processing, has no actives sources and no child busses.
 		if( pVPL->CanDestroy() )
 		{
@@ -2142,6 +2197,35 @@ void CAkLEngine::RemoveMixBusses()
 
 // Optimized version of single-pipeline execution.
 void CAkLEngine::RunVPL(CAkVPLSrcCbxNode * in_pCbx, AkVPLState & io_state)
+{
+	if (RunVPLUpstream(in_pCbx, io_state))
+	{
+		in_pCbx->m_cbxRec.m_BQF.ConsumeBuffer(io_state);
+		RunVPLDownstream(in_pCbx, io_state);
+	}
+}
+
+// Same as RunVPL for up to CAkSrcLpHpFilter::kMonoBankWidth voices that went through RunVPLUpstream and whose
+// BQF nodes accepted their buffers with CanConsumeInBank: the voices are filtered together, then finished one by one.
+void CAkLEngine::RunVPLBank(CAkVPLSrcCbxNode ** in_ppCbx, AkUInt32 in_uNumCbx)
+{
+	CAkVPLBQFNode * pNodes[CAkSrcLpHpFilter::kMonoBankWidth];
+	AkVPLState * pStates[CAkSrcLpHpFilter::kMonoBankWidth];
+	for (AkUInt32 i = 0; i < in_uNumCbx; ++i)
+	{
+		pNodes[i] = &in_ppCbx[i]->m_cbxRec.m_BQF;
+		pStates[i] = &in_ppCbx[i]->m_vplState;
+	}
+
+	CAkVPLBQFNode::ConsumeBufferBank(pNodes, pStates, in_uNumCbx);
+
+	for (AkUInt32 i = 0; i < in_uNumCbx; ++i)
+		RunVPLDownstream(in_ppCbx[i], in_ppCbx[i]->m_vplState);
+}
+
+// Pulls data through the source and the effects of the pipeline. Returns true when io_state holds a buffer
+// (or the end of the data) ready for the BQF node.
+bool CAkLEngine::RunVPLUpstream(CAkVPLSrcCbxNode * in_pCbx, AkVPLState & io_state)
 {
 	AkVPLSrcCbxRec & cbxRec = in_pCbx->m_cbxRec;
 
@@ -2164,7 +2248,7 @@ GetFilter:
 				}
 				else
 				{
-					return;
+					return false;
 				}
 			}
 		}
@@ -2174,7 +2258,7 @@ GetSource:
 	in_pCbx->GetBuffer(io_state);	
 	if ( AK_EXPECT_FALSE(io_state.result != AK_DataReady && io_state.result != AK_NoMoreData) )
 	{
-		return;
+		return false;
 	}	
 
 ConsumeFilter:
@@ -2205,13 +2289,20 @@ ConsumeFilter:
 			else if ( io_state.result != AK_DataReady
  				&& io_state.result != AK_NoMoreData )
  			{
- 				return;
+ 				return false;
 			}
 		}
 		uFXIndex++;
 	}
 
-	cbxRec.m_BQF.ConsumeBuffer( io_state );
+	return true;
+}
+
+// Runs the pipeline after its BQF node has consumed io_state: volume automation, then the cbx node, down to mixing.
+void CAkLEngine::RunVPLDownstream(CAkVPLSrcCbxNode * in_pCbx, AkVPLState & io_state)
+{
+	AkVPLSrcCbxRec & cbxRec = in_pCbx->m_cbxRec;
+
 	AKASSERT( io_state.result == AK_DataReady
 		|| io_state.result == AK_NoMoreData ); // LPF has no failure case
 
@@ -2252,6 +2343,8 @@ void CAkLEngine::SoftwarePerform()
 
 	HandleStarvation();
 
+	AkProcessingArenas::BeginAudioThread();
+
 	//If the engine was suspended without rendering, avoid doing so
 	bool bRender = CAkOutputMgr::RenderIsActive();
 
@@ -2270,6 +2363,7 @@ void CAkLEngine::SoftwarePerform()
 	else
 	{
 		// Older execution model, optimized for single-thread execution
+		OutputStage();
 		ProcessSources(bRender);
 		PerformMixing(bRender);
 	}
@@ -2278,15 +2372,85 @@ void CAkLEngine::SoftwarePerform()
 	AkPerf::PostPipelineStats();
 #endif
 
-	// End of frame
-	for (AkDeviceList::Iterator it = CAkOutputMgr::OutputBegin(); it != CAkOutputMgr::OutputEnd(); ++it)
-		(*it)->FrameEnd();
-
-	CAkOutputMgr::ResetMasterVolume(CAkOutputMgr::GetMasterVolume().fNext);	//Volume is now at target.
+	// End of frame, unless the top-level busses were left for the next frame's OutputStage().
+	if (!m_bOutputFramePending)
+		EndOutputFrame();
 
 	RemoveMixBusses();
+
+	AkProcessingArenas::EndAudioThread();
+	AkProcessingArenas::FrameEnd();
 } // Perform
 
+// With AkInitSettings::bFloat16VoiceBuffers, voices run by tasks hand their output to their bus in half-precision,
+// and their pipeline buffers go back to the free lists while still in cache, for the next voices of the task.
+static AkForceInline void PackVoiceOutputs(CAkVPLSrcCbxNode ** in_ppCbx, AkUInt32 in_uNumCbx)
+{
+	if (g_settings.bFloat16VoiceBuffers)
+	{
+		for (AkUInt32 i = 0; i < in_uNumCbx; ++i)
+			in_ppCbx[i]->PackMixableBuffer();
+	}
+}
+
+// Mono voices with steady filters are held back after their source and effects have run, and filtered
+// CAkSrcLpHpFilter::kMonoBankWidth at a time by one SIMD filter bank (see RunVPLBank) before being finished.
+struct AkVPLSrcBank
+{
+	AkVPLSrcBank() : uNumSrcs(0), uNumFrames(0) {}
+
+	// Voices held together must have the same number of frames.
+	inline bool Accepts(AkUInt32 in_uNumFrames) const { return uNumSrcs == 0 || uNumFrames == in_uNumFrames; }
+	inline bool IsFull() const { return uNumSrcs == CAkSrcLpHpFilter::kMonoBankWidth; }
+	inline void Add(CAkVPLSrcCbxNode * in_pSrc, AkInt32 in_iSrc, AkUInt32 in_uNumFrames)
+	{
+		pSrcs[uNumSrcs] = in_pSrc;
+		iSrcs[uNumSrcs] = in_iSrc;
+		uNumFrames = in_uNumFrames;
+		++uNumSrcs;
+	}
+
+	CAkVPLSrcCbxNode *	pSrcs[CAkSrcLpHpFilter::kMonoBankWidth];
+	AkInt32				iSrcs[CAkSrcLpHpFilter::kMonoBankWidth];	// Index of each voice in m_Sources.
+	AkUInt32			uNumSrcs;
+	AkUInt32			uNumFrames;
+};
+
+// Runs in_pSrc up to its BQF node, then either holds it in io_bank or finishes it. Returns true if the voice was held:
+// held voices are finished by in_fcnRunBank, along with the other voices of the bank. Voices of a different length
+// are run before in_pSrc is held, and a full bank is run right away.
+bool CAkLEngine::RunVPLOrHold(CAkVPLSrcCbxNode * in_pSrc, AkInt32 in_iSrc, AkVPLSrcBank & io_bank, RunVPLSrcBankFunc in_fcnRunBank)
+{
+	AkVPLState & state = in_pSrc->m_vplState;
+	if (!RunVPLUpstream(in_pSrc, state))
+		return false;
+
+	if (!in_pSrc->m_cbxRec.m_BQF.CanConsumeInBank(state))
+	{
+		in_pSrc->m_cbxRec.m_BQF.ConsumeBuffer(state);
+		RunVPLDownstream(in_pSrc, state);
+		return false;
+	}
+
+	if (!io_bank.Accepts(state.uValidFrames))
+		in_fcnRunBank(io_bank);
+	io_bank.Add(in_pSrc, in_iSrc, state.uValidFrames);
+	if (io_bank.IsFull())
+		in_fcnRunBank(io_bank);
+	return true;
+}
+
+// Finishes the voices held by VoiceRangeTask.
+void CAkLEngine::RunVoiceBank(AkVPLSrcBank & io_bank)
+{
+	if (io_bank.uNumSrcs > 0)
+	{
+		RunVPLBank(io_bank.pSrcs, io_bank.uNumSrcs);
+		PackVoiceOutputs(io_bank.pSrcs, io_bank.uNumSrcs);
+		io_bank.uNumSrcs = 0;
+	}
+}
+
 void CAkLEngine::VoiceRangeTask(void* in_pData, AkUInt32 in_uIdxBegin, AkUInt32 in_uIdxEnd, AkTaskContext in_ctx, void* /*in_pUserData*/)
 {
 #if defined AK_CPU_X86 || defined AK_CPU_X86_64
@@ -2298,13 +2462,26 @@ void CAkLEngine::VoiceRangeTask(void* in_pData, AkUInt32 in_uIdxBegin, AkUInt32
 	_MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
 #endif
 
+	AkProcessingArenas::BeginTask(in_ctx.uIdxThread);
+
+	AkVPLSrcBank bank;
+
 	AkArrayVPLSrcs& srcs = *(AkArrayVPLSrcs*)in_pData;
 	AkUInt32 iSrc = in_uIdxBegin;
 	do
 	{
 		CAkVPLSrcCbxNode * pSrc = srcs[iSrc];
 		if (pSrc->m_vplState.result == AK_DataNeeded)
-			RunVPL(pSrc, pSrc->m_vplState);
+		{
+#if defined(AK_HARDWARE_DECODING_SUPPORTED)
+			// Hardware voices prepare their next buffer right below, so they must be finished first.
+			if (pSrc->SrcProcessOrder() == SrcProcessOrder_HwVoice)
+				RunVPL(pSrc, pSrc->m_vplState);
+			else
+#endif
+			if (!RunVPLOrHold(pSrc, iSrc, bank, RunVoiceBank))
+				PackVoiceOutputs(&pSrc, 1);
+		}
 
 #if defined(AK_HARDWARE_DECODING_SUPPORTED)
 		if (pSrc->SrcProcessOrder() == SrcProcessOrder_HwVoice)
@@ -2313,6 +2490,10 @@ void CAkLEngine::VoiceRangeTask(void* in_pData, AkUInt32 in_uIdxBegin, AkUInt32
 	} 
 	while (++iSrc < in_uIdxEnd);
 
+	RunVoiceBank(bank);
+
+	AkProcessingArenas::EndTask(in_ctx.uIdxThread);
+
 #if defined AK_CPU_X86 || defined AK_CPU_X86_64
 	_MM_SET_FLUSH_ZERO_MODE(uFlushZeroMode);
 #endif
@@ -2388,10 +2569,42 @@ void CAkLEngine::ProcessGraph(bool in_bRender)
 	if ( idxFirstHwVoice == ~0 )
 		idxFirstHwVoice = m_Sources.Length();
 
+	AkUInt32 hwPivot = AkMin(idxFirstHwVoice, idxFirstLLVoice);
+
+	// When all voices are software voices, voices and non-top-level busses are executed together: each bus is dispatched 
+	// as soon as its last input voice or bus is processed, without waiting for all the voices or for the other busses of the same depth.
+	// Must test for sort dirty because sorted VPLs are absolutely necessary for proper mixing (see below).
+	bool bDependencyGraph = in_bRender
+		&& hwPivot == m_Sources.Length()
+		&& !m_arrayVPLs.IsEmpty()
+		&& !m_bVPLsDirty
+		&& m_bVPLsSchedulable
+		&& PrepareGraph(hwPivot);
+
+	// Pipelined output: the effects of the top-level busses of the previous frame are processed by one graph task
+	// while the others start on this frame's voices; their device output follows on this thread once the graph is joined. Feedback connections into top-level busses are consumed 
+	// after the buffers are released, so graphs with cycles are not pipelined.
+	m_bGraphOutputStage = bDependencyGraph && m_bPipelinedOutput && !m_bVPLsHaveCycles;
+	if (!m_bGraphOutputStage)
+		OutputStage();
+
+	if (bDependencyGraph)
+	{
+		{
+			AK_INSTRUMENT_SCOPE("CAkLEngine::GraphTask");
+			AkAtomicStore32(&m_iGraphOutputClaimed, 0);
+			AkAtomicStore32(&m_iGraphOutputDone, m_bGraphOutputStage ? 0 : 1);
+			AkUInt32 uNumTasks = AkMax(g_settings.taskSchedulerDesc.uNumSchedulerWorkerThreads, (AkUInt32)1);
+			g_settings.taskSchedulerDesc.fcnParallelFor(&m_Sources, 0, uNumTasks, 1, GraphTask, NULL, "AK::Graph");
+		}
+
+		// Sinks and capture are only called from the audio thread: push the effected buffers and end the previous device frame now.
+		if (m_bGraphOutputStage)
+			OutputStage();
+	}
 	// Process voices in parallel.
-	if (m_Sources.Length() && in_bRender)
+	else if (m_Sources.Length() && in_bRender)
 	{
-		AkUInt32 hwPivot = AkMin(idxFirstHwVoice, idxFirstLLVoice);
 		// Software voices are at the start (i.e. lower processing order)
 		if ( hwPivot != 0 )
 		{
@@ -2436,7 +2649,7 @@ void CAkLEngine::ProcessGraph(bool in_bRender)
 		//	- a memory allocation failure occured in SortVPLs.
 		if (!m_arrayVPLs.IsEmpty() && !m_bVPLsDirty)
 		{
-			AkInt32 iDepthNum = m_arrayVPLDepthCnt.Length();
+			AkInt32 iDepthNum = bDependencyGraph ? 1 : m_arrayVPLDepthCnt.Length(); // Non-top-level busses were already processed by GraphTask.
 			int iMaxDepth = iDepthNum - 1;
 
 			AkInt32 * pDepthIdx = (AkInt32*)AkAlloca(iDepthNum * sizeof(AkInt32));
@@ -2475,11 +2688,30 @@ void CAkLEngine::ProcessGraph(bool in_bRender)
 				}
 			}
 
-			for (int i = m_arrayVPLDepthCnt[0] - 1; i >= 0; --i)
-				BusTask(m_arrayVPLs[i]);
+			AkInt32 iNumTopLevel = m_arrayVPLDepthCnt[0];
+			for (int i = iNumTopLevel - 1; i >= 0; --i)
+			{
+				AkVPL * pVPL = m_arrayVPLs[i];
+				if (m_bGraphOutputStage)
+				{
+					ConsumeBusInputs(pVPL);
+					if (!m_arrayOutputPending.AddLast(pVPL))
+						pVPL->m_MixBus.m_pMixableBuffer = CAkLEngine::TransferBuffer(pVPL); // Out of memory: not pipelined, but still in the same device frame.
+				}
+				else
+				{
+					BusTask(pVPL);
+				}
+			}
+
+			if (m_bGraphOutputStage)
+				m_bOutputFramePending = true;
 
 			for (int i = m_arrayVPLs.Length() - 1; i >= 0; --i)
 			{
+				// Pending top-level busses are released by FlushPendingOutput().
+				if (m_bGraphOutputStage && i < iNumTopLevel && m_arrayOutputPending.Exists(m_arrayVPLs[i]))
+					continue;
 				m_arrayVPLs[i]->m_MixBus.ReleaseBuffer();
 				if (m_bVPLsHaveCycles)
 					FeedbackTask(m_arrayVPLs[i]);
@@ -2525,6 +2757,64 @@ void CAkLEngine::ProcessGraph(bool in_bRender)
 
 }
 
+// Mixes the output of a voice that ran in ProcessSources into its busses and releases it.
+void CAkLEngine::MixSource(CAkVPLSrcCbxNode * in_pCbx)
+{
+	AkVPLState & rVPLState = in_pCbx->m_vplState;
+
+	// Release buffer in all cases, except if the source has starved.
+	// In such a case it is kept for next LEngine pass.
+	if (rVPLState.result != AK_NoDataReady)
+	{
+		AkAudioBuffer * pMixableBuffer = in_pCbx->m_pMixableBuffer;
+		if (pMixableBuffer)
+		{
+			// Mix the voice into all output busses.
+			for (AkMixConnectionList::Iterator it = in_pCbx->BeginConnection(); it != in_pCbx->EndConnection(); ++it)
+			{
+				AkMixConnection * pConnection = (*it);
+				if (pConnection->IsAudible())
+				{
+					pConnection->GetOutputBus()->ConsumeBuffer(*pMixableBuffer, *pConnection);
+				}
+			}
+		}
+		in_pCbx->ReleaseBuffer();
+	}
+	else
+	{
+		// We already computed new volumes, but did not use it because data is not ready.
+		// Restore them for next time.
+		in_pCbx->RestorePreviousVolumes(&rVPLState);
+	}
+}
+
+// End of a voice's frame in ProcessSources, whether it ran or not.
+void CAkLEngine::FinishSource(CAkVPLSrcCbxNode * in_pCbx)
+{
+#if defined(AK_HARDWARE_DECODING_SUPPORTED)
+	if (in_pCbx->SrcProcessOrder() == SrcProcessOrder_HwVoice)
+		in_pCbx->PrepareNextBuffer();
+#endif
+
+	FinishRun(in_pCbx, in_pCbx->m_vplState);
+}
+
+// Finishes the voices held by ProcessSources.
+void CAkLEngine::RunSourceBank(AkVPLSrcBank & io_bank)
+{
+	if (io_bank.uNumSrcs > 0)
+	{
+		RunVPLBank(io_bank.pSrcs, io_bank.uNumSrcs);
+		for (AkUInt32 i = 0; i < io_bank.uNumSrcs; ++i)
+		{
+			MixSource(io_bank.pSrcs[i]);
+			FinishSource(io_bank.pSrcs[i]);
+		}
+		io_bank.uNumSrcs = 0;
+	}
+}
+
 void CAkLEngine::ProcessSources(bool in_bRender)
 {
 	WWISE_SCOPED_PROFILE_MARKER("CAkLEngine::ProcessSources");
@@ -2533,51 +2823,35 @@ void CAkLEngine::ProcessSources(bool in_bRender)
 	AkUInt32 idxFirstLLVoice = ~0;
 	PreprocessSources(in_bRender, idxFirstHwVoice, idxFirstLLVoice);
 
+	AkVPLSrcBank bank;
+
 	// Voice processing.  Process each "sequence" as a whole.
-	for ( AkArrayVPLSrcs::Iterator itSrc = m_Sources.Begin(); itSrc != m_Sources.End(); )
+	for ( AkUInt32 iSrc = 0; iSrc < m_Sources.Length(); ++iSrc )
 	{
-		CAkVPLSrcCbxNode * pCbx = *itSrc;
-		AkVPLState & rVPLState = pCbx->m_vplState;
+		CAkVPLSrcCbxNode * pCbx = m_Sources[iSrc];
 
 		if (pCbx->m_vplState.result == AK_DataNeeded)
 		{
-			RunVPL(pCbx, rVPLState);
-
-			// Release buffer in all cases, except if the source has starved.
-			// In such a case it is kept for next LEngine pass.
-			if (rVPLState.result != AK_NoDataReady)
-			{
-				AkAudioBuffer * pMixableBuffer = pCbx->m_pMixableBuffer;
-				if (pMixableBuffer)
-				{
-					// Mix the voice into all output busses.
-					for (AkMixConnectionList::Iterator it = pCbx->BeginConnection(); it != pCbx->EndConnection(); ++it)
-					{
-						AkMixConnection * pConnection = (*it);
-						if (pConnection->IsAudible())
-						{
-							pConnection->GetOutputBus()->ConsumeBuffer(*pMixableBuffer, *pConnection);
-						}
-					}
-				}
-				pCbx->ReleaseBuffer();
-			}
+#if defined(AK_HARDWARE_DECODING_SUPPORTED)
+			if (pCbx->SrcProcessOrder() == SrcProcessOrder_HwVoice)
+				RunVPL(pCbx, pCbx->m_vplState);
 			else
-			{
-				// We already computed new volumes, but did not use it because data is not ready.
-				// Restore them for next time.
-				pCbx->RestorePreviousVolumes(&rVPLState);
-			}
+#endif
+			if (RunVPLOrHold(pCbx, iSrc, bank, RunSourceBank))
+				continue; // Mixed and finished along with the other voices of the bank.
+
+			MixSource(pCbx);
 		}
 
-#if defined(AK_HARDWARE_DECODING_SUPPORTED)
-		if (pCbx->SrcProcessOrder() == SrcProcessOrder_HwVoice)
-			pCbx->PrepareNextBuffer();
-#endif
+		FinishSource(pCbx);
+	}
 
-		FinishRun(pCbx, rVPLState);
+	RunSourceBank(bank);
 
-		// Destroy voice when stopped
+	// Destroy voices when stopped
+	for ( AkArrayVPLSrcs::Iterator itSrc = m_Sources.Begin(); itSrc != m_Sources.End(); )
+	{
+		CAkVPLSrcCbxNode * pCbx = *itSrc;
 		if (pCbx->GetState() == NodeStateStop)
 		{
 			itSrc = m_Sources.Erase(itSrc);
@@ -2616,6 +2890,8 @@ void CAkLEngine::BusRangeTask(void* in_pData, AkUInt32 in_uIdxBegin, AkUInt32 in
 	_MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
 #endif
 
+	AkProcessingArenas::BeginTask(in_ctx.uIdxThread);
+
     AkArrayVPL& sortedVPLs = *(AkArrayVPL*)in_pData;
 	AkUInt32 iVPL = in_uIdxBegin;
 
@@ -2625,12 +2901,302 @@ void CAkLEngine::BusRangeTask(void* in_pData, AkUInt32 in_uIdxBegin, AkUInt32 in
 	} 
 	while (++iVPL < in_uIdxEnd);
 
+	AkProcessingArenas::EndTask(in_ctx.uIdxThread);
+
 #if defined AK_CPU_X86 || defined AK_CPU_X86_64
 	_MM_SET_FLUSH_ZERO_MODE(uFlushZeroMode);
 #endif
 }
 
+// Dependency graph execution: a bus belongs to the graph if it is reachable from a top-level bus and is not top-level itself.
+// Top-level busses push data to devices and are still processed serially by the calling thread.
+static inline bool IsGraphBus(AkVPL * in_pVPL)
+{
+	return in_pVPL && in_pVPL->m_iDepth > 0 && in_pVPL->m_iDepth != INT_MAX;
+}
+
+static inline bool FeedsTopLevelBus(CAkVPLSrcCbxNode * in_pCbx)
+{
+	for (AkMixConnectionList::Iterator it = in_pCbx->BeginConnection(); it != in_pCbx->EndConnection(); ++it)
+	{
+		if (!IsGraphBus((*it)->GetOutputVPL()))
+			return true;
+	}
+	return false;
+}
+
+// Finishes the voices held by GraphTask, then releases the busses they feed.
+void CAkLEngine::RunGraphBank(AkVPLSrcBank & io_bank)
+{
+	if (io_bank.uNumSrcs > 0)
+	{
+		RunVPLBank(io_bank.pSrcs, io_bank.uNumSrcs);
+		PackVoiceOutputs(io_bank.pSrcs, io_bank.uNumSrcs);
+		for (AkUInt32 i = 0; i < io_bank.uNumSrcs; ++i)
+			ReleaseGraphDependents(io_bank.iSrcs[i]);
+		io_bank.uNumSrcs = 0;
+	}
+}
+
+void CAkLEngine::GraphTask(void* in_pData, AkUInt32 /*in_uIdxBegin*/, AkUInt32 /*in_uIdxEnd*/, AkTaskContext in_ctx, void* /*in_pUserData*/)
+{
+#if defined AK_CPU_X86 || defined AK_CPU_X86_64
+#if defined (_MSC_VER) && (_MSC_VER < 1700)
+	AkUInt32 uFlushZeroMode = _MM_GET_FLUSH_ZERO_MODE(dummy);
+#else
+	AkUInt32 uFlushZeroMode = _MM_GET_FLUSH_ZERO_MODE();
+#endif
+	_MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+#endif
+
+	AkProcessingArenas::BeginTask(in_ctx.uIdxThread);
+
+	// Every task runs the same loop regardless of the range it was given: with a serial scheduler, one call does all the work.
+	AkArrayVPLSrcs& srcs = *(AkArrayVPLSrcs*)in_pData;
+	const AkInt32 iNumVoices = (AkInt32)m_uGraphNumVoices;
+	AkVPLSrcBank bank;
+
+	// The first task to get here runs the effects of the previous frame's top-level busses; the others go straight to the voices.
+	if (m_bGraphOutputStage && AkAtomicCas32(&m_iGraphOutputClaimed, 1, 0))
+	{
+		ProcessPendingOutputFx();
+		AkAtomicStore32(&m_iGraphOutputDone, 1);
+	}
+
+	AkUInt32 uSpin = 0;
+	for (;;)
+	{
+		// Ready busses first: they are on the critical path to the top-level busses.
+		AkVPL * pBus = PopReadyBus();
+		if (pBus)
+		{
+			BusTask(pBus);
+			ReleaseGraphDependents(pBus->m_iGraphIdx);
+			AkAtomicDec32(&m_iGraphBussesLeft);
+			continue;
+		}
+
+		if (AkAtomicLoad32(&m_iGraphNextVoice) < iNumVoices)
+		{
+			AkInt32 iVoice = AkAtomicInc32(&m_iGraphNextVoice) - 1;
+			if (iVoice < iNumVoices)
+			{
+				CAkVPLSrcCbxNode * pSrc = srcs[iVoice];
+				if (pSrc->m_vplState.result == AK_DataNeeded)
+				{
+					// Voices mixed directly into a top-level bus must not run while that bus is still outputting the previous frame.
+					if (!AkAtomicLoad32(&m_iGraphOutputDone) && FeedsTopLevelBus(pSrc))
+					{
+						while (!AkAtomicLoad32(&m_iGraphOutputDone))
+							AKPLATFORM::AkSleep(0);
+					}
+#if defined(AK_HARDWARE_DECODING_SUPPORTED)
+					if (pSrc->SrcProcessOrder() == SrcProcessOrder_HwVoice)
+						RunVPL(pSrc, pSrc->m_vplState); // Hardware voices keep their buffers until they prepare the next one.
+					else
+#endif
+					if (RunVPLOrHold(pSrc, iVoice, bank, RunGraphBank))
+						continue; // Its busses are released along with the other voices of the bank.
+					else
+						PackVoiceOutputs(&pSrc, 1);
+				}
+				ReleaseGraphDependents(iVoice);
+			}
+			continue;
+		}
+
+		// No voice left to claim: the voices held in the bank must be finished before waiting for busses that may depend on them.
+		RunGraphBank(bank);
+
+		if (AkAtomicLoad32(&m_iGraphBussesLeft) == 0)
+			break;
+
+		// Remaining busses wait on inputs being processed by other tasks.
+		if ((++uSpin & 63) == 0)
+			AKPLATFORM::AkSleep(0);
+	}
+
+	AkProcessingArenas::EndTask(in_ctx.uIdxThread);
+
+#if defined AK_CPU_X86 || defined AK_CPU_X86_64
+	_MM_SET_FLUSH_ZERO_MODE(uFlushZeroMode);
+#endif
+}
+
+bool CAkLEngine::PrepareGraph(AkUInt32 in_uNumVoices)
+{
+	AkUInt32 cVPLs = m_arrayVPLs.Length();
+	if (!m_arrayGraphDependentsIdx.Resize(in_uNumVoices + cVPLs + 1)
+		|| !m_arrayGraphReady.Resize(cVPLs))
+		return false;
+
+	m_arrayGraphDependents.RemoveAll();
+	AkInt32 * pDependentsIdx = m_arrayGraphDependentsIdx.Data();
+
+	AkInt32 iNumBusses = 0;
+	for (AkUInt32 iVPL = 0; iVPL < cVPLs; ++iVPL)
+	{
+		AkVPL * pVPL = m_arrayVPLs[iVPL];
+		pVPL->m_iGraphPendingInputs = 0;
+		pVPL->m_iGraphIdx = in_uNumVoices + iVPL;
+		m_arrayGraphReady[iVPL] = NULL;
+		if (IsGraphBus(pVPL))
+			++iNumBusses;
+	}
+
+	// Voices which run this frame are producers for all the busses they are connected to.
+	for (AkUInt32 iSrc = 0; iSrc < in_uNumVoices; ++iSrc)
+	{
+		pDependentsIdx[iSrc] = m_arrayGraphDependents.Length();
+		CAkVPLSrcCbxNode * pCbx = m_Sources[iSrc];
+		if (pCbx->m_vplState.result != AK_DataNeeded)
+			continue;
+
+		for (AkMixConnectionList::Iterator it = pCbx->BeginConnection(); it != pCbx->EndConnection(); ++it)
+		{
+			AkVPL * pOutput = (*it)->GetOutputVPL();
+			if (IsGraphBus(pOutput))
+			{
+				if (!m_arrayGraphDependents.AddLast(pOutput))
+					return false;
+				++pOutput->m_iGraphPendingInputs;
+			}
+		}
+	}
+
+	// Busses are producers for their parents, except through feedback connections (consumed after the graph by FeedbackTask).
+	for (AkUInt32 iVPL = 0; iVPL < cVPLs; ++iVPL)
+	{
+		pDependentsIdx[in_uNumVoices + iVPL] = m_arrayGraphDependents.Length();
+		AkVPL * pVPL = m_arrayVPLs[iVPL];
+		if (!IsGraphBus(pVPL))
+			continue;
+
+		for (AkMixConnectionList::Iterator it = pVPL->m_MixBus.BeginConnection(); it != pVPL->m_MixBus.EndConnection(); ++it)
+		{
+			AkVPL * pOutput = (*it)->GetOutputVPL();
+			if (!(*it)->GetFeedback() && IsGraphBus(pOutput))
+			{
+				if (!m_arrayGraphDependents.AddLast(pOutput))
+					return false;
+				++pOutput->m_iGraphPendingInputs;
+			}
+		}
+	}
+	pDependentsIdx[in_uNumVoices + cVPLs] = m_arrayGraphDependents.Length();
+
+	m_uGraphNumVoices = in_uNumVoices;
+	AkAtomicStore32(&m_iGraphNextVoice, 0);
+	AkAtomicStore32(&m_iGraphReadyWrite, 0);
+	AkAtomicStore32(&m_iGraphReadyRead, 0);
+	AkAtomicStore32(&m_iGraphBussesLeft, iNumBusses);
+
+	// Busses without pending inputs can start right away.
+	for (AkUInt32 iVPL = 0; iVPL < cVPLs; ++iVPL)
+	{
+		AkVPL * pVPL = m_arrayVPLs[iVPL];
+		if (IsGraphBus(pVPL) && pVPL->m_iGraphPendingInputs == 0)
+			PushReadyBus(pVPL);
+	}
+
+	return true;
+}
+
+void CAkLEngine::ReleaseGraphDependents(AkInt32 in_iProducer)
+{
+	const AkInt32 * pDependentsIdx = m_arrayGraphDependentsIdx.Data();
+	AkVPL ** pDependents = m_arrayGraphDependents.Data();
+	for (AkInt32 i = pDependentsIdx[in_iProducer]; i < pDependentsIdx[in_iProducer + 1]; ++i)
+	{
+		AkVPL * pVPL = pDependents[i];
+		if (AkAtomicDec32(&pVPL->m_iGraphPendingInputs) == 0)
+			PushReadyBus(pVPL);
+	}
+}
+
+void CAkLEngine::PushReadyBus(AkVPL * in_pVPL)
+{
+	// Each bus is pushed exactly once per frame, so m_arrayGraphReady never overflows.
+	AkInt32 iWrite = AkAtomicInc32(&m_iGraphReadyWrite) - 1;
+	AkAtomicStorePtr((AkAtomicPtr*)&m_arrayGraphReady[iWrite], in_pVPL);
+}
+
+AkVPL * CAkLEngine::PopReadyBus()
+{
+	for (;;)
+	{
+		AkInt32 iRead = AkAtomicLoad32(&m_iGraphReadyRead);
+		if (iRead >= AkAtomicLoad32(&m_iGraphReadyWrite))
+			return NULL;
+
+		if (AkAtomicCas32(&m_iGraphReadyRead, iRead + 1, iRead))
+		{
+			// The slot is reserved but the producer may not have written it yet.
+			void * pVPL;
+			while ((pVPL = AkAtomicLoadPtr((AkAtomicPtr*)&m_arrayGraphReady[iRead])) == NULL) {}
+			return (AkVPL*)pVPL;
+		}
+	}
+}
+
+bool CAkLEngine::IsBusGraphSchedulable()
+{
+	// Topological sort of the non-feedback bus connections. With feedback loops, there is no guarantee that dropping 
+	// feedback connections leaves an acyclic graph; dependency counts would never reach zero in that case.
+	AkUInt32 cVPLs = m_arrayVPLs.Length();
+	AkVPL ** pReady = (AkVPL **)AkAlloca(cVPLs * sizeof(AkVPL *));
+	AkUInt32 uNumBusses = 0;
+	AkUInt32 uNumReady = 0;
+
+	for (AkUInt32 iVPL = 0; iVPL < cVPLs; ++iVPL)
+		m_arrayVPLs[iVPL]->m_iGraphPendingInputs = 0;
+
+	for (AkUInt32 iVPL = 0; iVPL < cVPLs; ++iVPL)
+	{
+		AkVPL * pVPL = m_arrayVPLs[iVPL];
+		if (!IsGraphBus(pVPL))
+			continue;
+		++uNumBusses;
+		for (AkMixConnectionList::Iterator it = pVPL->m_MixBus.BeginConnection(); it != pVPL->m_MixBus.EndConnection(); ++it)
+		{
+			AkVPL * pOutput = (*it)->GetOutputVPL();
+			if (!(*it)->GetFeedback() && IsGraphBus(pOutput))
+				++pOutput->m_iGraphPendingInputs;
+		}
+	}
+
+	for (AkUInt32 iVPL = 0; iVPL < cVPLs; ++iVPL)
+	{
+		AkVPL * pVPL = m_arrayVPLs[iVPL];
+		if (IsGraphBus(pVPL) && pVPL->m_iGraphPendingInputs == 0)
+			pReady[uNumReady++] = pVPL;
+	}
+
+	AkUInt32 uNumVisited = 0;
+	while (uNumReady > 0)
+	{
+		AkVPL * pVPL = pReady[--uNumReady];
+		++uNumVisited;
+		for (AkMixConnectionList::Iterator it = pVPL->m_MixBus.BeginConnection(); it != pVPL->m_MixBus.EndConnection(); ++it)
+		{
+			AkVPL * pOutput = (*it)->GetOutputVPL();
+			if (!(*it)->GetFeedback() && IsGraphBus(pOutput) && --pOutput->m_iGraphPendingInputs == 0)
+				pReady[uNumReady++] = pOutput;
+		}
+	}
+
+	return uNumVisited == uNumBusses;
+}
+
 void CAkLEngine::BusTask(AkVPL * in_pVPL)
+{
+	ConsumeBusInputs(in_pVPL);
+
+	// Push the normal bus buffer to the final mix or their parent mix.
+	in_pVPL->m_MixBus.m_pMixableBuffer = CAkLEngine::TransferBuffer(in_pVPL);
+}
+
+void CAkLEngine::ConsumeBusInputs(AkVPL * in_pVPL)
 {
 	// For each dependency, try to consume it.
 	const AkInputConnectionList & inputs = in_pVPL->m_MixBus.Inputs();
@@ -2645,11 +3211,67 @@ void CAkLEngine::BusTask(AkVPL * in_pVPL)
 			{
 				in_pVPL->m_MixBus.ConsumeBuffer(*pMixableBuffer, *pThisConnection);
 			}
+			else if (pThisConnection->Owner()->m_pPackedMixableBuffer)
+			{
+				// Voice output stored in half-precision: mix a single-precision copy of it (voices have no feedback connections).
+				// Only voices with one audible connection are packed, so each of them is unpacked once per frame.
+				const AkFloat16Buffer * pPackedBuffer = pThisConnection->Owner()->m_pPackedMixableBuffer;
+				AkPipelineBufferBase unpackedBuffer;
+				unpackedBuffer.SetChannelConfig(pPackedBuffer->GetChannelConfig());
+				unpackedBuffer.SetRequestSize(pPackedBuffer->MaxFrames());
+				if (unpackedBuffer.GetScratchBuffer() == AK_Success)
+				{
+					pPackedBuffer->Unpack(unpackedBuffer);
+					in_pVPL->m_MixBus.ConsumeBuffer(unpackedBuffer, *pThisConnection);
+					unpackedBuffer.ReleaseScratchBuffer();
+				}
+			}
 		}
 	}
+}
 
-	// Push the normal bus buffer to the final mix or their parent mix.
-	in_pVPL->m_MixBus.m_pMixableBuffer = CAkLEngine::TransferBuffer(in_pVPL);
+void CAkLEngine::ProcessPendingOutputFx()
+{
+	// Run the effects of the top-level busses mixed in the previous frame. Their device output is left to FlushPendingOutput().
+	for (AkArrayVPL::Iterator it = m_arrayOutputPending.Begin(); it != m_arrayOutputPending.End(); ++it)
+	{
+		AkVPL * pVPL = *it;
+		pVPL->m_MixBus.m_pMixableBuffer = pVPL->m_MixBus.GetResultingBuffer();
+	}
+	m_bOutputFxDone = true;
+}
+
+void CAkLEngine::FlushPendingOutput()
+{
+	// Push the top-level busses mixed in the previous frame to their device, running their effects first if no graph task did.
+	for (AkArrayVPL::Iterator it = m_arrayOutputPending.Begin(); it != m_arrayOutputPending.End(); ++it)
+	{
+		AkVPL * pVPL = *it;
+		AkAudioBuffer * pBuffer = m_bOutputFxDone ? pVPL->m_MixBus.m_pMixableBuffer : pVPL->m_MixBus.GetResultingBuffer();
+		pVPL->m_MixBus.m_pMixableBuffer = CAkLEngine::PushBuffer(pVPL, pBuffer);
+		pVPL->m_MixBus.ReleaseBuffer();
+	}
+	m_arrayOutputPending.RemoveAll();
+	m_bOutputFxDone = false;
+}
+
+void CAkLEngine::OutputStage()
+{
+	FlushPendingOutput();
+
+	if (m_bOutputFramePending)
+	{
+		m_bOutputFramePending = false;
+		EndOutputFrame();
+	}
+}
+
+void CAkLEngine::EndOutputFrame()
+{
+	for (AkDeviceList::Iterator it = CAkOutputMgr::OutputBegin(); it != CAkOutputMgr::OutputEnd(); ++it)
+		(*it)->FrameEnd();
+
+	CAkOutputMgr::ResetMasterVolume(CAkOutputMgr::GetMasterVolume().fNext);	//Volume is now at target.
 }
 
 void CAkLEngine::FeedbackTask(AkVPL * in_pVPL)
@@ -2786,6 +3408,8 @@ AKRESULT CAkLEngine::SortVPLs()
 					m_arrayVPLDepthInterconnects[i] = false;
 			}
 		}
+
+		m_bVPLsSchedulable = !m_bVPLsHaveCycles || IsBusGraphSchedulable();
 	}
 
 	m_bVPLsDirty = false;
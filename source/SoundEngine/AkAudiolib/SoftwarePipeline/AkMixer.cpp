@@ -19,6 +19,7 @@
 #include "AkMixer.h"
 #include "AkMixerCommon.h"
 #include "AkSrcLpFilter.h"
+#include "AkRuntimeEnvironmentMgr.h"
 
 //////////////////////////////////////////////////////////////////////////
 
@@ -44,6 +45,18 @@ typedef void(*ApplyGainFuncPtr) (
 // MixerFuncTable[SrcSpeakerConfig][DestSpeakerConfig][ConvertToInt16];
 static ApplyGainFuncPtr ApplyGainFuncTable[ApplyGainSpeaker_End][ApplyGainSpeaker_End][2];
 
+// Same-config gain, indexed by ConvertToInt16
+static ApplyGainFuncPtr ApplyGainNFuncTable[2] = { ApplyGainN_V4F32, ApplyGainNInt16_V4F32 };
+
+typedef void(*MixChannelFuncPtr) (
+	AkReal32* in_pSourceData,
+	AkReal32* in_pDestData,
+	AkReal32 in_fVolume,
+	AkReal32 in_fVolumeDelta,
+	AkUInt32 in_uNumSamples);
+
+static MixChannelFuncPtr MixChannelFunc = MixChannel_V4F32;
+
 ApplyGainSpeakerPreset GetApplyGainSpeakerPreset(AkChannelMask channelMask)
 {
 	ApplyGainSpeakerPreset preset = ApplyGainSpeaker_End;
@@ -83,6 +96,22 @@ void InitMixerFunctTable()
 	ApplyGainFuncTable[ApplyGainSpeaker_71][ApplyGainSpeaker_71][0] = ApplyGainAndInterleave71_V4F32;
 	ApplyGainFuncTable[ApplyGainSpeaker_51][ApplyGainSpeaker_71][0] = ApplyGainAndInterleave71From51_V4F32;
 	ApplyGainFuncTable[ApplyGainSpeaker_Stereo][ApplyGainSpeaker_71][0] = ApplyGainAndInterleave71FromStereo_V4F32;
+
+	ApplyGainNFuncTable[0] = ApplyGainN_V4F32;
+	ApplyGainNFuncTable[1] = ApplyGainNInt16_V4F32;
+	MixChannelFunc = MixChannel_V4F32;
+
+#if defined( AKSIMD_AVX2_SUPPORTED )
+	if (AK::AkRuntimeEnvironmentMgr::Instance()->GetSIMDSupport(AK::AK_SIMD_AVX2))
+	{
+		ApplyGainFuncTable[ApplyGainSpeaker_Mono][ApplyGainSpeaker_Mono][0] = ApplyGainMono_AVX2;
+		ApplyGainFuncTable[ApplyGainSpeaker_Mono][ApplyGainSpeaker_Mono][1] = ApplyGainNInt16_AVX2;
+
+		ApplyGainNFuncTable[0] = ApplyGainN_AVX2;
+		ApplyGainNFuncTable[1] = ApplyGainNInt16_AVX2;
+		MixChannelFunc = MixChannel_AVX2;
+	}
+#endif
 }
 
 void ApplyGainAndInterleave(
@@ -109,14 +138,17 @@ void ApplyGain(
 	bool in_convertToInt16)
 {
 	AKASSERT(in_pInputBuffer->GetChannelConfig() == in_pOutputBuffer->GetChannelConfig());
-	if (in_convertToInt16)
-	{
-		ApplyGainNInt16_V4F32(in_pInputBuffer, in_pOutputBuffer, in_gain);
-	}
-	else
-	{
-		ApplyGainN_V4F32(in_pInputBuffer, in_pOutputBuffer, in_gain);
-	}
+	ApplyGainNFuncTable[in_convertToInt16 ? 1 : 0](in_pInputBuffer, in_pOutputBuffer, in_gain);
+}
+
+void MixChannelSIMD(
+	AkReal32*	in_pSourceData,
+	AkReal32*	in_pDestData,
+	AkReal32	in_fVolume,
+	AkReal32	in_fVolumeDelta,
+	AkUInt32	in_uNumSamples)
+{
+	MixChannelFunc(in_pSourceData, in_pDestData, in_fVolume, in_fVolumeDelta, in_uNumSamples);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -224,7 +256,7 @@ void MixFilterNinNChannels(
 	}
 	else
 	{
-		pTempBuffer = (AkUInt8*)AkMalign(AkMemID_Processing, size, AK_SIMD_ALIGNMENT);
+		pTempBuffer = (AkUInt8*)AkProcessingArenas::Alloc(size);
 	}
 
 	if (pTempBuffer)
@@ -243,7 +275,7 @@ void MixFilterNinNChannels(
 	in_BQF->CheckBypass();
 
 	if (pTempBuffer != NULL && size > MAX_BUFFER_STACK_ALLOC)
-		AkFalign(AkMemID_Processing, pTempBuffer);
+		AkProcessingArenas::Free(pTempBuffer, size);
 }
 
 void MixBypassNinNChannels(
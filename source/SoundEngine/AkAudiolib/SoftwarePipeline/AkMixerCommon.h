@@ -35,6 +35,24 @@ struct AkSpeakerVolumesN
 	}
 };
 
+// After running this macro, Vol will have the base, initial, volume for 4 samples of data, and volDelta will have the offset to apply each simd step
+#define BUILD_VOLUME_DELTA_VECTOR( VOL, VOLDELTA, RAMP, NUMFRAMES ) \
+	AKSIMD_V4F32 VOL = AKSIMD_SET_V4F32(RAMP.fPrev); \
+	AKSIMD_V4F32 VOLDELTA = AKSIMD_SET_V4F32((RAMP.fNext - RAMP.fPrev) / (AkReal32)NUMFRAMES); \
+	{ \
+		AK_ALIGN_SIMD(const AkReal32 aVolumes[4]) = { 0.f, 1.f, 2.f, 3.f}; \
+		VOL = AKSIMD_ADD_V4F32(VOL, AKSIMD_MUL_V4F32(VOLDELTA, AKSIMD_LOAD_V4F32(aVolumes))); \
+		VOLDELTA = AKSIMD_MUL_V4F32(VOLDELTA, AKSIMD_SET_V4F32(4.f)); \
+	} \
+
+#define BUILD_VOLUME_VECTOR( VECT, VOLUME, VOLUME_DELTA ) \
+	AK_ALIGN_SIMD(AkReal32 aVolumes[4]);\
+	aVolumes[0] = VOLUME; \
+	aVolumes[1] = VOLUME + VOLUME_DELTA; \
+	aVolumes[2] = VOLUME + 2.f * VOLUME_DELTA; \
+	aVolumes[3] = VOLUME + 3.f * VOLUME_DELTA; \
+	AKSIMD_V4F32 VECT = AKSIMD_LOAD_V4F32( aVolumes );
+
 // Helper functions to perform gain and interleave
 
 // GainN; i.e. in_pSrc and in_pDest have the same number (N) of channels
@@ -57,4 +75,15 @@ void ApplyGainAndInterleave71_V4F32(AkAudioBuffer* in_pInputBuffer, AkAudioBuffe
 void ApplyGainAndInterleave71From51_V4F32(AkAudioBuffer* in_pInputBuffer, AkAudioBuffer* in_pOutputBuffer, AkRamp in_gain);
 void ApplyGainAndInterleave71FromStereo_V4F32(AkAudioBuffer* in_pInputBuffer, AkAudioBuffer* in_pOutputBuffer, AkRamp in_gain);
 
+// MixChannel; see AkMixer::MixChannelSIMD
+void MixChannel_V4F32(AkReal32* in_pSourceData, AkReal32* in_pDestData, AkReal32 in_fVolume, AkReal32 in_fVolumeDelta, AkUInt32 in_uNumSamples);
+
+// 8-wide variants of the above, producing the same results. Runtime support for AVX2 must be checked before using them.
+#if defined( AKSIMD_AVX2_SUPPORTED )
+void ApplyGainN_AVX2(AkAudioBuffer* in_pInputBuffer, AkAudioBuffer* in_pOutputBuffer, AkRamp in_gain);
+void ApplyGainNInt16_AVX2(AkAudioBuffer* in_pInputBuffer, AkAudioBuffer* in_pOutputBuffer, AkRamp in_gain);
+void ApplyGainMono_AVX2(AkAudioBuffer* in_pInputBuffer, AkAudioBuffer* in_pOutputBuffer, AkRamp in_gain);
+void MixChannel_AVX2(AkReal32* in_pSourceData, AkReal32* in_pDestData, AkReal32 in_fVolume, AkReal32 in_fVolumeDelta, AkUInt32 in_uNumSamples);
+#endif
+
 #endif
@@ -27,24 +27,6 @@
 // Number of floats in vectors.
 static const AkUInt32	ulVectorSize = 4;
 
-// After running this macro, Vol will have the base, initial, volume for 4 samples of data, and volDelta will have the offset to apply each simd step
-#define BUILD_VOLUME_DELTA_VECTOR( VOL, VOLDELTA, RAMP, NUMFRAMES ) \
-	AKSIMD_V4F32 VOL = AKSIMD_SET_V4F32(RAMP.fPrev); \
-	AKSIMD_V4F32 VOLDELTA = AKSIMD_SET_V4F32((RAMP.fNext - RAMP.fPrev) / (AkReal32)NUMFRAMES); \
-	{ \
-		AK_ALIGN_SIMD(const AkReal32 aVolumes[4]) = { 0.f, 1.f, 2.f, 3.f}; \
-		VOL = AKSIMD_ADD_V4F32(VOL, AKSIMD_MUL_V4F32(VOLDELTA, AKSIMD_LOAD_V4F32(aVolumes))); \
-		VOLDELTA = AKSIMD_MUL_V4F32(VOLDELTA, AKSIMD_SET_V4F32(AkReal32(ulVectorSize))); \
-	} \
-
-#define BUILD_VOLUME_VECTOR( VECT, VOLUME, VOLUME_DELTA ) \
-	AK_ALIGN_SIMD(AkReal32 aVolumes[4]);\
-	aVolumes[0] = VOLUME; \
-	aVolumes[1] = VOLUME + VOLUME_DELTA; \
-	aVolumes[2] = VOLUME + 2.f * VOLUME_DELTA; \
-	aVolumes[3] = VOLUME + 3.f * VOLUME_DELTA; \
-	AKSIMD_V4F32 VECT = AKSIMD_LOAD_V4F32( aVolumes );
-
 // Assumes usMaxFrames % 8 == 0
 void ApplyGainMono_V4F32(
 	AkAudioBuffer* in_pInputBuffer,
@@ -941,7 +923,7 @@ void ApplyGainN_V4F32(
 //////////////////////////////////////////////////////////////////////////
 
 // Assumes in_uNumSamples % 8 == 0
-void AkMixer::MixChannelSIMD(
+void MixChannel_V4F32(
 	AkReal32*	in_pSourceData,
 	AkReal32*	in_pDestData,
 	AkReal32	in_fVolume,
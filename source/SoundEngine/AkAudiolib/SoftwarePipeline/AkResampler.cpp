@@ -139,6 +139,15 @@ void CAkResampler::InitDSPFunctTable()
 	PitchDSPFuncTable[PitchOperatingMode_Interpolating][Native_1Chan] =		Interpolating_Native_1Chan;
 	PitchDSPFuncTable[PitchOperatingMode_Interpolating][Native_2Chan] =		Interpolating_Native_2Chan;
 	PitchDSPFuncTable[PitchOperatingMode_Interpolating][Native_NChan] =		Interpolating_Native_NChan;
+#if defined( AKSIMD_AVX2_SUPPORTED )
+	if (AK::AkRuntimeEnvironmentMgr::Instance()->GetSIMDSupport(AK::AK_SIMD_AVX2))
+	{
+		PitchDSPFuncTable[PitchOperatingMode_Interpolating][I16_1Chan] =		Interpolating_I16_1ChanAVX2;
+		PitchDSPFuncTable[PitchOperatingMode_Interpolating][I16_2Chan] =		Interpolating_I16_2ChanAVX2;
+		PitchDSPFuncTable[PitchOperatingMode_Interpolating][Native_1Chan] =		Interpolating_Native_1ChanAVX2;
+		PitchDSPFuncTable[PitchOperatingMode_Interpolating][Native_2Chan] =		Interpolating_Native_2ChanAVX2;
+	}
+#endif
 }
 
 
@@ -169,12 +169,24 @@ AKRESULT Interpolating_I16_1Chan(	AkAudioBuffer * io_pInBuffer,
 									AkAudioBuffer * io_pOutBuffer,
 									AkUInt32 uRequestedSize,
 									AkInternalPitchState * io_pPitchState );	
+#if defined ( AKSIMD_AVX2_SUPPORTED )
+AKRESULT Interpolating_I16_1ChanAVX2(	AkAudioBuffer * io_pInBuffer,
+									AkAudioBuffer * io_pOutBuffer,
+									AkUInt32 uRequestedSize,
+									AkInternalPitchState * io_pPitchState );
+#endif
 
 // Interpolating resampling (pitch changes) with INTERLEAVED signed 16-bit samples optimized for 2 channel signals.
 AKRESULT Interpolating_I16_2Chan(	AkAudioBuffer * io_pInBuffer, 
 									AkAudioBuffer * io_pOutBuffer,
 									AkUInt32 uRequestedSize,
 									AkInternalPitchState * io_pPitchState );	
+#if defined ( AKSIMD_AVX2_SUPPORTED )
+AKRESULT Interpolating_I16_2ChanAVX2(	AkAudioBuffer * io_pInBuffer,
+									AkAudioBuffer * io_pOutBuffer,
+									AkUInt32 uRequestedSize,
+									AkInternalPitchState * io_pPitchState );
+#endif
 
 // Interpolating resampling (pitch changes) with INTERLEAVED signed 16-bit samples for any number of channels.
 AKRESULT Interpolating_I16_NChan(		AkAudioBuffer * io_pInBuffer, 
@@ -187,12 +199,24 @@ AKRESULT Interpolating_Native_1Chan(	AkAudioBuffer * io_pInBuffer,
 										AkAudioBuffer * io_pOutBuffer,
 										AkUInt32 uRequestedSize,
 										AkInternalPitchState * io_pPitchState );	
+#if defined ( AKSIMD_AVX2_SUPPORTED )
+AKRESULT Interpolating_Native_1ChanAVX2(	AkAudioBuffer * io_pInBuffer,
+										AkAudioBuffer * io_pOutBuffer,
+										AkUInt32 uRequestedSize,
+										AkInternalPitchState * io_pPitchState );
+#endif
 
 //  Interpolating resampling (pitch changes) with DEINTERLEAVED floating point samples optimized for 2 channel signals.
 AKRESULT Interpolating_Native_2Chan(	AkAudioBuffer * io_pInBuffer, 
 										AkAudioBuffer * io_pOutBuffer,
 										AkUInt32 uRequestedSize,
 										AkInternalPitchState * io_pPitchState );
+#if defined ( AKSIMD_AVX2_SUPPORTED )
+AKRESULT Interpolating_Native_2ChanAVX2(	AkAudioBuffer * io_pInBuffer,
+										AkAudioBuffer * io_pOutBuffer,
+										AkUInt32 uRequestedSize,
+										AkInternalPitchState * io_pPitchState );
+#endif
 
 //  Interpolating resampling (pitch changes) with DEINTERLEAVED floating point samples for any number of channels.
 AKRESULT Interpolating_Native_NChan(	AkAudioBuffer * io_pInBuffer, 
@@ -93,8 +93,6 @@ void CAkSrcFileADPCM::GetBuffer( AkVPLState & io_state )
 
 	AkUInt8 * pOutBuffer = m_pOutBuffer;
 	
-	AkUInt32 uChannelBlockSize = m_uInputBlockSize / uNumChannels;
-	
 	// Might need to process one compressed block split between input buffers
 
 	if ( m_wExtraSize )
@@ -103,15 +101,9 @@ void CAkSrcFileADPCM::GetBuffer( AkVPLState & io_state )
 		AKPLATFORM::AkMemCpy( m_pExtraBlock + m_wExtraSize, m_pNextAddress, m_uInputBlockSize - m_wExtraSize );
 
 		if (m_uFormatTag == AK_WAVE_FORMAT_ADPCM)
-		{
-			for (AkUInt32 iChan = 0; iChan < uNumChannels; ++iChan)
-				CAkADPCMCodec::Decode(m_pExtraBlock + iChan * uChannelBlockSize, pOutBuffer + iChan * sizeof(AkInt16), 1, m_uInputBlockSize, uNumChannels);
-		}
+			CAkADPCMCodec::DecodeAllChannels(m_pExtraBlock, pOutBuffer, 1, uNumChannels);
 		else
-		{
-			for (AkUInt32 iChan = 0; iChan < uNumChannels; ++iChan)
-				PtADPCM::DecodeBlocks((AkInt16 *)pOutBuffer + iChan, m_pExtraBlock + iChan * uChannelBlockSize, m_uSamplesPerBlock, m_uInputBlockSize, uNumChannels);
-		}
+			PtADPCM::DecodeAllChannels((AkInt16 *)pOutBuffer, m_pExtraBlock, 1, uNumChannels);
 			
 		ConsumeData( m_uInputBlockSize - m_wExtraSize );
 
@@ -126,16 +118,11 @@ void CAkSrcFileADPCM::GetBuffer( AkVPLState & io_state )
 	AkUInt32 uNumBlocks = uMaxFrames / m_uSamplesPerBlock;
 	AkUInt32 ulADPCMBlocksToProcess = AkMin( uSizeLeftFrames, uNumBlocks);
 
+	// Channel blocks are decoded together, several at a time where SIMD is available.
 	if (m_uFormatTag == AK_WAVE_FORMAT_ADPCM)
-	{
-		for (AkUInt32 iChan = 0; iChan < uNumChannels; ++iChan)
-			CAkADPCMCodec::Decode(m_pNextAddress + iChan * uChannelBlockSize, pOutBuffer + iChan * sizeof(AkInt16), ulADPCMBlocksToProcess, m_uInputBlockSize, uNumChannels);
-	}
+		CAkADPCMCodec::DecodeAllChannels(m_pNextAddress, pOutBuffer, ulADPCMBlocksToProcess, uNumChannels);
 	else
-	{
-		for (AkUInt32 iChan = 0; iChan < uNumChannels; ++iChan)
-			PtADPCM::DecodeBlocks((AkInt16 *)pOutBuffer + iChan, m_pNextAddress + iChan * uChannelBlockSize, ulADPCMBlocksToProcess*m_uSamplesPerBlock, m_uInputBlockSize, uNumChannels);
-	}
+		PtADPCM::DecodeAllChannels((AkInt16 *)pOutBuffer, m_pNextAddress, ulADPCMBlocksToProcess, uNumChannels);
 
 	pOutBuffer += ulADPCMBlocksToProcess * ulPCMBlockAlign;
 
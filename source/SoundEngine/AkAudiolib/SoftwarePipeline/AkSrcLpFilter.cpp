@@ -246,6 +246,80 @@ void _Execute( AkAudioBuffer * io_pBuffer, AkBQFParams& io_params, DSP::BiquadFi
 	}
 }
 
+template< typename EvalBqfParams >
+static AkForceInline void _UpdateBlockCoefs( AkBQFParams& io_params, DSP::BiquadFilterMultiSIMD& in_Bqf, AkReal32 in_fParamStart, AkReal32 in_fParamDiff )
+{
+	if ( io_params.IsInterpolating() )
+	{
+		++io_params.uNumInterBlocks;
+		AkReal32 fCurrentPar = in_fParamStart + (in_fParamDiff*io_params.uNumInterBlocks)/NUMBLOCKTOREACHTARGET;
+		AkReal32 fCutFreq = EvalBqfParams::EvalCutoff( fCurrentPar, AK_NUM_VOICE_REFILL_FRAMES );
+		EvalBqfParams::ComputeCoefs(in_Bqf, fCutFreq);
+	}
+}
+
+// End-of-buffer state transitions of a non-bypassed filter; same as the tail of both branches of _Execute.
+template< typename EvalBqfParams >
+static AkForceInline void _EndBuffer( AkBQFParams& io_params, bool in_bWasInterpolating )
+{
+	if ( in_bWasInterpolating )
+	{
+		if ( !io_params.IsInterpolating() )
+		{
+			io_params.fCurrentPar = io_params.fTargetPar;
+			if (EvalBqfParams::EvalBypass( io_params.fTargetPar ))
+				io_params.iNextBypass = AkBQFParams::kFramesToBypass;
+		}
+	}
+	else if (AK_EXPECT_FALSE( io_params.iNextBypass > 0 ) )
+	{
+		if ( --io_params.iNextBypass == 0 )
+			io_params.SetBypassed(true);
+	}
+}
+
+// Runs the LPF and the HPF in a single pass, one LPFPARAMUPDATEPERIOD block at a time, so that each block is still in cache
+// when the HPF processes it. Both filters must be active (not bypassed). The output is identical to running _Execute on
+// each filter in turn: the filter states are independent, coefficients are updated on the same block boundaries, and the
+// biquads carry their memories across blocks exactly.
+static void _ExecuteCascade( AkAudioBuffer * io_pBuffer, AkInternalBQFState& io_state )
+{
+	AKASSERT( io_pBuffer != NULL && io_pBuffer->GetChannel( 0 ) != NULL );
+	AKASSERT( io_pBuffer->MaxFrames() != 0 && io_pBuffer->uValidFrames <= io_pBuffer->MaxFrames() );
+	AKASSERT( !io_state.m_LPFParams.IsBypassed() && !io_state.m_HPFParams.IsBypassed() );
+
+	AkReal32 * pfBuf = (AkReal32*)io_pBuffer->GetInterleavedData();
+	const AkUInt32 uNumFrames = io_pBuffer->uValidFrames;
+	const AkUInt32 uMaxFrames = io_pBuffer->MaxFrames();
+
+	AkBQFParams& lpfParams = io_state.m_LPFParams;
+	AkBQFParams& hpfParams = io_state.m_HPFParams;
+
+	const bool bLPFInterpolating = lpfParams.IsInterpolating();
+	const bool bHPFInterpolating = hpfParams.IsInterpolating();
+	const AkReal32 fLPFParamStart = lpfParams.fCurrentPar;
+	const AkReal32 fLPFParamDiff = lpfParams.fTargetPar - fLPFParamStart;
+	const AkReal32 fHPFParamStart = hpfParams.fCurrentPar;
+	const AkReal32 fHPFParamDiff = hpfParams.fTargetPar - fHPFParamStart;
+
+	AkUInt32 uFramesProduced = 0;
+	while ( uFramesProduced < uNumFrames )
+	{
+		AkUInt32 uFramesInBlock = AkMin(LPFPARAMUPDATEPERIOD, uNumFrames-uFramesProduced);
+
+		_UpdateBlockCoefs<AkLpfParamEval>( lpfParams, io_state.m_LPF, fLPFParamStart, fLPFParamDiff );
+		io_state.m_LPF.ProcessBuffer(pfBuf + uFramesProduced, uFramesInBlock, uMaxFrames);
+
+		_UpdateBlockCoefs<AkHpfParamEval>( hpfParams, io_state.m_HPF, fHPFParamStart, fHPFParamDiff );
+		io_state.m_HPF.ProcessBuffer(pfBuf + uFramesProduced, uFramesInBlock, uMaxFrames);
+
+		uFramesProduced += uFramesInBlock;
+	}
+
+	_EndBuffer<AkLpfParamEval>( lpfParams, bLPFInterpolating );
+	_EndBuffer<AkHpfParamEval>( hpfParams, bHPFInterpolating );
+}
+
 // This is just a copy of _Execute using the out of place logic from the mono code
 template< typename EvalBqfParams >
 void _ExecuteOutOfPlace(AkAudioBuffer * in_pBuffer, AkAudioBuffer * out_pBuffer, AkBQFParams& io_params, DSP::BiquadFilterMultiSIMD& in_Bqf)
@@ -544,10 +618,21 @@ void CAkSrcLpHpFilter::Execute( AkAudioBuffer * io_pBuffer )
 	AKPLATFORM::PerformanceCounter( &TimeBefore ); 
 #endif
 
-	if ( m_InternalBQFState.m_LPF.IsInitialized() )
-		_Execute<AkLpfParamEval>( io_pBuffer, m_InternalBQFState.m_LPFParams, m_InternalBQFState.m_LPF );
-	if ( m_InternalBQFState.m_HPF.IsInitialized() )
-		_Execute<AkHpfParamEval>( io_pBuffer, m_InternalBQFState.m_HPFParams, m_InternalBQFState.m_HPF );
+	// Parameter changes of one filter do not affect the other, so they can all be managed up front.
+	// When both filters end up active, process them in a single pass over the buffer.
+	if ( IsInitialized()
+		&& !_ManageBQFChange<AkLpfParamEval>( m_InternalBQFState.m_LPFParams, m_InternalBQFState.m_LPF )
+		&& !_ManageBQFChange<AkHpfParamEval>( m_InternalBQFState.m_HPFParams, m_InternalBQFState.m_HPF ) )
+	{
+		_ExecuteCascade( io_pBuffer, m_InternalBQFState );
+	}
+	else
+	{
+		if ( m_InternalBQFState.m_LPF.IsInitialized() )
+			_Execute<AkLpfParamEval>( io_pBuffer, m_InternalBQFState.m_LPFParams, m_InternalBQFState.m_LPF );
+		if ( m_InternalBQFState.m_HPF.IsInitialized() )
+			_Execute<AkHpfParamEval>( io_pBuffer, m_InternalBQFState.m_HPFParams, m_InternalBQFState.m_HPF );
+	}
 
 #ifdef PERFORMANCE_BENCHMARK
 	AkInt64 TimeAfter;
@@ -686,3 +771,171 @@ bool CAkSrcLpHpFilter::ManageBQFChange()
 
 	return res;
 }
+
+bool CAkSrcLpHpFilter::PrepareMonoBank( AkAudioBuffer * in_pBuffer )
+{
+	if ( !IsInitialized() || m_InternalBQFState.channelConfig.uNumChannels != 1 )
+		return false;
+
+	// The bank processes 4 frames at a time, exactly like the mono SIMD biquad when the frame count needs no padding.
+	const AkUInt32 uNumFrames = in_pBuffer->uValidFrames;
+	if ( uNumFrames == 0 || ( uNumFrames & 3 ) != 0 )
+		return false;
+
+	AkBQFParams& lpfParams = m_InternalBQFState.m_LPFParams;
+	AkBQFParams& hpfParams = m_InternalBQFState.m_HPFParams;
+	bool bLPFBypassed = _ManageBQFChange<AkLpfParamEval>( lpfParams, m_InternalBQFState.m_LPF );
+	bool bHPFBypassed = _ManageBQFChange<AkHpfParamEval>( hpfParams, m_InternalBQFState.m_HPF );
+
+	// Nothing to gain when both filters are bypassed, and interpolation or DC removal are left to the per-voice path.
+	return ( !bLPFBypassed || !bHPFBypassed )
+		&& ( bLPFBypassed ? lpfParams.IsDcRemoved() : !lpfParams.IsInterpolating() )
+		&& ( bHPFBypassed ? hpfParams.IsDcRemoved() : !hpfParams.IsInterpolating() );
+}
+
+#ifdef AKSIMD_V4F32_SUPPORTED
+#define AKSIMD_TRANSPOSE4_V4F32( __a__, __b__, __c__, __d__ ) \
+{ \
+	AKSIMD_V4F32 __t0__ = AKSIMD_SHUFFLE_V4F32( (__a__), (__b__), AKSIMD_SHUFFLE( 1, 0, 1, 0 ) ); \
+	AKSIMD_V4F32 __t1__ = AKSIMD_SHUFFLE_V4F32( (__a__), (__b__), AKSIMD_SHUFFLE( 3, 2, 3, 2 ) ); \
+	AKSIMD_V4F32 __t2__ = AKSIMD_SHUFFLE_V4F32( (__c__), (__d__), AKSIMD_SHUFFLE( 1, 0, 1, 0 ) ); \
+	AKSIMD_V4F32 __t3__ = AKSIMD_SHUFFLE_V4F32( (__c__), (__d__), AKSIMD_SHUFFLE( 3, 2, 3, 2 ) ); \
+	(__a__) = AKSIMD_SHUFFLE_V4F32( __t0__, __t2__, AKSIMD_SHUFFLE( 2, 0, 2, 0 ) ); \
+	(__b__) = AKSIMD_SHUFFLE_V4F32( __t0__, __t2__, AKSIMD_SHUFFLE( 3, 1, 3, 1 ) ); \
+	(__c__) = AKSIMD_SHUFFLE_V4F32( __t1__, __t3__, AKSIMD_SHUFFLE( 2, 0, 2, 0 ) ); \
+	(__d__) = AKSIMD_SHUFFLE_V4F32( __t1__, __t3__, AKSIMD_SHUFFLE( 3, 1, 3, 1 ) ); \
+}
+
+// One direct form biquad step for all lanes: Y = X*B0 + Xm1*B1 + Xm2*B2 + Ym1*A1 + Ym2*A2 (A1 and A2 negated).
+#define AK_BANK_BIQUAD_STEP( __vX__, __vY__ ) \
+{ \
+	AKSIMD_V4F32 vTerm = AKSIMD_MUL_V4F32( (__vX__), vB0 ); \
+	vTerm = AKSIMD_MADD_V4F32( vXm1, vB1, vTerm ); \
+	vTerm = AKSIMD_MADD_V4F32( vXm2, vB2, vTerm ); \
+	vTerm = AKSIMD_MADD_V4F32( vYm1, vA1, vTerm ); \
+	(__vY__) = AKSIMD_MADD_V4F32( vYm2, vA2, vTerm ); \
+	vXm2 = vXm1; \
+	vXm1 = (__vX__); \
+	vYm2 = vYm1; \
+	vYm1 = (__vY__); \
+}
+
+// Runs one biquad per lane over in_uNumFrames (a multiple of 4) frames of each lane's buffer, in place.
+// Unused lanes repeat the first lane's input and their output is discarded.
+static void _ProcessMonoBank( DSP::BiquadFilterMultiSIMD ** in_ppBqf, AkReal32 ** io_ppBuf, AkUInt32 in_uLanes, AkUInt32 in_uNumFrames )
+{
+	AKASSERT( in_uLanes >= 1 && in_uLanes <= CAkSrcLpHpFilter::kMonoBankWidth );
+	AKASSERT( ( in_uNumFrames & 3 ) == 0 );
+
+	AK_ALIGN_SIMD( AkReal32 fCoefs[5][4] );
+	AK_ALIGN_SIMD( AkReal32 fMems[4][4] );
+	AkReal32 * pBuf[4];
+	for ( AkUInt32 uLane = 0; uLane < 4; ++uLane )
+	{
+		AkUInt32 uSrcLane = ( uLane < in_uLanes ) ? uLane : 0;
+		in_ppBqf[uSrcLane]->GetMonoCoefs( fCoefs[0][uLane], fCoefs[1][uLane], fCoefs[2][uLane], fCoefs[3][uLane], fCoefs[4][uLane] );
+		in_ppBqf[uSrcLane]->GetMemories( 0, fMems[0][uLane], fMems[1][uLane], fMems[2][uLane], fMems[3][uLane] );
+		pBuf[uLane] = io_ppBuf[uSrcLane];
+	}
+
+	const AKSIMD_V4F32 vB0 = AKSIMD_LOAD_V4F32( fCoefs[0] );
+	const AKSIMD_V4F32 vB1 = AKSIMD_LOAD_V4F32( fCoefs[1] );
+	const AKSIMD_V4F32 vB2 = AKSIMD_LOAD_V4F32( fCoefs[2] );
+	const AKSIMD_V4F32 vA1 = AKSIMD_LOAD_V4F32( fCoefs[3] );
+	const AKSIMD_V4F32 vA2 = AKSIMD_LOAD_V4F32( fCoefs[4] );
+	AKSIMD_V4F32 vXm1 = AKSIMD_LOAD_V4F32( fMems[0] );
+	AKSIMD_V4F32 vXm2 = AKSIMD_LOAD_V4F32( fMems[1] );
+	AKSIMD_V4F32 vYm1 = AKSIMD_LOAD_V4F32( fMems[2] );
+	AKSIMD_V4F32 vYm2 = AKSIMD_LOAD_V4F32( fMems[3] );
+
+	for ( AkUInt32 uFrame = 0; uFrame < in_uNumFrames; uFrame += 4 )
+	{
+		// Rows are lanes on load; after the transpose, each vector holds one frame of every lane.
+		AKSIMD_V4F32 v0 = AKSIMD_LOAD_V4F32( pBuf[0] + uFrame );
+		AKSIMD_V4F32 v1 = AKSIMD_LOAD_V4F32( pBuf[1] + uFrame );
+		AKSIMD_V4F32 v2 = AKSIMD_LOAD_V4F32( pBuf[2] + uFrame );
+		AKSIMD_V4F32 v3 = AKSIMD_LOAD_V4F32( pBuf[3] + uFrame );
+		AKSIMD_TRANSPOSE4_V4F32( v0, v1, v2, v3 );
+
+		AKSIMD_V4F32 vY0, vY1, vY2, vY3;
+		AK_BANK_BIQUAD_STEP( v0, vY0 );
+		AK_BANK_BIQUAD_STEP( v1, vY1 );
+		AK_BANK_BIQUAD_STEP( v2, vY2 );
+		AK_BANK_BIQUAD_STEP( v3, vY3 );
+
+		AKSIMD_TRANSPOSE4_V4F32( vY0, vY1, vY2, vY3 );
+		AKSIMD_STORE_V4F32( pBuf[0] + uFrame, vY0 );
+		if ( in_uLanes > 1 ) AKSIMD_STORE_V4F32( pBuf[1] + uFrame, vY1 );
+		if ( in_uLanes > 2 ) AKSIMD_STORE_V4F32( pBuf[2] + uFrame, vY2 );
+		if ( in_uLanes > 3 ) AKSIMD_STORE_V4F32( pBuf[3] + uFrame, vY3 );
+	}
+
+	AKSIMD_STORE_V4F32( fMems[0], vXm1 );
+	AKSIMD_STORE_V4F32( fMems[1], vXm2 );
+	AKSIMD_STORE_V4F32( fMems[2], vYm1 );
+	AKSIMD_STORE_V4F32( fMems[3], vYm2 );
+	for ( AkUInt32 uLane = 0; uLane < in_uLanes; ++uLane )
+		in_ppBqf[uLane]->SetMemories( 0, fMems[0][uLane], fMems[1][uLane], fMems[2][uLane], fMems[3][uLane] );
+}
+
+// Runs one of the two filters (LPF or HPF) of every voice. Active filters are packed in the bank; bypassed ones, or a
+// lone active one, go through _Execute, which then only has to track memories or run the regular mono biquad.
+template< typename EvalBqfParams >
+static void _ExecuteMonoBankFilter( DSP::BiquadFilterMultiSIMD ** in_ppBqf, AkBQFParams ** io_ppParams, AkAudioBuffer ** io_ppBuffers, AkUInt32 in_uNumVoices )
+{
+	DSP::BiquadFilterMultiSIMD * pLaneBqf[CAkSrcLpHpFilter::kMonoBankWidth];
+	AkReal32 * pLaneBuf[CAkSrcLpHpFilter::kMonoBankWidth];
+	bool bInBank[CAkSrcLpHpFilter::kMonoBankWidth];
+	AkUInt32 uLanes = 0;
+	for ( AkUInt32 i = 0; i < in_uNumVoices; ++i )
+	{
+		bInBank[i] = !io_ppParams[i]->IsBypassed();
+		if ( bInBank[i] )
+		{
+			pLaneBqf[uLanes] = in_ppBqf[i];
+			pLaneBuf[uLanes] = (AkReal32*)io_ppBuffers[i]->GetInterleavedData();
+			++uLanes;
+		}
+	}
+
+	if ( uLanes > 1 )
+		_ProcessMonoBank( pLaneBqf, pLaneBuf, uLanes, io_ppBuffers[0]->uValidFrames );
+
+	for ( AkUInt32 i = 0; i < in_uNumVoices; ++i )
+	{
+		if ( bInBank[i] && uLanes > 1 )
+			_EndBuffer<EvalBqfParams>( *io_ppParams[i], false );
+		else
+			_Execute<EvalBqfParams>( io_ppBuffers[i], *io_ppParams[i], *in_ppBqf[i] );
+	}
+}
+#endif
+
+void CAkSrcLpHpFilter::ExecuteMonoBank( CAkSrcLpHpFilter ** in_ppFilters, AkAudioBuffer ** io_ppBuffers, AkUInt32 in_uNumVoices )
+{
+	AKASSERT( in_uNumVoices <= kMonoBankWidth );
+
+#ifdef AKSIMD_V4F32_SUPPORTED
+	DSP::BiquadFilterMultiSIMD * pBqf[kMonoBankWidth];
+	AkBQFParams * pParams[kMonoBankWidth];
+
+	// The HPF runs on the output of the LPF, as in Execute.
+	for ( AkUInt32 i = 0; i < in_uNumVoices; ++i )
+	{
+		AKASSERT( io_ppBuffers[i]->uValidFrames == io_ppBuffers[0]->uValidFrames );
+		pBqf[i] = &in_ppFilters[i]->m_InternalBQFState.m_LPF;
+		pParams[i] = &in_ppFilters[i]->m_InternalBQFState.m_LPFParams;
+	}
+	_ExecuteMonoBankFilter<AkLpfParamEval>( pBqf, pParams, io_ppBuffers, in_uNumVoices );
+
+	for ( AkUInt32 i = 0; i < in_uNumVoices; ++i )
+	{
+		pBqf[i] = &in_ppFilters[i]->m_InternalBQFState.m_HPF;
+		pParams[i] = &in_ppFilters[i]->m_InternalBQFState.m_HPFParams;
+	}
+	_ExecuteMonoBankFilter<AkHpfParamEval>( pBqf, pParams, io_ppBuffers, in_uNumVoices );
+#else
+	for ( AkUInt32 i = 0; i < in_uNumVoices; ++i )
+		in_ppFilters[i]->Execute( io_ppBuffers[i] );
+#endif
+}
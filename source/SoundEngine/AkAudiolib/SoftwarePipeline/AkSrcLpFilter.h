@@ -122,6 +122,18 @@ public:
 
 	bool ManageBQFChange();
 
+	// Number of mono voices filtered together by ExecuteMonoBank, one per SIMD lane.
+	static const AkUInt32 kMonoBankWidth = 4;
+
+	// Applies pending parameter changes and returns whether the filters of this voice can be run by ExecuteMonoBank on
+	// in_pBuffer: mono, at least one filter active, no coefficient interpolation, and a multiple of 4 frames.
+	bool PrepareMonoBank( AkAudioBuffer * in_pBuffer );
+
+	// Filters the buffers of up to kMonoBankWidth mono voices, which must all have the same number of valid frames and
+	// have been accepted by PrepareMonoBank. Equivalent to calling Execute on each voice, but the active filters of
+	// different voices run side by side in the lanes of one SIMD filter bank.
+	static void ExecuteMonoBank( CAkSrcLpHpFilter ** in_ppFilters, AkAudioBuffer ** io_ppBuffers, AkUInt32 in_uNumVoices );
+
 private:
 
 	AkInternalBQFState m_InternalBQFState;
@@ -24,6 +24,7 @@
 #include "AkBehavioralCtx.h"
 
 struct SpeakerVolumeMatrixCallback;
+class AkFloat16Buffer;
 
 
 class CAkVPL3dMixable : public AK::IAkVoicePluginInfo
@@ -47,6 +48,7 @@ public:
 					  , m_bVisited(false)
 #endif
 					  , m_pMixableBuffer(NULL)
+					  , m_pPackedMixableBuffer(NULL)
 	{}
 
 	virtual ~CAkVPL3dMixable();
@@ -297,6 +299,7 @@ protected:
 #endif
 public:
 	AkAudioBuffer * m_pMixableBuffer;
+	const AkFloat16Buffer * m_pPackedMixableBuffer;	// Half-precision output of a voice, used instead of m_pMixableBuffer (see AkInitSettings::bFloat16VoiceBuffers).
 };
 
 
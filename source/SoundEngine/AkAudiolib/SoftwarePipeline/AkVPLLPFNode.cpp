@@ -27,6 +27,22 @@ void CAkVPLBQFNode::ConsumeBuffer( AkVPLState & io_state )
 	}
 }
 
+void CAkVPLBQFNode::ConsumeBufferBank( CAkVPLBQFNode ** in_ppNodes, AkVPLState ** io_ppStates, AkUInt32 in_uNumNodes )
+{
+	AKASSERT( in_uNumNodes <= CAkSrcLpHpFilter::kMonoBankWidth );
+
+	CAkSrcLpHpFilter * pFilters[CAkSrcLpHpFilter::kMonoBankWidth];
+	AkAudioBuffer * pBuffers[CAkSrcLpHpFilter::kMonoBankWidth];
+	for ( AkUInt32 i = 0; i < in_uNumNodes; ++i )
+	{
+		AKASSERT( io_ppStates[i]->HasData() );
+		pFilters[i] = &in_ppNodes[i]->m_LpHpFilter;
+		pBuffers[i] = io_ppStates[i];
+	}
+
+	CAkSrcLpHpFilter::ExecuteMonoBank( pFilters, pBuffers, in_uNumNodes );
+}
+
 void CAkVPLBQFNode::ProcessDone( AkVPLState & io_state )
 {
 }
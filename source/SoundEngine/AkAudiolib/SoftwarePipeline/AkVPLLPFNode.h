@@ -40,6 +40,13 @@ public:
 
 	virtual void		VirtualOn( AkVirtualQueueBehavior eBehavior );
 
+	// True when ConsumeBuffer for io_state may be deferred to ConsumeBufferBank (see CAkSrcLpHpFilter::PrepareMonoBank).
+	AkForceInline bool	CanConsumeInBank( AkVPLState & io_state ) { return io_state.HasData() && m_LpHpFilter.PrepareMonoBank( &io_state ); }
+
+	// Same as calling ConsumeBuffer on each node, for up to CAkSrcLpHpFilter::kMonoBankWidth nodes accepted by
+	// CanConsumeInBank with states of the same length, filtered together by one SIMD filter bank.
+	static void			ConsumeBufferBank( CAkVPLBQFNode ** in_ppNodes, AkVPLState ** io_ppStates, AkUInt32 in_uNumNodes );
+
 private:
 	CAkSrcLpHpFilter		m_LpHpFilter;			// Pointer to lpf/hpf object.
 };
@@ -1241,7 +1241,7 @@ void CAkVPLMixBusNode::ConsumeBuffer(
 			AkVPLState outOfPlaceCopy;
 			outOfPlaceCopy.SetChannelConfig( io_rVPLState.GetChannelConfig() );
 			outOfPlaceCopy.SetRequestSize( io_rVPLState.MaxFrames() );
-			AKRESULT eResult = outOfPlaceCopy.GetCachedBuffer( );
+			AKRESULT eResult = outOfPlaceCopy.GetScratchBuffer( );
 			if ( eResult == AK_Success )
 			{
 				memcpy( outOfPlaceCopy.GetChannel( 0 ), io_rVPLState.GetChannel( 0 ), io_rVPLState.GetChannelConfig().uNumChannels * io_rVPLState.MaxFrames() * sizeof( AkSampleType ) );
@@ -1278,7 +1278,7 @@ void CAkVPLMixBusNode::ConsumeBuffer(
 #endif
 			if ( eResult == AK_Success )
 			{
-				outOfPlaceCopy.ReleaseCachedBuffer();
+				outOfPlaceCopy.ReleaseScratchBuffer();
 			}
 			else
 			{
@@ -28,6 +28,7 @@
 #include "AkPositionRepository.h"
 #include "AkPlayingMgr.h"
 #include "AkSrcPhysModel.h"
+#include "AkURenderer.h"
 
 #define MAX_NODES		( 5 + AK_NUM_EFFECTS_PER_OBJ )	// Max nodes in the cbx node list. 4 is "LPF + HPF + Pitch + Source + VolumeAutomation"
 
@@ -63,6 +64,11 @@ CAkVPLSrcCbxNode::CAkVPLSrcCbxNode()
 	, m_eState( NodeStateInit )
 	, m_bHasStarved( false )
 	, m_bPipelineAdded( false )
+	, m_bColdVirtualVoice( false )
+	, m_bColdRefValid( false )
+	, m_uColdFrames( 0 )
+	, m_uColdPositionVersion( 0 )
+	, m_fColdMinDistance( 0.f )
 #ifndef AK_OPTIMIZED
 	, m_iWasStarvationSignaled( 0 )
 #endif
@@ -329,13 +335,22 @@ bool CAkVPLSrcCbxNode::StartRun( AkVPLState & io_state )
 	pSrcContext->CloseSoundBrace();
 #endif
 
-	GetVolumes( pSrcContext, channelConfig, fMakeupGainLinearNormalized, pSrcNode->StartWithFadeIn(), bNextSilent, bAudible,
-		((pSrcContext->GetRegisteredNotif() & AK_SpeakerVolumeMatrix) ? &cb : NULL));
+	if ( m_bColdVirtualVoice )
+	{
+		// Not evaluated this frame: stays virtual.
+		bNextSilent = true;
+		bAudible = false;
+	}
+	else
+	{
+		GetVolumes( pSrcContext, channelConfig, fMakeupGainLinearNormalized, pSrcNode->StartWithFadeIn(), bNextSilent, bAudible,
+			((pSrcContext->GetRegisteredNotif() & AK_SpeakerVolumeMatrix) ? &cb : NULL));
 
-	// Set voice LPF.
-	const AkSoundParams & params = pSrcContext->GetEffectiveParams();
-	m_cbxRec.m_BQF.SetLPF(params.LPF());
-	m_cbxRec.m_BQF.SetHPF(params.HPF());
+		// Set voice LPF.
+		const AkSoundParams & params = pSrcContext->GetEffectiveParams();
+		m_cbxRec.m_BQF.SetLPF(params.LPF());
+		m_cbxRec.m_BQF.SetHPF(params.HPF());
+	}
 
 	bool bNeedToRun = true;
 	AkInt32 iFrameSize = pSrcContext->ScaleFrameSize( io_state.MaxFrames() );
@@ -651,11 +666,40 @@ void CAkVPLSrcCbxNode::ConsumeBuffer( AkVPLState & io_state )
 //-----------------------------------------------------------------------------
 void CAkVPLSrcCbxNode::ReleaseBuffer()
 {
-	// We need to release an upstream node's buffer.
-	m_cbxRec.Head()->ReleaseBuffer();
+	if ( m_pPackedMixableBuffer )
+	{
+		// Upstream buffers were already released when packing.
+		m_packedVplState.ReleaseBuffer();
+		m_pPackedMixableBuffer = NULL;
+	}
+	else
+	{
+		// We need to release an upstream node's buffer.
+		m_cbxRec.Head()->ReleaseBuffer();
+	}
 	m_pMixableBuffer = NULL;
 } // ReleaseBuffer
 
+void CAkVPLSrcCbxNode::PackMixableBuffer()
+{
+	// Each audible connection unpacks its own copy: voices mixed into more than one bus keep their buffer.
+	AkUInt32 uNumAudibleConnections = 0;
+	for ( CAkMixConnections::Iterator it = BeginConnection(); it != EndConnection(); ++it )
+	{
+		if ( (*it)->IsAudible() )
+			++uNumAudibleConnections;
+	}
+
+	if ( uNumAudibleConnections == 1
+		&& m_pMixableBuffer
+		&& m_packedVplState.Pack( *m_pMixableBuffer ) == AK_Success )
+	{
+		m_cbxRec.Head()->ReleaseBuffer();
+		m_pMixableBuffer = NULL;
+		m_pPackedMixableBuffer = &m_packedVplState;
+	}
+}
+
 // Switch to next source on the combiner in the sample-accurate transition scenario
 AKRESULT CAkVPLSrcCbxNode::TrySwitchToNextSrc(const AkPipelineBuffer &io_state)
 {
@@ -770,7 +814,7 @@ void CAkVPLSrcCbxNode::SwitchToNextSrc()
 	m_pSources[ 0 ] = m_pSources[ 1 ];
 	m_pContext = m_pSources[0]->GetContext(); //<- update m_pContext to point to new source.
 	m_pSources[ 1 ] = NULL;
-
+	m_bColdRefValid = false; // New context: its virtual voice reference must be taken again.
 
 	m_pSources[ 0 ]->Start();
 	m_cbxRec.m_VolAutm.SetPBI(m_pSources[0]->GetContext());
@@ -1204,6 +1248,10 @@ void CAkVPLSrcCbxNode::ComputeVolumeRays()
 	CAkPBI * AK_RESTRICT pContext = m_pSources[ 0 ]->GetContext(); // remember the FIRST context to play in this frame
 	AKASSERT( pContext != NULL );
 
+	m_bColdVirtualVoice = CanSkipVirtualVoiceEvaluation( pContext );
+	if ( m_bColdVirtualVoice )
+		return;
+
 	pContext->CalcEffectiveParams();
 
 	if( !pContext->IsForcedVirtualized() )
@@ -1231,6 +1279,49 @@ void CAkVPLSrcCbxNode::ComputeVolumeRays()
 	}
 }
 
+// Virtual voices that fell below the volume threshold are fully evaluated only every g_settings.uVirtualVoiceRefreshInterval frames,
+// or as soon as their parameters change or their emitter gets closer to or farther from its listeners by more than g_settings.fVirtualVoiceRefreshDistance.
+bool CAkVPLSrcCbxNode::CanSkipVirtualVoiceEvaluation( CAkPBI * in_pCtx )
+{
+	AkUInt32 uInterval = g_settings.uVirtualVoiceRefreshInterval;
+	if ( uInterval <= 1
+		|| m_bAudible
+		|| m_eBelowThresholdBehavior != AkBelowThresholdBehavior_SetAsVirtualVoice
+		|| in_pCtx->IsForcedVirtualized()
+		|| in_pCtx->HasPendingParameterChanges()
+		|| !in_pCtx->GetModulatorData().IsEmpty()
+		|| in_pCtx->Get3DAutomation() )
+	{
+		m_bColdRefValid = false;
+		return false;
+	}
+
+	CAkEmitter * pEmitter = in_pCtx->GetEmitter();
+	if ( !m_bColdRefValid )
+	{
+		// Just became virtual: evaluate this frame, and take the reference for the following ones.
+		// Start at a different point of the interval for each voice, to spread the evaluations over frames.
+		m_bColdRefValid = true;
+		m_uColdFrames = in_pCtx->GetPipelineID() % uInterval;
+		m_uColdPositionVersion = pEmitter->GetPositionVersion();
+		m_fColdMinDistance = CAkURenderer::GetMinDistance( pEmitter->GetPosition(), in_pCtx->GetGameObjectPtr()->GetListeners() );
+		return false;
+	}
+
+	bool bIntervalElapsed = ( ++m_uColdFrames >= uInterval );
+	if ( !bIntervalElapsed && pEmitter->GetPositionVersion() == m_uColdPositionVersion && pEmitter->IsPositionCached() )
+		return true;
+
+	m_uColdPositionVersion = pEmitter->GetPositionVersion();
+	AkReal32 fMinDistance = CAkURenderer::GetMinDistance( pEmitter->GetPosition(), in_pCtx->GetGameObjectPtr()->GetListeners() );
+	if ( !bIntervalElapsed && AkMath::Abs( fMinDistance - m_fColdMinDistance ) <= g_settings.fVirtualVoiceRefreshDistance )
+		return true;
+
+	m_uColdFrames = 0;
+	m_fColdMinDistance = fMinDistance;
+	return false;
+}
+
 //-----------------------------------------------------------------------------
 // Name: AddSrc
 // Desc: Add a source.
@@ -26,6 +26,7 @@
 #include "AkMixConnection.h"
 #include "AkVPL3dMixable.h"
 #include "AkMarkersQueue.h"
+#include "AkFloat16Buffer.h"
 
 #define MAX_NUM_SOURCES			2			// Max no. of sources in sample accurate container. 
 
@@ -77,6 +78,10 @@ public:
 	void ReleaseBuffer();
 	AKRESULT AddPipeline();
 
+	// Stores the mixable buffer in half-precision and releases the pipeline buffers right away (see AkInitSettings::bFloat16VoiceBuffers).
+	// Leaves the mixable buffer as is if the voice has more than one audible connection, or if the copy cannot be allocated.
+	void PackMixableBuffer();
+
 	bool IsUsingThisSlot(const CAkUsageSlot* in_pUsageSlot);
 	bool IsUsingThisSlot(const AkUInt8* in_pData);
 	AKRESULT FetchStreamedData(CAkPBI * in_pCtx);
@@ -127,6 +132,10 @@ public:
 	// Compute volumes of all emitter-listener pairs for this sound. 
 	void ComputeVolumeRays();
 
+	// True when this virtual voice is not evaluated this frame (see AkInitSettings::uVirtualVoiceRefreshInterval).
+	// Set by ComputeVolumeRays(); its connections, HDR and volumes are then left untouched until the next evaluation.
+	AkForceInline bool IsColdVirtualVoice() const { return m_bColdVirtualVoice; }
+
 	// AK::IAkVoicePluginInfo interface
 	virtual AkPlayingID GetPlayingID() const { return GetPBI()->GetPlayingID(); }
 	virtual AkPriority GetPriority() const { return GetPBI()->GetPriority(); }
@@ -170,6 +179,7 @@ protected:
 	// Helpers.
 	// 
 	void SetAudible( CAkPBI * in_pCtx, bool in_bAudible );
+	bool CanSkipVirtualVoiceEvaluation( CAkPBI * in_pCtx );
 
 	AkVPLSrcCbxRec		m_cbxRec;
 	CAkVPLSrcNode *		m_pSources[MAX_NUM_SOURCES];	// [0] == Current, [1] == Next
@@ -185,12 +195,19 @@ protected:
 
 	AkUInt8				m_bHasStarved:1;
 	AkUInt8				m_bPipelineAdded:1;
+	AkUInt8				m_bColdVirtualVoice:1;
+	AkUInt8				m_bColdRefValid:1;		// m_uColdPositionVersion and m_fColdMinDistance were taken at the last evaluation of this virtual voice.
+
+	AkUInt32			m_uColdFrames;			// Frames since the last evaluation of this virtual voice.
+	AkUInt32			m_uColdPositionVersion;	// Emitter position version (see CAkEmitter::GetPositionVersion()) when m_fColdMinDistance was last checked.
+	AkReal32			m_fColdMinDistance;		// Distance to the closest listener at the last evaluation.
 
 #ifndef AK_OPTIMIZED
 	AkUInt8				m_iWasStarvationSignaled;// must signal when == 0, reset to MIMINUM_SOURCE_STARVATION_DELAY.
 #endif
 
 	AkVPLState m_vplState;
+	AkFloat16Buffer m_packedVplState;	// Packed copy of m_vplState, from PackMixableBuffer() until ReleaseBuffer().
 
 	AkChannelConfig		m_channelConfig;
 
@@ -16,6 +16,7 @@
 #include <stdint.h>
 #include "PtADPCM_Decode.h"
 #include "AkFileParserBase.h"
+#include <AK/SoundEngine/Common/AkSimd.h>
 
 #include <stdio.h>
 #include <math.h>
@@ -181,6 +182,95 @@ bool PtADPCM::DecodeBlocks( int16_t* pDst, uint8_t* pSrc, uint32_t samples, uint
 	
 	return true;
 }
+#ifdef AKSIMD_V4F32_SUPPORTED
+// Same as DecodeBlocks() for one whole block per lane. Differences only depend on the codes, so they are
+// first looked up for all lanes at once; the estimates of all lanes are then computed in the SIMD lanes.
+static void DecodeLanes( int16_t* const* ppDst, uint8_t* const* ppSrc, uint32_t channels )
+{
+	using namespace PtADPCM;
+	
+	const uint32_t codes = SamplePerBlock - 2;
+	AK_ALIGN_SIMD( int32_t diffs[codes][4] );
+	AK_ALIGN_SIMD( int32_t comps[SamplePerBlock][4] );
+	int32_t dLevs[4];
+	
+	// Block header
+	for( uint32_t lane = 0; lane < 4; lane++ ){
+		uint8_t* pBlock = ppSrc[lane];
+		comps[0][lane] = *reinterpret_cast<int16_t*>(pBlock);
+		pBlock += sizeof(int16_t);
+		comps[1][lane] = *reinterpret_cast<int16_t*>(pBlock);
+		pBlock += sizeof(int16_t);
+		dLevs[lane] = *pBlock;
+		PtADPCM_Assert( dLevs[lane] <= SIZEOF_DIFFERENCE_LEVEL );
+	}
+	
+	// difference & level
+	const uint32_t headerSize = 2 * sizeof(int16_t) + sizeof(uint8_t);
+	for( uint32_t i = 0; i < codes; i += 2 ){
+		for( uint32_t lane = 0; lane < 4; lane++ ){
+			uint8_t code = ppSrc[lane][headerSize + i / 2];
+			
+			const DifferenceTblItem& diff1 = DifferenceTbl[ dLevs[lane] * SIZEOF_DIFFERENCE + (code & 0xf) ];
+			diffs[i][lane] = diff1.diff;
+			
+			const DifferenceTblItem& diff2 = DifferenceTbl[ diff1.level * SIZEOF_DIFFERENCE + (code >> 4) ];
+			diffs[i + 1][lane] = diff2.diff;
+			dLevs[lane] = diff2.level;
+		}
+	}
+	
+	AKSIMD_V4I32 prev2 = AKSIMD_LOAD_V4I32( (AKSIMD_V4I32*)comps[0] );
+	AKSIMD_V4I32 prev1 = AKSIMD_LOAD_V4I32( (AKSIMD_V4I32*)comps[1] );
+	for( uint32_t i = 0; i < codes; i++ ){
+		/* estimate, add & clipping (packing saturates to 16 bits) */
+		AKSIMD_V4I32 comp = AKSIMD_ADD_V4I32( AKSIMD_SUB_V4I32( AKSIMD_ADD_V4I32( prev1, prev1 ), prev2 ), AKSIMD_LOAD_V4I32( (AKSIMD_V4I32*)diffs[i] ) );
+		AKSIMD_V4I32 packed = AKSIMD_PACKS_V4I32( comp, comp );
+		comp = AKSIMD_SHIFTRIGHTARITH_V4I32( AKSIMD_UNPACKLO_VECTOR8I16( packed, packed ), 16 );
+		
+		/* prev value */
+		prev2 = prev1;
+		prev1 = comp;
+		
+		AKSIMD_STORE_V4I32( (AKSIMD_V4I32*)comps[i + 2], comp );
+	}
+	
+	for( uint32_t lane = 0; lane < 4; lane++ ){
+		int16_t* pDst = ppDst[lane];
+		for( uint32_t i = 0; i < SamplePerBlock; i++ ){
+			*pDst = static_cast<int16_t>(comps[i][lane]);
+			pDst += channels;
+		}
+	}
+}
+#endif
+
+bool PtADPCM::DecodeAllChannels( int16_t* pDst, uint8_t* pSrc, uint32_t blocks, uint32_t channels )
+{
+	// Channel blocks follow each other: channel block u is the block of channel u % channels
+	// in frame block u / channels.
+	uint32_t channelBlocks = blocks * channels;
+	uint32_t u = 0;
+	
+#ifdef AKSIMD_V4F32_SUPPORTED
+	for( ; u + 4 <= channelBlocks; u += 4 ){
+		int16_t* dsts[4];
+		uint8_t* srcs[4];
+		for( uint32_t lane = 0; lane < 4; lane++ ){
+			dsts[lane] = pDst + ((u + lane) / channels) * SamplePerBlock * channels + (u + lane) % channels;
+			srcs[lane] = pSrc + (u + lane) * BlockSize;
+		}
+		DecodeLanes( dsts, srcs, channels );
+	}
+#endif
+	
+	for( ; u < channelBlocks; u++ ){
+		DecodeBlocks( pDst + (u / channels) * SamplePerBlock * channels + u % channels, pSrc + u * BlockSize, SamplePerBlock, BlockSize * channels, channels );
+	}
+	
+	return true;
+}
+
 // Validates a PtADPCM format structure.
 bool PtADPCM::IsValidPtAdpcmFormat(WaveFormatEx & wfx)
 {
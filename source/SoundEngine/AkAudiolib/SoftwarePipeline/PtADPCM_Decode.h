@@ -28,4 +28,6 @@ namespace PtADPCM{
 	const uint32_t SamplePerBlock = 64;
 	const uint32_t BlockSize = 36; // 5 + (64 - 2) / 2
 	bool DecodeBlocks( int16_t* pDst, uint8_t* pSrc, uint32_t samples, uint32_t blockAlignment, uint32_t channels );
+	// Decodes all channels of interleaved blocks, several channel blocks at a time in SIMD lanes where available.
+	bool DecodeAllChannels( int16_t* pDst, uint8_t* pSrc, uint32_t blocks, uint32_t channels );
 }
\ No newline at end of file
@@ -37,6 +37,7 @@ static unsigned char AK_Opus_wav_permute_matrix_decode[8][8] =
 
 CAkCodecWemOpus::CAkCodecWemOpus()
 	: m_uSamplesPerPacket(0)
+	, m_uBufferFrames(0)
 	, m_pOpusDecoder(nullptr)
 	, m_uSampleRate(0)
 	, m_uCodecDelay(0)
@@ -103,6 +104,11 @@ IAkSrcMediaCodec::Result CAkCodecWemOpus::Init(const AK::SrcMedia::Header& in_he
 	m_uMappingFamily = pFmt->uMappingFamily;
 	m_uSkipSamples = (AkUInt32)pFmt->uCodecDelay;
 
+	// Output buffer: several packets for long media, decoded ahead.
+	m_uBufferFrames = m_uSamplesPerPacket;
+	if (pFmt->dwTotalPCMFrames >= AK_OPUS_DECODE_AHEAD_MIN_LENGTH * OPUS_RATE && m_uSamplesPerPacket < AK_OPUS_DECODE_AHEAD_FRAMES)
+		m_uBufferFrames = (AK_OPUS_DECODE_AHEAD_FRAMES / m_uSamplesPerPacket) * m_uSamplesPerPacket;
+
 	// Seek table.
 	AKRESULT res = m_SeekTable.Init(pFmt->uSeekTableSize, in_header.SeekInfo.pSeekTable, m_uSamplesPerPacket);
 	if (res != AK_Success)
@@ -133,13 +139,29 @@ void CAkCodecWemOpus::Term()
 
 IAkSrcMediaCodec::Result CAkCodecWemOpus::GetBuffer(AK::SrcMedia::Stream::State* pStream, AkUInt16 uMaxFrames, BufferInfo& out_buffer)
 {
+	AkUInt32 uValidFrames = 0;
 	Result eResult;
 	do
 	{
-		eResult = ProcessPacket(pStream, out_buffer);
-		// Keep consuming packets until we're done skipping frames
-	} while (eResult == AK_DataNeeded);
-	return eResult;
+		AkUInt32 uPacketFrames = 0;
+		bool bEnd = false;
+		eResult = DecodePacket(pStream, uValidFrames, uPacketFrames, bEnd);
+		uValidFrames += uPacketFrames;
+		if (eResult == AK_DataReady && (bEnd || !CanDecodeAhead(pStream, uValidFrames)))
+			break;
+		// Keep consuming packets until we're done skipping frames, or while decoding ahead
+	} while (eResult == AK_DataReady || eResult == AK_DataNeeded);
+
+	if (uValidFrames == 0 || eResult == AK_Fail)
+		return eResult;
+
+	// Frames decoded before a packet that could not be read are still returned.
+	out_buffer.Buffer.AttachInterleavedData(
+		m_OutputBuffer.GetInterleavedData(),
+		m_uBufferFrames, // Very important to specify this number as uMaxFrames, because it is the actual stride of the de-interleaved buffer
+		uValidFrames);
+	out_buffer.uSrcFrames = uValidFrames;
+	return AK_DataReady;
 }
 
 IAkSrcMediaCodec::Result CAkCodecWemOpus::FindClosestFileOffset(AkUInt32 in_uDesiredSample, SeekInfo& out_SeekInfo)
@@ -168,6 +190,12 @@ void CAkCodecWemOpus::StopLooping(const AK::SrcMedia::Position::State& position)
 }
 
 
+struct AkOpusChannelOut
+{
+	AkUInt32 uSkipSamples;	// Frames of the packet not written
+	AkUInt32 uStride;		// Distance between channels in the output buffer, in frames
+};
+
 // This is the function that writes the pcm output as a de-interleaved buffer
 static void ak_opus_deinterleave_channel_out_float(
 	void *dst,
@@ -179,22 +207,41 @@ static void ak_opus_deinterleave_channel_out_float(
 	void *user_data
 )
 {
-	AkUInt32 uSkipSamples = *(AkUInt32*)user_data;
-	float *float_dst = (float*)dst;
+	const AkOpusChannelOut* pOut = (const AkOpusChannelOut*)user_data;
+	int uSkipSamples = (int)pOut->uSkipSamples;
+	float *float_dst = (float*)dst + dst_channel*pOut->uStride;
 
 	if (src != NULL)
 	{
 		for (int i = uSkipSamples; i < frame_size; i++)
-			float_dst[dst_channel*frame_size + (i - uSkipSamples)] = src[i*src_stride];
+			float_dst[i - uSkipSamples] = src[i*src_stride];
 	}
 	else
 	{
 		for (int i = uSkipSamples; i < frame_size; i++)
-			float_dst[dst_channel*frame_size + (i - uSkipSamples)] = 0;
+			float_dst[i - uSkipSamples] = 0;
 	}
 }
 
 IAkSrcMediaCodec::Result CAkCodecWemOpus::ProcessPacket(AK::SrcMedia::Stream::State* pStream, BufferInfo& out_buffer)
+{
+	AkUInt32 uValidFrames = 0;
+	bool bEnd = false;
+	Result eResult = DecodePacket(pStream, 0, uValidFrames, bEnd);
+	if (eResult != AK_DataReady)
+		return eResult;
+
+	out_buffer.Buffer.AttachInterleavedData(
+		m_OutputBuffer.GetInterleavedData(),
+		m_uBufferFrames, // Very important to specify this number as uMaxFrames, because it is the actual stride of the de-interleaved buffer
+		uValidFrames);
+
+	out_buffer.uSrcFrames = uValidFrames;
+	return AK_DataReady;
+}
+
+// Decodes the next packet into the output buffer, at frame uOffset. out_bEnd is set when the packet reached the loop end or the end of the media.
+IAkSrcMediaCodec::Result CAkCodecWemOpus::DecodePacket(AK::SrcMedia::Stream::State* pStream, AkUInt32 uOffset, AkUInt32& out_uValidFrames, bool& out_bEnd)
 {
 	void* pPacket = nullptr;
 	AkUInt32 uPacketSize = 0;
@@ -206,18 +253,20 @@ IAkSrcMediaCodec::Result CAkCodecWemOpus::ProcessPacket(AK::SrcMedia::Stream::St
 		return eResult;
 	AKASSERT(pPacket != nullptr);
 	AKASSERT(uPacketSize > 0);
+	AKASSERT(uOffset + m_uSamplesPerPacket <= m_uBufferFrames);
 	m_uCurPacket++;
 
+	AkOpusChannelOut channelOut = { m_uSkipSamples, m_uBufferFrames };
 	int samples = opus_multistream_decode_native(
 		m_pOpusDecoder,
 		(AkUInt8*)pPacket,
 		uPacketSize,
-		m_OutputBuffer.GetInterleavedData(),
+		(AkReal32*)m_OutputBuffer.GetInterleavedData() + uOffset,
 		ak_opus_deinterleave_channel_out_float,
 		m_uSamplesPerPacket,
 		0,
 		0,
-		&m_uSkipSamples);
+		&channelOut);
 	if (samples < 0)
 	{
 		return Result(AK_Fail, AK::Monitor::ErrorCode_OpusDecodeError);
@@ -238,20 +287,16 @@ IAkSrcMediaCodec::Result CAkCodecWemOpus::ProcessPacket(AK::SrcMedia::Stream::St
 	// Cut samples beyond the loop end point
 	AK::SrcMedia::Position::ClampFrames(&m_Position, uValidFrames);
 
-	out_buffer.Buffer.AttachInterleavedData(
-		m_OutputBuffer.GetInterleavedData(),
-		samples, // Very important to specify this number as uMaxFrames, because it is the actual stride of the de-interleaved buffer
-		uValidFrames);
-
-	out_buffer.uSrcFrames = uValidFrames;
+	out_uValidFrames = uValidFrames;
 	bool bLoop;
-	AK::SrcMedia::Position::Forward(&m_Position, uValidFrames, bLoop);
+	out_bEnd = AK::SrcMedia::Position::Forward(&m_Position, uValidFrames, bLoop) == AK_NoMoreData;
 	if (bLoop)
 	{
 		// We will be seeking back to loop start on the next GetBuffer()
 		// Don't forget to skip over the usual 80 ms pre-roll
 		m_uSkipSamples = m_uLoopStartSkipSamples;
 		m_uCurPacket = m_uLoopStartPacketIndex;
+		out_bEnd = true;
 	}
 	return AK_DataReady;
 }
@@ -262,7 +307,7 @@ IAkSrcMediaCodec::Result CAkCodecWemOpus::AllocateResources()
 	channelConfig.Deserialize(m_uChannelConfig);
 
 	m_OutputBuffer.SetChannelConfig(channelConfig);
-	m_OutputBuffer.SetRequestSize(m_uSamplesPerPacket);
+	m_OutputBuffer.SetRequestSize(m_uBufferFrames);
 	AKRESULT eResult = m_OutputBuffer.GetCachedBuffer();
 	if (eResult != AK_Success)
 	{
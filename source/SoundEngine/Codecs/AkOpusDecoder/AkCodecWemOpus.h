@@ -18,6 +18,11 @@ Copyright (c) 2006-2020 Audiokinetic Inc.
 
 struct OpusMSDecoder;
 
+// Packets of long media are decoded ahead, several per GetBuffer(), as long as they are already in the
+// current stream buffer: the decoder state stays in cache and the pipeline is called less often.
+#define AK_OPUS_DECODE_AHEAD_FRAMES		(4096)	// Size of the output buffer of media decoded ahead, in frames.
+#define AK_OPUS_DECODE_AHEAD_MIN_LENGTH	(10)	// Minimum duration of media decoded ahead, in seconds.
+
 class CAkCodecWemOpus : public IAkSrcMediaCodec
 {
 public:
@@ -69,6 +74,14 @@ public:
 
 private:
 
+	Result DecodePacket(AK::SrcMedia::Stream::State* pStream, AkUInt32 uOffset, AkUInt32& out_uValidFrames, bool& out_bEnd);
+
+	bool CanDecodeAhead(AK::SrcMedia::Stream::State* pStream, AkUInt32 uValidFrames)
+	{
+		return uValidFrames + m_uSamplesPerPacket <= m_uBufferFrames
+			&& pStream->uSizeLeft >= m_SeekTable.GetPacketSize(m_uCurPacket);
+	}
+
 	Result AllocateResources();
 
 	void FreeResources();
@@ -94,6 +107,7 @@ private:
 	typedef AK::SrcMedia::PacketStitcher<AK::SrcMedia::ManualStitcherState> OpusPacketStitcher;
 
 	AkUInt16       m_uSamplesPerPacket;
+	AkUInt16       m_uBufferFrames;		// Capacity of m_OutputBuffer: one packet, or more when decoding ahead.
 	OpusMSDecoder* m_pOpusDecoder;
 
 	// Buffers
@@ -0,0 +1,100 @@
+/* Copyright (c) 2014, Cisco Systems, INC
+   Written by XiangMingZhu WeiZhou MinPeng YanWang
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "macros.h"
+#include "mathops.h"
+#include "pitch.h"
+
+#if defined(OPUS_X86_MAY_HAVE_AVX) && !defined(FIXED_POINT)
+
+#include <immintrin.h>
+#include "arch.h"
+
+/* Same as comb_filter_const_sse(), 8 samples at a time; the results are
+   identical. Like the SSE version, it sums the g11 and g12 terms first,
+   then adds them to x[i] + g10*x[i-T]. comb_filter_const_c() adds the
+   terms from left to right, so its results can differ in the last bits.
+   Since T >= COMBFILTER_MINPERIOD, x[i-T+2..i-T+9] never overlaps
+   the samples being written when filtering in place. */
+void comb_filter_const_avx(opus_val32 *y, opus_val32 *x, int T, int N,
+      opus_val16 g10, opus_val16 g11, opus_val16 g12)
+{
+   int i;
+   __m256 g10v, g11v, g12v;
+   g10v = _mm256_set1_ps(g10);
+   g11v = _mm256_set1_ps(g11);
+   g12v = _mm256_set1_ps(g12);
+   for (i=0;i<N-7;i+=8)
+   {
+      __m256 yi, yi2, x0v, x1v, x2v, x3v, x4v;
+      const opus_val32 *xp = &x[i-T-2];
+      yi = _mm256_loadu_ps(x+i);
+      x0v = _mm256_loadu_ps(xp);
+      x1v = _mm256_loadu_ps(xp+1);
+      x2v = _mm256_loadu_ps(xp+2);
+      x3v = _mm256_loadu_ps(xp+3);
+      x4v = _mm256_loadu_ps(xp+4);
+
+      yi = _mm256_add_ps(yi, _mm256_mul_ps(g10v,x2v));
+      yi2 = _mm256_add_ps(_mm256_mul_ps(g11v,_mm256_add_ps(x3v,x1v)),
+                          _mm256_mul_ps(g12v,_mm256_add_ps(x4v,x0v)));
+      yi = _mm256_add_ps(yi, yi2);
+      _mm256_storeu_ps(y+i, yi);
+   }
+   for (;i<N-3;i+=4)
+   {
+      __m128 yi, yi2, x0v, x1v, x2v, x3v, x4v;
+      const opus_val32 *xp = &x[i-T-2];
+      yi = _mm_loadu_ps(x+i);
+      x0v = _mm_loadu_ps(xp);
+      x1v = _mm_loadu_ps(xp+1);
+      x2v = _mm_loadu_ps(xp+2);
+      x3v = _mm_loadu_ps(xp+3);
+      x4v = _mm_loadu_ps(xp+4);
+
+      yi = _mm_add_ps(yi, _mm_mul_ps(_mm256_castps256_ps128(g10v),x2v));
+      yi2 = _mm_add_ps(_mm_mul_ps(_mm256_castps256_ps128(g11v),_mm_add_ps(x3v,x1v)),
+                       _mm_mul_ps(_mm256_castps256_ps128(g12v),_mm_add_ps(x4v,x0v)));
+      yi = _mm_add_ps(yi, yi2);
+      _mm_storeu_ps(y+i, yi);
+   }
+#ifdef CUSTOM_MODES
+   for (;i<N;i++)
+   {
+      y[i] = x[i]
+               + MULT16_32_Q15(g10,x[i-T])
+               + MULT16_32_Q15(g11,ADD32(x[i-T+1],x[i-T-1]))
+               + MULT16_32_Q15(g12,ADD32(x[i-T+2],x[i-T-2]));
+   }
+#endif
+}
+
+#endif
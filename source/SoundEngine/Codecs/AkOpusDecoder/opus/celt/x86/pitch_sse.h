@@ -153,12 +153,20 @@ void comb_filter_const_sse(opus_val32 *y,
     opus_val16  g12);
 
 
+#if defined(OPUS_X86_MAY_HAVE_AVX)
+void comb_filter_const_avx(opus_val32 *y,
+    opus_val32 *x,
+    int         T,
+    int         N,
+    opus_val16  g10,
+    opus_val16  g11,
+    opus_val16  g12);
+#endif
+
+
 #if defined(OPUS_X86_PRESUME_SSE)
 # define dual_inner_prod(x, y01, y02, N, xy1, xy2, arch) \
     ((void)(arch),dual_inner_prod_sse(x, y01, y02, N, xy1, xy2))
-
-# define comb_filter_const(y, x, T, N, g10, g11, g12, arch) \
-    ((void)(arch),comb_filter_const_sse(y, x, T, N, g10, g11, g12))
 #else
 
 extern void (*const DUAL_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
@@ -172,6 +180,16 @@ extern void (*const DUAL_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
 #define dual_inner_prod(x, y01, y02, N, xy1, xy2, arch) \
     ((*DUAL_INNER_PROD_IMPL[(arch) & OPUS_ARCHMASK])(x, y01, y02, N, xy1, xy2))
 
+#endif
+
+#if defined(OPUS_X86_PRESUME_AVX)
+# define comb_filter_const(y, x, T, N, g10, g11, g12, arch) \
+    ((void)(arch),comb_filter_const_avx(y, x, T, N, g10, g11, g12))
+#elif defined(OPUS_X86_PRESUME_SSE) && !defined(OPUS_X86_MAY_HAVE_AVX)
+# define comb_filter_const(y, x, T, N, g10, g11, g12, arch) \
+    ((void)(arch),comb_filter_const_sse(y, x, T, N, g10, g11, g12))
+#else
+
 extern void (*const COMB_FILTER_CONST_IMPL[OPUS_ARCHMASK + 1])(
               opus_val32 *y,
               opus_val32 *x,
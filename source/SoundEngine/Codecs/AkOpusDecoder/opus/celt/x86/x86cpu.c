@@ -49,6 +49,11 @@ static _inline void cpuid(unsigned int CPUInfo[4], unsigned int InfoType)
     __cpuid((int*)CPUInfo, InfoType);
 }
 
+static _inline unsigned int xgetbv0(void)
+{
+    return (unsigned int)_xgetbv(0);
+}
+
 #else
 
 #if defined(CPU_INFO_BY_C)
@@ -85,6 +90,20 @@ static void cpuid(unsigned int CPUInfo[4], unsigned int InfoType)
 #endif
 }
 
+/* Only called when the OS supports XSAVE (see opus_cpu_feature_check()). */
+static unsigned int xgetbv0(void)
+{
+    unsigned int eax, edx;
+    __asm__ __volatile__ (
+        ".byte 0x0f, 0x01, 0xd0": /* xgetbv */
+        "=a" (eax),
+        "=d" (edx) :
+        "c" (0)
+    );
+    (void)edx;
+    return eax;
+}
+
 #endif
 
 typedef struct CPU_Feature{
@@ -109,7 +128,10 @@ static void opus_cpu_feature_check(CPU_Feature *cpu_feature)
         cpu_feature->HW_SSE = (info[3] & (1 << 25)) != 0;
         cpu_feature->HW_SSE2 = (info[3] & (1 << 26)) != 0;
         cpu_feature->HW_SSE41 = (info[2] & (1 << 19)) != 0;
-        cpu_feature->HW_AVX = (info[2] & (1 << 28)) != 0;
+        /* AVX also needs the OS to save the YMM registers (OSXSAVE, and XCR0 bits 1 and 2). */
+        cpu_feature->HW_AVX = (info[2] & (1 << 28)) != 0
+            && (info[2] & (1 << 27)) != 0
+            && (xgetbv0() & 0x6) == 0x6;
     }
     else {
         cpu_feature->HW_SSE = 0;
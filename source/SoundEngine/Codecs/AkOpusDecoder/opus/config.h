@@ -143,6 +143,11 @@
 	#define OPUS_X86_MAY_HAVE_SSE2
 	#define OPUS_X86_MAY_HAVE_SSE4_1
 
+	/* AVX functions are compiled separately, with AVX enabled, on 64-bit targets only (see x86/pitch_avx.c) */
+	#if defined(_M_X64) || defined(__x86_64__)
+		#define OPUS_X86_MAY_HAVE_AVX
+	#endif
+
 	/* Presume SSE functions, if compiled to use SSE/SSE2/AVX (note that AMD64 implies SSE2, and AVX
 	implies SSE4.1) */
 	#if defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1)) || defined(__AVX__)
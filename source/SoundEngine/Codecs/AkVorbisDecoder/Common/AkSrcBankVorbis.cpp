@@ -14,6 +14,7 @@
 #include "AkSrcBankVorbis.h"
 #include "AkMonitor.h"
 #include "AkVorbisCodebookMgr.h"
+#include "AkPBI.h"
 
 // Constructor
 CAkSrcBankVorbis::CAkSrcBankVorbis( CAkPBI * in_pCtx ) 
@@ -22,6 +23,8 @@ CAkSrcBankVorbis::CAkSrcBankVorbis( CAkPBI * in_pCtx )
 , m_pucDataStart( NULL )// start of audio data
 , m_pOutputBuffer( NULL )
 , m_uOutputBufferSize( 0 )
+, m_pDecodedMedia( NULL )
+, m_pRecording( NULL )
 {
 	// do this here as well as it is legal to be StopStream'ed
 	// without having been StartStream'ed
@@ -39,6 +42,12 @@ CAkSrcBankVorbis::~CAkSrcBankVorbis()
 // GetBuffer
 void CAkSrcBankVorbis::GetBuffer( AkVPLState & io_state )
 {
+	if ( m_pDecodedMedia )
+	{
+		GetDecodedMediaBuffer( io_state );
+		return;
+	}
+
 	// The stream should not start before all headers are decoded
 	AKASSERT( m_VorbisState.TremorInfo.ReturnInfo.eDecoderState >= PACKET_STREAM );
 
@@ -60,6 +69,12 @@ void CAkSrcBankVorbis::GetBuffer( AkVPLState & io_state )
 	m_pucData += m_VorbisState.TremorInfo.ReturnInfo.uInputBytesConsumed;
 	m_VorbisState.TremorInfo.uRequestedFrames = m_VorbisState.TremorInfo.ReturnInfo.uFramesProduced;
 
+	if ( m_pRecording && m_VorbisState.TremorInfo.ReturnInfo.uFramesProduced > 0 )
+	{
+		AkUInt32 uFramesProduced = m_VorbisState.TremorInfo.ReturnInfo.uFramesProduced;
+		AkDecodedMediaCache::Record( m_pRecording, m_uCurSample, m_pOutputBuffer, uFramesProduced, uFramesProduced );
+	}
+
 	// Prepare buffer for VPL, update PCM position, handle end of loop/file, post markers and position info.
 	SubmitBufferAndUpdate( 
 		m_pOutputBuffer,
@@ -162,6 +177,19 @@ AKRESULT CAkSrcBankVorbis::StartStream( AkUInt8 * pvBuffer, AkUInt32 ulBufferSiz
 	m_pucData = m_pucDataStart;
 	LoopInit();
 
+	if ( m_pCtx && AkDecodedMediaCache::IsEnabled() )
+	{
+		InitDecodedMedia( ulBufferSize );
+		if ( m_pDecodedMedia )
+		{
+			// Playing decoded samples: the Vorbis decoder is not needed.
+			m_VorbisState.TremorInfo.ReturnInfo.eDecoderState = PACKET_STREAM;
+			if ( m_pCtx->RequiresSourceSeek() )
+				eResult = SeekToNativeOffset();
+			return eResult;
+		}
+	}
+
 	eResult = DecodeVorbisHeader();
 
 	if( eResult == AK_Success )
@@ -221,6 +249,7 @@ void CAkSrcBankVorbis::StopStream()
 		m_VorbisState.pSeekTable = NULL;
 	}
 	FreeOutputBuffer();
+	TermDecodedMedia();
 
 	CAkSrcBaseEx::StopStream();
 }
@@ -233,7 +262,8 @@ AKRESULT CAkSrcBankVorbis::StopLooping()
 
 void CAkSrcBankVorbis::VirtualOn( AkVirtualQueueBehavior eBehavior )
 {
-	if ( eBehavior == AkVirtualQueueBehavior_FromBeginning || eBehavior == AkVirtualQueueBehavior_FromElapsedTime )
+	if ( ( eBehavior == AkVirtualQueueBehavior_FromBeginning || eBehavior == AkVirtualQueueBehavior_FromElapsedTime )
+		&& !m_pDecodedMedia )
 	{
 		vorbis_dsp_clear(&m_VorbisState.TremorInfo.VorbisDSPState);
 		FreeOutputBuffer();
@@ -244,7 +274,8 @@ void CAkSrcBankVorbis::VirtualOn( AkVirtualQueueBehavior eBehavior )
 // VirtualOff
 AKRESULT CAkSrcBankVorbis::VirtualOff( AkVirtualQueueBehavior eBehavior, bool in_bUseSourceOffset )
 {
-	if ( eBehavior == AkVirtualQueueBehavior_FromBeginning || eBehavior == AkVirtualQueueBehavior_FromElapsedTime )
+	if ( ( eBehavior == AkVirtualQueueBehavior_FromBeginning || eBehavior == AkVirtualQueueBehavior_FromElapsedTime )
+		&& !m_pDecodedMedia )
 	{
 		if (vorbis_dsp_init(&m_VorbisState.TremorInfo.VorbisDSPState, m_VorbisState.TremorInfo.VorbisDSPState.channels) == -1)
 			return AK_Fail;	//Could not allocate the buffers again.  Kill this voice.
@@ -290,6 +321,13 @@ AKRESULT CAkSrcBankVorbis::VirtualOff( AkVirtualQueueBehavior eBehavior, bool in
 // VirtualSeek - Determine where to seek
 AKRESULT CAkSrcBankVorbis::VirtualSeek( AkUInt32 & io_uSeekPosition )
 {
+	// Decoded samples can be played from any position.
+	if ( m_pDecodedMedia )
+		return AK_Success;
+
+	// Decoding resumes from a packet boundary, so the output no longer matches a straight play.
+	AkDecodedMediaCache::CancelRecording( m_pRecording );
+
 #ifndef AK_OPTIMIZED
 	if ( !HasSeekTable() && ( m_uTotalSamples > AK_VORBIS_SEEK_TABLE_WARN_SIZE ) )
 	{
@@ -478,7 +516,7 @@ AKRESULT CAkSrcBankVorbis::OnLoopComplete(
 {
 	// IMPORTANT: Call base first. VorbisDSPRestart() checks the loop count, so it has to be updated first.
 	AKRESULT eResult = CAkSrcBaseEx::OnLoopComplete( in_bEndOfFile );
-	if ( !in_bEndOfFile )
+	if ( !in_bEndOfFile && !m_pDecodedMedia )
 	{
 		m_pucData = m_pucDataStart + m_VorbisState.VorbisInfo.LoopInfo.dwLoopStartPacketOffset + m_VorbisState.VorbisInfo.dwSeekTableSize;
 		
@@ -491,6 +529,73 @@ AKRESULT CAkSrcBankVorbis::OnLoopComplete(
 	return eResult;
 }
 
+void CAkSrcBankVorbis::InitDecodedMedia( AkUInt32 in_uMediaSize )
+{
+	const AkMediaInformation & mediaInfo = m_pCtx->GetSrcTypeInfo()->mediaInfo;
+	if ( mediaInfo.bExternallySupplied )
+		return;
+
+	AkDecodedMediaKey key;
+	key.mediaID = mediaInfo.sourceID;
+	key.uMediaSize = in_uMediaSize;
+	key.uSampleRate = m_VorbisState.uSampleRate;
+	key.uChannelConfig = m_VorbisState.TremorInfo.channelConfig.Serialize();
+	key.uFormatTag = AK_WAVE_FORMAT_VORBIS;
+
+	m_pDecodedMedia = AkDecodedMediaCache::Acquire( key );
+
+	// Only record plays of the whole media without looping: around loop points, the decoder output
+	// differs from the one of a straight play.
+	if ( !m_pDecodedMedia && !DoLoop() && !m_pCtx->RequiresSourceSeek() )
+	{
+		m_pRecording = AkDecodedMediaCache::BeginRecording(
+			key,
+			m_uTotalSamples,
+			m_VorbisState.TremorInfo.channelConfig.uNumChannels,
+			m_VorbisState.uSampleRate,
+			0 );
+	}
+}
+
+void CAkSrcBankVorbis::GetDecodedMediaBuffer( AkVPLState & io_state )
+{
+	AkUInt32 uEndOfRange = DoLoop() ? m_uPCMLoopEnd + 1 : m_uTotalSamples;
+	AKASSERT( m_uCurSample < uEndOfRange );
+	AkUInt16 uNumFrames = (AkUInt16)AkMin( (AkUInt32)io_state.MaxFrames(), uEndOfRange - m_uCurSample );
+
+	AkUInt32 uOutputBufferSize = m_pDecodedMedia->NumChannels() * uNumFrames * sizeof(AkReal32);
+	if ( m_uOutputBufferSize < uOutputBufferSize )
+	{
+		FreeOutputBuffer();
+		m_pOutputBuffer = (AkReal32 *)AkMalign( AkMemID_Processing, uOutputBufferSize, AK_BUFFER_ALIGNMENT );
+		if ( !m_pOutputBuffer )
+		{
+			io_state.result = AK_Fail;
+			return;
+		}
+		m_uOutputBufferSize = uOutputBufferSize;
+	}
+
+	m_pDecodedMedia->CopyFrames( m_uCurSample, uNumFrames, m_pOutputBuffer, uNumFrames );
+
+	SubmitBufferAndUpdate( 
+		m_pOutputBuffer,
+		uNumFrames, 
+		m_VorbisState.uSampleRate,
+		m_VorbisState.TremorInfo.channelConfig, 
+		io_state );
+}
+
+void CAkSrcBankVorbis::TermDecodedMedia()
+{
+	if ( m_pDecodedMedia )
+	{
+		AkDecodedMediaCache::Release( m_pDecodedMedia );
+		m_pDecodedMedia = NULL;
+	}
+	AkDecodedMediaCache::CancelRecording( m_pRecording );
+}
+
 CAkVorbisGrainCodec::CAkVorbisGrainCodec()
 	: m_Node(nullptr)
 {
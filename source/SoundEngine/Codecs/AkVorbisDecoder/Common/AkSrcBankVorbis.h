@@ -17,6 +17,7 @@
 #include "AkSrcVorbis.h"
 #include "AkVorbisCodec.h"
 #include "AkPluginCodec.h"
+#include "AkDecodedMediaCache.h"
 
 class CAkSrcBankVorbis : public CAkSrcBaseEx
 {
@@ -62,10 +63,18 @@ protected:
 	AkUInt32 GetMaxInputDataSize();
 	void FreeOutputBuffer();
 
+	// Decoded media cache
+	void InitDecodedMedia( AkUInt32 in_uMediaSize );	// Acquires the decoded media, or starts recording it.
+	void GetDecodedMediaBuffer( AkVPLState & io_state );
+	void TermDecodedMedia();
+
 private:
 	inline bool	HasSeekTable(){ return m_VorbisState.pSeekTable != NULL; }
 	inline void VorbisDSPRestart( AkUInt16 in_uSrcOffsetRemainder )
 	{
+		if ( m_pDecodedMedia )
+			return;	// Not decoding.
+
 		// Re-Initialize global decoder state
 		vorbis_dsp_restart(
 			&m_VorbisState.TremorInfo.VorbisDSPState,
@@ -84,6 +93,9 @@ private:
 
 	AkReal32*			m_pOutputBuffer;
 	AkUInt32			m_uOutputBufferSize;
+
+	const AkDecodedMedia *	m_pDecodedMedia;	// Set when playing from the decoded media cache instead of decoding.
+	AkDecodedMedia *		m_pRecording;		// Set while the decoded output is recorded for the decoded media cache.
 };
 
 class CAkVorbisGrainCodec : public IAkGrainCodec
@@ -44,7 +44,8 @@ AkVorbisCodebookMgr::AkVorbisCodebookMgr()
 AkVorbisCodebookMgr::~AkVorbisCodebookMgr()
 {
 #ifdef _DEBUG
-	AKASSERT( m_codebooks.Length() == 0 );
+	for ( AkUInt32 i = 0; i < NumShards; ++i )
+		AKASSERT( m_shards[i].codebooks.Length() == 0 );
 #endif
 }
 
@@ -54,23 +55,61 @@ codec_setup_info * AkVorbisCodebookMgr::Decodebook(
 	ogg_packet *op
 	)
 {
+	AkUInt32 uHash = in_VorbisState.VorbisInfo.uHashCodebook;
+	CodebookShard & shard = GetShard( uHash );
+
 	// Look for existing codebook
+	{
+		AkAutoLock<CAkLock> codebookLock(shard.lock);
+
+		Codebook * pCodebook = shard.codebooks.Exists( uHash );
+		if ( pCodebook )
+		{
+			AkAtomicInc32( &pCodebook->cRef );
+			return &pCodebook->csi;
+		}
+	}
 
-	AkAutoLock<CAkLock> codebookLock(m_codebookLock);
+	// Not found; decode without holding the lock, so that other sources may start meanwhile.
 
-	Codebook * pCodebook = m_codebooks.Exists( in_VorbisState.VorbisInfo.uHashCodebook );
+	Codebook * pNewCodebook = CreateCodebook( in_VorbisState, in_pPBI, op );
+	if ( !pNewCodebook )
+		return NULL;
+
+	AkAutoLock<CAkLock> codebookLock(shard.lock);
+
+	// Another source may have decoded the same codebook in the meantime: use it instead.
+	Codebook * pCodebook = shard.codebooks.Exists( uHash );
 	if ( pCodebook )
 	{
-		++pCodebook->cRef;
+		AkAtomicInc32( &pCodebook->cRef );
+		DestroyCodebook( pNewCodebook );
 		return &pCodebook->csi;
 	}
 
-	// Not found; create new codebook entry and decode
+	pNewCodebook->cRef = 1;
+	if ( ! shard.codebooks.Set( pNewCodebook ) )
+	{
+		MONITOR_SOURCE_ERROR(AK::Monitor::ErrorCode_NotEnoughMemoryToStart, in_pPBI);		
+		DestroyCodebook( pNewCodebook );
+		return NULL;
+	}
 
-	pCodebook = AkNew(AkMemID_Processing, Codebook());
+	return &pNewCodebook->csi;
+}
+
+Codebook * AkVorbisCodebookMgr::CreateCodebook(
+	AkVorbisSourceState & in_VorbisState, 
+	CAkPBI * in_pPBI,		// For error monitoring
+	ogg_packet *op
+	)
+{
+	Codebook * pCodebook = AkNew(AkMemID_Processing, Codebook());
 	if (!pCodebook)
 		return NULL;
 
+	pCodebook->key = in_VorbisState.VorbisInfo.uHashCodebook;
+
 #ifdef AK_POINTER_64
 	AkUInt32 uAllocSize = in_VorbisState.VorbisInfo.dwDecodeX64AllocSize;
 #else
@@ -105,45 +144,42 @@ codec_setup_info * AkVorbisCodebookMgr::Decodebook(
 		goto error;
 	}
 
-	// Success
-
-	++pCodebook->cRef;
-
-	pCodebook->key = in_VorbisState.VorbisInfo.uHashCodebook;
-	if ( ! m_codebooks.Set( pCodebook ) )
-	{
-		MONITOR_SOURCE_ERROR(AK::Monitor::ErrorCode_NotEnoughMemoryToStart, in_pPBI);		
-		goto error;
-	}
-
-	return &pCodebook->csi;
+	return pCodebook;
 
 error:
-	pCodebook->Term( );
-	AkDelete( AkMemID_Processing, pCodebook );
+	DestroyCodebook( pCodebook );
 	return NULL;
 }
 
-void AkVorbisCodebookMgr::ReleaseCodebook( AkVorbisSourceState & in_VorbisState )
+void AkVorbisCodebookMgr::DestroyCodebook( Codebook * in_pCodebook )
 {
-	AkAutoLock<CAkLock> codebookLock(m_codebookLock);
-	CodebookList::IteratorEx it = m_codebooks.FindEx( in_VorbisState.VorbisInfo.uHashCodebook );
-	if ( it != m_codebooks.End() )
-	{
-		Codebook * pCodebook = *it;
-		if ( --pCodebook->cRef <= 0 )
-		{
-			m_codebooks.Erase( it );
+	in_pCodebook->Term( );
+	AkDelete( AkMemID_Processing, in_pCodebook );
+}
 
-			pCodebook->Term( );
-			AkDelete( AkMemID_Processing, pCodebook );
-		}
+void AkVorbisCodebookMgr::ReleaseCodebook( AkVorbisSourceState & in_VorbisState )
+{
+	AkUInt32 uHash = in_VorbisState.VorbisInfo.uHashCodebook;
+	CodebookShard & shard = GetShard( uHash );
 
-		if (m_codebooks.Length() == 0)
-			m_codebooks.Term();
+	// The source holds a reference, so its codebook cannot be destroyed before this point.
+	Codebook * pCodebook = Codebook::FromSetupInfo( in_VorbisState.TremorInfo.VorbisDSPState.csi );
+	AKASSERT( pCodebook->key == uHash );
 
+	if ( AkAtomicDec32( &pCodebook->cRef ) > 0 )
 		return;
-	}
 
-	AKASSERT( false && "Vorbis Codebook not found" );
+	// Last reference: the codebook may have been acquired again, or already destroyed by the source
+	// that released it next, before the lock is taken. Only the hash may be used until it is found again.
+	AkAutoLock<CAkLock> codebookLock(shard.lock);
+	CodebookList::IteratorEx it = shard.codebooks.FindEx( uHash );
+	if ( it != shard.codebooks.End() && (*it)->cRef <= 0 )
+	{
+		pCodebook = *it;
+		shard.codebooks.Erase( it );
+		DestroyCodebook( pCodebook );
+
+		if (shard.codebooks.Length() == 0)
+			shard.codebooks.Term();
+	}
 }
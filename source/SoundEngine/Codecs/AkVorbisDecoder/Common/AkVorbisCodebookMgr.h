@@ -18,6 +18,7 @@
 #include <AK/Tools/Common/AkLock.h>
 #include "AkPrivateTypes.h"
 #include "packed_codebooks.h"
+#include <stddef.h>
 
 struct AkVorbisSourceState;
 
@@ -26,7 +27,7 @@ struct Codebook
 	AkUInt32 key;
 	Codebook * pNextItem;
 	CAkVorbisAllocator allocator;
-	AkInt32 cRef;
+	AkAtomic32 cRef;
 	codec_setup_info csi;
 
 	Codebook(): cRef(0)
@@ -36,6 +37,11 @@ struct Codebook
 	}
 
 	void Term();
+
+	static AkForceInline Codebook * FromSetupInfo( codec_setup_info * in_pCsi )
+	{
+		return (Codebook*)( (AkUInt8*)in_pCsi - offsetof( Codebook, csi ) );
+	}
 };
 
 class AkVorbisCodebookMgr
@@ -44,13 +50,6 @@ public:
 	AkVorbisCodebookMgr();
 	~AkVorbisCodebookMgr();
 
-	enum CodebookDecodeState
-	{
-		Codebook_NeedsDecode,
-		Codebook_NeedsWait,
-		Codebook_Decoded
-	};
-
 	codec_setup_info * Decodebook(
 		AkVorbisSourceState & in_VorbisState, 
 		class CAkPBI * in_pPBI,		// For error monitoring
@@ -60,11 +59,30 @@ public:
 	void ReleaseCodebook( AkVorbisSourceState & in_VorbisState );
 
 private:
-	
+	Codebook * CreateCodebook(
+		AkVorbisSourceState & in_VorbisState, 
+		class CAkPBI * in_pPBI,
+		ogg_packet *op
+		);
+	static void DestroyCodebook( Codebook * in_pCodebook );
 
 	typedef AkHashListBare<AkUInt32, Codebook> CodebookList;
-	CodebookList m_codebooks;
-	CAkLock m_codebookLock;
+
+	// Codebooks are spread over shards by hash, each with its own lock, so that voices starting
+	// with different codebooks on different threads do not contend. Codebooks are decoded outside
+	// of the locks; references are counted atomically, so releasing a codebook that is still used
+	// by other sources does not lock.
+	struct CodebookShard
+	{
+		CodebookList codebooks;
+		CAkLock lock;
+	};
+
+	enum { NumShards = 16 };
+
+	AkForceInline CodebookShard & GetShard( AkUInt32 in_uHash ) { return m_shards[ in_uHash % NumShards ]; }
+
+	CodebookShard m_shards[NumShards];
 };
 
 extern AkVorbisCodebookMgr g_VorbisCodebookMgr;
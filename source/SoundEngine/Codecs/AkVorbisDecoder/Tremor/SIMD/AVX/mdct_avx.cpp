@@ -0,0 +1,732 @@
+/***********************************************************************
+The content of this file includes source code for the sound engine
+portion of the AUDIOKINETIC Wwise Technology and constitutes "Level
+Two Source Code" as defined in the Source Code Addendum attached
+with this file.  Any use of the Level Two Source Code shall be
+subject to the terms and conditions outlined in the Source Code
+Addendum and the End User License Agreement for Wwise(R).
+
+Version:  Build:
+Copyright (c) 2006-2020 Audiokinetic Inc.
+***********************************************************************/
+
+//////////////////////////////////////////////////////////////////////
+//
+// mdct_avx.cpp
+//
+// Inverse MDCT of two channels at once, one per 128-bit lane.
+// This is the algorithm of mdct_SIMD.cpp, step for step: every 4-wide operation there is
+// done here on 8-wide vectors holding the same 4 values of channel A (low lane) and channel B (high lane).
+// All shuffles used by the algorithm stay within 128-bit lanes, so both channels are transformed independently,
+// with the same rounding as the 4-wide version.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "../mdct.h"
+#include "../SinCosGen.h"
+#include <AK/SoundEngine/Platforms/SSE/AkSimdAvx.h>
+
+#define CosThreePiOverEight	0.38268343237353648635257803199467f
+#define CosPiOverFour	0.70710678152139614407038136574923f
+#define CosPiOverEight	0.92387953303934984516322139891014f
+
+// Twiddles are generated 4-wide, and applied to both channels.
+#define AKSIMD_DUPLICATE_V4F32( __a__ ) AKSIMD_SET_V2F128( (__a__), (__a__) )
+
+// Lane-wise equivalents of AKSIMD_MOVELH_V4F32( a, b ) and AKSIMD_MOVEHL_V4F32( b, a )
+#define AKSIMD_MOVELH_V8F32( a, b ) _mm256_castpd_ps( _mm256_unpacklo_pd( _mm256_castps_pd( a ), _mm256_castps_pd( b ) ) )
+#define AKSIMD_MOVEHL_V8F32( b, a ) _mm256_castpd_ps( _mm256_unpackhi_pd( _mm256_castps_pd( a ), _mm256_castps_pd( b ) ) )
+
+#define AKSIMD_SHUFFLE_V8_DBCA( __a__ ) AKSIMD_SHUFFLE_V8F32( (__a__), (__a__), AKSIMD_SHUFFLE(0,2,1,3) )
+#define AKSIMD_SHUFFLE_V8_ACBD( __a__ ) AKSIMD_SHUFFLE_V8F32( (__a__), (__a__), AKSIMD_SHUFFLE(3,1,2,0) )
+#define AKSIMD_SHUFFLE_V8_DCBA( __a__ ) AKSIMD_SHUFFLE_V8F32( (__a__), (__a__), AKSIMD_SHUFFLE(0,1,2,3) )
+
+#define AKSIMD_CONVERT_V8I32BITS_TO_V8F32( __a__ ) AKSIMD_CONVERT_V8I32_TO_V8F32( _mm256_castps_si256( (__a__) ) )
+
+AkForceInline void SIMDRotate_V8(AKSIMD_V8F32 &A, AKSIMD_V8F32 &B, AKSIMD_V8F32 &C, AKSIMD_V8F32 &D)
+{
+	AKSIMD_V8F32 tmp4, tmp5, tmp6, tmp7;
+	tmp4 = AKSIMD_MOVELH_V8F32(A, B);
+	tmp5 = AKSIMD_MOVEHL_V8F32(B, A);
+	tmp6 = AKSIMD_MOVELH_V8F32(C, D);
+	tmp7 = AKSIMD_MOVEHL_V8F32(D, C);
+
+	A = AKSIMD_SHUFFLE_V8F32(tmp4, tmp6, AKSIMD_SHUFFLE(2,0,2,0));
+	B = AKSIMD_SHUFFLE_V8F32(tmp4, tmp6, AKSIMD_SHUFFLE(3,1,3,1));
+	C = AKSIMD_SHUFFLE_V8F32(tmp5, tmp7, AKSIMD_SHUFFLE(2,0,2,0));
+	D = AKSIMD_SHUFFLE_V8F32(tmp5, tmp7, AKSIMD_SHUFFLE(3,1,3,1));
+}
+
+AkForceInline void SIMDShiftRightAndInsert(AKSIMD_V4F32& A, const AKSIMD_V4F32&B)
+{
+	AKSIMD_V4F32 TC = AKSIMD_SHUFFLE_V4F32(B, A, AKSIMD_SHUFFLE(3,3,0,0));
+	A = AKSIMD_SHUFFLE_V4F32(A, TC, AKSIMD_SHUFFLE(1,2,2,1));
+}
+
+AkForceInline void SinCosNext_V8(SinCosGenerator &sincos, AKSIMD_V8F32 &s, AKSIMD_V8F32 &c)
+{
+	AKSIMD_V4F32 s4, c4;
+	sincos.Next(s4, c4);
+	s = AKSIMD_DUPLICATE_V4F32(s4);
+	c = AKSIMD_DUPLICATE_V4F32(c4);
+}
+
+#define SIMDRead4_V8(p, step, A, B, C, D)\
+	A = AKSIMD_LOAD_V8F32(p);	\
+	B = AKSIMD_LOAD_V8F32(p+step);	\
+	C = AKSIMD_LOAD_V8F32(p+2*step);	\
+	D = AKSIMD_LOAD_V8F32(p+3*step);
+
+#define SIMD_ffXPROD31_V8(a, b, t, v, x, y) \
+	x = AKSIMD_MADD_V8F32(a, t, AKSIMD_MUL_V8F32(b, v));	\
+	y = AKSIMD_MSUB_V8F32(b, t, AKSIMD_MUL_V8F32(a, v));
+
+#define SIMD_ffXNPROD31_V8(a, b, t, v, x, y) \
+	x = AKSIMD_MSUB_V8F32(a, t, AKSIMD_MUL_V8F32(b, v)); \
+	y = AKSIMD_MADD_V8F32(b, t, AKSIMD_MUL_V8F32(a, v));
+
+#define BUTTERFLY_STAGE_XN_V8(_s1ar, _s1ai, _s1br, _s1bi, _symIncAr, _symIncAi, _symIncBr, _symIncBi, _y1ar, _y1ai, _y1br, _y1bi, _y3ar, _y3ai, _y3br, _y3bi)\
+	_y3ar	= AKSIMD_ADD_V8F32(_symIncAr, _symIncAi);\
+	r0		= AKSIMD_SUB_V8F32(_symIncAr, _symIncAi);\
+	_y3br	= AKSIMD_ADD_V8F32(_symIncBr, _symIncBi);\
+	r1		= AKSIMD_SUB_V8F32(_symIncBr, _symIncBi);\
+	_y3ai	= AKSIMD_ADD_V8F32(_s1ai, _s1ar);\
+	r2		= AKSIMD_SUB_V8F32(_s1ar, _s1ai);\
+	_y3bi	= AKSIMD_ADD_V8F32(_s1bi, _s1br);\
+	r3		= AKSIMD_SUB_V8F32(_s1bi, _s1br);\
+	SIMD_ffXNPROD31_V8(r0, r1, Tr, Ti, _y1ar, _y1br);\
+	SIMD_ffXNPROD31_V8(r3, r2, Tr, Ti, _y1ai, _y1bi);
+
+#define BUTTERFLY_STAGE_X_V8(_s2ar, _s2ai, _s2br, _s2bi, _symIncAr, _symIncAi, _symIncBr, _symIncBi, _y2ar, _y2ai, _y2br, _y2bi, _y4ar, _y4ai, _y4br, _y4bi)\
+	_y4ar	= AKSIMD_ADD_V8F32(_symIncAr, _symIncAi);\
+	r0		= AKSIMD_SUB_V8F32(_symIncAr, _symIncAi);\
+	_y4br	= AKSIMD_ADD_V8F32(_symIncBr, _symIncBi);\
+	r1		= AKSIMD_SUB_V8F32(_symIncBi, _symIncBr);\
+	_y4ai	= AKSIMD_ADD_V8F32(_s2ai, _s2ar);\
+	r2		= AKSIMD_SUB_V8F32(_s2ai, _s2ar);\
+	_y4bi	= AKSIMD_ADD_V8F32(_s2bi, _s2br);\
+	r3		= AKSIMD_SUB_V8F32(_s2bi, _s2br);\
+	SIMD_ffXPROD31_V8(r1, r0, TEr, TEi, _y2ar, _y2br);\
+	SIMD_ffXPROD31_V8(r2, r3, TEr, TEi, _y2ai, _y2bi);
+
+// In all functions below, offsets and sizes are in vectors of 4 values of each channel (i.e. 8 floats).
+
+static void mdct_presymmetry_x2(AKSIMD_V8F32 *x, const int points, const int shift, AKSIMD_V8F32 *in_floor, const int end)
+{
+	AKSIMD_V8F32 *pOut = x;
+	AKSIMD_V8F32 *pRevOut = x + points / 4 - 4;
+
+	AKSIMD_V8F32 *pC = x;
+	AKSIMD_V8F32 *pSym = x + points / 4;
+	AKSIMD_V8F32 *pFloor = in_floor;
+	AKSIMD_V8F32 *pFloorSym = in_floor + points / 4;
+
+	AKSIMD_V8F32 symIncAr, symIncAi, symIncBr, symIncBi, symDecAr, symDecAi, symDecBr, symDecBi;
+	AKSIMD_V8F32 f0, f1, f2, f3;
+	AKSIMD_V8F32 Tr, Ti;
+	AKSIMD_V8F32 s1ar, s1ai;
+	AKSIMD_V8F32 s1br, s1bi;
+	AKSIMD_V8F32 s4ar, s4ai;
+	AKSIMD_V8F32 s4br, s4bi;
+
+	SinCosGenerator sincos;
+	sincos.InitFwd(shift, 0);
+	AKSIMD_V4F32 tmpR, tmpI, Tr4, Ti4;
+	sincos.Next(tmpR, tmpI);
+
+	pSym -= 1;
+	pFloorSym -= 1;
+
+	if (end < points)
+	{
+		AKASSERT((points - end) % 16 == 0);
+		AKSIMD_V8F32 *pOutZero = x + (points - end) / 4;
+		const AKSIMD_V8F32 zero = AKSIMD_SETZERO_V8F32();
+
+		while (pOut < pOutZero)
+		{
+			Tr4 = tmpR;
+			Ti4 = tmpI;
+			Tr = AKSIMD_DUPLICATE_V4F32(Tr4);
+			Ti = AKSIMD_DUPLICATE_V4F32(Ti4);
+
+			SIMDRead4_V8(pC, 1, symIncAr, symIncAi, symIncBr, symIncBi);
+
+			SIMDRead4_V8(pFloor, 1, f0, f1, f2, f3);
+			symIncAr = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32BITS_TO_V8F32(symIncAr), f0);
+			symIncAi = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32BITS_TO_V8F32(symIncAi), f1);
+			symIncBr = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32BITS_TO_V8F32(symIncBr), f2);
+			symIncBi = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32BITS_TO_V8F32(symIncBi), f3);
+
+			SIMDRotate_V8(symIncAr, symIncAi, symIncBr, symIncBi);
+
+			SIMD_ffXNPROD31_V8(symIncBr, symIncAr, Ti, Tr, s4ar, s4br);
+
+			sincos.Next(tmpR, tmpI);
+			SIMDShiftRightAndInsert(Tr4, tmpR);
+			SIMDShiftRightAndInsert(Ti4, tmpI);
+			Tr = AKSIMD_DUPLICATE_V4F32(Tr4);
+			Ti = AKSIMD_DUPLICATE_V4F32(Ti4);
+
+			SIMD_ffXPROD31_V8(symIncAi, symIncBi, Ti, Tr, s1ai, s1bi);
+
+			AKSIMD_STORE_V8F32(pOut + 0, zero);
+			AKSIMD_STORE_V8F32(pOut + 1, s1ai);
+			AKSIMD_STORE_V8F32(pOut + 2, zero);
+			AKSIMD_STORE_V8F32(pOut + 3, s1bi);
+			pOut += 4;
+
+			AKSIMD_STORE_V8F32(pRevOut + 0, AKSIMD_SHUFFLE_V8_DCBA(s4ar));
+			AKSIMD_STORE_V8F32(pRevOut + 2, AKSIMD_SHUFFLE_V8_DCBA(s4br));
+			pRevOut -= 4;
+
+			pC += 4;
+			pFloor += 4;
+		}
+		pSym -= (points - end) / 4;
+		pFloorSym -= (points - end) / 4;
+	}
+
+	while (pOut < pRevOut)
+	{
+		Tr4 = tmpR;
+		Ti4 = tmpI;
+		Tr = AKSIMD_DUPLICATE_V4F32(Tr4);
+		Ti = AKSIMD_DUPLICATE_V4F32(Ti4);
+
+		SIMDRead4_V8(pC, 1, symIncAr, symIncAi, symIncBr, symIncBi);
+
+		SIMDRead4_V8(pFloor, 1, f0, f1, f2, f3);
+		symIncAr = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32BITS_TO_V8F32(symIncAr), f0);
+		symIncAi = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32BITS_TO_V8F32(symIncAi), f1);
+		symIncBr = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32BITS_TO_V8F32(symIncBr), f2);
+		symIncBi = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32BITS_TO_V8F32(symIncBi), f3);
+
+		SIMDRotate_V8(symIncAr, symIncAi, symIncBr, symIncBi);
+
+		SIMDRead4_V8(pSym, -1, symDecAr, symDecAi, symDecBr, symDecBi);
+
+		SIMDRead4_V8(pFloorSym, -1, f0, f1, f2, f3);
+		symDecAr = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32BITS_TO_V8F32(symDecAr), f0);
+		symDecAi = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32BITS_TO_V8F32(symDecAi), f1);
+		symDecBr = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32BITS_TO_V8F32(symDecBr), f2);
+		symDecBi = AKSIMD_MUL_V8F32(AKSIMD_CONVERT_V8I32BITS_TO_V8F32(symDecBi), f3);
+
+		SIMDRotate_V8(symDecAr, symDecAi, symDecBr, symDecBi);
+
+		SIMD_ffXPROD31_V8(symDecAi, symDecBi, Tr, Ti, s4ai, s4bi);
+		SIMD_ffXNPROD31_V8(symIncBr, symIncAr, Ti, Tr, s4ar, s4br);
+
+		sincos.Next(tmpR, tmpI);
+		SIMDShiftRightAndInsert(Tr4, tmpR);
+		SIMDShiftRightAndInsert(Ti4, tmpI);
+		Tr = AKSIMD_DUPLICATE_V4F32(Tr4);
+		Ti = AKSIMD_DUPLICATE_V4F32(Ti4);
+
+		SIMD_ffXPROD31_V8(symIncAi, symIncBi, Ti, Tr, s1ai, s1bi);
+		SIMD_ffXNPROD31_V8(symDecBr, symDecAr, Tr, Ti, s1ar, s1br);
+
+		AKSIMD_STORE_V8F32(pOut + 0, s1ar);
+		AKSIMD_STORE_V8F32(pOut + 1, s1ai);
+		AKSIMD_STORE_V8F32(pOut + 2, s1br);
+		AKSIMD_STORE_V8F32(pOut + 3, s1bi);
+		pOut += 4;
+
+		AKSIMD_STORE_V8F32(pRevOut + 0, AKSIMD_SHUFFLE_V8_DCBA(s4ar));
+		AKSIMD_STORE_V8F32(pRevOut + 1, AKSIMD_SHUFFLE_V8_DCBA(s4ai));
+		AKSIMD_STORE_V8F32(pRevOut + 2, AKSIMD_SHUFFLE_V8_DCBA(s4br));
+		AKSIMD_STORE_V8F32(pRevOut + 3, AKSIMD_SHUFFLE_V8_DCBA(s4bi));
+		pRevOut -= 4;
+
+		pSym -= 4;
+		pC += 4;
+		pFloor += 4;
+		pFloorSym -= 4;
+	}
+}
+
+static void mdct_first_2stages_x2(AKSIMD_V8F32 *x, const int points, const int shift, AKSIMD_V8F32 *pOut)
+{
+	AKSIMD_V8F32 r0, r1, r2, r3;
+	int n4 = points / 16;
+	int x1a, x2a, x3a, x4a;
+	x1a = 0;
+
+	SinCosGenerator sincos;
+	sincos.InitFwd(shift + 1, 1);
+	SinCosGenerator sincos2;
+	sincos2.InitReverse(shift + 1);
+	SinCosGenerator sincos3;
+	sincos3.InitFwd(shift + 2, 1);
+
+	AKSIMD_V8F32 *pC = x;
+
+	AKSIMD_V8F32 Tr, Ti, TEr, TEi;
+	AKSIMD_V8F32 s1ar, s1ai, s1br, s1bi;
+	AKSIMD_V8F32 s2ar, s2ai, s2br, s2bi;
+	AKSIMD_V8F32 s3ar, s3ai, s3br, s3bi;
+	AKSIMD_V8F32 s4ar, s4ai, s4br, s4bi;
+
+	AKSIMD_V8F32 y1ar, y1ai, y1br, y1bi;
+	AKSIMD_V8F32 y2ar, y2ai, y2br, y2bi;
+	AKSIMD_V8F32 y3ar, y3ai, y3br, y3bi;
+	AKSIMD_V8F32 y4ar, y4ai, y4br, y4bi;
+
+	AKSIMD_V8F32 x1ar, x1ai, x1br, x1bi;
+	AKSIMD_V8F32 x2ar, x2ai, x2br, x2bi;
+	AKSIMD_V8F32 x3ar, x3ai, x3br, x3bi;
+	AKSIMD_V8F32 x4ar, x4ai, x4br, x4bi;
+
+	for (int i = 0; i < points / 64; i++)
+	{
+		x2a = x1a + n4;
+		x3a = x2a + n4;
+		x4a = x3a + n4;
+
+		SIMDRead4_V8(pC + x1a, 1, s1ar, s1ai, s1br, s1bi);
+		SIMDRead4_V8(pC + x3a, 1, s3ar, s3ai, s3br, s3bi);
+
+		SinCosNext_V8(sincos, Tr, Ti);
+
+		BUTTERFLY_STAGE_XN_V8(s1ar, s1ai, s1br, s1bi,
+			s3ar, s3ai, s3br, s3bi,
+			y1ar, y1ai, y1br, y1bi,
+			y3ar, y3ai, y3br, y3bi);
+
+		SinCosNext_V8(sincos2, TEr, TEi);
+
+		SIMDRead4_V8(pC + x2a, 1, s2ar, s2ai, s2br, s2bi);
+		SIMDRead4_V8(pC + x4a, 1, s4ar, s4ai, s4br, s4bi);
+
+		BUTTERFLY_STAGE_X_V8(s2ar, s2ai, s2br, s2bi,
+			s4ar, s4ai, s4br, s4bi,
+			y2ar, y2ai, y2br, y2bi,
+			y4ar, y4ai, y4br, y4bi);
+
+		SinCosNext_V8(sincos3, Tr, Ti);
+
+		BUTTERFLY_STAGE_XN_V8(y1ar, y1ai, y1br, y1bi,
+			y2ar, y2ai, y2br, y2bi,
+			x1ar, x1ai, x1br, x1bi,
+			x2ar, x2ai, x2br, x2bi);
+
+		BUTTERFLY_STAGE_XN_V8(y3ar, y3ai, y3br, y3bi,
+			y4ar, y4ai, y4br, y4bi,
+			x3ar, x3ai, x3br, x3bi,
+			x4ar, x4ai, x4br, x4bi);
+
+		SIMDRotate_V8(x1ar, x2ar, x3ar, x4ar);
+		AKSIMD_STORE_V8F32(pOut + 0, x1ar);
+		AKSIMD_STORE_V8F32(pOut + 4, x2ar);
+		AKSIMD_STORE_V8F32(pOut + 8, x3ar);
+		AKSIMD_STORE_V8F32(pOut + 12, x4ar);
+		pOut += 1;
+
+		SIMDRotate_V8(x1ai, x2ai, x3ai, x4ai);
+		AKSIMD_STORE_V8F32(pOut + 0, x1ai);
+		AKSIMD_STORE_V8F32(pOut + 4, x2ai);
+		AKSIMD_STORE_V8F32(pOut + 8, x3ai);
+		AKSIMD_STORE_V8F32(pOut + 12, x4ai);
+		pOut += 1;
+
+		SIMDRotate_V8(x1br, x2br, x3br, x4br);
+		AKSIMD_STORE_V8F32(pOut + 0, x1br);
+		AKSIMD_STORE_V8F32(pOut + 4, x2br);
+		AKSIMD_STORE_V8F32(pOut + 8, x3br);
+		AKSIMD_STORE_V8F32(pOut + 12, x4br);
+		pOut += 1;
+
+		SIMDRotate_V8(x1bi, x2bi, x3bi, x4bi);
+		AKSIMD_STORE_V8F32(pOut + 0, x1bi);
+		AKSIMD_STORE_V8F32(pOut + 4, x2bi);
+		AKSIMD_STORE_V8F32(pOut + 8, x3bi);
+		AKSIMD_STORE_V8F32(pOut + 12, x4bi);
+
+		pOut += 16 - 3;
+		x1a += 4;
+	}
+}
+
+static void mdct_butterfly_stage_x2(AKSIMD_V8F32 *x, int points, int shift)
+{
+	AKSIMD_V8F32 *x1 = x + points / 4 - 4;
+	AKSIMD_V8F32 *x2 = x + points / 8 - 4;
+
+	AKSIMD_V8F32 TEr, TEi;
+	SinCosGenerator sincos;
+	sincos.InitFwdSingle(shift);
+
+	AKSIMD_V8F32 r0, r1, r2, r3;
+	AKSIMD_V8F32 a0, a1, a2, a3, b0, b1, b2, b3;
+
+	do
+	{
+		SinCosNext_V8(sincos, TEr, TEi);
+
+		SIMDRead4_V8(x1, 1, a0, a1, a2, a3);
+		SIMDRead4_V8(x2, 1, b0, b1, b2, b3);
+
+		r0 = AKSIMD_SUB_V8F32(a0, a1);
+		r1 = AKSIMD_SUB_V8F32(a3, a2);
+		r2 = AKSIMD_SUB_V8F32(b1, b0);
+		r3 = AKSIMD_SUB_V8F32(b3, b2);
+		AKSIMD_STORE_V8F32(x1 + 0, AKSIMD_ADD_V8F32(a0, a1));
+		AKSIMD_STORE_V8F32(x1 + 2, AKSIMD_ADD_V8F32(a2, a3));
+		AKSIMD_STORE_V8F32(x1 + 1, AKSIMD_ADD_V8F32(b1, b0));
+		AKSIMD_STORE_V8F32(x1 + 3, AKSIMD_ADD_V8F32(b3, b2));
+
+		SIMD_ffXPROD31_V8(r1, r0, TEr, TEi, b0, b2);
+		SIMD_ffXPROD31_V8(r2, r3, TEr, TEi, b1, b3);
+		AKSIMD_STORE_V8F32(x2 + 0, b0);
+		AKSIMD_STORE_V8F32(x2 + 1, b1);
+		AKSIMD_STORE_V8F32(x2 + 2, b2);
+		AKSIMD_STORE_V8F32(x2 + 3, b3);
+
+		x1 -= 4;
+		x2 -= 4;
+	} while (x2 >= x);
+}
+
+#define READ_CPLX_V8(_i, _j) \
+	AKSIMD_V8F32 x##_i = AKSIMD_LOAD_V8F32(x+_i);	\
+	AKSIMD_V8F32 x##_j = AKSIMD_LOAD_V8F32(x+_i+1);
+
+#define COMPUTE_SUM_AND_DIFF_V8(_i, _j, _name)	\
+	AKSIMD_V8F32 s##_name = AKSIMD_ADD_V8F32(_i,_j);	\
+	AKSIMD_V8F32 d##_name = AKSIMD_SUB_V8F32(_i,_j);
+
+#define SPLIT_AND_STORE16_V8() \
+	AKSIMD_STORE_V8F32(x++, evenA); \
+	AKSIMD_STORE_V8F32(x++, oddA); \
+	AKSIMD_STORE_V8F32(x++, evenB); \
+	AKSIMD_STORE_V8F32(x++, oddB);
+
+static AkForceInline void mdct_butterfly_16_combinedx4_x2(AKSIMD_V8F32 *x)
+{
+	READ_CPLX_V8(0, 1);
+	READ_CPLX_V8(2, 3);
+	READ_CPLX_V8(4, 5);
+	READ_CPLX_V8(6, 7);
+	READ_CPLX_V8(8, 9);
+	READ_CPLX_V8(10, 11);
+	READ_CPLX_V8(12, 13);
+	READ_CPLX_V8(14, 15);
+
+	const AKSIMD_V8F32 K = AKSIMD_SET_V8F32(CosPiOverFour);
+	COMPUTE_SUM_AND_DIFF_V8(x0, x1, 0);
+	COMPUTE_SUM_AND_DIFF_V8(x2, x3, 2);
+	COMPUTE_SUM_AND_DIFF_V8(x4, x5, 4);
+	COMPUTE_SUM_AND_DIFF_V8(x6, x7, 6);
+	COMPUTE_SUM_AND_DIFF_V8(x8, x9, 8);
+	COMPUTE_SUM_AND_DIFF_V8(x10, x11, 10);
+	COMPUTE_SUM_AND_DIFF_V8(x12, x13, 12);
+	COMPUTE_SUM_AND_DIFF_V8(x14, x15, 14);
+
+	COMPUTE_SUM_AND_DIFF_V8(d8, d10, d8d10);
+	COMPUTE_SUM_AND_DIFF_V8(d0, d2, d0d2);
+
+	AKSIMD_V8F32 K0 = AKSIMD_MUL_V8F32(AKSIMD_SUB_V8F32(sd8d10, dd0d2), K);
+	AKSIMD_V8F32 K1 = AKSIMD_MUL_V8F32(AKSIMD_SUB_V8F32(AKSIMD_NEG_V8F32(dd8d10), sd0d2), K);
+	AKSIMD_V8F32 K2 = AKSIMD_MUL_V8F32(AKSIMD_SUB_V8F32(sd0d2, dd8d10), K);
+	AKSIMD_V8F32 K3 = AKSIMD_MUL_V8F32(AKSIMD_SUB_V8F32(AKSIMD_NEG_V8F32(sd8d10), dd0d2), K);
+
+	COMPUTE_SUM_AND_DIFF_V8(d12, d6, d12d6);
+	COMPUTE_SUM_AND_DIFF_V8(d14, d4, d14d4);
+	COMPUTE_SUM_AND_DIFF_V8(s12, s4, s12s4);
+	COMPUTE_SUM_AND_DIFF_V8(s14, s6, s14s6);
+	COMPUTE_SUM_AND_DIFF_V8(s8, s0, s8s0);
+	COMPUTE_SUM_AND_DIFF_V8(s10, s2, s10s2);
+
+	AKSIMD_V8F32 evenA, oddA, evenB, oddB;
+	evenA = AKSIMD_ADD_V8F32(sd12d6, K0);
+	oddA = AKSIMD_ADD_V8F32(dd14d4, K1);
+	evenB = AKSIMD_SUB_V8F32(sd12d6, K0);
+	oddB = AKSIMD_SUB_V8F32(dd14d4, K1);
+	SPLIT_AND_STORE16_V8();
+
+	evenA = AKSIMD_ADD_V8F32(dd12d6, K2);
+	oddA = AKSIMD_ADD_V8F32(sd14d4, K3);
+	evenB = AKSIMD_SUB_V8F32(dd12d6, K2);
+	oddB = AKSIMD_SUB_V8F32(sd14d4, K3);
+	SPLIT_AND_STORE16_V8();
+
+	evenA = AKSIMD_ADD_V8F32(ds12s4, ds10s2);
+	oddA = AKSIMD_SUB_V8F32(ds14s6, ds8s0);
+	evenB = AKSIMD_SUB_V8F32(ds12s4, ds10s2);
+	oddB = AKSIMD_ADD_V8F32(ds14s6, ds8s0);
+	SPLIT_AND_STORE16_V8();
+
+	evenA = AKSIMD_SUB_V8F32(ss12s4, ss8s0);
+	oddA = AKSIMD_SUB_V8F32(ss14s6, ss10s2);
+	evenB = AKSIMD_ADD_V8F32(ss12s4, ss8s0);
+	oddB = AKSIMD_ADD_V8F32(ss14s6, ss10s2);
+	SPLIT_AND_STORE16_V8();
+}
+
+#define SPLIT_AND_STORE32_V8(offset) \
+	AKSIMD_STORE_V8F32(x + offset, even);	\
+	AKSIMD_STORE_V8F32(x + offset+1, odd);
+
+// Last 5 stages on 32 complex values (see mdct_butterfly_32x4 in mdct_SIMD.cpp).
+#define BUTTERFLY_32_QUARTER_V8(_a, _b, _c, _d, _e, _f, _g, _h)	\
+	READ_CPLX_V8(_a, _b);	\
+	READ_CPLX_V8(_c, _d);	\
+	READ_CPLX_V8(_e, _f);	\
+	READ_CPLX_V8(_g, _h);
+
+static AkForceInline void mdct_butterfly_32x4_x2(AKSIMD_V8F32 *x)
+{
+	AKSIMD_V8F32 r0, r1, r2, r3, even, odd;
+	const AKSIMD_V8F32 K3_8 = AKSIMD_SET_V8F32(CosThreePiOverEight);
+	const AKSIMD_V8F32 K1_8 = AKSIMD_SET_V8F32(CosPiOverEight);
+	const AKSIMD_V8F32 K1_4 = AKSIMD_SET_V8F32(CosPiOverFour);
+
+	{
+		BUTTERFLY_32_QUARTER_V8(16, 17, 18, 19, 0, 1, 2, 3);
+
+		r0 = AKSIMD_SUB_V8F32(x16, x17);
+		r1 = AKSIMD_SUB_V8F32(x18, x19);
+		r2 = AKSIMD_SUB_V8F32(x1, x0);
+		r3 = AKSIMD_SUB_V8F32(x3, x2);
+
+		even = AKSIMD_ADD_V8F32(x16, x17);
+		odd = AKSIMD_ADD_V8F32(x1, x0);
+		SPLIT_AND_STORE32_V8(16);
+
+		even = AKSIMD_ADD_V8F32(x18, x19);
+		odd = AKSIMD_ADD_V8F32(x3, x2);
+		SPLIT_AND_STORE32_V8(18);
+
+		even = AKSIMD_MSUB_V8F32(r0, K3_8, AKSIMD_MUL_V8F32(r1, K1_8));
+		odd = AKSIMD_MADD_V8F32(r2, K1_8, AKSIMD_MUL_V8F32(r3, K3_8));
+		SPLIT_AND_STORE32_V8(0);
+
+		even = AKSIMD_MADD_V8F32(r1, K3_8, AKSIMD_MUL_V8F32(r0, K1_8));
+		odd = AKSIMD_MSUB_V8F32(r3, K1_8, AKSIMD_MUL_V8F32(r2, K3_8));
+		SPLIT_AND_STORE32_V8(2);
+	}
+
+	{
+		BUTTERFLY_32_QUARTER_V8(20, 21, 22, 23, 4, 5, 6, 7);
+
+		r0 = AKSIMD_SUB_V8F32(x20, x21);
+		r1 = AKSIMD_SUB_V8F32(x22, x23);
+		r2 = AKSIMD_SUB_V8F32(x5, x4);
+		r3 = AKSIMD_SUB_V8F32(x7, x6);
+
+		even = AKSIMD_ADD_V8F32(x20, x21);
+		odd = AKSIMD_ADD_V8F32(x5, x4);
+		SPLIT_AND_STORE32_V8(20);
+
+		even = AKSIMD_ADD_V8F32(x22, x23);
+		odd = AKSIMD_ADD_V8F32(x7, x6);
+		SPLIT_AND_STORE32_V8(22);
+
+		even = AKSIMD_MUL_V8F32(AKSIMD_SUB_V8F32(r0, r1), K1_4);
+		odd = AKSIMD_MUL_V8F32(AKSIMD_ADD_V8F32(r3, r2), K1_4);
+		SPLIT_AND_STORE32_V8(4);
+
+		even = AKSIMD_MUL_V8F32(AKSIMD_ADD_V8F32(r0, r1), K1_4);
+		odd = AKSIMD_MUL_V8F32(AKSIMD_SUB_V8F32(r3, r2), K1_4);
+		SPLIT_AND_STORE32_V8(6);
+	}
+
+	{
+		BUTTERFLY_32_QUARTER_V8(24, 25, 26, 27, 8, 9, 10, 11);
+
+		r0 = AKSIMD_SUB_V8F32(x24, x25);
+		r1 = AKSIMD_SUB_V8F32(x26, x27);
+		r2 = AKSIMD_SUB_V8F32(x9, x8);
+		r3 = AKSIMD_SUB_V8F32(x11, x10);
+
+		even = AKSIMD_ADD_V8F32(x24, x25);
+		odd = AKSIMD_ADD_V8F32(x9, x8);
+		SPLIT_AND_STORE32_V8(24);
+
+		even = AKSIMD_ADD_V8F32(x26, x27);
+		odd = AKSIMD_ADD_V8F32(x11, x10);
+		SPLIT_AND_STORE32_V8(26);
+
+		even = AKSIMD_MSUB_V8F32(r0, K1_8, AKSIMD_MUL_V8F32(r1, K3_8));
+		odd = AKSIMD_MADD_V8F32(r2, K3_8, AKSIMD_MUL_V8F32(r3, K1_8));
+		SPLIT_AND_STORE32_V8(8);
+
+		even = AKSIMD_MADD_V8F32(r1, K1_8, AKSIMD_MUL_V8F32(r0, K3_8));
+		odd = AKSIMD_MSUB_V8F32(r3, K3_8, AKSIMD_MUL_V8F32(r2, K1_8));
+		SPLIT_AND_STORE32_V8(10);
+	}
+
+	{
+		BUTTERFLY_32_QUARTER_V8(28, 29, 30, 31, 12, 13, 14, 15);
+
+		r0 = AKSIMD_SUB_V8F32(x28, x29);
+		r1 = AKSIMD_SUB_V8F32(x30, x31);
+		r2 = AKSIMD_SUB_V8F32(x12, x13);
+		r3 = AKSIMD_SUB_V8F32(x15, x14);
+
+		even = AKSIMD_ADD_V8F32(x28, x29);
+		odd = AKSIMD_ADD_V8F32(x13, x12);
+		SPLIT_AND_STORE32_V8(28);
+
+		even = AKSIMD_ADD_V8F32(x30, x31);
+		odd = AKSIMD_ADD_V8F32(x15, x14);
+		SPLIT_AND_STORE32_V8(30);
+
+		even = r0;
+		odd = r3;
+		SPLIT_AND_STORE32_V8(12);
+
+		even = r1;
+		odd = r2;
+		SPLIT_AND_STORE32_V8(14);
+	}
+
+	mdct_butterfly_16_combinedx4_x2(x);
+	mdct_butterfly_16_combinedx4_x2(x + 16);
+}
+
+static void mdct_reverse_step7_step8_x2(AKSIMD_V8F32 *pIn, int n, int shift, AKSIMD_V8F32 *pO)
+{
+	AKSIMD_V8F32 w0r, w0i, w1r, w1i;
+
+	n = n >> 1;
+
+	SinCosGenerator sincos;
+	sincos.InitStep7(shift + 1);
+
+	SinCosGenerator sincosStep8;
+	sincosStep8.InitStep7(shift - 1);
+
+	int n2 = n / 8;
+	int idx0 = 0;
+	int idx1 = n2 - 1;
+	int idxOut = n / 8 - 1;
+
+	AKSIMD_V8F32 fr0, fr1;
+	AKSIMD_V8F32 fr2, fr3;
+	AKSIMD_V8F32 Tr, Ti, T8r, T8i;
+	const AKSIMD_V8F32 vHalf = AKSIMD_SET_V8F32(0.5f);
+	const AKSIMD_V8F32 vSin45 = AKSIMD_SET_V8F32(CosPiOverFour);
+	const AKSIMD_V8F32 vQuantizeFactor = AKSIMD_SET_V8F32(1.f / 256.f);
+
+	int significant = shift - 1;
+
+	do
+	{
+		int src0 = g_rev9[idx1] >> significant;
+		w0r = AKSIMD_LOAD_V8F32(pIn + src0);
+		w0i = AKSIMD_LOAD_V8F32(pIn + src0 + 1);
+
+		w0r = AKSIMD_SHUFFLE_V8_DBCA(w0r);
+		w0i = AKSIMD_SHUFFLE_V8_DBCA(w0i);
+
+		int src1 = g_rev9[idx0] >> significant;
+		w1r = AKSIMD_LOAD_V8F32(pIn + src1);
+		w1i = AKSIMD_LOAD_V8F32(pIn + src1 + 1);
+
+		w1r = AKSIMD_SHUFFLE_V8_ACBD(w1r);
+		w1i = AKSIMD_SHUFFLE_V8_ACBD(w1i);
+
+		SinCosNext_V8(sincos, Tr, Ti);
+
+		fr0 = AKSIMD_ADD_V8F32(w0r, w1r);
+		fr1 = AKSIMD_SUB_V8F32(w1i, w0i);
+		fr2 = AKSIMD_MUL_V8F32(AKSIMD_MADD_V8F32(fr0, Ti, AKSIMD_MUL_V8F32(fr1, Tr)), vHalf);
+		fr3 = AKSIMD_MUL_V8F32(AKSIMD_MSUB_V8F32(fr1, Ti, AKSIMD_MUL_V8F32(fr0, Tr)), vHalf);
+
+		fr0 = AKSIMD_MUL_V8F32(AKSIMD_ADD_V8F32(w0i, w1i), vHalf);
+		fr1 = AKSIMD_MUL_V8F32(AKSIMD_SUB_V8F32(w0r, w1r), vHalf);
+
+		w0r = AKSIMD_ADD_V8F32(fr0, fr2);
+		w0i = AKSIMD_ADD_V8F32(fr1, fr3);
+		w1r = AKSIMD_SUB_V8F32(fr0, fr2);
+		w1i = AKSIMD_SUB_V8F32(fr3, fr1);
+
+		//Step 8
+		SinCosNext_V8(sincosStep8, Tr, Ti);
+		w0i = AKSIMD_NEG_V8F32(w0i);
+		SIMD_ffXPROD31_V8(w0r, w0i, Tr, Ti, fr0, fr1);
+
+		fr0 = AKSIMD_MUL_V8F32(fr0, vQuantizeFactor);
+		fr1 = AKSIMD_MUL_V8F32(fr1, vQuantizeFactor);
+
+		AKSIMD_STORE_V8F32(pO + idx0, fr0);
+		AKSIMD_STORE_V8F32(pO + idx0 + n / 8, fr1);
+
+		w1i = AKSIMD_NEG_V8F32(w1i);
+		T8r = AKSIMD_MUL_V8F32(AKSIMD_SUB_V8F32(Ti, Tr), vSin45);
+		T8i = AKSIMD_MUL_V8F32(AKSIMD_ADD_V8F32(Ti, Tr), vSin45);
+		SIMD_ffXPROD31_V8(w1r, w1i, T8r, T8i, fr0, fr1);
+
+		fr0 = AKSIMD_SHUFFLE_V8_DCBA(fr0);
+		fr1 = AKSIMD_SHUFFLE_V8_DCBA(fr1);
+
+		fr0 = AKSIMD_MUL_V8F32(fr0, vQuantizeFactor);
+		fr1 = AKSIMD_MUL_V8F32(fr1, vQuantizeFactor);
+
+		AKSIMD_STORE_V8F32(pO + idxOut, fr0);
+		AKSIMD_STORE_V8F32(pO + idxOut + n / 8, fr1);
+
+		idx0++;
+		idx1--;
+		idxOut--;
+	} while (idx0 < idx1);
+}
+
+// Puts 4 values of A, then 4 values of B, in each vector of out_pPair.
+static AkForceInline void mdct_interleave_x2(const float *in_pA, const float *in_pB, AKSIMD_V8F32 *out_pPair, int in_iNumValues)
+{
+	for (int i = 0; i < in_iNumValues; i += 4)
+		AKSIMD_STORE_V8F32(out_pPair++, AKSIMD_SET_V2F128(AKSIMD_LOAD_V4F32(in_pA + i), AKSIMD_LOAD_V4F32(in_pB + i)));
+}
+
+static AkForceInline void mdct_deinterleave_x2(const AKSIMD_V8F32 *in_pPair, float *out_pA, float *out_pB, int in_iNumValues)
+{
+	for (int i = 0; i < in_iNumValues; i += 4)
+	{
+		AKSIMD_V8F32 v = AKSIMD_LOAD_V8F32(in_pPair++);
+		AKSIMD_STORE_V4F32(out_pA + i, _mm256_castps256_ps128(v));
+		AKSIMD_STORE_V4F32(out_pB + i, _mm256_extractf128_ps(v, 1));
+	}
+}
+
+void mdct_backward_x2_AVX(int n, float *inA, float *inB, float *floorA, float *floorB, int end, float *scratch)
+{
+	int shift;
+	for (shift = 4; !(n&(1 << shift)); shift++);
+	shift = 13 - shift;
+
+	n /= 2;
+
+	// Both floors are copied before the residues, since floorB may be at the start of the scratch buffer.
+	AKSIMD_V8F32 *in = (AKSIMD_V8F32 *)scratch;
+	AKSIMD_V8F32 *mdctBuffer = (AKSIMD_V8F32 *)scratch + n / 4;
+	mdct_interleave_x2(floorA, floorB, mdctBuffer, n);
+	mdct_interleave_x2(inA, inB, in, n);
+
+	mdct_presymmetry_x2(in, n, shift, mdctBuffer, end);
+
+	mdct_first_2stages_x2(in, n, shift, mdctBuffer);
+
+	int stages = 8 - shift - 2;
+	int i, j;
+	int bitshift = 2 + shift;
+
+	for (i = 0; --stages > 0; i++)
+	{
+		for (j = 0; j < (1 << i); j++)
+		{
+			mdct_butterfly_stage_x2(mdctBuffer + ((n >> i) * j) / 4, n >> i, bitshift);
+		}
+		bitshift++;
+	}
+
+	for (i = 0; i < n; i += 32 * 4)
+	{
+		mdct_butterfly_32x4_x2(mdctBuffer + i / 4);
+	}
+
+	mdct_reverse_step7_step8_x2(mdctBuffer, n * 2, shift, in);
+
+	mdct_deinterleave_x2(in, inA, inB, n);
+}
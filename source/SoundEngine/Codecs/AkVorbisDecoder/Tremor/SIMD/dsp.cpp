@@ -64,6 +64,7 @@ int vorbis_dsp_init(vorbis_dsp_state* v, int channels )
 #endif
 
 	InitFloorFunc();
+	InitMdctFunc();
 
 	// otherwise vorbis_dsp_clear will take it for some valid address
 	v->work[0]		= NULL;
@@ -39,6 +39,17 @@
 
 extern void mdct_backward(int n, float *in, float* floor, int end);
 
+// Inverse MDCT of two channels of the same packet, with the same block size and spectrum end, done together in wider vectors.
+// The floors of both channels must be rendered up to end. io_pScratch must hold 2*n floats;
+// in_floorB may point to its first half. NULL when not supported by the CPU.
+typedef void(*mdct_backward_x2_fn)(int n, float *inA, float *inB, float *in_floorA, float *in_floorB, int end, float *io_pScratch);
+extern mdct_backward_x2_fn mdct_backward_x2;
+
+// Must be called at init to use mdct_backward_x2
+extern void InitMdctFunc();
+
+extern const unsigned short g_rev9[512];
+
 AkForceInline void mdct_shift_right(int n, DATA_TYPE *in, DATA_TYPE *right)
 {
 	AKPLATFORM::AkMemCpy(right, in + n/4, n/4*sizeof(float));	
@@ -25,12 +25,14 @@
 #include <AK/SoundEngine/Common/AkSimd.h>
 #include <AK/Tools/Common/AkAssert.h>
 #include <AK/Tools/Common/AkPlatformFuncs.h>
+#include "../../../../AkAudiolib/Common/AkRuntimeEnvironmentMgr.h"
 
 #if TARGET_IPHONE_SIMULATOR
 #include "../FloatingPoint/mdct.cpp"
 #elif defined( AKSIMD_V4F32_SUPPORTED )
 
 #include "SinCosGen.h"
+#include "mdct.h"
 
 // #define cPI3_8 (0x30fbc54d) -> 0.38268343237353648635257803199467 = cos(3 * pi / 8)
 #define CosThreePiOverEight	0.38268343237353648635257803199467f
@@ -1403,3 +1405,17 @@ void mdct_unroll_lap(	int			n0,
 
 
 #endif
+
+#if defined AKSIMD_AVX_SUPPORTED
+extern void mdct_backward_x2_AVX(int n, float *inA, float *inB, float *in_floorA, float *in_floorB, int end, float *io_pScratch);
+#endif
+
+mdct_backward_x2_fn mdct_backward_x2 = NULL;
+
+void InitMdctFunc()
+{
+#if defined AKSIMD_AVX_SUPPORTED
+	if (AK::AkRuntimeEnvironmentMgr::Instance()->GetSIMDSupport(AK::AK_SIMD_AVX))
+		mdct_backward_x2 = mdct_backward_x2_AVX;
+#endif
+}
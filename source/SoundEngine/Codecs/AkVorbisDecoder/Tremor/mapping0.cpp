@@ -303,6 +303,13 @@ int mapping_inverse(vorbis_dsp_state *vd,vorbis_info_mapping *info)
 
 	AK_ALIGN_SIMD(float mdctBuffer[2048+8]);	//Used for the MDCT and the Floor curve.  (Floor could overshoot by 8 because of AVX)		
 
+	//Intra-packet only: the two channels of a stereo packet (or adjacent channels of a multichannel one) are transformed together when the CPU allows it.
+	//Each source decodes its own packets, so channels of different voices are never paired, and mono media gain nothing.
+	//The pair scratch is on the stack, so only for blocks up to 2048.
+	float *pPairScratch = NULL;
+	if (mdct_backward_x2 && vd->channels > 1 && n <= 2048)
+		pPairScratch = (float*)AkAllocaSIMD(2 * n * sizeof(float));
+
 	/* compute and apply spectral envelope */
 	for(i=0;i<vd->channels;i++)
 	{		
@@ -323,6 +330,23 @@ int mapping_inverse(vorbis_dsp_state *vd,vorbis_info_mapping *info)
 		/* floor 1 */
 		floor1_inverse2(vd,&ci->floor_param[floorno],floormemo[i], (ogg_int32_t*) mdctBuffer, end);
 		
+		if (pPairScratch && i + 1 < vd->channels)
+		{
+			int submapB = info->submaps > 1 ? info->chmuxlist[i + 1] : 0;
+			int floornoB = info->submaplist[submapB].floor;
+			vorbis_info_residue *res_infoB = ci->residue_param + info->submaplist[submapB].residue;
+			int endB = res_infoB->end <= max ? res_infoB->end : max;
+			if (endB == end)
+			{
+				//The floor of the second channel goes in the scratch buffer, which is only written once the floors are read.
+				floor1_inverse2(vd, &ci->floor_param[floornoB], floormemo[i + 1], (ogg_int32_t*)pPairScratch, end);
+
+				mdct_backward_x2(n, (float *)vd->work[i], (float *)vd->work[i + 1], mdctBuffer, pPairScratch, end, pPairScratch);
+				i++;
+				continue;
+			}
+		}
+
 		mdct_backward(n, (float *)vd->work[i] , mdctBuffer, end);
 	}
 
@@ -928,8 +928,8 @@ namespace DSP
 			}
 		}
 	
-		AkForceInline void GetMemories(AkUInt32 in_uChannel, AkReal32& fFFwd1, AkReal32& fFFwd2, AkReal32& fFFbk1, AkReal32& fFFbk2) 
-		{ 
+		AkForceInline void GetMemories(AkUInt32 in_uChannel, AkReal32& fFFwd1, AkReal32& fFFwd2, AkReal32& fFFbk1, AkReal32& fFFbk2)
+		{
 			return m_Memories.GetMemories(in_uChannel, fFFwd1, fFFwd2, fFFbk1, fFFbk2);
 		}
 
@@ -938,7 +938,19 @@ namespace DSP
 			m_Memories.SetMemories(in_uChannel, fFFwd1, fFFwd2, fFFbk1, fFFbk2);
 		}
 
-	protected:		
+		// Direct form coefficients, as passed to SetCoefs (A1 and A2 are negated), of a filter that has mono coefficients.
+		AkForceInline void GetMonoCoefs(AkReal32& out_fB0, AkReal32& out_fB1, AkReal32& out_fB2, AkReal32& out_fNegA1, AkReal32& out_fNegA2)
+		{
+			AKASSERT((m_Memories.NumChannels() & 1) || m_Memories.MonoProcess());
+			const AkReal32 *pCoefs = m_Memories.GetMonoCoefPtr();
+			out_fB0 = pCoefs[0];			//First term
+			out_fB1 = pCoefs[4 * 4];		//vXPrev1 term
+			out_fB2 = pCoefs[5 * 4];		//vXPrev2 term
+			out_fNegA1 = pCoefs[6 * 4];		//vYPrev1 term
+			out_fNegA2 = pCoefs[7 * 4];		//vYPrev2 term
+		}
+
+	protected:
 		CHANNEL_POLICY	m_Memories;
 
 #include "./BiquadFilter.cpp"	//Inlined code.
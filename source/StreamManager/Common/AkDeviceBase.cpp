@@ -48,7 +48,10 @@ using namespace AK::StreamMgr;
 CAkDeviceBase::CAkDeviceBase( 
 	IAkLowLevelIOHook *	in_pLowLevelHook
 	)
-: m_pLowLevelHook( in_pLowLevelHook )
+: m_pIndexedTasks( NULL )
+, m_pSchedulingChanges( NULL )
+, m_uNextTaskSeq( 1 )
+, m_pLowLevelHook( in_pLowLevelHook )
 , m_uMaxCachePinnedBytes(AkUInt32(-1))
 , m_uCurrentCachePinnedData(0)
 #ifndef AK_OPTIMIZED
@@ -57,6 +60,9 @@ CAkDeviceBase::CAkDeviceBase(
 , m_uBytesThisInterval( 0 )
 , m_uNumLowLevelRequests( 0 )
 , m_uNumLowLevelRequestsCancelled( 0 )
+, m_uNumSchedulerPasses( 0 )
+, m_uNumSchedulerTasksEvaluated( 0 )
+, m_uMaxSchedulerTasksPerPass( 0 )
 , m_uBytesThisSession(0)
 , m_uCacheBytesThisSession(0)
 , m_bIsMonitoring( false )
@@ -221,7 +227,7 @@ bool CAkDeviceBase::ClearTaskList(TaskList& in_listTasks)
 			if ( pTask->CanBeDestroyed() )
 			{
 				it = in_listTasks.Erase( it );
-				pTask->InstantDestroy();
+				DestroyTask( pTask );
 			}
 			else
 			{
@@ -263,6 +269,16 @@ void CAkDeviceBase::AddTask(
     
     in_listToAddTo.AddFirst( in_pStmTask );
 
+	if ( &in_listToAddTo == &m_listTasks )
+	{
+		// Tasks are not visible to other threads before being added, so their current scheduling state
+		// can be indexed directly. Subsequent changes are notified.
+		in_pStmTask->uTaskSeq = m_uNextTaskSeq++;
+		if ( !m_uNextTaskSeq )
+			m_uNextTaskSeq = 1;	// 0 is reserved for tasks that are not in m_listTasks.
+		UpdateSchedulerIndex( in_pStmTask );
+	}
+
 #ifndef AK_OPTIMIZED
     // Compute and assign a new unique stream ID.
     in_pStmTask->SetStreamID(
@@ -305,7 +321,7 @@ CAkStmTask * CAkDeviceBase::SchedulerFindNextCachingTask()
 		{
 			CAkStmTask * pTaskToDestroy = (*it);
 			it = m_listCachingTasks.Erase( it );
-			pTaskToDestroy->InstantDestroy();
+			DestroyTask( pTaskToDestroy );
 			bStreamDestroyed = true;
 		}
 		else
@@ -383,6 +399,195 @@ CAkStmTask * CAkDeviceBase::SchedulerFindNextCachingTask()
 
 ////////////////////////////////////////
 
+// Scheduler index.
+// A scheduler pass only needs to evaluate tasks that are signaled (see note 5 in SchedulerFindNextTask()), and tasks 
+// that need to be cleaned up. Instead of walking all the tasks on each pass, these are kept in an intrusive list. 
+// Tasks notify changes to their scheduling state with a lock-free push on m_pSchedulingChanges, which the scheduler 
+// applies to the index before each pass. Unsignaled tasks are only walked when no signaled task is ready for I/O 
+// and a caching stream is about to be serviced, to compute the deadline passed to the low-level IO.
+
+// Sync: Lock-free; may be called from any thread, with the task's status locked.
+void CAkDeviceBase::NotifySchedulingChange( CAkStmTask * in_pTask )
+{
+	// Tasks that are not in m_listTasks are not indexed, and are indexed from their current state when they are added.
+	if ( !in_pTask->uTaskSeq )
+		return;
+
+	// Push only if it is not already pending: its state will be read when the change is applied.
+	if ( !AkAtomicCas32( &in_pTask->iSchedulingChangePending, 1, 0 ) )
+		return;
+
+	void * pHead;
+	do
+	{
+		pHead = AkAtomicLoadPtr( &m_pSchedulingChanges );
+		in_pTask->pNextSchedulingChange = (CAkStmTask*)pHead;
+	}
+	while ( !AkAtomicCasPtr( &m_pSchedulingChanges, in_pTask, pHead ) );
+}
+
+// Sync: task list lock.
+void CAkDeviceBase::ApplySchedulingChanges()
+{
+	CAkStmTask * pTask = (CAkStmTask*)AkAtomicExchangePtr( &m_pSchedulingChanges, NULL );
+	while ( pTask )
+	{
+		// Read sibling before clearing the pending flag: the task may be pushed again as soon as it is cleared.
+		CAkStmTask * pNext = pTask->pNextSchedulingChange;
+		AkAtomicStore32( &pTask->iSchedulingChangePending, 0 );
+		UpdateSchedulerIndex( pTask );
+		pTask = pNext;
+	}
+}
+
+// Sync: task list lock.
+void CAkDeviceBase::UpdateSchedulerIndex( CAkStmTask * in_pTask )
+{
+	if ( in_pTask->NeedsScheduling() )
+	{
+		if ( !in_pTask->bIsIndexed )
+		{
+			in_pTask->pPrevIndexed = NULL;
+			in_pTask->pNextIndexed = m_pIndexedTasks;
+			if ( m_pIndexedTasks )
+				m_pIndexedTasks->pPrevIndexed = in_pTask;
+			m_pIndexedTasks = in_pTask;
+			in_pTask->bIsIndexed = true;
+		}
+	}
+	else if ( in_pTask->bIsIndexed )
+	{
+		RemoveFromSchedulerIndex( in_pTask );
+	}
+}
+
+// Sync: task list lock.
+void CAkDeviceBase::RemoveFromSchedulerIndex( CAkStmTask * in_pTask )
+{
+	AKASSERT( in_pTask->bIsIndexed );
+	if ( in_pTask->pPrevIndexed )
+		in_pTask->pPrevIndexed->pNextIndexed = in_pTask->pNextIndexed;
+	else
+		m_pIndexedTasks = in_pTask->pNextIndexed;
+	if ( in_pTask->pNextIndexed )
+		in_pTask->pNextIndexed->pPrevIndexed = in_pTask->pPrevIndexed;
+	in_pTask->pNextIndexed = NULL;
+	in_pTask->pPrevIndexed = NULL;
+	in_pTask->bIsIndexed = false;
+}
+
+// Sync: task list lock.
+void CAkDeviceBase::DestroyTask( CAkStmTask * in_pTask )
+{
+	// Flush pending changes so that the task is not referenced by the stack of scheduling changes anymore.
+	ApplySchedulingChanges();
+	if ( in_pTask->bIsIndexed )
+		RemoveFromSchedulerIndex( in_pTask );
+	in_pTask->InstantDestroy();
+}
+
+// Find task with smallest effective deadline.
+// If a task has a deadline equal to 0, this means we are starving; user throughtput is greater than
+// low-level bandwidth. In that situation, starving streams are chosen according to their priority.
+// If more than one starving stream has the same priority, the scheduler chooses the one that has been 
+// waiting for I/O for the longest time.
+// Remaining ties are resolved in favor of the most recently added task.
+// Note 1: This scheduler does not have any idea of the actual low-level throughput, nor does it try to
+// know it. It just reacts to the status of its streams at a given moment.
+// Note 2: By choosing the highest priority stream only when we encounter starvation, we take the bet
+// that the transfer will complete before the user has time consuming its data. Therefore it remains 
+// possible that high priority streams starve.
+// Note 3: Automatic streams that just started are considered starving. They are chosen according to
+// their priority first, in a round robin fashion (starving mechanism).
+// Note 4: If starving mode lasts for a long time, low-priority streams will stop being chosen for I/O.
+bool CAkDeviceBase::IsBetterCandidate(
+	CAkStmTask *	in_pTask,
+	AkReal32		in_fDeadline,
+	CAkStmTask *	in_pBest,
+	AkReal32		in_fBestDeadline
+	)
+{
+	if ( in_fDeadline == 0 )
+	{
+		// Deadline is zero: starvation mode.
+		// Choose task with highest priority among those that are starving.
+		if ( in_fBestDeadline > 0 || in_pTask->Priority() > in_pBest->Priority() )
+			return true;
+		if ( in_pTask->Priority() < in_pBest->Priority() )
+			return false;
+
+		// Same priority: choose the one that has waited the most.
+		AkReal32 fWait = in_pTask->TimeSinceLastTransfer( GetTime() );
+		AkReal32 fBestWait = in_pBest->TimeSinceLastTransfer( GetTime() );
+		if ( fWait != fBestWait )
+			return fWait > fBestWait;
+	}
+	else if ( in_fDeadline != in_fBestDeadline )
+	{
+		// Deadline is not zero: low-level has enough bandwidth. Just take the task with smallest deadline.
+		// We take the bet that this transfer will have time to occur fast enough to properly service
+		// the others on next pass.
+		return in_fDeadline < in_fBestDeadline;
+	}
+
+	return (AkInt32)( in_pTask->uTaskSeq - in_pBest->uTaskSeq ) > 0;
+}
+
+// Sync: task list lock.
+CAkStmTask * CAkDeviceBase::SchedulerFindIndexedTask(
+	bool		in_bStdStmOnly,		// Consider only standard streams.
+	AkReal32 &	out_fOpDeadline		// Returned deadline of the task chosen. Untouched if none.
+	)
+{
+	CAkStmTask * pTask = NULL;
+	AkReal32 fSmallestDeadline = 0;
+#ifndef AK_OPTIMIZED
+	AkUInt32 uNumEvaluated = 0;
+#endif
+
+	CAkStmTask * pCandidate = m_pIndexedTasks;
+	while ( pCandidate )
+	{
+		CAkStmTask * pNext = pCandidate->pNextIndexed;
+#ifndef AK_OPTIMIZED
+		++uNumEvaluated;
+#endif
+		// Verify that we can perform I/O on this one.
+		if ( pCandidate->IsToBeDestroyed() )
+		{
+			if ( pCandidate->CanBeDestroyed() )
+			{
+				// Clean up.
+				m_listTasks.Remove( pCandidate );
+				DestroyTask( pCandidate );
+			}
+			// Otherwise, not ready to be destroyed: wait until next turn.
+		}
+		else if ( ( in_bStdStmOnly ? ( pCandidate->StmType() == AK_StmTypeStandard ) : pCandidate->RequiresScheduling() )
+				&& pCandidate->ReadyForIO() )
+		{
+			AkReal32 fDeadline = pCandidate->EffectiveDeadline();
+			if ( !pTask || IsBetterCandidate( pCandidate, fDeadline, pTask, fSmallestDeadline ) )
+			{
+				pTask = pCandidate;
+				fSmallestDeadline = fDeadline;
+			}
+		}
+		pCandidate = pNext;
+	}
+
+#ifndef AK_OPTIMIZED
+	++m_uNumSchedulerPasses;
+	m_uNumSchedulerTasksEvaluated += uNumEvaluated;
+	if ( uNumEvaluated > m_uMaxSchedulerTasksPerPass )
+		m_uMaxSchedulerTasksPerPass = uNumEvaluated;
+#endif
+
+	if ( pTask )
+		out_fOpDeadline = fSmallestDeadline;
+	return pTask;
+}
+
 // Scheduler algorithm.
 // Finds the next task for which an I/O request should be issued.
 // Return: If a task is found, a valid pointer to a task is returned, as well
@@ -404,271 +609,65 @@ CAkStmTask * CAkDeviceBase::SchedulerFindNextTask(
     // Stamp time.
     AKPLATFORM::PerformanceCounter( &m_time );
 
+    ApplySchedulingChanges();
+
     // If m_bDoWaitMemoryChange, no automatic stream operation can be scheduled because memory is full
     // and will not be reassigned until someone calls NotifyMemChange().
     // Therefore, we only look for a pending standard stream (too bad if memory is freed in the meantime).
     if ( CannotScheduleAutoStreams() )
         return ScheduleStdStmOnly( out_fOpDeadline );
 
-    TaskList::IteratorEx it = m_listTasks.BeginEx();
-    CAkStmTask * pTask = NULL;
-	AkReal32 fSmallestDeadline;
-	bool bLeastBufferedTaskRequiresScheduling = false;
-    
-    // Get first valid task's values for comparison.
-    while ( it != m_listTasks.End() )
+    // Note 5: Tasks that are actually signaled (RequireScheduling) have priority over other tasks. A task 
+    // that is unsignaled may still have a smaller deadline than other tasks (because tasks must be double-
+    // buffered at least). However, an unsignaled task will only be chosen if there are no signaled task.
+    // Since unsignaled tasks are never chosen here, only the scheduler index needs to be evaluated.
+    CAkStmTask * pTask = SchedulerFindIndexedTask( false, out_fOpDeadline );
+    if ( pTask )
+        return pTask;
+
+    // No signaled task: caching streams may be serviced.
+    pTask = SchedulerFindNextCachingTask();
+    if ( pTask )
     {
-		// Verify that we can perform I/O on this one.
-        if ( (*it)->IsToBeDestroyed() )
-        {
-			if ( (*it)->CanBeDestroyed() )
-			{
-				// Clean up.
-				CAkStmTask * pTaskToDestroy = (*it);
-	            it = m_listTasks.Erase( it );
-				pTaskToDestroy->InstantDestroy();
-	        }
-			else 
-			{
-				// Not ready to be destroyed: wait until next turn.
-				++it;
-			}
-        }
-        else if ( !(*it)->ReadyForIO() )
-            ++it;   // Skip this one.
-        else
+        // Pass the deadline of the most urgent task that is ready for I/O, if any, along with the caching transfer.
+        CAkStmTask * pLeastBuffered = NULL;
+        AkReal32 fSmallestDeadline = 0;
+#ifndef AK_OPTIMIZED
+        AkUInt32 uNumEvaluated = 0;
+#endif
+        for ( TaskList::Iterator it = m_listTasks.Begin(); it != m_listTasks.End(); ++it )
         {
-            // Current iterator refers to a task that is not scheduled to be destroyed, and is ready for I/O. Proceed.
-			// pTask and fSmallestDeadline are the current task and associated effective deadline chosen for I/O.
-            pTask = (*it);
-			fSmallestDeadline = pTask->EffectiveDeadline();
-			bLeastBufferedTaskRequiresScheduling = pTask->RequiresScheduling();
-			break;  
+#ifndef AK_OPTIMIZED
+            ++uNumEvaluated;
+#endif
+            if ( !(*it)->IsToBeDestroyed() && (*it)->ReadyForIO() )
+            {
+                AkReal32 fDeadline = (*it)->EffectiveDeadline();
+                if ( !pLeastBuffered || IsBetterCandidate( (*it), fDeadline, pLeastBuffered, fSmallestDeadline ) )
+                {
+                    pLeastBuffered = (*it);
+                    fSmallestDeadline = fDeadline;
+                }
+            }
         }
-    }    
-
-    if ( !pTask )
-    {
-        // No task was ready for I/O. Leave.
-        return SchedulerFindNextCachingTask();
+#ifndef AK_OPTIMIZED
+        m_uNumSchedulerTasksEvaluated += uNumEvaluated;
+#endif
+        if ( pLeastBuffered )
+            out_fOpDeadline = fSmallestDeadline;
     }
-
-    // Find task with smallest effective deadline.
-    // If a task has a deadline equal to 0, this means we are starving; user throughtput is greater than
-    // low-level bandwidth. In that situation, starving streams are chosen according to their priority.
-    // If more than one starving stream has the same priority, the scheduler chooses the one that has been 
-    // waiting for I/O for the longest time.
-    // Note 1: This scheduler does not have any idea of the actual low-level throughput, nor does it try to
-    // know it. It just reacts to the status of its streams at a given moment.
-    // Note 2: By choosing the highest priority stream only when we encounter starvation, we take the bet
-    // that the transfer will complete before the user has time consuming its data. Therefore it remains 
-    // possible that high priority streams starve.
-    // Note 3: Automatic streams that just started are considered starving. They are chosen according to
-    // their priority first, in a round robin fashion (starving mechanism).
-    // Note 4: If starving mode lasts for a long time, low-priority streams will stop being chosen for I/O.
-	// Note 5: Tasks that are actually signaled (RequireScheduling) have priority over other tasks. A task 
-	// that is unsignaled may still have a smaller deadline than other tasks (because tasks must be double-
-	// buffered at least). However, an unsignaled task will only be chosen if there are no signaled task.
-
-    // Start with the following task.
-    AKASSERT( pTask );
-    ++it;
-
-    while ( it != m_listTasks.End() )
-    {
-        // Verify that we can perform I/O on this one.
-        if ( (*it)->IsToBeDestroyed() )
-        {
-			if ( (*it)->CanBeDestroyed() )
-			{
-				// Clean up.
-				CAkStmTask * pTaskToDestroy = (*it);
-	            it = m_listTasks.Erase( it );
-				pTaskToDestroy->InstantDestroy();
-	        }
-			else 
-			{
-				// Not ready to be destroyed: wait until next turn.
-				++it;
-			}
-        }
-        else if ( (*it)->ReadyForIO() )
-        {
-			AkReal32 fDeadline = (*it)->EffectiveDeadline();
-
-			if ( !bLeastBufferedTaskRequiresScheduling && (*it)->RequiresScheduling() )
-			{
-				// This is the first task that we run into which actually requires action from 
-				// scheduler: pick it. 
-				pTask = (*it);
-				fSmallestDeadline = fDeadline;
-				bLeastBufferedTaskRequiresScheduling = true;
-			}
-			else if ( !bLeastBufferedTaskRequiresScheduling || (*it)->RequiresScheduling() )
-			{
-				if ( fDeadline == 0 )
-				{
-					// Deadline is zero: starvation mode.
-					// Choose task with highest priority among those that are starving.
-					if ( (*it)->Priority() > pTask->Priority() || fSmallestDeadline > 0 )
-					{
-						pTask = (*it);
-						fSmallestDeadline = fDeadline;
-						bLeastBufferedTaskRequiresScheduling = pTask->RequiresScheduling();
-					}
-					else if ( (*it)->Priority() == pTask->Priority() )
-					{
-						// Same priority: choose the one that has waited the most.
-						if ( (*it)->TimeSinceLastTransfer( GetTime() ) > pTask->TimeSinceLastTransfer( GetTime() ) )
-						{
-							pTask = (*it);
-							fSmallestDeadline = fDeadline;
-							bLeastBufferedTaskRequiresScheduling = pTask->RequiresScheduling();
-						}
-					}
-				}
-				else if ( fDeadline < fSmallestDeadline )
-				{
-					// Deadline is not zero: low-level has enough bandwidth. Just take the task with smallest deadline.
-					// We take the bet that this transfer will have time to occur fast enough to properly service
-					// the others on next pass.
-					pTask = (*it);
-					fSmallestDeadline = fDeadline;
-					bLeastBufferedTaskRequiresScheduling = pTask->RequiresScheduling();
-				}
-			}
-            ++it;
-        }
-        else
-            ++it;   // Skip this task: it is not waiting for I/O.
-	}
-
-	out_fOpDeadline = fSmallestDeadline;
-
-	if ( bLeastBufferedTaskRequiresScheduling )
-	    return pTask;
-	return SchedulerFindNextCachingTask();
+    return pTask;
 }
 
 // Scheduler algorithm: standard stream-only version.
 // Finds next task among standard streams only (typically when there is no more memory).
-// Note: standard streams that are ready for IO are always signaled.
+// Note: standard streams that are ready for IO are always signaled, and are therefore all in the scheduler index.
+// Sync: task list lock.
 CAkStmTask * CAkDeviceBase::ScheduleStdStmOnly(
 	AkReal32 &	out_fOpDeadline	// Returned deadline for this transfer.
     )
 {
-    TaskList::IteratorEx it = m_listTasks.BeginEx();
-    CAkStmTask * pTask = NULL;
-    
-    // Get first valid task's values for comparison.
-    while ( it != m_listTasks.End() )
-    {
-        // Verify that we can perform I/O on this one.
-        if ( (*it)->IsToBeDestroyed() )
-        {
-            if ( (*it)->CanBeDestroyed() )
-			{
-				// Clean up.
-				CAkStmTask * pTaskToDestroy = (*it);
-	            it = m_listTasks.Erase( it );
-				pTaskToDestroy->InstantDestroy();
-	        }
-			else 
-			{
-				// Not ready to be destroyed: wait until next turn.
-				++it;
-			}
-        }
-        else if ( (*it)->StmType() == AK_StmTypeStandard &&
-                    (*it)->ReadyForIO() )
-        {
-            // Current iterator refers to a standard stream task that is not scheduled to be destroyed, 
-            // and that is pending. Proceed.
-            pTask = (*it);
-            break;
-        }
-        else
-            ++it;
-    }    
-
-    if ( !pTask )
-    {
-        // No task was ready for I/O. Leave.
-        return NULL;
-    }
-
-    // fSmallestDeadline is the smallest effective deadline found to date. Used to find the next task for I/O.
-    AkReal32 fSmallestDeadline = pTask->EffectiveDeadline();
-    
-    // Find task with smallest effective deadline.
-    // See note in SchedulerFindNextTask(). It is the same algorithm, except that automatic streams are excluded.
-    
-    // Start with the following task.
-    AKASSERT( pTask );
-    ++it;
-
-    while ( it != m_listTasks.End() )
-    {
-        // Verify that we can perform I/O on this one.
-        if ( (*it)->IsToBeDestroyed() )
-        {
-            if ( (*it)->CanBeDestroyed() )
-			{
-				// Clean up.
-				CAkStmTask * pTaskToDestroy = (*it);
-	            it = m_listTasks.Erase( it );
-				pTaskToDestroy->InstantDestroy();
-	        }
-			else 
-			{
-				// Not ready to be destroyed: wait until next turn.
-				++it;
-			}
-        }
-        else if ( (*it)->StmType() == AK_StmTypeStandard &&
-                    (*it)->ReadyForIO() )
-        {
-            AkReal32 fDeadline = (*it)->EffectiveDeadline(); 
-
-            if ( fDeadline == 0 )
-            {
-                // Deadline is zero. Starvation mode: user throughput is greater than low-level bandwidth.
-                // Choose task with highest priority among those that are starving.
-                if ( (*it)->Priority() > pTask->Priority() || fSmallestDeadline > 0 )
-                {
-                    pTask = (*it);
-                    fSmallestDeadline = fDeadline;
-                }
-                else if ( (*it)->Priority() == pTask->Priority() )
-                {
-                    // Same priority: choose the one that has waited the most.
-                    if ( (*it)->TimeSinceLastTransfer( GetTime() ) > pTask->TimeSinceLastTransfer( GetTime() ) )
-                    {
-                        pTask = (*it);
-                        fSmallestDeadline = fDeadline;
-                    }
-                }
-            }
-            else if ( fDeadline < fSmallestDeadline )
-            {
-                // Deadline is not zero: low-level has enough bandwidth. Just take the task with smallest deadline.
-                // We take the bet that this transfer will have time to occur fast enough to properly service
-                // the others.
-                pTask = (*it);
-                fSmallestDeadline = fDeadline;
-            }
-            ++it;
-        }
-        else
-            ++it;   // Skip this task; not waiting for I/O.
-    }
-
-    AKASSERT( pTask );
-
-	out_fOpDeadline = fSmallestDeadline;
-
-    return pTask;
-
+	return SchedulerFindIndexedTask( true, out_fOpDeadline );
 }
 
 void CAkDeviceBase::ForceCleanup(
@@ -701,7 +700,7 @@ bool CAkDeviceBase::ForceTaskListCleanup(
 				// Clean up.
 				CAkStmTask * pTaskToDestroy = (*it);
 	            it = in_listTasks.Erase( it );
-				pTaskToDestroy->InstantDestroy();
+				DestroyTask( pTaskToDestroy );
 	        }
 			else
 			{
@@ -821,11 +820,17 @@ void CAkDeviceBase::GetData(
 	out_deviceData.uNumLowLevelRequestsPending = AkMin(m_uMaxConcurrentIO,GetNumConcurrentIO());
 	out_deviceData.uCustomParam = m_pLowLevelHook->GetDeviceData();
 	out_deviceData.uCachePinnedBytes = m_uCurrentCachePinnedData;
+	out_deviceData.uNumSchedulerPasses = m_uNumSchedulerPasses;
+	out_deviceData.uNumSchedulerTasksEvaluated = m_uNumSchedulerTasksEvaluated;
+	out_deviceData.uMaxSchedulerTasksPerPass = m_uMaxSchedulerTasksPerPass;
 	
 	m_uBytesLowLevelThisInterval = 0;
 	m_uBytesThisInterval = 0;
 	m_uNumLowLevelRequests = 0;
 	m_uNumLowLevelRequestsCancelled = 0;
+	m_uNumSchedulerPasses = 0;
+	m_uNumSchedulerTasksEvaluated = 0;
+	m_uMaxSchedulerTasksPerPass = 0;
 }
 
 bool CAkDeviceBase::IsNew( )
@@ -929,7 +934,13 @@ AK::IAkStreamProfile * CAkDeviceBase::GetStreamProfile(
 //       the device scheduler.
 //-----------------------------------------------------------------------------
 CAkStmTask::CAkStmTask()
-: m_pDeferredOpenData( NULL )
+: pNextIndexed( NULL )
+, pPrevIndexed( NULL )
+, pNextSchedulingChange( NULL )
+, iSchedulingChangePending( 0 )
+, uTaskSeq( 0 )
+, bIsIndexed( false )
+, m_pDeferredOpenData( NULL )
 , m_pFileDesc( NULL )
 , m_pszStreamName( NULL )
 #ifndef AK_OPTIMIZED
@@ -1671,7 +1682,7 @@ void CAkStdStmBase::SetStatus(
 		if ( !m_bRequiresScheduling )
         {
             // Signal IO thread for clean up.
-			m_bRequiresScheduling = true;
+			SetRequiresScheduling( true );
 #ifndef AK_OPTIMIZED
 			m_bWasActive = true;
 			m_bCanClearActiveProfile = false;
@@ -1688,7 +1699,7 @@ void CAkStdStmBase::SetStatus(
 			SetReadyForIO( true );
 			if ( !m_bRequiresScheduling )
 			{
-				m_bRequiresScheduling = true;
+				SetRequiresScheduling( true );
 #ifndef AK_OPTIMIZED
 				m_bWasActive = true;
 				m_bCanClearActiveProfile = false;
@@ -1702,7 +1713,7 @@ void CAkStdStmBase::SetStatus(
 			SetReadyForIO( false );
 			if ( m_bRequiresScheduling )
 			{
-				m_bRequiresScheduling = false;
+				SetRequiresScheduling( false );
 				m_pDevice->StdSemDecr();
 			}
 		}
@@ -2866,7 +2877,7 @@ void CAkAutoStmBase::UpdateSchedulingStatus()
     {
         if ( !m_bRequiresScheduling )
         {
-			m_bRequiresScheduling = true;
+			SetRequiresScheduling( true );
 #ifndef AK_OPTIMIZED
 			m_bWasActive = true;
 			m_bCanClearActiveProfile = false;
@@ -2878,7 +2889,7 @@ void CAkAutoStmBase::UpdateSchedulingStatus()
     {
         if ( m_bRequiresScheduling )
         {
-			m_bRequiresScheduling = false;
+			SetRequiresScheduling( false );
             m_pDevice->AutoSemDecr();
         }
     }
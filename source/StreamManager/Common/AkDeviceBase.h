@@ -226,6 +226,11 @@ namespace StreamMgr
 			return m_uMaxCachePinnedBytes - m_uCurrentCachePinnedData;	
 		}
 
+		// Notifies the scheduler that the scheduling state of a task (RequiresScheduling(), or destruction) has changed.
+		// The change is applied to the scheduler index at the beginning of the next scheduler pass.
+		// Sync: Lock-free; may be called from any thread, with the task's status locked.
+		void NotifySchedulingChange( CAkStmTask * in_pTask );
+
         // Device Profile Ex interface.
         // --------------------------------------------------------
 #ifndef AK_OPTIMIZED
@@ -316,9 +321,33 @@ namespace StreamMgr
 			AkReal32 &	out_fOpDeadline		// Returned deadline for this transfer.
             );
 
+		// Scheduler index helpers.
+		// Sync: task list lock.
+		void ApplySchedulingChanges();
+		void UpdateSchedulerIndex( CAkStmTask * in_pTask );
+		void RemoveFromSchedulerIndex( CAkStmTask * in_pTask );
+		
+		// Walks the scheduler index, cleaning up tasks that can be destroyed, and returns the best task that 
+		// is ready for I/O. Only signaled tasks are considered, unless in_bStdStmOnly is set, in which case only 
+		// standard streams are considered. Returns NULL if there is none.
+		CAkStmTask *	SchedulerFindIndexedTask(
+			bool		in_bStdStmOnly,		// Consider only standard streams.
+			AkReal32 &	out_fOpDeadline		// Returned deadline of the task chosen. Untouched if none.
+			);
+
+		// Returns true if in_pTask (with deadline in_fDeadline) should be serviced before in_pBest.
+		bool IsBetterCandidate(
+			CAkStmTask *	in_pTask,
+			AkReal32		in_fDeadline,
+			CAkStmTask *	in_pBest,
+			AkReal32		in_fBestDeadline
+			);
+
+		// Removes a task from the scheduler index and destroys it. It must have been removed from its task list.
+		void DestroyTask( CAkStmTask * in_pTask );
+
 	protected:
 		typedef AkArrayAllocatorNoAlign<AkMemID_Streaming> ArrayPoolLocal;
-		CAkStmTask * SchedulerFindLowestPriorityCachingTask(AkPriority in_uMaxPriority);
 
 		// Time in milliseconds. Stamped at every scheduler pass.
         AkInt64         m_time;
@@ -332,6 +361,14 @@ namespace StreamMgr
 		TaskList		m_listCachingTasks;    // List of caching tasks.
         CAkLock         m_lockTasksList;        // Protects tasks array.
 
+		// Scheduler index.
+		// Tasks of m_listTasks that are signaled (RequiresScheduling()) or scheduled for destruction are also linked 
+		// in this intrusive list, so that scheduler passes only evaluate them instead of walking all tasks. 
+		// Membership is updated from the notifications pushed on m_pSchedulingChanges by NotifySchedulingChange().
+		CAkStmTask *	m_pIndexedTasks;		// First task of the scheduler index.
+		AkAtomicPtr		m_pSchedulingChanges;	// Lock-free stack of tasks whose scheduling state changed.
+		AkUInt32		m_uNextTaskSeq;			// Sequence number given to the next task added to m_listTasks.
+
 		// Stream IO memory.
 		CAkIOMemMgr			m_mgrMemIO;
 
@@ -359,6 +396,9 @@ namespace StreamMgr
 		AkUInt32		m_uBytesThisInterval;	// Bandwidth, including the amount of data newly referenced from cache.
 		AkUInt32		m_uNumLowLevelRequests;	// Number of requests to the low-level IO since lass profiling pass.
 		AkUInt32		m_uNumLowLevelRequestsCancelled;	// Number of requests to the low-level IO that were cancelled since lass profiling pass.
+		AkUInt32		m_uNumSchedulerPasses;		// Number of scheduler passes since last profiling pass.
+		AkUInt32		m_uNumSchedulerTasksEvaluated;	// Number of tasks evaluated by the scheduler since last profiling pass.
+		AkUInt32		m_uMaxSchedulerTasksPerPass;	// Largest number of tasks evaluated in one scheduler pass since last profiling pass.
         
 		//Per profiling session data:
 		AkUInt64		m_uBytesThisSession;	// Data, including the data grabbed from cache, over the life of the profiling session.
@@ -601,10 +641,25 @@ namespace StreamMgr
 		// List bare light sibling: device's TaskList.
 		CAkStmTask * pNextLightItem;
 
+		// Device's scheduler index (see CAkDeviceBase::m_pIndexedTasks). Owned by the device.
+		CAkStmTask *	pNextIndexed;			// Siblings in the scheduler index.
+		CAkStmTask *	pPrevIndexed;
+		CAkStmTask *	pNextSchedulingChange;	// Sibling in the device's stack of scheduling changes.
+		AkAtomic32		iSchedulingChangePending;	// 1 while the task is in the stack of scheduling changes.
+		AkUInt32		uTaskSeq;				// Order of addition to the device's task list (0 if not in it). Breaks scheduling ties.
+		bool			bIsIndexed;				// True when the task is in the scheduler index.
+
+		// True when the task must be looked at by the scheduler: it is signaled, or it needs to be cleaned up eventually.
+		inline bool NeedsScheduling()
+		{
+			return m_bRequiresScheduling || m_bIsToBeDestroyed;
+		}
+
 		inline void SetToBeDestroyed()
 		{
 			m_bIsToBeDestroyed = true;
 			SetReadyForIO( false );
+			m_pDevice->NotifySchedulingChange( this );
 		}
 
 		//
@@ -631,6 +686,14 @@ namespace StreamMgr
 			m_bIsReadyForIO = in_bReadyForIO;
 		}
 
+		// Set "Requires scheduling" status. Keeps the device's scheduler index up-to-date.
+		// Note: Callers must also update the device's scheduler semaphore.
+		inline void SetRequiresScheduling( bool in_bRequiresScheduling )
+		{
+			m_bRequiresScheduling = in_bRequiresScheduling;
+			m_pDevice->NotifySchedulingChange( this );
+		}
+
 		// Returns size clamped to end of file.
 		inline AkUInt32 ClampRequestSizeToEof( AkUInt64 in_uPosition, AkUInt32 in_uDesiredSize, bool & out_bEof )
 		{